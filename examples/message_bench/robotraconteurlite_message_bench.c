@@ -0,0 +1,552 @@
+/* Copyright 2011-2024 Wason Technology, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Measures Message 4 element header decoding. The same message is parsed by the library from a single contiguous
+   buffer, where headers are decoded from one span, and from a buffer split into small segments, where headers fall
+   back to the cursor. The per-byte run decodes the contiguous buffer in the bench with one bounds-checked
+   robotraconteurlite_buffer_vec_copy_to_<type>() call per field, like the reader before the fast path. It skips the
+   name strings instead of resolving them, so it is a lower bound for the old decoder and not a before/after
+   comparison. For that, build this example against the library before and after a change. Also prints the wire size
+   of a robot state message with padded and with compact uint_x sizes and counts. */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include <robotraconteurlite/robotraconteurlite.h>
+
+#define FAILED ROBOTRACONTEURLITE_FAILED
+#define NO_MORE ROBOTRACONTEURLITE_NO_MORE
+
+#define BENCH_ELEMENT_COUNT 64U
+#define BENCH_ITERATIONS 20000U
+#define BENCH_SEGMENT_SIZE 7U
+#define BENCH_BUFFER_SIZE 8192U
+#define BENCH_MAX_SEGMENTS ((BENCH_BUFFER_SIZE / BENCH_SEGMENT_SIZE) + 1U)
+
+static uint8_t bench_buffer_bytes[BENCH_BUFFER_SIZE];
+static struct robotraconteurlite_buffer bench_segments[BENCH_MAX_SEGMENTS];
+
+static robotraconteurlite_status bench_write_message(struct robotraconteurlite_buffer_vec* buffer, size_t* message_len)
+{
+    struct robotraconteurlite_message_writer writer;
+    struct robotraconteurlite_messageentry_writer entry_writer;
+    struct robotraconteurlite_messageelement_writer element_writer;
+    struct robotraconteurlite_message_header header;
+    struct robotraconteurlite_messageentry_header entry_header;
+    struct robotraconteurlite_string element_name;
+    char element_name_data[16];
+    robotraconteurlite_status rv = -1;
+    uint32_t i = 0;
+
+    rv = robotraconteurlite_message_writer_init(&writer, buffer, 0, BENCH_BUFFER_SIZE, 4);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+    rv = robotraconteurlite_message_writer_enable_compact_uint_x(&writer);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    (void)memset(&header, 0, sizeof(header));
+    header.entry_count = 1;
+    robotraconteurlite_string_from_c_str("bench_sender", &header.sender_nodename);
+    rv = robotraconteurlite_message_writer_begin_message(&writer, &header, &entry_writer);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    (void)memset(&entry_header, 0, sizeof(entry_header));
+    entry_header.entry_type = ROBOTRACONTEURLITE_MESSAGEENTRYTYPE_FUNCTIONCALLREQ;
+    robotraconteurlite_string_from_c_str("bench_service.obj", &entry_header.service_path);
+    robotraconteurlite_string_from_c_str("bench_function", &entry_header.member_name);
+    rv = robotraconteurlite_messageentry_writer_begin_entry(&entry_writer, &entry_header, &element_writer);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    for (i = 0; i < BENCH_ELEMENT_COUNT; i++)
+    {
+        (void)sprintf(element_name_data, "param%u", (unsigned int)i);
+        robotraconteurlite_string_from_c_str(element_name_data, &element_name);
+        rv = robotraconteurlite_messageelement_writer_write_uint32(&element_writer, &element_name, i);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+    }
+
+    rv = robotraconteurlite_messageentry_writer_end_entry(&entry_writer, &entry_header, &element_writer);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+    rv = robotraconteurlite_message_writer_end_message(&writer, &header, &entry_writer);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    *message_len = header.message_size;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+static robotraconteurlite_status bench_write_double_array(struct robotraconteurlite_messageelement_writer* writer,
+                                                          const char* name, double* data, size_t len)
+{
+    struct robotraconteurlite_string element_name;
+    struct robotraconteurlite_array_double value;
+
+    robotraconteurlite_string_from_c_str(name, &element_name);
+    value.data = data;
+    value.len = len;
+    return robotraconteurlite_messageelement_writer_write_double_array(writer, &element_name, &value);
+}
+
+/* Robot state property response: a structure with joint arrays, a nested pose structure and a status string */
+static robotraconteurlite_status bench_write_state_message(struct robotraconteurlite_buffer_vec* buffer, int compact,
+                                                           size_t* message_len)
+{
+    struct robotraconteurlite_message_writer writer;
+    struct robotraconteurlite_messageentry_writer entry_writer;
+    struct robotraconteurlite_messageelement_writer element_writer;
+    struct robotraconteurlite_messageelement_writer state_writer;
+    struct robotraconteurlite_messageelement_writer pose_writer;
+    struct robotraconteurlite_message_header header;
+    struct robotraconteurlite_messageentry_header entry_header;
+    struct robotraconteurlite_messageelement_header state_header;
+    struct robotraconteurlite_messageelement_header pose_header;
+    struct robotraconteurlite_string element_name;
+    double joint_position[7] = {0.1, -0.2, 0.3, -1.4, 0.5, 1.6, -0.7};
+    double joint_velocity[7] = {0.0, 0.01, -0.02, 0.03, 0.0, -0.01, 0.02};
+    double position[3] = {0.45, -0.1, 0.62};
+    double orientation[4] = {1.0, 0.0, 0.0, 0.0};
+    robotraconteurlite_status rv = -1;
+
+    rv = robotraconteurlite_message_writer_init(&writer, buffer, 0, BENCH_BUFFER_SIZE, 4);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+    if (compact != 0)
+    {
+        rv = robotraconteurlite_message_writer_enable_compact_uint_x(&writer);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+    }
+
+    (void)memset(&header, 0, sizeof(header));
+    header.entry_count = 1;
+    robotraconteurlite_string_from_c_str("bench_sender", &header.sender_nodename);
+    rv = robotraconteurlite_message_writer_begin_message(&writer, &header, &entry_writer);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    (void)memset(&entry_header, 0, sizeof(entry_header));
+    entry_header.entry_type = ROBOTRACONTEURLITE_MESSAGEENTRYTYPE_PROPERTYGETRES;
+    robotraconteurlite_string_from_c_str("bench_service.robot", &entry_header.service_path);
+    robotraconteurlite_string_from_c_str("robot_state", &entry_header.member_name);
+    rv = robotraconteurlite_messageentry_writer_begin_entry(&entry_writer, &entry_header, &element_writer);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    (void)memset(&state_header, 0, sizeof(state_header));
+    state_header.element_type = ROBOTRACONTEURLITE_DATATYPE_STRUCTURE;
+    robotraconteurlite_string_from_c_str("value", &state_header.element_name);
+    robotraconteurlite_string_from_c_str("bench.RobotState", &state_header.element_type_name);
+    rv = robotraconteurlite_messageelement_writer_begin_nested_element(&element_writer, &state_header, &state_writer);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    robotraconteurlite_string_from_c_str("seqno", &element_name);
+    rv = robotraconteurlite_messageelement_writer_write_uint64(&state_writer, &element_name, 1234567U);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+    robotraconteurlite_string_from_c_str("command_mode", &element_name);
+    rv = robotraconteurlite_messageelement_writer_write_int32(&state_writer, &element_name, 2);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+    rv = bench_write_double_array(&state_writer, "joint_position", joint_position, 7U);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+    rv = bench_write_double_array(&state_writer, "joint_velocity", joint_velocity, 7U);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    (void)memset(&pose_header, 0, sizeof(pose_header));
+    pose_header.element_type = ROBOTRACONTEURLITE_DATATYPE_STRUCTURE;
+    robotraconteurlite_string_from_c_str("tool_pose", &pose_header.element_name);
+    robotraconteurlite_string_from_c_str("bench.Pose", &pose_header.element_type_name);
+    rv = robotraconteurlite_messageelement_writer_begin_nested_element(&state_writer, &pose_header, &pose_writer);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+    rv = bench_write_double_array(&pose_writer, "position", position, 3U);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+    rv = bench_write_double_array(&pose_writer, "orientation", orientation, 4U);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+    rv = robotraconteurlite_messageelement_writer_end_nested_element(&state_writer, &pose_header, &pose_writer);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    rv = robotraconteurlite_messageelement_writer_write_data_string_c_str(&state_writer, "status", "ready");
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+    rv = robotraconteurlite_messageelement_writer_end_nested_element(&element_writer, &state_header, &state_writer);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    rv = robotraconteurlite_messageentry_writer_end_entry(&entry_writer, &entry_header, &element_writer);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+    rv = robotraconteurlite_message_writer_end_message(&writer, &header, &entry_writer);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    *message_len = header.message_size;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+/* Wire size of the state message with padded uint_x sizes and counts, and with the minimal widths written when
+   ROBOTRACONTEURLITE_CONFIG_FLAGS_ENABLE_COMPACT_UINT_X4 is set on a connection */
+static int bench_wire_size(struct robotraconteurlite_buffer_vec* buffer)
+{
+    size_t padded_len = 0;
+    size_t compact_len = 0;
+
+    if (FAILED(bench_write_state_message(buffer, 0, &padded_len)) ||
+        FAILED(bench_write_state_message(buffer, 1, &compact_len)))
+    {
+        (void)fprintf(stderr, "state message write failed\n");
+        return 1;
+    }
+
+    (void)printf("state message wire size: padded %lu bytes, compact uint_x %lu bytes (%lu saved)\n",
+                 (unsigned long)padded_len, (unsigned long)compact_len, (unsigned long)(padded_len - compact_len));
+    return 0;
+}
+
+/* Element header decoding as done before the span fast path: every field is read with a bounds-checked
+   robotraconteurlite_buffer_vec_copy_to_<type>() call, one byte at a time for uint_x codes. Kept in the bench as a
+   reference for the library decoder. */
+static robotraconteurlite_status bench_copy_read_uint_x(const struct robotraconteurlite_buffer_vec* buffer, size_t* o,
+                                                        uint32_t* val)
+{
+    robotraconteurlite_status rv = -1;
+    uint8_t b = 0;
+    uint16_t val16 = 0;
+
+    rv = robotraconteurlite_buffer_vec_copy_to_uint8(buffer, *o, &b);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+    *o += 1U;
+
+    if (b <= 252U)
+    {
+        *val = b;
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    }
+    if (b == 253U)
+    {
+        rv = robotraconteurlite_buffer_vec_copy_to_uint16(buffer, *o, &val16);
+        *val = val16;
+        *o += 2U;
+        return rv;
+    }
+    if (b == 254U)
+    {
+        rv = robotraconteurlite_buffer_vec_copy_to_uint32(buffer, *o, val);
+        *o += 4U;
+        return rv;
+    }
+    return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
+}
+
+static robotraconteurlite_status bench_copy_skip_string(const struct robotraconteurlite_buffer_vec* buffer, size_t* o)
+{
+    robotraconteurlite_status rv = -1;
+    uint32_t len = 0;
+
+    rv = bench_copy_read_uint_x(buffer, o, &len);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+    *o += len;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+static robotraconteurlite_status bench_copy_read_element_header(const struct robotraconteurlite_buffer_vec* buffer,
+                                                                size_t o, uint32_t* checksum, uint32_t* element_size)
+{
+    robotraconteurlite_status rv = -1;
+    uint8_t flags = 0;
+    uint16_t element_type = 0;
+    uint32_t v = 0;
+    uint32_t data_count = 0;
+
+    rv = bench_copy_read_uint_x(buffer, &o, element_size);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+    rv = robotraconteurlite_buffer_vec_copy_to_uint8(buffer, o, &flags);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+    o += 1U;
+
+    if ((flags & ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_ELEMENT_NAME_STR) != 0U)
+    {
+        rv = bench_copy_skip_string(buffer, &o);
+    }
+    if (!FAILED(rv) && ((flags & ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_ELEMENT_NAME_CODE) != 0U))
+    {
+        rv = bench_copy_read_uint_x(buffer, &o, &v);
+    }
+    if (FAILED(rv) || ((flags & ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_ELEMENT_NUMBER) != 0U))
+    {
+        /* Not written by the bench */
+        return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
+    }
+    rv = robotraconteurlite_buffer_vec_copy_to_uint16(buffer, o, &element_type);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+    o += 2U;
+    if ((flags & ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_ELEMENT_TYPE_NAME_STR) != 0U)
+    {
+        rv = bench_copy_skip_string(buffer, &o);
+    }
+    if (!FAILED(rv) && ((flags & ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_ELEMENT_TYPE_NAME_CODE) != 0U))
+    {
+        rv = bench_copy_read_uint_x(buffer, &o, &v);
+    }
+    if (!FAILED(rv) && ((flags & ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_META_INFO) != 0U))
+    {
+        rv = bench_copy_skip_string(buffer, &o);
+    }
+    if (!FAILED(rv) && ((flags & ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_EXTENDED) != 0U))
+    {
+        rv = bench_copy_skip_string(buffer, &o);
+    }
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+    rv = bench_copy_read_uint_x(buffer, &o, &data_count);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    *checksum += *element_size + data_count + element_type;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+static robotraconteurlite_status bench_read_message(struct robotraconteurlite_buffer_vec* buffer, size_t message_len,
+                                                    int copy_decode, uint32_t* checksum)
+{
+    struct robotraconteurlite_message_reader reader;
+    struct robotraconteurlite_messageentry_reader entry_reader;
+    struct robotraconteurlite_messageelement_reader element_reader;
+    struct robotraconteurlite_message_header header;
+    struct robotraconteurlite_messageentry_header entry_header;
+    struct robotraconteurlite_messageelement_header element_header;
+    robotraconteurlite_status rv = -1;
+
+    rv = robotraconteurlite_message_reader_init(&reader, buffer, 0, message_len);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+    (void)memset(&header, 0, sizeof(header));
+    rv = robotraconteurlite_message_reader_read_header(&reader, &header);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+    rv = robotraconteurlite_message_reader_begin_read_entries(&reader, &entry_reader);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+    (void)memset(&entry_header, 0, sizeof(entry_header));
+    rv = robotraconteurlite_messageentry_reader_read_header(&entry_reader, &entry_header);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+    rv = robotraconteurlite_messageentry_reader_begin_read_elements(&entry_reader, &element_reader);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    if (copy_decode != 0)
+    {
+        size_t o = element_reader.buffer_offset;
+        uint32_t element_size = 0;
+        size_t i = 0;
+
+        for (i = 0; i < element_reader.total_elements; i++)
+        {
+            rv = bench_copy_read_element_header(buffer, o, checksum, &element_size);
+            if (FAILED(rv))
+            {
+                return rv;
+            }
+            o += element_size;
+        }
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    }
+
+    while (1)
+    {
+        (void)memset(&element_header, 0, sizeof(element_header));
+        rv = robotraconteurlite_messageelement_reader_read_header(&element_reader, &element_header);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+        *checksum += element_header.element_size + element_header.data_count + element_header.element_type;
+
+        rv = robotraconteurlite_messageelement_reader_move_next(&element_reader);
+        if (NO_MORE(rv))
+        {
+            return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+        }
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+    }
+}
+
+static int bench_run(const char* label, const char* description, struct robotraconteurlite_buffer_vec* buffer,
+                     size_t message_len, int copy_decode)
+{
+    uint32_t checksum = 0;
+    clock_t start = 0;
+    double elapsed = 0;
+    uint32_t i = 0;
+
+    start = clock();
+    for (i = 0; i < BENCH_ITERATIONS; i++)
+    {
+        if (FAILED(bench_read_message(buffer, message_len, copy_decode, &checksum)))
+        {
+            (void)fprintf(stderr, "%s: message read failed\n", label);
+            return 1;
+        }
+    }
+    elapsed = (double)(clock() - start) / (double)CLOCKS_PER_SEC;
+
+    (void)printf("%-12s %8.1f ns/element (checksum %lu)  %s\n", label,
+                 (elapsed * 1.0e9) / ((double)BENCH_ITERATIONS * (double)BENCH_ELEMENT_COUNT),
+                 (unsigned long)checksum, description);
+    return 0;
+}
+
+int main(void)
+{
+    struct robotraconteurlite_buffer_vec buffer;
+    size_t message_len = 0;
+    size_t i = 0;
+
+    bench_segments[0].data = bench_buffer_bytes;
+    bench_segments[0].len = sizeof(bench_buffer_bytes);
+    buffer.buffer_vec = bench_segments;
+    buffer.buffer_vec_cnt = 1;
+
+    if (bench_wire_size(&buffer) != 0)
+    {
+        return 1;
+    }
+
+    if (FAILED(bench_write_message(&buffer, &message_len)))
+    {
+        (void)fprintf(stderr, "message write failed\n");
+        return 1;
+    }
+
+    (void)printf("message size %lu bytes, %u elements, %u iterations\n", (unsigned long)message_len,
+                 BENCH_ELEMENT_COUNT, BENCH_ITERATIONS);
+
+    if (bench_run("contiguous", "library decoder, span fast path", &buffer, message_len, 0) != 0)
+    {
+        return 1;
+    }
+    if (bench_run("per-byte", "bench decoder, one buffer_vec_copy_to call per field, names skipped", &buffer,
+                  message_len, 1) != 0)
+    {
+        return 1;
+    }
+
+    /* Split the same bytes into small segments so most headers straddle a segment boundary */
+    for (i = 0; (i * BENCH_SEGMENT_SIZE) < message_len; i++)
+    {
+        bench_segments[i].data = &bench_buffer_bytes[i * BENCH_SEGMENT_SIZE];
+        bench_segments[i].len = message_len - (i * BENCH_SEGMENT_SIZE);
+        if (bench_segments[i].len > BENCH_SEGMENT_SIZE)
+        {
+            bench_segments[i].len = BENCH_SEGMENT_SIZE;
+        }
+    }
+    buffer.buffer_vec_cnt = i;
+
+    return bench_run("segmented", "library decoder, cursor fallback across 7 byte segments", &buffer, message_len, 0);
+}
@@ -46,6 +46,17 @@ struct robotraconteurlite_buffer_vec
     struct robotraconteurlite_array_storage _scalar_storage;
 };
 
+/* Sequential access position in a buffer_vec. Caches the segment containing pos so nearby accesses do not need to
+   walk the segment list from the start. total_len is refreshed if segments are appended to the buffer_vec. */
+struct robotraconteurlite_buffer_vec_cursor
+{
+    const struct robotraconteurlite_buffer_vec* buffer_vec;
+    size_t total_len;
+    size_t pos;
+    size_t segment;
+    size_t segment_pos;
+};
+
 /* Complex types */
 struct robotraconteurlite_cdouble
 {
@@ -261,6 +272,85 @@ struct robotraconteurlite_array_vec_bool
     struct robotraconteurlite_array_storage _scalar_storage;
 };
 
+/* Multidimensional arrays are stored in column major (Fortran) order */
+struct robotraconteurlite_multidimarray_double
+{
+    struct robotraconteurlite_array_uint32 dims;
+    struct robotraconteurlite_array_double array;
+};
+
+struct robotraconteurlite_multidimarray_single
+{
+    struct robotraconteurlite_array_uint32 dims;
+    struct robotraconteurlite_array_single array;
+};
+
+struct robotraconteurlite_multidimarray_int8
+{
+    struct robotraconteurlite_array_uint32 dims;
+    struct robotraconteurlite_array_int8 array;
+};
+
+struct robotraconteurlite_multidimarray_uint8
+{
+    struct robotraconteurlite_array_uint32 dims;
+    struct robotraconteurlite_array_uint8 array;
+};
+
+struct robotraconteurlite_multidimarray_int16
+{
+    struct robotraconteurlite_array_uint32 dims;
+    struct robotraconteurlite_array_int16 array;
+};
+
+struct robotraconteurlite_multidimarray_uint16
+{
+    struct robotraconteurlite_array_uint32 dims;
+    struct robotraconteurlite_array_uint16 array;
+};
+
+struct robotraconteurlite_multidimarray_int32
+{
+    struct robotraconteurlite_array_uint32 dims;
+    struct robotraconteurlite_array_int32 array;
+};
+
+struct robotraconteurlite_multidimarray_uint32
+{
+    struct robotraconteurlite_array_uint32 dims;
+    struct robotraconteurlite_array_uint32 array;
+};
+
+struct robotraconteurlite_multidimarray_int64
+{
+    struct robotraconteurlite_array_uint32 dims;
+    struct robotraconteurlite_array_int64 array;
+};
+
+struct robotraconteurlite_multidimarray_uint64
+{
+    struct robotraconteurlite_array_uint32 dims;
+    struct robotraconteurlite_array_uint64 array;
+};
+
+struct robotraconteurlite_multidimarray_cdouble
+{
+    struct robotraconteurlite_array_uint32 dims;
+    struct robotraconteurlite_array_cdouble array;
+};
+
+struct robotraconteurlite_multidimarray_csingle
+{
+    struct robotraconteurlite_array_uint32 dims;
+    struct robotraconteurlite_array_csingle array;
+};
+
+struct robotraconteurlite_multidimarray_bool
+{
+    struct robotraconteurlite_array_uint32 dims;
+    struct robotraconteurlite_array_bool array;
+};
+
 ROBOTRACONTEURLITE_API robotraconteurlite_status
 robotraconteurlite_buffer_init_scalar(struct robotraconteurlite_buffer* buffer, void* data, size_t len);
 
@@ -293,10 +383,37 @@ ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_buffer_vec_c
     const struct robotraconteurlite_buffer_vec* source, size_t source_pos, uint8_t* dest, size_t dest_len,
     size_t dest_pos, size_t dest_elem_size, size_t dest_count);
 
+/* Copy count elements of elem_size bytes starting at source_pos, storing element i at dest[i * dest_stride].
+   dest_len is the size of dest in bytes. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_buffer_vec_copy_to_mem_strided(
+    const struct robotraconteurlite_buffer_vec* source, size_t source_pos, uint8_t* dest, size_t dest_len,
+    size_t dest_stride, size_t elem_size, size_t count);
+
 ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_buffer_vec_copy_from_mem(
     struct robotraconteurlite_buffer_vec* dest, size_t dest_pos, const uint8_t* source, size_t source_len,
     size_t source_pos, size_t source_elem_size, size_t source_count);
 
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_buffer_vec_get_span(
+    const struct robotraconteurlite_buffer_vec* source, size_t source_pos, size_t len,
+    struct robotraconteurlite_buffer* span);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_buffer_vec_cursor_init(
+    struct robotraconteurlite_buffer_vec_cursor* cursor, const struct robotraconteurlite_buffer_vec* buffer_vec);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status
+robotraconteurlite_buffer_vec_cursor_seek(struct robotraconteurlite_buffer_vec_cursor* cursor, size_t pos);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_buffer_vec_cursor_read(
+    struct robotraconteurlite_buffer_vec_cursor* cursor, size_t pos, void* dest, size_t len);
+
+/* Seek to pos and return the contiguous remainder of the segment containing pos. The span is empty at the end of
+   the buffer. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_buffer_vec_cursor_peek(
+    struct robotraconteurlite_buffer_vec_cursor* cursor, size_t pos, struct robotraconteurlite_buffer* span);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_buffer_vec_cursor_write(
+    struct robotraconteurlite_buffer_vec_cursor* cursor, size_t pos, const void* source, size_t len);
+
 /* double */
 ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_buffer_vec_copy_to_double_array(
     const struct robotraconteurlite_buffer_vec* source_buf, size_t source_buf_pos,
@@ -540,8 +657,14 @@ static int robotraconteurlite_string_cmp_c_str(const struct robotraconteurlite_s
     return memcmp(str1->data, str2, str1->len);
 }
 
+/* Non-cryptographic hash of the string bytes (FNV-1a with a final mix). The value may change between library
+   versions, do not send it on the wire. */
 ROBOTRACONTEURLITE_API uint32_t robotraconteurlite_string_hash(const struct robotraconteurlite_string* str);
 
+/* Same result as robotraconteurlite_string_hash() for len bytes at source_pos, hashed in place across segments */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_buffer_vec_string_hash(
+    const struct robotraconteurlite_buffer_vec* source, size_t source_pos, size_t len, uint32_t* hash);
+
 ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_string_copy_to(
     const struct robotraconteurlite_string* source, struct robotraconteurlite_string* dest);
 
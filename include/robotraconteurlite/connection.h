@@ -24,6 +24,9 @@
 #define ROBOTRACONTEURLITE_CONFIG_FLAGS_NULL 0U
 #define ROBOTRACONTEURLITE_CONFIG_FLAGS_ISSERVER 0x1U
 #define ROBOTRACONTEURLITE_CONFIG_FLAGS_ENABLE_REDUCED_HEADER4 0x2U
+#define ROBOTRACONTEURLITE_CONFIG_FLAGS_ENABLE_COMPACT_UINT_X4 0x4U
+/* Raise a header event as soon as the message and first entry headers of a partly received message arrive */
+#define ROBOTRACONTEURLITE_CONFIG_FLAGS_ENABLE_STREAM_RECV 0x8U
 
 /* robotraconteurlite_connection_status_flags */
 #define ROBOTRACONTEURLITE_STATUS_FLAGS_NULL 0U
@@ -48,6 +51,14 @@
 #define ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_SENT_CONSUMED 0x40000U
 #define ROBOTRACONTEURLITE_STATUS_FLAGS_CONNECTED_CONSUMED 0x80000U
 #define ROBOTRACONTEURLITE_STATUS_FLAGS_SEND_MESSAGE4 0x100000U
+#define ROBOTRACONTEURLITE_STATUS_FLAGS_STRING_TABLE4 0x200000U
+#define ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_HEADER_RECEIVED 0x400000U
+#define ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_HEADER_CONSUMED 0x800000U
+#define ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_STREAMING 0x1000000U
+#define ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_REJECTED 0x2000000U
+#define ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_CHUNK_RECEIVED 0x4000000U
+/* The transport modifies the payload as it sends, so messages cannot be sent from caller memory */
+#define ROBOTRACONTEURLITE_STATUS_FLAGS_SEND_COPY_ONLY 0x8000000U
 
 /* transport_capability_flags */
 #define ROBOTRACONTEURLITE_TRANSPORT_CAPABILITY_CODE_PAGE_MASK 0xFFF00000U
@@ -55,6 +66,8 @@
 #define ROBOTRACONTEURLITE_TRANSPORT_CAPABILITY_CODE_MESSAGE2_BASIC_ENABLE 0x00000001U
 #define ROBOTRACONTEURLITE_TRANSPORT_CAPABILITY_CODE_MESSAGE4_BASIC_PAGE 0x04000000U
 #define ROBOTRACONTEURLITE_TRANSPORT_CAPABILITY_CODE_MESSAGE4_BASIC_ENABLE 0x00000001U
+#define ROBOTRACONTEURLITE_TRANSPORT_CAPABILITY_CODE_MESSAGE4_STRINGTABLE_PAGE 0x04100000U
+#define ROBOTRACONTEURLITE_TRANSPORT_CAPABILITY_CODE_MESSAGE4_STRINGTABLE_ENABLE 0x00000001U
 
 #ifdef __cplusplus
 extern "C" {
@@ -70,6 +83,24 @@ struct robotraconteurlite_user_storage
     void* user_data;
 };
 
+struct robotraconteurlite_connection;
+
+/* Large receive buffer shared by the connections, lent to a connection for a single message that does not fit its
+   own receive buffer */
+struct robotraconteurlite_connection_buffer_pool_entry
+{
+    uint8_t* data;
+    size_t len;
+    /* Connection the buffer is lent to, NULL when free */
+    struct robotraconteurlite_connection* owner;
+};
+
+struct robotraconteurlite_connection_buffer_pool
+{
+    struct robotraconteurlite_connection_buffer_pool_entry* entries;
+    size_t entries_len;
+};
+
 /* NOLINTNEXTLINE(clang-analyzer-optin.performance.Padding) */
 struct robotraconteurlite_connection
 {
@@ -87,6 +118,12 @@ struct robotraconteurlite_connection
     size_t recv_buffer_len;
     size_t send_buffer_pos;
     size_t recv_buffer_pos;
+    /* Scatter-gather send segments, NULL when sending directly from send_buffer */
+    struct robotraconteurlite_buffer_vec* send_buffer_vec;
+
+    /* Message 4 string tables, NULL to disable. Owned by the user. */
+    struct robotraconteurlite_string_table* send_string_table;
+    struct robotraconteurlite_string_table* recv_string_table;
 
     /* Control flags */
     uint32_t config_flags;
@@ -113,6 +150,19 @@ struct robotraconteurlite_connection
     /* Message information */
     uint32_t recv_message_len;
     uint32_t send_message_len;
+    /* Entries of the received message already delivered as events */
+    uint32_t recv_message_entry_index;
+    /* Buffer offset of entry recv_message_entry_index, so the next event starts there without reading the earlier
+       entries again */
+    size_t recv_message_entry_offset;
+    /* Streaming receive. The part of the message not yet received when streaming began, recv_stream_offset bytes
+       into the message, is received into recv_sink instead of recv_buffer. */
+    uint8_t* recv_sink;
+    size_t recv_sink_len;
+    size_t recv_sink_pos;
+    size_t recv_stream_offset;
+    /* Pool lending buffers for messages larger than recv_buffer, NULL to disable. Owned by the user. */
+    struct robotraconteurlite_connection_buffer_pool* recv_buffer_pool;
 
     /* Transport storage */
     struct robotraconteurlite_transport_storage transport_storage;
@@ -166,6 +216,19 @@ ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_connection_b
     struct robotraconteurlite_connection* connection, struct robotraconteurlite_message_writer* message_writer,
     struct robotraconteurlite_buffer_vec* buffer_storage);
 
+/* Begin a scatter-gather send. buffer_storage->buffer_vec_cnt is the number of segments available. Arrays of at
+   least external_min_len bytes are sent from the caller memory, which must stay valid until the message sent event.
+   Connections flagged ROBOTRACONTEURLITE_STATUS_FLAGS_SEND_COPY_ONLY, such as websockets, copy all arrays into the send
+   buffer instead. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_connection_begin_send_message_ex(
+    struct robotraconteurlite_connection* connection, struct robotraconteurlite_message_writer* message_writer,
+    struct robotraconteurlite_buffer_vec* buffer_storage, size_t external_min_len);
+
+/* Copy a prebuilt message into the send buffer and request it to be sent */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_connection_send_message_template(
+    struct robotraconteurlite_connection* connection,
+    const struct robotraconteurlite_message_template* message_template);
+
 ROBOTRACONTEURLITE_API robotraconteurlite_status
 robotraconteurlite_connection_end_send_message(struct robotraconteurlite_connection* connection, size_t message_len);
 
@@ -179,6 +242,44 @@ ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_connection_m
 ROBOTRACONTEURLITE_API robotraconteurlite_status
 robotraconteurlite_connection_message_receive_consume(struct robotraconteurlite_connection* connection);
 
+/* Streaming receive, enabled with ROBOTRACONTEURLITE_CONFIG_FLAGS_ENABLE_STREAM_RECV. Called by the transport after
+   each receive to raise the header event once the message header and first entry header of an incomplete message
+   have arrived. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status
+robotraconteurlite_connection_check_message_header(struct robotraconteurlite_connection* connection);
+
+/* Read the headers of a message while the rest of it is still being received. message_reader is a partial reader,
+   see robotraconteurlite_message_reader_init_partial. Returns RETRY if there is no header event. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_connection_message_receive_header(
+    struct robotraconteurlite_connection* connection, struct robotraconteurlite_message_reader* message_reader,
+    struct robotraconteurlite_buffer_vec* buffer_storage);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status
+robotraconteurlite_connection_message_receive_header_consume(struct robotraconteurlite_connection* connection);
+
+/* After the header event, receive the rest of the message directly into sink, which must hold all of it. A chunk
+   event is raised each time more of the message arrives, with recv_sink_pos bytes of sink filled, and the message
+   received event is raised once it is complete. The message is then read across the receive buffer and sink, so
+   buffer_storage for robotraconteurlite_connection_message_receive needs two segments. sink must stay valid until
+   the message is consumed. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_connection_message_receive_stream(
+    struct robotraconteurlite_connection* connection, uint8_t* sink, size_t sink_len);
+
+/* After the header event, discard the rest of the message as it arrives. No message received event is raised. The
+   receive buffer is overwritten, so header string views of the message are no longer valid. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status
+robotraconteurlite_connection_message_receive_reject(struct robotraconteurlite_connection* connection);
+
+/* Called by the transport once the receive buffer is full of a message larger than it. Lends the smallest free pool
+   buffer that holds the rest of the message and streams into it. Returns RETRY if all large enough buffers are lent
+   out, and OUT_OF_RANGE if there is no pool or no pool buffer is large enough. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status
+robotraconteurlite_connection_borrow_recv_buffer(struct robotraconteurlite_connection* connection);
+
+/* Return the pool buffer lent to the connection, if any */
+ROBOTRACONTEURLITE_API robotraconteurlite_status
+robotraconteurlite_connection_release_recv_buffer(struct robotraconteurlite_connection* connection);
+
 ROBOTRACONTEURLITE_API robotraconteurlite_status
 robotraconteurlite_connection_close(struct robotraconteurlite_connection* connection);
 
@@ -241,9 +342,44 @@ static int robotraconteurlite_connection_is_message_received_event(struct robotr
 
 static void robotraconteurlite_connection_consume_message_received(struct robotraconteurlite_connection* connection)
 {
+    connection->recv_message_entry_index = 0;
+    connection->recv_message_entry_offset = 0;
     ROBOTRACONTEURLITE_FLAGS_SET(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_CONSUMED);
 }
 
+static int robotraconteurlite_connection_is_message_header_received_event(
+    struct robotraconteurlite_connection* connection)
+{
+    return (ROBOTRACONTEURLITE_FLAGS_CHECK(connection->connection_state,
+                                           ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_HEADER_RECEIVED)) &&
+           (!ROBOTRACONTEURLITE_FLAGS_CHECK(connection->connection_state,
+                                            (ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_HEADER_CONSUMED |
+                                             ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_RECEIVED)));
+}
+
+static void robotraconteurlite_connection_consume_message_header_received(
+    struct robotraconteurlite_connection* connection)
+{
+    ROBOTRACONTEURLITE_FLAGS_SET(connection->connection_state,
+                                 ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_HEADER_CONSUMED);
+}
+
+static int robotraconteurlite_connection_is_message_chunk_received_event(
+    struct robotraconteurlite_connection* connection)
+{
+    return (ROBOTRACONTEURLITE_FLAGS_CHECK(connection->connection_state,
+                                           ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_CHUNK_RECEIVED)) &&
+           (!ROBOTRACONTEURLITE_FLAGS_CHECK(connection->connection_state,
+                                            ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_RECEIVED));
+}
+
+static void robotraconteurlite_connection_consume_message_chunk_received(
+    struct robotraconteurlite_connection* connection)
+{
+    ROBOTRACONTEURLITE_FLAGS_CLEAR(connection->connection_state,
+                                   ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_CHUNK_RECEIVED);
+}
+
 static int robotraconteurlite_connection_is_message_sent(struct robotraconteurlite_connection* connection)
 {
     return ROBOTRACONTEURLITE_FLAGS_CHECK(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_SENT);
@@ -276,6 +412,18 @@ ROBOTRACONTEURLITE_API struct robotraconteurlite_connection* robotraconteurlite_
     struct robotraconteurlite_connection connections_fixed_storage[], size_t connections_fixed_storage_len,
     uint8_t buffers[], size_t buffer_size, size_t buffer_count);
 
+/* Split buffers into entries_len pool buffers of buffer_size bytes each */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_connection_buffer_pool_init(
+    struct robotraconteurlite_connection_buffer_pool* pool,
+    struct robotraconteurlite_connection_buffer_pool_entry entries[], size_t entries_len, uint8_t buffers[],
+    size_t buffer_size);
+
+/* Share the pool between all connections of the list. The per-connection buffers then only need to hold the
+   message headers and typical traffic. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status
+robotraconteurlite_connections_set_recv_buffer_pool(struct robotraconteurlite_connection* connections_head,
+                                                    struct robotraconteurlite_connection_buffer_pool* pool);
+
 static int robotraconteurlite_connection_is_heartbeat_timeout(struct robotraconteurlite_connection* connection,
                                                               robotraconteurlite_timespec now)
 {
@@ -45,6 +45,10 @@
 #define ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER (-22)
 #define ROBOTRACONTEURLITE_ERROR_SYSTEM_ERROR (-23)
 
+/* robotraconteurlite_status informational codes (non-negative, treated as success) */
+
+#define ROBOTRACONTEURLITE_STATUS_COPIED 1
+
 #ifdef __cplusplus
 extern "C" {
 #endif
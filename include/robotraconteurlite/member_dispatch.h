@@ -0,0 +1,74 @@
+/* Copyright 2011-2024 Wason Technology, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ROBOTRACONTEURLITE_MEMBER_DISPATCH_H
+#define ROBOTRACONTEURLITE_MEMBER_DISPATCH_H
+
+#include <stdint.h>
+#include "robotraconteurlite/config.h"
+#include "robotraconteurlite/err.h"
+#include "robotraconteurlite/array.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Number of hash seeds tried by robotraconteurlite_member_dispatch_init before giving up */
+#define ROBOTRACONTEURLITE_MEMBER_DISPATCH_MAX_SEEDS 64U
+
+/* Number of displacements tried for each bucket */
+#define ROBOTRACONTEURLITE_MEMBER_DISPATCH_MAX_DISPLACEMENT 1024U
+
+struct robotraconteurlite_messageentry_header;
+
+struct robotraconteurlite_member_dispatch_entry
+{
+    uint16_t entry_type;
+    const char* service_path;
+    const char* member_name;
+    uint32_t handler_id;
+};
+
+/* Perfect hash from (entry_type, service_path, member_name) to an entry, built by
+   robotraconteurlite_member_dispatch_init. A key is hashed once into a bucket, and the bucket displacement selects a
+   slot that holds at most one entry, so a lookup costs one hash and one string compare. */
+struct robotraconteurlite_member_dispatch
+{
+    const struct robotraconteurlite_member_dispatch_entry* entries;
+    size_t entries_len;
+    uint16_t* slots;
+    size_t slots_len;
+    uint16_t* displacements;
+    size_t displacements_len;
+    uint32_t seed;
+};
+
+/* Build the hash for a static array of entries. slots_len must be at least entries_len, and about 1.25 times
+   entries_len with one displacement for every four entries builds quickly. Fails with INVALID_PARAMETER for duplicate
+   entries and OUT_OF_RANGE if no perfect hash is found, in which case more slots or displacements are needed. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_member_dispatch_init(
+    struct robotraconteurlite_member_dispatch* dispatch, const struct robotraconteurlite_member_dispatch_entry* entries,
+    size_t entries_len, uint16_t slots[], size_t slots_len, uint16_t displacements[], size_t displacements_len);
+
+/* Find the handler for a received entry header. Fails with KEY_NOT_FOUND if no entry matches. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_member_dispatch_find(
+    const struct robotraconteurlite_member_dispatch* dispatch,
+    const struct robotraconteurlite_messageentry_header* entry_header, uint32_t* handler_id);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ROBOTRACONTEURLITE_MEMBER_DISPATCH_H */
@@ -21,6 +21,7 @@
 #include "robotraconteurlite/array.h"
 #include "robotraconteurlite/nodeid.h"
 #include "robotraconteurlite/message_data.h"
+#include "robotraconteurlite/string_table.h"
 
 /* Data Types */
 #define ROBOTRACONTEURLITE_DATATYPE_VOID 0U
@@ -216,6 +217,20 @@
 #define ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_EXTENDED 0x80U
 #define ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_VERSION2COMPAT 0x29U
 
+/* Maximum nesting of structure, list and map elements checked by robotraconteurlite_message_reader_validate */
+#ifndef ROBOTRACONTEURLITE_MESSAGE_VALIDATE_MAX_DEPTH
+#define ROBOTRACONTEURLITE_MESSAGE_VALIDATE_MAX_DEPTH 8U
+#endif
+
+/* Maximum number of tokens of a path passed to robotraconteurlite_messageentry_reader_find_path */
+#ifndef ROBOTRACONTEURLITE_MESSAGEELEMENT_PATH_MAX_TOKENS
+#define ROBOTRACONTEURLITE_MESSAGEELEMENT_PATH_MAX_TOKENS 16U
+#endif
+
+/* Element path token types */
+#define ROBOTRACONTEURLITE_MESSAGEELEMENT_PATH_TOKEN_NAME 0U
+#define ROBOTRACONTEURLITE_MESSAGEELEMENT_PATH_TOKEN_NUMBER 1U
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -268,34 +283,100 @@ struct robotraconteurlite_messageelement_header
     uint32_t data_count;
 };
 
+struct robotraconteurlite_messageelement_index_entry
+{
+    uint32_t name_hash;
+    size_t name_offset;
+    size_t name_len;
+    uint16_t element_type;
+    uint32_t data_count;
+    size_t data_offset;
+    size_t element_offset;
+    size_t element_size;
+    size_t element_remaining;
+    size_t element_number;
+    uint32_t name_code;
+};
+
+/* Caller provided element lookup table. entries is used as an open addressed hash table, so entries_len must be at
+   least the number of elements. Unused slots have element_size == 0. */
+struct robotraconteurlite_messageelement_index
+{
+    struct robotraconteurlite_messageelement_index_entry* entries;
+    size_t entries_len;
+    size_t entries_count;
+    size_t total_elements;
+};
+
+/* One step of a compiled element path. element_name is a view into the path string, for number tokens it holds the
+   digits so Message 2 list elements named by their index are also found. */
+struct robotraconteurlite_messageelement_path_token
+{
+    uint8_t token_type;
+    struct robotraconteurlite_string element_name;
+    int32_t element_number;
+    /* Position of the element found by the last lookup, relative to the first element of its list. SIZE_MAX if
+       there is none. */
+    size_t cached_offset;
+    size_t cached_element;
+};
+
+struct robotraconteurlite_messageelement_path
+{
+    struct robotraconteurlite_messageelement_path_token* tokens;
+    size_t tokens_count;
+};
+
 struct robotraconteurlite_message_reader
 {
     struct robotraconteurlite_buffer_vec* buffer;
+    struct robotraconteurlite_buffer_vec_cursor cursor;
     size_t buffer_offset;
     size_t buffer_count;
     uint16_t message_version;
+    const struct robotraconteurlite_string_table* string_table;
+    uint8_t string_views;
+    uint8_t validated;
 };
 
 struct robotraconteurlite_messageentry_reader
 {
     struct robotraconteurlite_buffer_vec* buffer;
+    struct robotraconteurlite_buffer_vec_cursor cursor;
     size_t buffer_offset;
     size_t buffer_count;
     size_t buffer_remaining;
     size_t entry_count_offset;
     size_t current_entry;
     uint16_t message_version;
+    const struct robotraconteurlite_string_table* string_table;
+    uint8_t string_views;
+    uint8_t validated;
+    struct robotraconteurlite_messageelement_index* element_index;
 };
 
 struct robotraconteurlite_messageelement_reader
 {
     struct robotraconteurlite_buffer_vec* buffer;
+    struct robotraconteurlite_buffer_vec_cursor cursor;
     size_t buffer_offset;
     size_t buffer_count;
     size_t buffer_remaining;
     size_t current_element;
     size_t total_elements;
     uint16_t message_version;
+    const struct robotraconteurlite_string_table* string_table;
+    uint8_t validated;
+    struct robotraconteurlite_messageelement_index* nested_element_index;
+};
+
+/* Reads the fields of a structure, pod or namedarray element. Fields requested in the order they were written are
+   found without a name search. */
+struct robotraconteurlite_messageelement_field_reader
+{
+    struct robotraconteurlite_messageelement_reader first;
+    struct robotraconteurlite_messageelement_reader next;
+    uint8_t at_end;
 };
 
 struct robotraconteurlite_message_buffer_info
@@ -304,6 +385,8 @@ struct robotraconteurlite_message_buffer_info
     size_t header_size;
     size_t entry_count_offset;
     size_t entry_start_offset;
+    size_t sender_endpoint_offset;
+    size_t receiver_endpoint_offset;
 };
 
 struct robotraconteurlite_messageentry_buffer_info
@@ -313,6 +396,7 @@ struct robotraconteurlite_messageentry_buffer_info
     size_t element_count_offset;
     size_t element_start_offset;
     size_t entry_size_offset;
+    size_t request_id_offset;
 };
 
 struct robotraconteurlite_messageelement_buffer_info
@@ -328,48 +412,118 @@ struct robotraconteurlite_messageelement_buffer_info
 struct robotraconteurlite_message_writer
 {
     struct robotraconteurlite_buffer_vec* buffer;
+    struct robotraconteurlite_buffer_vec_cursor cursor;
     size_t buffer_offset;
     size_t buffer_count;
     size_t message_size_offset;
     size_t entry_count_offset;
     uint16_t message_version;
+    size_t external_segment_capacity;
+    size_t external_min_len;
+    uint8_t compact_uint_x;
+    const struct robotraconteurlite_string_table* string_table;
     /* uint8_t dry_run; */
 };
 
 struct robotraconteurlite_messageentry_writer
 {
     struct robotraconteurlite_buffer_vec* buffer;
+    struct robotraconteurlite_buffer_vec_cursor cursor;
     size_t buffer_offset;
     size_t buffer_count;
     size_t entries_written_count;
     size_t entries_written_size;
+    /* Bytes of entries_written_size held in external segments instead of the send buffer */
+    size_t external_written_size;
     size_t entry_size_offset;
     size_t element_count_offset;
     size_t entry_header_size;
     uint16_t message_version;
+    size_t external_segment_capacity;
+    size_t external_min_len;
+    uint8_t compact_uint_x;
+    const struct robotraconteurlite_string_table* string_table;
     /* uint8_t dry_run; */
 };
 
 struct robotraconteurlite_messageelement_writer
 {
     struct robotraconteurlite_buffer_vec* buffer;
+    struct robotraconteurlite_buffer_vec_cursor cursor;
     size_t buffer_offset;
     size_t buffer_count;
     size_t elements_written_count;
     size_t elements_written_size;
+    /* Bytes of elements_written_size held in external segments instead of the send buffer */
+    size_t external_written_size;
     size_t element_size_offset;
     size_t data_count_offset;
     size_t element_header_size;
     uint16_t message_version;
+    size_t external_segment_capacity;
+    size_t external_min_len;
+    uint8_t compact_uint_x;
+    const struct robotraconteurlite_string_table* string_table;
+    size_t reserved_offset;
+    size_t reserved_size;
     /* uint8_t dry_run; */
 };
 
+/* Prebuilt message that is sent repeatedly by copying it and patching the endpoints, the request id of the first
+   entry, and the data of selected elements. Patched fields keep the size they were built with, so message 4
+   templates should be built with UINT32_MAX placeholders for the endpoints and request id. */
+struct robotraconteurlite_message_template_slot
+{
+    size_t offset;
+    size_t len;
+};
+
+struct robotraconteurlite_message_template
+{
+    uint8_t* data;
+    size_t message_len;
+    uint16_t message_version;
+    size_t sender_endpoint_offset;
+    size_t receiver_endpoint_offset;
+    size_t request_id_offset;
+    struct robotraconteurlite_message_template_slot* slots;
+    size_t slots_len;
+    size_t slots_count;
+};
+
 /* Message Reader */
 
 ROBOTRACONTEURLITE_API robotraconteurlite_status
 robotraconteurlite_message_reader_init(struct robotraconteurlite_message_reader* reader,
                                        struct robotraconteurlite_buffer_vec* buffer, size_t offset, size_t count);
 
+/* Begin reading a message of count bytes of which only the start has been received into buffer. Reads past the
+   received bytes fail with OUT_OF_RANGE, so the message and entry headers can be read as soon as they arrive. The
+   message must not be validated or have its element data read until it is complete. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_message_reader_init_partial(
+    struct robotraconteurlite_message_reader* reader, struct robotraconteurlite_buffer_vec* buffer, size_t offset,
+    size_t count);
+
+/* Message 4 only. Service paths, member names, element names and element type names sent as codes are resolved
+   using table. Codes missing from the table are left unresolved with an empty string. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status
+robotraconteurlite_message_reader_set_string_table(struct robotraconteurlite_message_reader* reader,
+                                                   const struct robotraconteurlite_string_table* table);
+
+/* With string_views set, message and entry header strings that are contiguous in the buffer are returned as views
+   into the buffer, or into the string table for coded strings, instead of being copied into the header storage. The
+   views are valid while the buffer and string table are unchanged. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_message_reader_set_string_views(
+    struct robotraconteurlite_message_reader* reader, uint8_t string_views);
+
+/* Check the structure of the whole message in one pass: header, entry and element sizes, entry and element counts,
+   nested element sizes, and data_count against the data size of numeric and string elements. On success the reader
+   is marked as validated, and data reads through it skip the checks already done here and decode element headers
+   without resolving name strings. The buffer must not be modified after validation. Fails with PROTOCOL for a
+   malformed message, or OUT_OF_RANGE if nesting exceeds ROBOTRACONTEURLITE_MESSAGE_VALIDATE_MAX_DEPTH. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status
+robotraconteurlite_message_reader_validate(struct robotraconteurlite_message_reader* reader);
+
 ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_message_reader_read_header(
     struct robotraconteurlite_message_reader* reader, struct robotraconteurlite_message_header* header);
 
@@ -391,6 +545,11 @@ ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_message_read
 ROBOTRACONTEURLITE_API robotraconteurlite_status
 robotraconteurlite_messageentry_reader_move_next(struct robotraconteurlite_messageentry_reader* entry_reader);
 
+/* Move an entry reader from the first entry straight to entry entry_index, which starts at entry_offset. The offset
+   is the buffer_offset of that entry from an earlier reader of the same message. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageentry_reader_seek(
+    struct robotraconteurlite_messageentry_reader* entry_reader, size_t entry_offset, size_t entry_index);
+
 ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageentry_reader_read_header(
     struct robotraconteurlite_messageentry_reader* entry_reader, struct robotraconteurlite_messageentry_header* header);
 
@@ -417,6 +576,9 @@ ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageentry
     struct robotraconteurlite_messageentry_reader* entry_reader, const struct robotraconteurlite_string* element_name,
     struct robotraconteurlite_messageelement_reader* element_reader);
 
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageentry_reader_build_element_index(
+    struct robotraconteurlite_messageentry_reader* entry_reader, struct robotraconteurlite_messageelement_index* index);
+
 ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageentry_reader_find_element_verify_scalar(
     struct robotraconteurlite_messageentry_reader* entry_reader, const struct robotraconteurlite_string* element_name,
     struct robotraconteurlite_messageelement_reader* element_reader, uint16_t expected_data_type);
@@ -458,6 +620,10 @@ ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageeleme
     const struct robotraconteurlite_string* nested_element_name,
     struct robotraconteurlite_messageelement_reader* nested_element_reader);
 
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_build_nested_element_index(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_messageelement_index* index);
+
 ROBOTRACONTEURLITE_API robotraconteurlite_status
 robotraconteurlite_messageelement_reader_find_nested_element_verify_scalar(
     struct robotraconteurlite_messageelement_reader* element_reader,
@@ -477,12 +643,50 @@ robotraconteurlite_messageelement_reader_find_nested_element_verify_string(
     const struct robotraconteurlite_string* nested_element_name,
     struct robotraconteurlite_messageelement_reader* nested_element_reader, uint32_t expected_max_len);
 
+/* Compile an element path such as pose.position[2].x into tokens. Names are separated by '.', [n] selects a list or
+   int32 map element by number and ["key"] a string map element. The tokens refer to path, which must stay valid
+   while the compiled path is used. Returns INVALID_PARAMETER for a malformed path and OUT_OF_RANGE if it has more
+   than tokens_len tokens. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_path_compile(
+    const struct robotraconteurlite_string* path, struct robotraconteurlite_messageelement_path_token tokens[],
+    size_t tokens_len, struct robotraconteurlite_messageelement_path* compiled_path);
+
+/* Find the element at compiled_path, walking the nesting once. Each token remembers where its element was found and
+   checks there first, so resolving the same path in messages of the same layout needs no scan. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageentry_reader_find_compiled_path(
+    struct robotraconteurlite_messageentry_reader* entry_reader,
+    struct robotraconteurlite_messageelement_path* compiled_path,
+    struct robotraconteurlite_messageelement_reader* element_reader);
+
+/* Compile path and find its element, see robotraconteurlite_messageelement_path_compile */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageentry_reader_find_path(
+    struct robotraconteurlite_messageentry_reader* entry_reader, const struct robotraconteurlite_string* path,
+    struct robotraconteurlite_messageelement_reader* element_reader);
+
 /* Message Writer */
 
 ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_message_writer_init(
     struct robotraconteurlite_message_writer* writer, struct robotraconteurlite_buffer_vec* buffer, size_t offset,
     size_t count, uint16_t message_version);
 
+/* Scatter-gather mode. Array payloads of at least min_len bytes are referenced as extra segments of the writer
+   buffer_vec instead of being copied. buffer_vec must have room for segment_capacity segments. Referenced arrays
+   must stay valid until the message has been sent. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_message_writer_enable_external_segments(
+    struct robotraconteurlite_message_writer* writer, size_t segment_capacity, size_t min_len);
+
+/* Message 4 only. Entry and nested element sizes and counts are written with the minimal uint_x width instead of
+   the padded width, moving the contents back when each entry or nested element ends. Has no effect while external
+   segments are enabled. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status
+robotraconteurlite_message_writer_enable_compact_uint_x(struct robotraconteurlite_message_writer* writer);
+
+/* Message 4 only. Service paths, member names, element names and element type names with a confirmed entry in
+   table are written as codes instead of strings. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status
+robotraconteurlite_message_writer_set_string_table(struct robotraconteurlite_message_writer* writer,
+                                                   const struct robotraconteurlite_string_table* table);
+
 ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_message_writer_write_header2_ex(
     struct robotraconteurlite_message_writer* writer, size_t* offset, struct robotraconteurlite_message_header* header,
     struct robotraconteurlite_message_buffer_info* buffer_info);
@@ -521,6 +725,15 @@ ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageentry
     struct robotraconteurlite_messageentry_writer* entry_writer, struct robotraconteurlite_messageentry_header* header,
     struct robotraconteurlite_messageelement_writer* element_writer);
 
+/* Forward a received entry to another message without decoding its elements. The entry is written with header, which
+   may be a modified copy of the source entry header, and header->element_count is ignored. If the reader and writer
+   use the same message version and string table the element list is copied as is. Otherwise each element header is
+   transcoded, with its strings held in string_storage, and the element data is copied untouched. Nesting is limited to
+   ROBOTRACONTEURLITE_MESSAGE_VALIDATE_MAX_DEPTH. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageentry_writer_copy_entry(
+    struct robotraconteurlite_messageentry_writer* entry_writer, struct robotraconteurlite_messageentry_header* header,
+    struct robotraconteurlite_messageentry_reader* entry_reader, char string_storage[], size_t string_storage_len);
+
 ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_write_header2_ex(
     struct robotraconteurlite_messageelement_writer* element_writer, size_t* offset,
     struct robotraconteurlite_messageelement_header* header,
@@ -551,6 +764,124 @@ ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageeleme
     const struct robotraconteurlite_string* element_name, size_t data_len, uint16_t data_type, size_t data_elem_size,
     struct robotraconteurlite_messageelement_buffer_info* buffer_info, size_t* element_size);
 
+/* Commit an element reserved with robotraconteurlite_messageelement_writer_reserve_<type>_array after its data has
+   been filled in. Returns INVALID_OPERATION if nothing is reserved or another element was written since. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_commit_reserved(
+    struct robotraconteurlite_messageelement_writer* element_writer);
+
+/* Type-converting array reads and writes. Any pair of the real numeric data types converts, as does
+   DATATYPE_CDOUBLE to and from DATATYPE_CSINGLE. Integer results saturate to the destination range and NaN converts
+   to zero. Other pairs return MESSAGEELEMENT_TYPE_MISMATCH. Data is converted directly between the message buffer
+   and the caller's array without an intermediate buffer. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_datatype_convert(
+    const uint8_t* source, uint16_t source_type, uint8_t* dest, uint16_t dest_type, size_t count);
+
+/* dest_len is the capacity of dest_buf in elements of dest_type, and is updated to the number of elements read */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_array_convert(
+    struct robotraconteurlite_messageelement_reader* element_reader, uint8_t* dest_buf, size_t* dest_len,
+    uint16_t dest_type);
+
+/* Write source_len elements of source_type as an array element of data_type */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_write_array_convert(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name, const uint8_t* source_buf, size_t source_len,
+    uint16_t source_type, uint16_t data_type);
+
+/* Bool arrays as packed bitsets. Bool i is bit (i % 64) of word i / 64 and any nonzero wire value reads as 1.
+   dest->len is the capacity of dest in words and is updated to the number of words used, and bit_count is set to
+   the number of bools. Unused bits of the last word are cleared. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_bool_bitset(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_uint64* dest,
+    size_t* bit_count);
+
+/* Write the first bit_count bits of source as a bool array element */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_write_bool_bitset(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name, const struct robotraconteurlite_array_uint64* source,
+    size_t bit_count);
+
+/* Message Size */
+
+/* Exact encoded sizes, computed without a buffer. An entry is its header plus the size of each element, a nested
+   element is its header plus the size of each child element, and a message is its header plus the size of each
+   entry. header->entry_count must be set before computing a message header size. Sizes assume names are written as
+   strings, so they are an upper bound when a string table is in use. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_message_writer_size_of_header(
+    uint16_t message_version, const struct robotraconteurlite_message_header* header, uint8_t message_flags_mask,
+    size_t* header_size);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageentry_writer_size_of_header(
+    uint16_t message_version, const struct robotraconteurlite_messageentry_header* header, size_t* header_size);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_header(
+    uint16_t message_version, const struct robotraconteurlite_messageelement_header* header, size_t* header_size);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_raw(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t data_len,
+    size_t data_elem_size, size_t* element_size);
+
+/* Adds size to total_size, failing with OUT_OF_RANGE if the total does not fit in a message */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_message_size_add(size_t* total_size, size_t size);
+
+/* Message Template */
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_message_template_init(
+    struct robotraconteurlite_message_template* message_template, uint8_t* data, size_t message_len,
+    struct robotraconteurlite_message_template_slot* slots, size_t slots_len);
+
+/* element_reader must read from the template data */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_message_template_add_slot(
+    struct robotraconteurlite_message_template* message_template,
+    struct robotraconteurlite_messageelement_reader* element_reader, size_t* slot);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_message_template_set_slot(
+    struct robotraconteurlite_message_template* message_template, size_t slot, const void* data, size_t len);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_message_template_set_endpoints(
+    struct robotraconteurlite_message_template* message_template, uint32_t sender_endpoint,
+    uint32_t receiver_endpoint);
+
+/* Begin reading the nested elements of element_reader as fields. Returns MESSAGEELEMENT_TYPE_MISMATCH unless the
+   element is of expected_element_type. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_begin_read_fields(
+    struct robotraconteurlite_messageelement_reader* element_reader, uint16_t expected_element_type,
+    struct robotraconteurlite_messageelement_field_reader* field_reader);
+
+/* Find the field named field_name. The next element is checked first, and the fields are searched from the start
+   only if it does not match. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_field_reader_next(
+    struct robotraconteurlite_messageelement_field_reader* field_reader,
+    const struct robotraconteurlite_string* field_name,
+    struct robotraconteurlite_messageelement_reader* element_reader);
+
+/* Return the next element by position, for the items of pod arrays. Returns NO_MORE after the last element. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_field_reader_next_element(
+    struct robotraconteurlite_messageelement_field_reader* field_reader,
+    struct robotraconteurlite_messageelement_reader* element_reader);
+
+/* Read a NAMEDARRAY_ARRAY element into dest_buf, an array of dest_len namedarrays that are each dest_elem_count
+   numbers of dest_elem_type. dest_len is updated to the number of namedarrays read. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_namedarray_ex(
+    struct robotraconteurlite_messageelement_reader* element_reader, uint8_t* dest_buf, size_t* dest_len,
+    uint16_t dest_elem_type, size_t dest_elem_size, size_t dest_elem_count);
+
+/* Begin the nested element at position index of a pod array or similar container. The element is named with the
+   decimal index, stored in name_storage, which must stay valid until the element ends. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_begin_indexed_element(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    struct robotraconteurlite_messageelement_header* header, uint32_t index, char name_storage[],
+    size_t name_storage_len, struct robotraconteurlite_messageelement_writer* nested_element_writer);
+
+/* Write source_len namedarrays of source_elem_count numbers each as a NAMEDARRAY_ARRAY element */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_write_namedarray_ex(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name, const struct robotraconteurlite_string* element_type_name,
+    const uint8_t* source_buf, size_t source_len, uint16_t source_elem_type, size_t source_elem_size,
+    size_t source_elem_count);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_message_template_set_request_id(
+    struct robotraconteurlite_message_template* message_template, uint32_t request_id);
+
 /* internal use functions */
 
 robotraconteurlite_status robotraconteurlite_messageelement_reader_get_data_info(
@@ -561,15 +892,51 @@ robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_ex(
     struct robotraconteurlite_messageelement_reader* element_reader, uint8_t* dest_buf, size_t* dest_len,
     uint16_t dest_elem_type, size_t dest_elem_size);
 
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_view_ex(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_buffer* dest,
+    uint16_t dest_elem_type, size_t dest_elem_size, size_t dest_elem_align);
+
+/* dest_len and dest_stride are in bytes, source_offset and count are in elements */
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_strided_ex(
+    struct robotraconteurlite_messageelement_reader* element_reader, uint8_t* dest_buf, size_t dest_len,
+    size_t dest_stride, size_t source_offset, size_t count, uint16_t dest_elem_type, size_t dest_elem_size);
+
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_ex(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_uint32* dims,
+    uint8_t* dest_buf, size_t* dest_len, uint16_t dest_elem_type, size_t dest_elem_size);
+
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_view_ex(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_uint32* dims,
+    struct robotraconteurlite_buffer* dest, uint16_t dest_elem_type, size_t dest_elem_size, size_t dest_elem_align);
+
 robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_scalar_ex(
     struct robotraconteurlite_messageelement_reader* element_reader, uint8_t* dest_scalar, uint16_t dest_elem_type,
     size_t dest_elem_size);
 
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_split_ex(
+    struct robotraconteurlite_messageelement_reader* element_reader, uint8_t* real_buf, uint8_t* imag_buf,
+    size_t* dest_len, uint16_t dest_elem_type, size_t dest_elem_size);
+
 robotraconteurlite_status robotraconteurlite_messageelement_writer_write_raw(
     struct robotraconteurlite_messageelement_writer* element_writer,
     const struct robotraconteurlite_string* element_name, const uint8_t* data_buf, size_t data_len, uint16_t data_type,
     size_t data_elem_size);
 
+robotraconteurlite_status robotraconteurlite_messageelement_writer_write_split_ex(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name, const uint8_t* real_buf, const uint8_t* imag_buf,
+    size_t source_len, uint16_t data_type, size_t data_elem_size);
+
+robotraconteurlite_status robotraconteurlite_messageelement_writer_reserve_raw(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name, size_t data_len, uint16_t data_type, size_t data_elem_size,
+    size_t data_elem_align, struct robotraconteurlite_buffer* reserved);
+
+robotraconteurlite_status robotraconteurlite_messageelement_writer_write_multidimarray_ex(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name, const struct robotraconteurlite_array_uint32* dims,
+    const uint8_t* source_buf, size_t source_len, uint16_t source_elem_type, size_t source_elem_size);
+
 #ifdef __cplusplus
 }
 #endif
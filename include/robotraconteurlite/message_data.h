@@ -33,81 +33,177 @@ ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageeleme
 ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_double(
     struct robotraconteurlite_messageelement_reader* element_reader, double* value);
 
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_double_view(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_double* array);
+
 ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_single_array(
     struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_single* array);
 
 ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_single(
     struct robotraconteurlite_messageelement_reader* element_reader, float* value);
 
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_single_view(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_single* array);
+
 ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_int8_array(
     struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_int8* array);
 
 ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_int8(
     struct robotraconteurlite_messageelement_reader* element_reader, int8_t* value);
 
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_int8_view(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_int8* array);
+
 ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_uint8_array(
     struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_uint8* array);
 
 ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_uint8(
     struct robotraconteurlite_messageelement_reader* element_reader, uint8_t* value);
 
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_uint8_view(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_uint8* array);
+
 ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_int16_array(
     struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_int16* array);
 
 ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_int16(
     struct robotraconteurlite_messageelement_reader* element_reader, int16_t* value);
 
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_int16_view(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_int16* array);
+
 ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_uint16_array(
     struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_uint16* array);
 
 ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_uint16(
     struct robotraconteurlite_messageelement_reader* element_reader, uint16_t* value);
 
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_uint16_view(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_uint16* array);
+
 ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_int32_array(
     struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_int32* array);
 
 ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_int32(
     struct robotraconteurlite_messageelement_reader* element_reader, int32_t* value);
 
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_int32_view(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_int32* array);
+
 ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_uint32_array(
     struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_uint32* array);
 
 ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_uint32(
     struct robotraconteurlite_messageelement_reader* element_reader, uint32_t* value);
 
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_uint32_view(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_uint32* array);
+
 ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_int64_array(
     struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_int64* array);
 
 ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_int64(
     struct robotraconteurlite_messageelement_reader* element_reader, int64_t* value);
 
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_int64_view(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_int64* array);
+
 ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_uint64_array(
     struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_uint64* array);
 
 ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_uint64(
     struct robotraconteurlite_messageelement_reader* element_reader, uint64_t* value);
 
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_uint64_view(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_uint64* array);
+
 ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_cdouble_array(
     struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_cdouble* array);
 
 ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_cdouble(
     struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_cdouble* value);
 
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_cdouble_view(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_cdouble* array);
+
 ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_csingle_array(
     struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_csingle* array);
 
 ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_csingle(
     struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_csingle* value);
 
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_csingle_view(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_csingle* array);
+
 ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_bool_array(
     struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_bool* array);
 
 ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_bool(
     struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_bool* value);
 
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_bool_view(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_bool* array);
+
 ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_string(
     struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_string* dest_str);
 
+/* strided */
+
+/* Read count elements starting at element source_offset of the array element into dest, storing element i at
+   dest->data[i * dest_stride]. dest->len is the capacity of dest and is not changed, so the elements can fill a
+   column of a matrix or a sub-range of a larger array. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_double_strided(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_double* dest,
+    size_t dest_stride, size_t source_offset, size_t count);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_single_strided(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_single* dest,
+    size_t dest_stride, size_t source_offset, size_t count);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_int8_strided(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_int8* dest,
+    size_t dest_stride, size_t source_offset, size_t count);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_uint8_strided(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_uint8* dest,
+    size_t dest_stride, size_t source_offset, size_t count);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_int16_strided(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_int16* dest,
+    size_t dest_stride, size_t source_offset, size_t count);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_uint16_strided(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_uint16* dest,
+    size_t dest_stride, size_t source_offset, size_t count);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_int32_strided(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_int32* dest,
+    size_t dest_stride, size_t source_offset, size_t count);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_uint32_strided(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_uint32* dest,
+    size_t dest_stride, size_t source_offset, size_t count);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_int64_strided(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_int64* dest,
+    size_t dest_stride, size_t source_offset, size_t count);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_uint64_strided(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_uint64* dest,
+    size_t dest_stride, size_t source_offset, size_t count);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_cdouble_strided(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_cdouble* dest,
+    size_t dest_stride, size_t source_offset, size_t count);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_csingle_strided(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_csingle* dest,
+    size_t dest_stride, size_t source_offset, size_t count);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_bool_strided(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_bool* dest,
+    size_t dest_stride, size_t source_offset, size_t count);
+
 /* writer */
 
 ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_write_double(
@@ -228,6 +324,349 @@ static robotraconteurlite_status robotraconteurlite_messageelement_writer_write_
     return robotraconteurlite_messageelement_writer_write_data_string(element_writer, &element_name_str, &value_str);
 }
 
+/* reserve */
+
+/* Write the header of an array element of len elements and point array at its data in the send buffer, to be
+   filled in place and committed with robotraconteurlite_messageelement_writer_commit_reserved. Returns NO_VALUE
+   without advancing the writer if the data would straddle buffer segments or be misaligned, in which case the
+   write_<type>_array functions must be used instead. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_reserve_double_array(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name, size_t len, struct robotraconteurlite_array_double* array);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_reserve_single_array(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name, size_t len, struct robotraconteurlite_array_single* array);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_reserve_int8_array(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name, size_t len, struct robotraconteurlite_array_int8* array);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_reserve_uint8_array(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name, size_t len, struct robotraconteurlite_array_uint8* array);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_reserve_int16_array(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name, size_t len, struct robotraconteurlite_array_int16* array);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_reserve_uint16_array(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name, size_t len, struct robotraconteurlite_array_uint16* array);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_reserve_int32_array(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name, size_t len, struct robotraconteurlite_array_int32* array);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_reserve_uint32_array(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name, size_t len, struct robotraconteurlite_array_uint32* array);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_reserve_int64_array(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name, size_t len, struct robotraconteurlite_array_int64* array);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_reserve_uint64_array(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name, size_t len, struct robotraconteurlite_array_uint64* array);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_reserve_cdouble_array(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name, size_t len, struct robotraconteurlite_array_cdouble* array);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_reserve_csingle_array(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name, size_t len, struct robotraconteurlite_array_csingle* array);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_reserve_bool_array(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name, size_t len, struct robotraconteurlite_array_bool* array);
+
+/* complex split */
+
+/* Read a complex array element into separate real and imaginary arrays in one pass over the receive buffer. The
+   lengths of real and imag are their capacities, and both are updated to the number of elements read. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_cdouble_array_split(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_double* real,
+    struct robotraconteurlite_array_double* imag);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_csingle_array_split(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_single* real,
+    struct robotraconteurlite_array_single* imag);
+
+/* Write separate real and imaginary arrays, which must be the same length, as an interleaved complex array */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_write_cdouble_array_split(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name, const struct robotraconteurlite_array_double* real,
+    const struct robotraconteurlite_array_double* imag);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_write_csingle_array_split(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name, const struct robotraconteurlite_array_single* real,
+    const struct robotraconteurlite_array_single* imag);
+
+/* sizes */
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_double(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t* element_size);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_double_array(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t len, size_t* element_size);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_single(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t* element_size);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_single_array(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t len, size_t* element_size);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_int8(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t* element_size);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_int8_array(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t len, size_t* element_size);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_uint8(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t* element_size);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_uint8_array(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t len, size_t* element_size);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_int16(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t* element_size);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_int16_array(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t len, size_t* element_size);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_uint16(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t* element_size);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_uint16_array(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t len, size_t* element_size);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_int32(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t* element_size);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_int32_array(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t len, size_t* element_size);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_uint32(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t* element_size);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_uint32_array(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t len, size_t* element_size);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_int64(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t* element_size);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_int64_array(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t len, size_t* element_size);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_uint64(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t* element_size);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_uint64_array(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t len, size_t* element_size);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_cdouble(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t* element_size);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_cdouble_array(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t len, size_t* element_size);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_csingle(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t* element_size);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_csingle_array(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t len, size_t* element_size);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_bool(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t* element_size);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_bool_array(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t len, size_t* element_size);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_data_string(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name,
+    const struct robotraconteurlite_string* value, size_t* element_size);
+
+/* multidimarrays */
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_double(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_double* array);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status
+robotraconteurlite_messageelement_reader_read_multidimarray_double_view(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_double* array);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_write_multidimarray_double(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name,
+    const struct robotraconteurlite_multidimarray_double* value);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_single(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_single* array);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status
+robotraconteurlite_messageelement_reader_read_multidimarray_single_view(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_single* array);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_write_multidimarray_single(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name,
+    const struct robotraconteurlite_multidimarray_single* value);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_int8(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_int8* array);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_int8_view(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_int8* array);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_write_multidimarray_int8(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name,
+    const struct robotraconteurlite_multidimarray_int8* value);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_uint8(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_uint8* array);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_uint8_view(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_uint8* array);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_write_multidimarray_uint8(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name,
+    const struct robotraconteurlite_multidimarray_uint8* value);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_int16(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_int16* array);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_int16_view(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_int16* array);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_write_multidimarray_int16(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name,
+    const struct robotraconteurlite_multidimarray_int16* value);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_uint16(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_uint16* array);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status
+robotraconteurlite_messageelement_reader_read_multidimarray_uint16_view(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_uint16* array);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_write_multidimarray_uint16(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name,
+    const struct robotraconteurlite_multidimarray_uint16* value);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_int32(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_int32* array);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_int32_view(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_int32* array);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_write_multidimarray_int32(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name,
+    const struct robotraconteurlite_multidimarray_int32* value);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_uint32(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_uint32* array);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status
+robotraconteurlite_messageelement_reader_read_multidimarray_uint32_view(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_uint32* array);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_write_multidimarray_uint32(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name,
+    const struct robotraconteurlite_multidimarray_uint32* value);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_int64(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_int64* array);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_int64_view(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_int64* array);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_write_multidimarray_int64(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name,
+    const struct robotraconteurlite_multidimarray_int64* value);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_uint64(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_uint64* array);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status
+robotraconteurlite_messageelement_reader_read_multidimarray_uint64_view(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_uint64* array);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_write_multidimarray_uint64(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name,
+    const struct robotraconteurlite_multidimarray_uint64* value);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_cdouble(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_cdouble* array);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status
+robotraconteurlite_messageelement_reader_read_multidimarray_cdouble_view(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_cdouble* array);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_write_multidimarray_cdouble(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name,
+    const struct robotraconteurlite_multidimarray_cdouble* value);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_csingle(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_csingle* array);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status
+robotraconteurlite_messageelement_reader_read_multidimarray_csingle_view(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_csingle* array);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_write_multidimarray_csingle(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name,
+    const struct robotraconteurlite_multidimarray_csingle* value);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_bool(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_bool* array);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_bool_view(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_bool* array);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_messageelement_writer_write_multidimarray_bool(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name,
+    const struct robotraconteurlite_multidimarray_bool* value);
+
 #ifdef __cplusplus
 }
 #endif
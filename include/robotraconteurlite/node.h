@@ -21,9 +21,18 @@
 #include "robotraconteurlite/clock.h"
 #include "robotraconteurlite/util.h"
 #include "robotraconteurlite/poll.h"
+#include "robotraconteurlite/member_dispatch.h"
 
 #define ROBOTRACONTEURLITE_NODE_DEFAULT_SLEEP_TIME 5000
 
+/* robotraconteurlite_node_flags */
+#define ROBOTRACONTEURLITE_NODE_FLAGS_NULL 0U
+/* Received header strings are views into the receive buffer, valid until the message is consumed */
+#define ROBOTRACONTEURLITE_NODE_FLAGS_HEADER_STRING_VIEWS 0x1U
+/* Received messages are checked with robotraconteurlite_message_reader_validate before any entry is delivered, and
+   element data reads of the delivered entries use the validated fast path */
+#define ROBOTRACONTEURLITE_NODE_FLAGS_VALIDATE_MESSAGES 0x2U
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -38,7 +47,9 @@ enum robotraconteurlite_event_type
     ROBOTRACONTEURLITE_EVENT_TYPE_MESSAGE_SEND_COMPLETE,
     ROBOTRACONTEURLITE_EVENT_TYPE_NEXT_CYCLE,
     ROBOTRACONTEURLITE_EVENT_TYPE_CONNECTION_HEARTBEAT_TIMEOUT,
-    ROBOTRACONTEURLITE_EVENT_TYPE_CONNECTION_TIMEOUT
+    ROBOTRACONTEURLITE_EVENT_TYPE_CONNECTION_TIMEOUT,
+    ROBOTRACONTEURLITE_EVENT_TYPE_MESSAGE_HEADER_RECEIVED,
+    ROBOTRACONTEURLITE_EVENT_TYPE_MESSAGE_CHUNK_RECEIVED
 };
 
 struct robotraconteurlite_node
@@ -52,6 +63,7 @@ struct robotraconteurlite_node
     struct robotraconteurlite_nodeid nodeid;
     char nodename_char[128];
     struct robotraconteurlite_string nodename;
+    uint32_t node_flags;
 
     /* Event information */
     size_t events_serviced;
@@ -73,6 +85,7 @@ struct robotraconteurlite_node_send_messageentry_data
     struct robotraconteurlite_messageentry_header message_entry_header_storage;
     struct robotraconteurlite_buffer buffer_storage;
     struct robotraconteurlite_buffer_vec buffer_vec_storage;
+    uint32_t batch_max_entries;
 };
 
 struct robotraconteurlite_node_receive_messageentry_data
@@ -84,8 +97,11 @@ struct robotraconteurlite_node_receive_messageentry_data
     struct robotraconteurlite_message_header received_message_header;
     struct robotraconteurlite_messageentry_header received_message_entry_header;
     struct robotraconteurlite_messageentry_reader entry_reader;
+    /* Index of the current entry, less than received_message_header.entry_count */
+    uint32_t entry_index;
     /* Internal */
-    struct robotraconteurlite_buffer buffer_storage;
+    /* A streamed message spans the receive buffer and the stream sink */
+    struct robotraconteurlite_buffer buffer_storage[2];
     struct robotraconteurlite_buffer_vec buffer_vec_storage;
     char receiver_nodename_char[128];
     char sender_nodename_char[128];
@@ -133,6 +149,7 @@ enum robotraconteurlite_client_handshake_state
 
 #define ROBOTRACONTEURLITE_CONNECTION_PARSE_CAPABILITY_MESSAGE2 0x1U
 #define ROBOTRACONTEURLITE_CONNECTION_PARSE_CAPABILITY_MESSAGE4 0x2U
+#define ROBOTRACONTEURLITE_CONNECTION_PARSE_CAPABILITY_STRING_TABLE4 0x4U
 
 struct robotraconteurlite_client_handshake_data
 {
@@ -178,9 +195,43 @@ robotraconteurlite_node_end_send_messageentry(struct robotraconteurlite_node_sen
 ROBOTRACONTEURLITE_API robotraconteurlite_status
 robotraconteurlite_node_abort_send_messageentry(struct robotraconteurlite_node_send_messageentry_data* send_data);
 
+/* Begin a message holding up to max_entries entries. Each entry is written between
+   robotraconteurlite_node_batch_begin_messageentry() and robotraconteurlite_node_batch_end_messageentry(), and the
+   message is sent by robotraconteurlite_node_end_send_messageentry_batch(). The send buffer is in use until the batch
+   ends, so no other message may be sent on the connection in between. A batch holds a single entry if the peer does
+   not accept multiple entries. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_node_begin_send_messageentry_batch(
+    struct robotraconteurlite_node_send_messageentry_data* send_data, uint32_t max_entries);
+
+/* Begin an entry using send_data->message_entry_header. Returns OUT_OF_RANGE if the batch is full. An entry that
+   fails while being written is discarded by beginning the next entry or ending the batch. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status
+robotraconteurlite_node_batch_begin_messageentry(struct robotraconteurlite_node_send_messageentry_data* send_data);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_node_batch_begin_messageentry_response(
+    struct robotraconteurlite_node_send_messageentry_data* send_data,
+    struct robotraconteurlite_messageentry_header* request_message_entry_header);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status
+robotraconteurlite_node_batch_end_messageentry(struct robotraconteurlite_node_send_messageentry_data* send_data);
+
+/* Send the batch. Returns NO_MORE and releases the send buffer if the batch is empty. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status
+robotraconteurlite_node_end_send_messageentry_batch(struct robotraconteurlite_node_send_messageentry_data* send_data);
+
 ROBOTRACONTEURLITE_API robotraconteurlite_status
 robotraconteurlite_node_receive_messageentry(struct robotraconteurlite_node_receive_messageentry_data* receive_data);
 
+/* Read the message and first entry headers of a partly received message for the MESSAGE_HEADER_RECEIVED event. The
+   entry elements cannot be read until the message received event. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_node_receive_messageentry_header(
+    struct robotraconteurlite_node_receive_messageentry_data* receive_data);
+
+/* Move to the next entry of a multiple entry message, reading its header into received_message_entry_header. Returns
+   NO_MORE after the last entry. Entries passed over here are not delivered again as separate events. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_node_receive_messageentry_move_next(
+    struct robotraconteurlite_node_receive_messageentry_data* receive_data);
+
 ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_node_receive_messageentry_consume(
     struct robotraconteurlite_node_receive_messageentry_data* receive_data);
 
@@ -209,6 +260,16 @@ ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_node_event_s
 ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_event_is_member(
     struct robotraconteurlite_event* event, const char* service_path, const char* member_name);
 
+/* Compare only the member name of a received message, for handlers that do not need the service path */
+ROBOTRACONTEURLITE_API robotraconteurlite_status
+robotraconteurlite_event_is_member_name(struct robotraconteurlite_event* event, const char* member_name);
+
+/* Resolve a received message to the handler_id of its dispatch entry with one hash lookup. Fails with KEY_NOT_FOUND
+   if no entry matches. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_event_find_member_handler(
+    struct robotraconteurlite_event* event, const struct robotraconteurlite_member_dispatch* dispatch,
+    uint32_t* handler_id);
+
 ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_client_is_connected(
     struct robotraconteurlite_node* node, struct robotraconteurlite_connection* connection);
 
@@ -233,6 +294,12 @@ ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_client_end_r
 ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_client_send_heartbeat(
     struct robotraconteurlite_node* node, struct robotraconteurlite_connection* connection);
 
+/* Send up to ROBOTRACONTEURLITE_STRING_TABLE_OP_MAX_ENTRIES unconfirmed entries of connection->send_string_table to
+   the peer. Entries are confirmed, and sent as codes, once the peer replies. Returns NO_MORE if there is nothing to
+   send, and INVALID_OPERATION if string tables were not negotiated for the connection. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_node_send_string_table_update(
+    struct robotraconteurlite_node* node, struct robotraconteurlite_connection* connection);
+
 ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_node_next_wake(
     struct robotraconteurlite_node* node, robotraconteurlite_timespec now, robotraconteurlite_timespec* wake_time);
 
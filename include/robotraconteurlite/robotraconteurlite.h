@@ -21,9 +21,11 @@
 #include "robotraconteurlite/config.h"
 #include "robotraconteurlite/connection.h"
 #include "robotraconteurlite/err.h"
+#include "robotraconteurlite/member_dispatch.h"
 #include "robotraconteurlite/message.h"
 #include "robotraconteurlite/node.h"
 #include "robotraconteurlite/nodeid.h"
+#include "robotraconteurlite/string_table.h"
 #include "robotraconteurlite/tcp_transport.h"
 #include "robotraconteurlite/util.h"
 
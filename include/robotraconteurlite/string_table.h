@@ -0,0 +1,132 @@
+/* Copyright 2011-2024 Wason Technology, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ROBOTRACONTEURLITE_STRING_TABLE_H
+#define ROBOTRACONTEURLITE_STRING_TABLE_H
+
+#include <stdint.h>
+#include "robotraconteurlite/config.h"
+#include "robotraconteurlite/err.h"
+#include "robotraconteurlite/array.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* String table entry flags */
+#define ROBOTRACONTEURLITE_STRING_TABLE_ENTRY_FLAGS_NULL 0U
+#define ROBOTRACONTEURLITE_STRING_TABLE_ENTRY_FLAGS_CONFIRMED 0x1U
+
+/* Maximum number of strings carried by one STRINGTABLEOP request */
+#define ROBOTRACONTEURLITE_STRING_TABLE_OP_MAX_ENTRIES 32U
+
+struct robotraconteurlite_string_table_entry
+{
+    uint32_t code;
+    uint32_t flags;
+    struct robotraconteurlite_string value;
+};
+
+/* Fixed capacity table mapping codes to strings. Strings are copied into string_storage. */
+struct robotraconteurlite_string_table
+{
+    struct robotraconteurlite_string_table_entry* entries;
+    size_t entries_len;
+    size_t entries_count;
+    char* string_storage;
+    size_t string_storage_len;
+    size_t string_storage_used;
+};
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_string_table_init(
+    struct robotraconteurlite_string_table* table, struct robotraconteurlite_string_table_entry* entries,
+    size_t entries_len, char* string_storage, size_t string_storage_len);
+
+/* Codes must be non-zero. Adding an existing code with the same string succeeds, a different string fails with
+   INVALID_PARAMETER. Fails with OUT_OF_RANGE when the entries or string storage are full. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_string_table_add(
+    struct robotraconteurlite_string_table* table, uint32_t code, const struct robotraconteurlite_string* value);
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status
+robotraconteurlite_string_table_confirm(struct robotraconteurlite_string_table* table, uint32_t code);
+
+/* Marks all entries as not confirmed, used when a connection is reset */
+ROBOTRACONTEURLITE_API void
+robotraconteurlite_string_table_clear_confirmed(struct robotraconteurlite_string_table* table);
+
+/* Removes all entries */
+ROBOTRACONTEURLITE_API void robotraconteurlite_string_table_clear(struct robotraconteurlite_string_table* table);
+
+/* Find the code for value. Only confirmed entries are considered if confirmed_only is non-zero. Fails with
+   KEY_NOT_FOUND if no entry matches. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_string_table_find_code(
+    const struct robotraconteurlite_string_table* table, const struct robotraconteurlite_string* value,
+    uint8_t confirmed_only, uint32_t* code);
+
+/* Find the string for code. value references the table storage. Fails with KEY_NOT_FOUND if no entry matches. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_string_table_find_string(
+    const struct robotraconteurlite_string_table* table, uint32_t code, struct robotraconteurlite_string* value);
+
+/* Interned string slot. value.len is zero for a free slot. */
+struct robotraconteurlite_string_intern_entry
+{
+    uint32_t hash;
+    struct robotraconteurlite_string value;
+};
+
+/* Fixed capacity open addressing table mapping strings to small integer ids, so names seen on the wire can be compared
+   as integers. The id is the slot index, so it is less than entries_len and stays valid until the table is cleared.
+   Strings are copied into string_storage. */
+struct robotraconteurlite_string_intern
+{
+    struct robotraconteurlite_string_intern_entry* entries;
+    size_t entries_len;
+    size_t entries_count;
+    char* string_storage;
+    size_t string_storage_len;
+    size_t string_storage_used;
+};
+
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_string_intern_init(
+    struct robotraconteurlite_string_intern* intern, struct robotraconteurlite_string_intern_entry* entries,
+    size_t entries_len, char* string_storage, size_t string_storage_len);
+
+/* Find or add value and return its id. Fails with INVALID_PARAMETER for an empty string and OUT_OF_RANGE when the
+   entries or string storage are full. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_string_intern_add(
+    struct robotraconteurlite_string_intern* intern, const struct robotraconteurlite_string* value, uint32_t* id);
+
+/* Find the id of value. Fails with KEY_NOT_FOUND if value has not been added. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_string_intern_find(
+    const struct robotraconteurlite_string_intern* intern, const struct robotraconteurlite_string* value, uint32_t* id);
+
+/* Find the id of the len bytes at source_pos in a buffer_vec without copying them out of the buffer. Fails with
+   KEY_NOT_FOUND if the string has not been added. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_string_intern_find_buffer_vec(
+    const struct robotraconteurlite_string_intern* intern, const struct robotraconteurlite_buffer_vec* source,
+    size_t source_pos, size_t len, uint32_t* id);
+
+/* Get the string for id. value references the table storage. Fails with KEY_NOT_FOUND for an unused id. */
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_string_intern_get_string(
+    const struct robotraconteurlite_string_intern* intern, uint32_t id, struct robotraconteurlite_string* value);
+
+/* Removes all strings. Previously returned ids are no longer valid. */
+ROBOTRACONTEURLITE_API void robotraconteurlite_string_intern_clear(struct robotraconteurlite_string_intern* intern);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ROBOTRACONTEURLITE_STRING_TABLE_H */
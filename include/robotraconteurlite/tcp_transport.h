@@ -161,6 +161,9 @@ ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_tcp_socket_s
                                                                                                 size_t* pos, size_t len,
                                                                                                 int* errno_out);
 
+ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_tcp_socket_sendv_nonblocking(
+    int sock, const struct robotraconteurlite_buffer_vec* buffers, size_t* pos, size_t len, int* errno_out);
+
 ROBOTRACONTEURLITE_API robotraconteurlite_status robotraconteurlite_tcp_socket_begin_server(
     const struct sockaddr_storage* serv_addr, size_t backlog, int* sock_out, int* errno_out);
 
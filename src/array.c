@@ -16,6 +16,9 @@
 #include <robotraconteurlite/robotraconteurlite.h>
 #include <string.h>
 #include <assert.h>
+#include "robotraconteurlite/util.h"
+
+#define FAILED ROBOTRACONTEURLITE_FAILED
 
 robotraconteurlite_status robotraconteurlite_buffer_init_scalar(struct robotraconteurlite_buffer* buffer, void* data,
                                                                 size_t len)
@@ -363,6 +366,117 @@ robotraconteurlite_status robotraconteurlite_buffer_vec_copy_to_mem(const struct
                                                      dest_pos, dest_elem_size, dest_count);
 }
 
+/* Store n contiguous elements at a stride. The fixed size cases compile to single loads and stores. */
+static void robotraconteurlite_buffer_scatter(const uint8_t* source, uint8_t* dest, size_t dest_stride,
+                                              size_t elem_size, size_t n)
+{
+    size_t i = 0;
+    switch (elem_size)
+    {
+    case 1:
+        for (i = 0; i < n; i++)
+        {
+            dest[i * dest_stride] = source[i];
+        }
+        break;
+    case 2:
+        for (i = 0; i < n; i++)
+        {
+            (void)memcpy(&dest[i * dest_stride], &source[i * 2U], 2U);
+        }
+        break;
+    case 4:
+        for (i = 0; i < n; i++)
+        {
+            (void)memcpy(&dest[i * dest_stride], &source[i * 4U], 4U);
+        }
+        break;
+    case 8:
+        for (i = 0; i < n; i++)
+        {
+            (void)memcpy(&dest[i * dest_stride], &source[i * 8U], 8U);
+        }
+        break;
+    default:
+        for (i = 0; i < n; i++)
+        {
+            (void)memcpy(&dest[i * dest_stride], &source[i * elem_size], elem_size);
+        }
+        break;
+    }
+}
+
+robotraconteurlite_status robotraconteurlite_buffer_vec_copy_to_mem_strided(
+    const struct robotraconteurlite_buffer_vec* source, size_t source_pos, uint8_t* dest, size_t dest_len,
+    size_t dest_stride, size_t elem_size, size_t count)
+{
+    struct robotraconteurlite_buffer_vec_cursor cursor;
+    struct robotraconteurlite_buffer span;
+    size_t done = 0;
+    size_t n = 0;
+    robotraconteurlite_status rv = -1;
+
+    assert(source != NULL);
+    assert(dest != NULL);
+
+    if (count == 0U)
+    {
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    }
+
+    if ((elem_size == 0U) || (dest_stride < elem_size))
+    {
+        return ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER;
+    }
+
+    if ((elem_size > dest_len) || ((count - 1U) > ((dest_len - elem_size) / dest_stride)))
+    {
+        return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+    }
+
+    rv = robotraconteurlite_buffer_vec_cursor_init(&cursor, source);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    if ((source_pos > cursor.total_len) || (count > ((cursor.total_len - source_pos) / elem_size)))
+    {
+        return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+    }
+
+    while (done < count)
+    {
+        rv = robotraconteurlite_buffer_vec_cursor_peek(&cursor, source_pos, &span);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+
+        n = span.len / elem_size;
+        n = (n < (count - done)) ? n : (count - done);
+        if (n == 0U)
+        {
+            /* The element straddles segments, the cursor assembles it in place */
+            n = 1U;
+            rv = robotraconteurlite_buffer_vec_cursor_read(&cursor, source_pos, &dest[done * dest_stride], elem_size);
+            if (FAILED(rv))
+            {
+                return rv;
+            }
+        }
+        else
+        {
+            robotraconteurlite_buffer_scatter(span.data, &dest[done * dest_stride], dest_stride, elem_size, n);
+        }
+
+        done += n;
+        source_pos += n * elem_size;
+    }
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
 robotraconteurlite_status robotraconteurlite_buffer_vec_copy_from_mem(struct robotraconteurlite_buffer_vec* dest,
                                                                       size_t dest_pos, const uint8_t* source,
                                                                       size_t source_len, size_t source_pos,
@@ -383,6 +497,252 @@ robotraconteurlite_status robotraconteurlite_buffer_vec_copy_from_mem(struct rob
                                                      dest_pos, 1, source_count * source_elem_size);
 }
 
+robotraconteurlite_status robotraconteurlite_buffer_vec_get_span(const struct robotraconteurlite_buffer_vec* source,
+                                                                 size_t source_pos, size_t len,
+                                                                 struct robotraconteurlite_buffer* span)
+{
+    size_t i = 0;
+    size_t seg_pos = source_pos;
+
+    assert(source != NULL);
+    assert(span != NULL);
+
+    /* Find the segment containing source_pos. Returns NO_VALUE if the range straddles segments. */
+    for (i = 0; i < source->buffer_vec_cnt; i++)
+    {
+        const struct robotraconteurlite_buffer* seg = &source->buffer_vec[i];
+        if (seg_pos < seg->len)
+        {
+            if (len > (seg->len - seg_pos))
+            {
+                return ROBOTRACONTEURLITE_ERROR_NO_VALUE;
+            }
+            span->data = &seg->data[seg_pos];
+            span->len = len;
+            return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+        }
+        if ((seg_pos == seg->len) && (len == 0U))
+        {
+            span->data = &seg->data[seg_pos];
+            span->len = 0;
+            return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+        }
+        seg_pos -= seg->len;
+    }
+
+    return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+}
+
+robotraconteurlite_status robotraconteurlite_buffer_vec_cursor_init(
+    struct robotraconteurlite_buffer_vec_cursor* cursor, const struct robotraconteurlite_buffer_vec* buffer_vec)
+{
+    size_t i = 0;
+
+    assert(cursor != NULL);
+    assert(buffer_vec != NULL);
+
+    cursor->buffer_vec = buffer_vec;
+    cursor->total_len = 0;
+    for (i = 0; i < buffer_vec->buffer_vec_cnt; i++)
+    {
+        cursor->total_len += buffer_vec->buffer_vec[i].len;
+    }
+    cursor->pos = 0;
+    cursor->segment = 0;
+    cursor->segment_pos = 0;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+static robotraconteurlite_status robotraconteurlite_buffer_vec_cursor_check_range(
+    struct robotraconteurlite_buffer_vec_cursor* cursor, size_t pos, size_t len)
+{
+    size_t i = 0;
+
+    if ((len <= cursor->total_len) && (pos <= (cursor->total_len - len)))
+    {
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    }
+
+    /* Segments may have been appended since the cursor was initialized, refresh the cached length */
+    cursor->total_len = 0;
+    for (i = 0; i < cursor->buffer_vec->buffer_vec_cnt; i++)
+    {
+        cursor->total_len += cursor->buffer_vec->buffer_vec[i].len;
+    }
+
+    if ((len > cursor->total_len) || (pos > (cursor->total_len - len)))
+    {
+        return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+    }
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status robotraconteurlite_buffer_vec_cursor_seek(struct robotraconteurlite_buffer_vec_cursor* cursor,
+                                                                    size_t pos)
+{
+    const struct robotraconteurlite_buffer_vec* buffer_vec = NULL;
+    size_t segment = 0;
+    size_t segment_start = 0;
+    robotraconteurlite_status rv = -1;
+
+    assert(cursor != NULL);
+    assert(cursor->buffer_vec != NULL);
+
+    rv = robotraconteurlite_buffer_vec_cursor_check_range(cursor, pos, 0);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    buffer_vec = cursor->buffer_vec;
+    segment = cursor->segment;
+    segment_start = cursor->pos - cursor->segment_pos;
+
+    /* Seeking backwards before the current segment restarts from the first segment */
+    if (pos < segment_start)
+    {
+        segment = 0;
+        segment_start = 0;
+    }
+
+    while (((segment + 1U) < buffer_vec->buffer_vec_cnt) &&
+           ((pos - segment_start) >= buffer_vec->buffer_vec[segment].len))
+    {
+        segment_start += buffer_vec->buffer_vec[segment].len;
+        segment++;
+    }
+
+    cursor->pos = pos;
+    cursor->segment = segment;
+    cursor->segment_pos = pos - segment_start;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status robotraconteurlite_buffer_vec_cursor_read(struct robotraconteurlite_buffer_vec_cursor* cursor,
+                                                                    size_t pos, void* dest, size_t len)
+{
+    /* cppcheck-suppress misra-c2012-11.5 */
+    uint8_t* dest1 = (uint8_t*)dest;
+    size_t done = 0;
+    robotraconteurlite_status rv = -1;
+
+    assert(cursor != NULL);
+    assert((dest != NULL) || (len == 0U));
+
+    rv = robotraconteurlite_buffer_vec_cursor_check_range(cursor, pos, len);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    rv = robotraconteurlite_buffer_vec_cursor_seek(cursor, pos);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    while (done < len)
+    {
+        const struct robotraconteurlite_buffer* segment = &cursor->buffer_vec->buffer_vec[cursor->segment];
+        size_t delta = segment->len - cursor->segment_pos;
+        if (delta == 0U)
+        {
+            cursor->segment++;
+            cursor->segment_pos = 0;
+            continue;
+        }
+        delta = ((len - done) < delta) ? (len - done) : delta;
+
+        assert(segment->data != NULL);
+        (void)memcpy(&dest1[done], &segment->data[cursor->segment_pos], delta);
+
+        done += delta;
+        cursor->segment_pos += delta;
+        cursor->pos += delta;
+    }
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status robotraconteurlite_buffer_vec_cursor_peek(struct robotraconteurlite_buffer_vec_cursor* cursor,
+                                                                    size_t pos, struct robotraconteurlite_buffer* span)
+{
+    const struct robotraconteurlite_buffer* segment = NULL;
+    robotraconteurlite_status rv = -1;
+
+    assert(cursor != NULL);
+    assert(span != NULL);
+
+    rv = robotraconteurlite_buffer_vec_cursor_seek(cursor, pos);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    span->data = NULL;
+    span->len = 0;
+    if (cursor->segment >= cursor->buffer_vec->buffer_vec_cnt)
+    {
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    }
+
+    segment = &cursor->buffer_vec->buffer_vec[cursor->segment];
+    if ((segment->data == NULL) || (cursor->segment_pos >= segment->len))
+    {
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    }
+
+    span->data = &segment->data[cursor->segment_pos];
+    span->len = segment->len - cursor->segment_pos;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status robotraconteurlite_buffer_vec_cursor_write(
+    struct robotraconteurlite_buffer_vec_cursor* cursor, size_t pos, const void* source, size_t len)
+{
+    /* cppcheck-suppress misra-c2012-11.5 */
+    const uint8_t* source1 = (const uint8_t*)source;
+    size_t done = 0;
+    robotraconteurlite_status rv = -1;
+
+    assert(cursor != NULL);
+    assert((source != NULL) || (len == 0U));
+
+    rv = robotraconteurlite_buffer_vec_cursor_check_range(cursor, pos, len);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    rv = robotraconteurlite_buffer_vec_cursor_seek(cursor, pos);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    while (done < len)
+    {
+        const struct robotraconteurlite_buffer* segment = &cursor->buffer_vec->buffer_vec[cursor->segment];
+        size_t delta = segment->len - cursor->segment_pos;
+        if (delta == 0U)
+        {
+            cursor->segment++;
+            cursor->segment_pos = 0;
+            continue;
+        }
+        delta = ((len - done) < delta) ? (len - done) : delta;
+
+        assert(segment->data != NULL);
+        (void)memcpy(&segment->data[cursor->segment_pos], &source1[done], delta);
+
+        done += delta;
+        cursor->segment_pos += delta;
+        cursor->pos += delta;
+    }
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
 /* string */
 robotraconteurlite_status robotraconteurlite_buffer_vec_copy_to_string(
     const struct robotraconteurlite_buffer_vec* source_buf, size_t source_buf_pos,
@@ -427,28 +787,87 @@ robotraconteurlite_status robotraconteurlite_string_cmp(const struct robotracont
     return memcmp(str1->data, str2->data, str1->len);
 }
 
-uint32_t robotraconteurlite_string_hash(const struct robotraconteurlite_string* str)
+/* 32-bit FNV-1a, updated incrementally so segmented strings hash the same as contiguous strings */
+#define ROBOTRACONTEURLITE_STRING_HASH_OFFSET 2166136261U
+#define ROBOTRACONTEURLITE_STRING_HASH_PRIME 16777619U
+
+static uint32_t robotraconteurlite_string_hash_update(uint32_t hash, const uint8_t* data, size_t len)
 {
+    uint32_t h = hash;
+    size_t i = 0;
 
-    uint32_t str_len = 0;
+    for (i = 0; i < len; i++)
+    {
+        h ^= (uint32_t)data[i];
+        h *= ROBOTRACONTEURLITE_STRING_HASH_PRIME;
+    }
+    return h;
+}
 
+static uint32_t robotraconteurlite_string_hash_final(uint32_t hash)
+{
+    /* FNV-1a mixes the high bits poorly for short keys, finish with the murmur3 avalanche so that hash modulo a
+       table size is well distributed */
+    uint32_t h = hash;
+    h ^= h >> 16U;
+    h *= 0x85EBCA6BU;
+    h ^= h >> 13U;
+    h *= 0xC2B2AE35U;
+    h ^= h >> 16U;
+    return h;
+}
+
+uint32_t robotraconteurlite_string_hash(const struct robotraconteurlite_string* str)
+{
     assert(str != NULL);
-    assert(str->data != NULL);
+    assert((str->data != NULL) || (str->len == 0U));
 
-    str_len = (uint32_t)str->len;
+    /* cppcheck-suppress misra-c2012-11.3 */
+    return robotraconteurlite_string_hash_final(robotraconteurlite_string_hash_update(
+        ROBOTRACONTEURLITE_STRING_HASH_OFFSET, (const uint8_t*)str->data, str->len));
+}
 
-    switch (str_len)
+robotraconteurlite_status robotraconteurlite_buffer_vec_string_hash(const struct robotraconteurlite_buffer_vec* source,
+                                                                    size_t source_pos, size_t len, uint32_t* hash)
+{
+    /* Same result as robotraconteurlite_string_hash() for a string stored in a buffer_vec, hashed in place one
+       segment at a time */
+    struct robotraconteurlite_buffer_vec_cursor cursor;
+    uint32_t h = ROBOTRACONTEURLITE_STRING_HASH_OFFSET;
+    size_t done = 0;
+    robotraconteurlite_status rv = -1;
+
+    assert(source != NULL);
+    assert(hash != NULL);
+
+    rv = robotraconteurlite_buffer_vec_cursor_init(&cursor, source);
+    if (FAILED(rv))
     {
-    case 0:
-        return 0;
-    case 1:
-        return (str_len & 0xFFFFU) | ((uint32_t)str->data[0] << 24);
-    case 2:
-        return (str_len & 0xFFFFU) | ((uint32_t)str->data[0] << 24) | ((uint32_t)str->data[str_len - 1U] << 16);
-    default:
-        return (str_len & 0xFFFFU) | ((uint32_t)str->data[0] << 24) |
-               (((uint32_t)str->data[str_len - 1U] ^ (uint32_t)str->data[str_len - 2U]) << 16);
+        return rv;
+    }
+
+    while (done < len)
+    {
+        struct robotraconteurlite_buffer span;
+        rv = robotraconteurlite_buffer_vec_cursor_peek(&cursor, source_pos + done, &span);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+        if (span.len == 0U)
+        {
+            return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+        }
+        if (span.len > (len - done))
+        {
+            span.len = len - done;
+        }
+        h = robotraconteurlite_string_hash_update(h, span.data, span.len);
+        done += span.len;
     }
+
+    *hash = robotraconteurlite_string_hash_final(h);
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
 }
 
 robotraconteurlite_status robotraconteurlite_string_copy_to(const struct robotraconteurlite_string* source,
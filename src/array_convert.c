@@ -0,0 +1,1846 @@
+/* Copyright 2011-2024 Wason Technology, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <robotraconteurlite/robotraconteurlite.h>
+#include <string.h>
+#include <assert.h>
+
+/* Conversion kernels. Elements are loaded and stored with fixed size memcpy so the source and destination may be
+   unaligned, and the loops are branch free so the compiler can vectorize them. */
+
+static void robotraconteurlite_convert_double_to_double(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        double v;
+        double r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (double)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_double_to_single(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        double v;
+        float r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (float)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_double_to_int8(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        double v;
+        int8_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v != v) ? 0 : ((v <= (double)INT8_MIN) ? INT8_MIN : ((v >= (double)INT8_MAX) ? INT8_MAX : (int8_t)v));
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_double_to_uint8(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        double v;
+        uint8_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v != v) ? 0 : ((v <= (double)0) ? 0 : ((v >= (double)UINT8_MAX) ? UINT8_MAX : (uint8_t)v));
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_double_to_int16(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        double v;
+        int16_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v != v) ? 0 : ((v <= (double)INT16_MIN) ? INT16_MIN : ((v >= (double)INT16_MAX) ? INT16_MAX : (int16_t)v));
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_double_to_uint16(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        double v;
+        uint16_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v != v) ? 0 : ((v <= (double)0) ? 0 : ((v >= (double)UINT16_MAX) ? UINT16_MAX : (uint16_t)v));
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_double_to_int32(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        double v;
+        int32_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v != v) ? 0 : ((v <= (double)INT32_MIN) ? INT32_MIN : ((v >= (double)INT32_MAX) ? INT32_MAX : (int32_t)v));
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_double_to_uint32(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        double v;
+        uint32_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v != v) ? 0 : ((v <= (double)0) ? 0 : ((v >= (double)UINT32_MAX) ? UINT32_MAX : (uint32_t)v));
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_double_to_int64(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        double v;
+        int64_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v != v) ? 0 : ((v <= (double)INT64_MIN) ? INT64_MIN : ((v >= (double)INT64_MAX) ? INT64_MAX : (int64_t)v));
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_double_to_uint64(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        double v;
+        uint64_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v != v) ? 0 : ((v <= (double)0) ? 0 : ((v >= (double)UINT64_MAX) ? UINT64_MAX : (uint64_t)v));
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_single_to_double(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        float v;
+        double r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (double)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_single_to_single(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        float v;
+        float r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (float)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_single_to_int8(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        float v;
+        int8_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v != v) ? 0 : ((v <= (float)INT8_MIN) ? INT8_MIN : ((v >= (float)INT8_MAX) ? INT8_MAX : (int8_t)v));
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_single_to_uint8(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        float v;
+        uint8_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v != v) ? 0 : ((v <= (float)0) ? 0 : ((v >= (float)UINT8_MAX) ? UINT8_MAX : (uint8_t)v));
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_single_to_int16(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        float v;
+        int16_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v != v) ? 0 : ((v <= (float)INT16_MIN) ? INT16_MIN : ((v >= (float)INT16_MAX) ? INT16_MAX : (int16_t)v));
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_single_to_uint16(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        float v;
+        uint16_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v != v) ? 0 : ((v <= (float)0) ? 0 : ((v >= (float)UINT16_MAX) ? UINT16_MAX : (uint16_t)v));
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_single_to_int32(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        float v;
+        int32_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v != v) ? 0 : ((v <= (float)INT32_MIN) ? INT32_MIN : ((v >= (float)INT32_MAX) ? INT32_MAX : (int32_t)v));
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_single_to_uint32(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        float v;
+        uint32_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v != v) ? 0 : ((v <= (float)0) ? 0 : ((v >= (float)UINT32_MAX) ? UINT32_MAX : (uint32_t)v));
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_single_to_int64(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        float v;
+        int64_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v != v) ? 0 : ((v <= (float)INT64_MIN) ? INT64_MIN : ((v >= (float)INT64_MAX) ? INT64_MAX : (int64_t)v));
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_single_to_uint64(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        float v;
+        uint64_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v != v) ? 0 : ((v <= (float)0) ? 0 : ((v >= (float)UINT64_MAX) ? UINT64_MAX : (uint64_t)v));
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_int8_to_double(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        int8_t v;
+        double r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (double)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_int8_to_single(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        int8_t v;
+        float r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (float)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_int8_to_int8(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        int8_t v;
+        int8_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (int8_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_int8_to_uint8(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        int8_t v;
+        uint8_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v < 0) ? 0 : (uint8_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_int8_to_int16(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        int8_t v;
+        int16_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (int16_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_int8_to_uint16(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        int8_t v;
+        uint16_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v < 0) ? 0 : (uint16_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_int8_to_int32(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        int8_t v;
+        int32_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (int32_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_int8_to_uint32(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        int8_t v;
+        uint32_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v < 0) ? 0 : (uint32_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_int8_to_int64(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        int8_t v;
+        int64_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (int64_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_int8_to_uint64(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        int8_t v;
+        uint64_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v < 0) ? 0 : (uint64_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_uint8_to_double(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        uint8_t v;
+        double r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (double)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_uint8_to_single(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        uint8_t v;
+        float r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (float)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_uint8_to_int8(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        uint8_t v;
+        int8_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v > (uint8_t)INT8_MAX) ? INT8_MAX : (int8_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_uint8_to_uint8(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        uint8_t v;
+        uint8_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (uint8_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_uint8_to_int16(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        uint8_t v;
+        int16_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (int16_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_uint8_to_uint16(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        uint8_t v;
+        uint16_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (uint16_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_uint8_to_int32(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        uint8_t v;
+        int32_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (int32_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_uint8_to_uint32(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        uint8_t v;
+        uint32_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (uint32_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_uint8_to_int64(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        uint8_t v;
+        int64_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (int64_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_uint8_to_uint64(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        uint8_t v;
+        uint64_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (uint64_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_int16_to_double(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        int16_t v;
+        double r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (double)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_int16_to_single(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        int16_t v;
+        float r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (float)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_int16_to_int8(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        int16_t v;
+        int8_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v < (int16_t)INT8_MIN) ? INT8_MIN : ((v > (int16_t)INT8_MAX) ? INT8_MAX : (int8_t)v);
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_int16_to_uint8(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        int16_t v;
+        uint8_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v < 0) ? 0 : ((v > (int16_t)UINT8_MAX) ? UINT8_MAX : (uint8_t)v);
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_int16_to_int16(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        int16_t v;
+        int16_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (int16_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_int16_to_uint16(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        int16_t v;
+        uint16_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v < 0) ? 0 : (uint16_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_int16_to_int32(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        int16_t v;
+        int32_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (int32_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_int16_to_uint32(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        int16_t v;
+        uint32_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v < 0) ? 0 : (uint32_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_int16_to_int64(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        int16_t v;
+        int64_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (int64_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_int16_to_uint64(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        int16_t v;
+        uint64_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v < 0) ? 0 : (uint64_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_uint16_to_double(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        uint16_t v;
+        double r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (double)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_uint16_to_single(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        uint16_t v;
+        float r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (float)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_uint16_to_int8(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        uint16_t v;
+        int8_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v > (uint16_t)INT8_MAX) ? INT8_MAX : (int8_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_uint16_to_uint8(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        uint16_t v;
+        uint8_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v > (uint16_t)UINT8_MAX) ? UINT8_MAX : (uint8_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_uint16_to_int16(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        uint16_t v;
+        int16_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v > (uint16_t)INT16_MAX) ? INT16_MAX : (int16_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_uint16_to_uint16(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        uint16_t v;
+        uint16_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (uint16_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_uint16_to_int32(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        uint16_t v;
+        int32_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (int32_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_uint16_to_uint32(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        uint16_t v;
+        uint32_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (uint32_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_uint16_to_int64(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        uint16_t v;
+        int64_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (int64_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_uint16_to_uint64(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        uint16_t v;
+        uint64_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (uint64_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_int32_to_double(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        int32_t v;
+        double r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (double)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_int32_to_single(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        int32_t v;
+        float r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (float)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_int32_to_int8(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        int32_t v;
+        int8_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v < (int32_t)INT8_MIN) ? INT8_MIN : ((v > (int32_t)INT8_MAX) ? INT8_MAX : (int8_t)v);
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_int32_to_uint8(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        int32_t v;
+        uint8_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v < 0) ? 0 : ((v > (int32_t)UINT8_MAX) ? UINT8_MAX : (uint8_t)v);
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_int32_to_int16(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        int32_t v;
+        int16_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v < (int32_t)INT16_MIN) ? INT16_MIN : ((v > (int32_t)INT16_MAX) ? INT16_MAX : (int16_t)v);
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_int32_to_uint16(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        int32_t v;
+        uint16_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v < 0) ? 0 : ((v > (int32_t)UINT16_MAX) ? UINT16_MAX : (uint16_t)v);
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_int32_to_int32(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        int32_t v;
+        int32_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (int32_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_int32_to_uint32(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        int32_t v;
+        uint32_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v < 0) ? 0 : (uint32_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_int32_to_int64(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        int32_t v;
+        int64_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (int64_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_int32_to_uint64(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        int32_t v;
+        uint64_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v < 0) ? 0 : (uint64_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_uint32_to_double(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        uint32_t v;
+        double r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (double)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_uint32_to_single(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        uint32_t v;
+        float r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (float)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_uint32_to_int8(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        uint32_t v;
+        int8_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v > (uint32_t)INT8_MAX) ? INT8_MAX : (int8_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_uint32_to_uint8(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        uint32_t v;
+        uint8_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v > (uint32_t)UINT8_MAX) ? UINT8_MAX : (uint8_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_uint32_to_int16(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        uint32_t v;
+        int16_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v > (uint32_t)INT16_MAX) ? INT16_MAX : (int16_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_uint32_to_uint16(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        uint32_t v;
+        uint16_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v > (uint32_t)UINT16_MAX) ? UINT16_MAX : (uint16_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_uint32_to_int32(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        uint32_t v;
+        int32_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v > (uint32_t)INT32_MAX) ? INT32_MAX : (int32_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_uint32_to_uint32(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        uint32_t v;
+        uint32_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (uint32_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_uint32_to_int64(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        uint32_t v;
+        int64_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (int64_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_uint32_to_uint64(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        uint32_t v;
+        uint64_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (uint64_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_int64_to_double(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        int64_t v;
+        double r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (double)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_int64_to_single(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        int64_t v;
+        float r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (float)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_int64_to_int8(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        int64_t v;
+        int8_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v < (int64_t)INT8_MIN) ? INT8_MIN : ((v > (int64_t)INT8_MAX) ? INT8_MAX : (int8_t)v);
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_int64_to_uint8(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        int64_t v;
+        uint8_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v < 0) ? 0 : ((v > (int64_t)UINT8_MAX) ? UINT8_MAX : (uint8_t)v);
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_int64_to_int16(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        int64_t v;
+        int16_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v < (int64_t)INT16_MIN) ? INT16_MIN : ((v > (int64_t)INT16_MAX) ? INT16_MAX : (int16_t)v);
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_int64_to_uint16(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        int64_t v;
+        uint16_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v < 0) ? 0 : ((v > (int64_t)UINT16_MAX) ? UINT16_MAX : (uint16_t)v);
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_int64_to_int32(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        int64_t v;
+        int32_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v < (int64_t)INT32_MIN) ? INT32_MIN : ((v > (int64_t)INT32_MAX) ? INT32_MAX : (int32_t)v);
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_int64_to_uint32(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        int64_t v;
+        uint32_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v < 0) ? 0 : ((v > (int64_t)UINT32_MAX) ? UINT32_MAX : (uint32_t)v);
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_int64_to_int64(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        int64_t v;
+        int64_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (int64_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_int64_to_uint64(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        int64_t v;
+        uint64_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v < 0) ? 0 : (uint64_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_uint64_to_double(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        uint64_t v;
+        double r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (double)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_uint64_to_single(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        uint64_t v;
+        float r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (float)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_uint64_to_int8(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        uint64_t v;
+        int8_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v > (uint64_t)INT8_MAX) ? INT8_MAX : (int8_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_uint64_to_uint8(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        uint64_t v;
+        uint8_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v > (uint64_t)UINT8_MAX) ? UINT8_MAX : (uint8_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_uint64_to_int16(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        uint64_t v;
+        int16_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v > (uint64_t)INT16_MAX) ? INT16_MAX : (int16_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_uint64_to_uint16(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        uint64_t v;
+        uint16_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v > (uint64_t)UINT16_MAX) ? UINT16_MAX : (uint16_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_uint64_to_int32(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        uint64_t v;
+        int32_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v > (uint64_t)INT32_MAX) ? INT32_MAX : (int32_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_uint64_to_uint32(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        uint64_t v;
+        uint32_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v > (uint64_t)UINT32_MAX) ? UINT32_MAX : (uint32_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_uint64_to_int64(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        uint64_t v;
+        int64_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (v > (uint64_t)INT64_MAX) ? INT64_MAX : (int64_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_uint64_to_uint64(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        uint64_t v;
+        uint64_t r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r = (uint64_t)v;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_cdouble_to_cdouble(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        struct robotraconteurlite_cdouble v;
+        struct robotraconteurlite_cdouble r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r.real = (double)v.real;
+        r.imag = (double)v.imag;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_cdouble_to_csingle(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        struct robotraconteurlite_cdouble v;
+        struct robotraconteurlite_csingle r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r.real = (float)v.real;
+        r.imag = (float)v.imag;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_csingle_to_cdouble(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        struct robotraconteurlite_csingle v;
+        struct robotraconteurlite_cdouble r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r.real = (double)v.real;
+        r.imag = (double)v.imag;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static void robotraconteurlite_convert_csingle_to_csingle(const uint8_t* source, uint8_t* dest, size_t count)
+{
+    size_t i = 0;
+    for (i = 0; i < count; i++)
+    {
+        struct robotraconteurlite_csingle v;
+        struct robotraconteurlite_csingle r;
+        (void)memcpy(&v, &source[i * sizeof(v)], sizeof(v));
+        r.real = (float)v.real;
+        r.imag = (float)v.imag;
+        (void)memcpy(&dest[i * sizeof(r)], &r, sizeof(r));
+    }
+}
+
+static robotraconteurlite_status robotraconteurlite_convert_from_double(const uint8_t* source, uint8_t* dest,
+                                                                        uint16_t dest_type, size_t count)
+{
+    switch (dest_type)
+    {
+    case ROBOTRACONTEURLITE_DATATYPE_DOUBLE:
+        robotraconteurlite_convert_double_to_double(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_SINGLE:
+        robotraconteurlite_convert_double_to_single(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_INT8:
+        robotraconteurlite_convert_double_to_int8(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_UINT8:
+        robotraconteurlite_convert_double_to_uint8(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_INT16:
+        robotraconteurlite_convert_double_to_int16(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_UINT16:
+        robotraconteurlite_convert_double_to_uint16(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_INT32:
+        robotraconteurlite_convert_double_to_int32(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_UINT32:
+        robotraconteurlite_convert_double_to_uint32(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_INT64:
+        robotraconteurlite_convert_double_to_int64(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_UINT64:
+        robotraconteurlite_convert_double_to_uint64(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    default:
+        return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_TYPE_MISMATCH;
+    }
+}
+
+static robotraconteurlite_status robotraconteurlite_convert_from_single(const uint8_t* source, uint8_t* dest,
+                                                                        uint16_t dest_type, size_t count)
+{
+    switch (dest_type)
+    {
+    case ROBOTRACONTEURLITE_DATATYPE_DOUBLE:
+        robotraconteurlite_convert_single_to_double(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_SINGLE:
+        robotraconteurlite_convert_single_to_single(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_INT8:
+        robotraconteurlite_convert_single_to_int8(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_UINT8:
+        robotraconteurlite_convert_single_to_uint8(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_INT16:
+        robotraconteurlite_convert_single_to_int16(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_UINT16:
+        robotraconteurlite_convert_single_to_uint16(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_INT32:
+        robotraconteurlite_convert_single_to_int32(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_UINT32:
+        robotraconteurlite_convert_single_to_uint32(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_INT64:
+        robotraconteurlite_convert_single_to_int64(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_UINT64:
+        robotraconteurlite_convert_single_to_uint64(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    default:
+        return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_TYPE_MISMATCH;
+    }
+}
+
+static robotraconteurlite_status robotraconteurlite_convert_from_int8(const uint8_t* source, uint8_t* dest,
+                                                                      uint16_t dest_type, size_t count)
+{
+    switch (dest_type)
+    {
+    case ROBOTRACONTEURLITE_DATATYPE_DOUBLE:
+        robotraconteurlite_convert_int8_to_double(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_SINGLE:
+        robotraconteurlite_convert_int8_to_single(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_INT8:
+        robotraconteurlite_convert_int8_to_int8(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_UINT8:
+        robotraconteurlite_convert_int8_to_uint8(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_INT16:
+        robotraconteurlite_convert_int8_to_int16(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_UINT16:
+        robotraconteurlite_convert_int8_to_uint16(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_INT32:
+        robotraconteurlite_convert_int8_to_int32(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_UINT32:
+        robotraconteurlite_convert_int8_to_uint32(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_INT64:
+        robotraconteurlite_convert_int8_to_int64(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_UINT64:
+        robotraconteurlite_convert_int8_to_uint64(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    default:
+        return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_TYPE_MISMATCH;
+    }
+}
+
+static robotraconteurlite_status robotraconteurlite_convert_from_uint8(const uint8_t* source, uint8_t* dest,
+                                                                       uint16_t dest_type, size_t count)
+{
+    switch (dest_type)
+    {
+    case ROBOTRACONTEURLITE_DATATYPE_DOUBLE:
+        robotraconteurlite_convert_uint8_to_double(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_SINGLE:
+        robotraconteurlite_convert_uint8_to_single(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_INT8:
+        robotraconteurlite_convert_uint8_to_int8(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_UINT8:
+        robotraconteurlite_convert_uint8_to_uint8(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_INT16:
+        robotraconteurlite_convert_uint8_to_int16(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_UINT16:
+        robotraconteurlite_convert_uint8_to_uint16(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_INT32:
+        robotraconteurlite_convert_uint8_to_int32(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_UINT32:
+        robotraconteurlite_convert_uint8_to_uint32(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_INT64:
+        robotraconteurlite_convert_uint8_to_int64(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_UINT64:
+        robotraconteurlite_convert_uint8_to_uint64(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    default:
+        return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_TYPE_MISMATCH;
+    }
+}
+
+static robotraconteurlite_status robotraconteurlite_convert_from_int16(const uint8_t* source, uint8_t* dest,
+                                                                       uint16_t dest_type, size_t count)
+{
+    switch (dest_type)
+    {
+    case ROBOTRACONTEURLITE_DATATYPE_DOUBLE:
+        robotraconteurlite_convert_int16_to_double(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_SINGLE:
+        robotraconteurlite_convert_int16_to_single(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_INT8:
+        robotraconteurlite_convert_int16_to_int8(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_UINT8:
+        robotraconteurlite_convert_int16_to_uint8(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_INT16:
+        robotraconteurlite_convert_int16_to_int16(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_UINT16:
+        robotraconteurlite_convert_int16_to_uint16(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_INT32:
+        robotraconteurlite_convert_int16_to_int32(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_UINT32:
+        robotraconteurlite_convert_int16_to_uint32(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_INT64:
+        robotraconteurlite_convert_int16_to_int64(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_UINT64:
+        robotraconteurlite_convert_int16_to_uint64(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    default:
+        return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_TYPE_MISMATCH;
+    }
+}
+
+static robotraconteurlite_status robotraconteurlite_convert_from_uint16(const uint8_t* source, uint8_t* dest,
+                                                                        uint16_t dest_type, size_t count)
+{
+    switch (dest_type)
+    {
+    case ROBOTRACONTEURLITE_DATATYPE_DOUBLE:
+        robotraconteurlite_convert_uint16_to_double(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_SINGLE:
+        robotraconteurlite_convert_uint16_to_single(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_INT8:
+        robotraconteurlite_convert_uint16_to_int8(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_UINT8:
+        robotraconteurlite_convert_uint16_to_uint8(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_INT16:
+        robotraconteurlite_convert_uint16_to_int16(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_UINT16:
+        robotraconteurlite_convert_uint16_to_uint16(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_INT32:
+        robotraconteurlite_convert_uint16_to_int32(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_UINT32:
+        robotraconteurlite_convert_uint16_to_uint32(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_INT64:
+        robotraconteurlite_convert_uint16_to_int64(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_UINT64:
+        robotraconteurlite_convert_uint16_to_uint64(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    default:
+        return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_TYPE_MISMATCH;
+    }
+}
+
+static robotraconteurlite_status robotraconteurlite_convert_from_int32(const uint8_t* source, uint8_t* dest,
+                                                                       uint16_t dest_type, size_t count)
+{
+    switch (dest_type)
+    {
+    case ROBOTRACONTEURLITE_DATATYPE_DOUBLE:
+        robotraconteurlite_convert_int32_to_double(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_SINGLE:
+        robotraconteurlite_convert_int32_to_single(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_INT8:
+        robotraconteurlite_convert_int32_to_int8(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_UINT8:
+        robotraconteurlite_convert_int32_to_uint8(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_INT16:
+        robotraconteurlite_convert_int32_to_int16(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_UINT16:
+        robotraconteurlite_convert_int32_to_uint16(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_INT32:
+        robotraconteurlite_convert_int32_to_int32(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_UINT32:
+        robotraconteurlite_convert_int32_to_uint32(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_INT64:
+        robotraconteurlite_convert_int32_to_int64(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_UINT64:
+        robotraconteurlite_convert_int32_to_uint64(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    default:
+        return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_TYPE_MISMATCH;
+    }
+}
+
+static robotraconteurlite_status robotraconteurlite_convert_from_uint32(const uint8_t* source, uint8_t* dest,
+                                                                        uint16_t dest_type, size_t count)
+{
+    switch (dest_type)
+    {
+    case ROBOTRACONTEURLITE_DATATYPE_DOUBLE:
+        robotraconteurlite_convert_uint32_to_double(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_SINGLE:
+        robotraconteurlite_convert_uint32_to_single(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_INT8:
+        robotraconteurlite_convert_uint32_to_int8(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_UINT8:
+        robotraconteurlite_convert_uint32_to_uint8(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_INT16:
+        robotraconteurlite_convert_uint32_to_int16(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_UINT16:
+        robotraconteurlite_convert_uint32_to_uint16(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_INT32:
+        robotraconteurlite_convert_uint32_to_int32(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_UINT32:
+        robotraconteurlite_convert_uint32_to_uint32(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_INT64:
+        robotraconteurlite_convert_uint32_to_int64(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_UINT64:
+        robotraconteurlite_convert_uint32_to_uint64(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    default:
+        return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_TYPE_MISMATCH;
+    }
+}
+
+static robotraconteurlite_status robotraconteurlite_convert_from_int64(const uint8_t* source, uint8_t* dest,
+                                                                       uint16_t dest_type, size_t count)
+{
+    switch (dest_type)
+    {
+    case ROBOTRACONTEURLITE_DATATYPE_DOUBLE:
+        robotraconteurlite_convert_int64_to_double(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_SINGLE:
+        robotraconteurlite_convert_int64_to_single(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_INT8:
+        robotraconteurlite_convert_int64_to_int8(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_UINT8:
+        robotraconteurlite_convert_int64_to_uint8(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_INT16:
+        robotraconteurlite_convert_int64_to_int16(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_UINT16:
+        robotraconteurlite_convert_int64_to_uint16(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_INT32:
+        robotraconteurlite_convert_int64_to_int32(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_UINT32:
+        robotraconteurlite_convert_int64_to_uint32(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_INT64:
+        robotraconteurlite_convert_int64_to_int64(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_UINT64:
+        robotraconteurlite_convert_int64_to_uint64(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    default:
+        return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_TYPE_MISMATCH;
+    }
+}
+
+static robotraconteurlite_status robotraconteurlite_convert_from_uint64(const uint8_t* source, uint8_t* dest,
+                                                                        uint16_t dest_type, size_t count)
+{
+    switch (dest_type)
+    {
+    case ROBOTRACONTEURLITE_DATATYPE_DOUBLE:
+        robotraconteurlite_convert_uint64_to_double(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_SINGLE:
+        robotraconteurlite_convert_uint64_to_single(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_INT8:
+        robotraconteurlite_convert_uint64_to_int8(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_UINT8:
+        robotraconteurlite_convert_uint64_to_uint8(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_INT16:
+        robotraconteurlite_convert_uint64_to_int16(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_UINT16:
+        robotraconteurlite_convert_uint64_to_uint16(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_INT32:
+        robotraconteurlite_convert_uint64_to_int32(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_UINT32:
+        robotraconteurlite_convert_uint64_to_uint32(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_INT64:
+        robotraconteurlite_convert_uint64_to_int64(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_UINT64:
+        robotraconteurlite_convert_uint64_to_uint64(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    default:
+        return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_TYPE_MISMATCH;
+    }
+}
+
+static robotraconteurlite_status robotraconteurlite_convert_from_cdouble(const uint8_t* source, uint8_t* dest,
+                                                                         uint16_t dest_type, size_t count)
+{
+    switch (dest_type)
+    {
+    case ROBOTRACONTEURLITE_DATATYPE_CDOUBLE:
+        robotraconteurlite_convert_cdouble_to_cdouble(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_CSINGLE:
+        robotraconteurlite_convert_cdouble_to_csingle(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    default:
+        return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_TYPE_MISMATCH;
+    }
+}
+
+static robotraconteurlite_status robotraconteurlite_convert_from_csingle(const uint8_t* source, uint8_t* dest,
+                                                                         uint16_t dest_type, size_t count)
+{
+    switch (dest_type)
+    {
+    case ROBOTRACONTEURLITE_DATATYPE_CDOUBLE:
+        robotraconteurlite_convert_csingle_to_cdouble(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case ROBOTRACONTEURLITE_DATATYPE_CSINGLE:
+        robotraconteurlite_convert_csingle_to_csingle(source, dest, count);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    default:
+        return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_TYPE_MISMATCH;
+    }
+}
+
+robotraconteurlite_status robotraconteurlite_datatype_convert(const uint8_t* source, uint16_t source_type,
+                                                              uint8_t* dest, uint16_t dest_type, size_t count)
+{
+    assert((source != NULL) || (count == 0U));
+    assert((dest != NULL) || (count == 0U));
+
+    switch (source_type)
+    {
+    case ROBOTRACONTEURLITE_DATATYPE_DOUBLE:
+        return robotraconteurlite_convert_from_double(source, dest, dest_type, count);
+    case ROBOTRACONTEURLITE_DATATYPE_SINGLE:
+        return robotraconteurlite_convert_from_single(source, dest, dest_type, count);
+    case ROBOTRACONTEURLITE_DATATYPE_INT8:
+        return robotraconteurlite_convert_from_int8(source, dest, dest_type, count);
+    case ROBOTRACONTEURLITE_DATATYPE_UINT8:
+        return robotraconteurlite_convert_from_uint8(source, dest, dest_type, count);
+    case ROBOTRACONTEURLITE_DATATYPE_INT16:
+        return robotraconteurlite_convert_from_int16(source, dest, dest_type, count);
+    case ROBOTRACONTEURLITE_DATATYPE_UINT16:
+        return robotraconteurlite_convert_from_uint16(source, dest, dest_type, count);
+    case ROBOTRACONTEURLITE_DATATYPE_INT32:
+        return robotraconteurlite_convert_from_int32(source, dest, dest_type, count);
+    case ROBOTRACONTEURLITE_DATATYPE_UINT32:
+        return robotraconteurlite_convert_from_uint32(source, dest, dest_type, count);
+    case ROBOTRACONTEURLITE_DATATYPE_INT64:
+        return robotraconteurlite_convert_from_int64(source, dest, dest_type, count);
+    case ROBOTRACONTEURLITE_DATATYPE_UINT64:
+        return robotraconteurlite_convert_from_uint64(source, dest, dest_type, count);
+    case ROBOTRACONTEURLITE_DATATYPE_CDOUBLE:
+        return robotraconteurlite_convert_from_cdouble(source, dest, dest_type, count);
+    case ROBOTRACONTEURLITE_DATATYPE_CSINGLE:
+        return robotraconteurlite_convert_from_csingle(source, dest, dest_type, count);
+    default:
+        return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_TYPE_MISMATCH;
+    }
+}
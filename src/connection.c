@@ -22,6 +22,8 @@
 #define FLAGS_SET ROBOTRACONTEURLITE_FLAGS_SET
 #define FLAGS_CLEAR ROBOTRACONTEURLITE_FLAGS_CLEAR
 
+#define FAILED ROBOTRACONTEURLITE_FAILED
+
 robotraconteurlite_status robotraconteurlite_connection_reset(struct robotraconteurlite_connection* connection)
 {
     connection->connection_state = ROBOTRACONTEURLITE_STATUS_FLAGS_IDLE;
@@ -29,7 +31,24 @@ robotraconteurlite_status robotraconteurlite_connection_reset(struct robotracont
     connection->recv_message_len = 0;
     connection->send_buffer_pos = 0;
     connection->send_message_len = 0;
+    connection->recv_message_entry_index = 0;
+    connection->recv_message_entry_offset = 0;
+    (void)robotraconteurlite_connection_release_recv_buffer(connection);
+    connection->recv_sink = NULL;
+    connection->recv_sink_len = 0;
+    connection->recv_sink_pos = 0;
+    connection->recv_stream_offset = 0;
+    connection->send_buffer_vec = NULL;
     connection->sock = -1;
+    if (connection->send_string_table != NULL)
+    {
+        /* The peer no longer knows any codes */
+        robotraconteurlite_string_table_clear_confirmed(connection->send_string_table);
+    }
+    if (connection->recv_string_table != NULL)
+    {
+        robotraconteurlite_string_table_clear(connection->recv_string_table);
+    }
     connection->local_endpoint = 0;
     connection->remote_endpoint = 0;
     if (robotraconteurlite_nodeid_reset(&connection->remote_nodeid) != 0)
@@ -82,6 +101,30 @@ robotraconteurlite_status robotraconteurlite_connection_message_receive(
     }
 
     assert(buffer_storage->buffer_vec_cnt >= 1U);
+    if (FLAGS_CHECK(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_STREAMING))
+    {
+        /* The start of the message is in the receive buffer and the rest in the sink */
+        if (buffer_storage->buffer_vec_cnt < 2U)
+        {
+            return ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER;
+        }
+        if ((robotraconteurlite_buffer_init_scalar(&buffer_storage->buffer_vec[0], connection->recv_buffer,
+                                                   connection->recv_stream_offset) != 0) ||
+            (robotraconteurlite_buffer_init_scalar(&buffer_storage->buffer_vec[1], connection->recv_sink,
+                                                   connection->recv_sink_pos) != 0))
+        {
+            return ROBOTRACONTEURLITE_ERROR_INTERNAL_ERROR;
+        }
+        buffer_storage->buffer_vec_cnt = 2U;
+        if (robotraconteurlite_message_reader_init(message_reader, buffer_storage, 0U, connection->recv_message_len) !=
+            0)
+        {
+            return ROBOTRACONTEURLITE_ERROR_INTERNAL_ERROR;
+        }
+        (void)robotraconteurlite_message_reader_set_string_table(message_reader, connection->recv_string_table);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    }
+
     if (robotraconteurlite_buffer_init_scalar(&buffer_storage->buffer_vec[0], connection->recv_buffer,
                                               connection->recv_buffer_pos) != 0)
     {
@@ -92,6 +135,7 @@ robotraconteurlite_status robotraconteurlite_connection_message_receive(
     {
         return ROBOTRACONTEURLITE_ERROR_INTERNAL_ERROR;
     }
+    (void)robotraconteurlite_message_reader_set_string_table(message_reader, connection->recv_string_table);
 
     return ROBOTRACONTEURLITE_ERROR_SUCCESS;
 }
@@ -105,14 +149,274 @@ robotraconteurlite_status robotraconteurlite_connection_message_receive_consume(
     }
 
     FLAGS_SET(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_CONSUMED);
+    connection->recv_message_entry_index = 0;
+    connection->recv_message_entry_offset = 0;
     return ROBOTRACONTEURLITE_ERROR_SUCCESS;
 }
 
-robotraconteurlite_status robotraconteurlite_connection_begin_send_message(
-    struct robotraconteurlite_connection* connection, struct robotraconteurlite_message_writer* message_writer,
+static robotraconteurlite_status robotraconteurlite_connection_message_reader_init_header(
+    struct robotraconteurlite_connection* connection, struct robotraconteurlite_message_reader* message_reader,
     struct robotraconteurlite_buffer_vec* buffer_storage)
 {
-    uint16_t message_version = 2;
+    robotraconteurlite_status rv = -1;
+
+    assert(buffer_storage->buffer_vec_cnt >= 1U);
+    rv = robotraconteurlite_buffer_init_scalar(&buffer_storage->buffer_vec[0], connection->recv_buffer,
+                                               connection->recv_buffer_pos);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+    buffer_storage->buffer_vec_cnt = 1U;
+    rv = robotraconteurlite_message_reader_init_partial(message_reader, buffer_storage, 0U,
+                                                        connection->recv_message_len);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+    (void)robotraconteurlite_message_reader_set_string_table(message_reader, connection->recv_string_table);
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status robotraconteurlite_connection_check_message_header(
+    struct robotraconteurlite_connection* connection)
+{
+    struct robotraconteurlite_buffer buffer;
+    struct robotraconteurlite_buffer_vec buffer_vec;
+    struct robotraconteurlite_message_reader message_reader;
+    struct robotraconteurlite_message_header header;
+    struct robotraconteurlite_messageentry_reader entry_reader;
+    struct robotraconteurlite_messageentry_header entry_header;
+    robotraconteurlite_status rv = -1;
+
+    if ((!FLAGS_CHECK(connection->config_flags, ROBOTRACONTEURLITE_CONFIG_FLAGS_ENABLE_STREAM_RECV)) ||
+        FLAGS_CHECK(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_HEADER_RECEIVED) ||
+        (connection->recv_message_len == 0U) || (connection->recv_buffer_pos >= connection->recv_message_len))
+    {
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    }
+
+    buffer_vec.buffer_vec = &buffer;
+    buffer_vec.buffer_vec_cnt = 1U;
+    rv = robotraconteurlite_connection_message_reader_init_header(connection, &message_reader, &buffer_vec);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    /* Header strings are not copied, reading them only checks they have arrived. OUT_OF_RANGE means the headers are
+       not complete yet. */
+    (void)memset(&header, 0, sizeof(header));
+    rv = robotraconteurlite_message_reader_read_header(&message_reader, &header);
+    if (rv == ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE)
+    {
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    }
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+    if (header.entry_count == 0U)
+    {
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    }
+
+    rv = robotraconteurlite_message_reader_begin_read_entries(&message_reader, &entry_reader);
+    if (rv == ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE)
+    {
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    }
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    (void)memset(&entry_header, 0, sizeof(entry_header));
+    rv = robotraconteurlite_messageentry_reader_read_header(&entry_reader, &entry_header);
+    if (rv == ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE)
+    {
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    }
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    FLAGS_SET(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_HEADER_RECEIVED);
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status robotraconteurlite_connection_message_receive_header(
+    struct robotraconteurlite_connection* connection, struct robotraconteurlite_message_reader* message_reader,
+    struct robotraconteurlite_buffer_vec* buffer_storage)
+{
+    if (robotraconteurlite_connection_is_message_header_received_event(connection) == 0)
+    {
+        return ROBOTRACONTEURLITE_ERROR_RETRY;
+    }
+
+    return robotraconteurlite_connection_message_reader_init_header(connection, message_reader, buffer_storage);
+}
+
+robotraconteurlite_status robotraconteurlite_connection_message_receive_header_consume(
+    struct robotraconteurlite_connection* connection)
+{
+    if (!FLAGS_CHECK(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_HEADER_RECEIVED))
+    {
+        return ROBOTRACONTEURLITE_ERROR_INVALID_OPERATION;
+    }
+
+    robotraconteurlite_connection_consume_message_header_received(connection);
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+static robotraconteurlite_status robotraconteurlite_connection_check_stream_ready(
+    struct robotraconteurlite_connection* connection)
+{
+    if ((!FLAGS_CHECK(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_HEADER_RECEIVED)) ||
+        FLAGS_CHECK(connection->connection_state, (ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_STREAMING |
+                                                   ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_CONSUMED)))
+    {
+        return ROBOTRACONTEURLITE_ERROR_INVALID_OPERATION;
+    }
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status robotraconteurlite_connection_message_receive_stream(
+    struct robotraconteurlite_connection* connection, uint8_t* sink, size_t sink_len)
+{
+    robotraconteurlite_status rv = robotraconteurlite_connection_check_stream_ready(connection);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    /* The rest of the message may have arrived before the handler ran */
+    if (FLAGS_CHECK(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_RECEIVED))
+    {
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    }
+
+    assert(sink != NULL);
+    if (sink_len < (connection->recv_message_len - connection->recv_buffer_pos))
+    {
+        return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+    }
+
+    connection->recv_sink = sink;
+    connection->recv_sink_len = sink_len;
+    connection->recv_sink_pos = 0;
+    connection->recv_stream_offset = connection->recv_buffer_pos;
+    FLAGS_SET(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_STREAMING);
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status robotraconteurlite_connection_message_receive_reject(
+    struct robotraconteurlite_connection* connection)
+{
+    robotraconteurlite_status rv = robotraconteurlite_connection_check_stream_ready(connection);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    if (FLAGS_CHECK(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_RECEIVED))
+    {
+        return robotraconteurlite_connection_message_receive_consume(connection);
+    }
+
+    /* The rest of the message is received over the start of the receive buffer and dropped, so it also works when
+       the receive buffer is full of a message larger than it */
+    connection->recv_sink = connection->recv_buffer;
+    connection->recv_sink_len = connection->recv_buffer_len;
+    connection->recv_sink_pos = 0;
+    connection->recv_stream_offset = connection->recv_buffer_pos;
+    FLAGS_SET(connection->connection_state,
+              (ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_STREAMING | ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_REJECTED));
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status robotraconteurlite_connection_borrow_recv_buffer(
+    struct robotraconteurlite_connection* connection)
+{
+    struct robotraconteurlite_connection_buffer_pool* pool = connection->recv_buffer_pool;
+    struct robotraconteurlite_connection_buffer_pool_entry* entry = NULL;
+    size_t stream_len = 0;
+    size_t i = 0;
+    uint8_t found = 0;
+
+    if (FLAGS_CHECK(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_STREAMING) ||
+        (connection->recv_buffer_pos > connection->recv_message_len))
+    {
+        return ROBOTRACONTEURLITE_ERROR_INVALID_OPERATION;
+    }
+
+    if (pool == NULL)
+    {
+        return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+    }
+
+    /* Take the smallest free buffer that holds the rest of the message */
+    stream_len = connection->recv_message_len - connection->recv_buffer_pos;
+    for (i = 0; i < pool->entries_len; i++)
+    {
+        if (pool->entries[i].len < stream_len)
+        {
+            continue;
+        }
+        found = 1U;
+        if ((pool->entries[i].owner == NULL) && ((entry == NULL) || (pool->entries[i].len < entry->len)))
+        {
+            entry = &pool->entries[i];
+        }
+    }
+
+    if (found == 0U)
+    {
+        return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+    }
+
+    if (entry == NULL)
+    {
+        return ROBOTRACONTEURLITE_ERROR_RETRY;
+    }
+
+    entry->owner = connection;
+    connection->recv_sink = entry->data;
+    connection->recv_sink_len = entry->len;
+    connection->recv_sink_pos = 0;
+    connection->recv_stream_offset = connection->recv_buffer_pos;
+    FLAGS_SET(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_STREAMING);
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status robotraconteurlite_connection_release_recv_buffer(
+    struct robotraconteurlite_connection* connection)
+{
+    struct robotraconteurlite_connection_buffer_pool* pool = connection->recv_buffer_pool;
+    size_t i = 0;
+
+    if (pool == NULL)
+    {
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    }
+
+    for (i = 0; i < pool->entries_len; i++)
+    {
+        if (pool->entries[i].owner == connection)
+        {
+            pool->entries[i].owner = NULL;
+        }
+    }
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+static robotraconteurlite_status robotraconteurlite_connection_check_send_ready(
+    struct robotraconteurlite_connection* connection)
+{
     if (FLAGS_CHECK(connection->connection_state,
                     (ROBOTRACONTEURLITE_STATUS_FLAGS_ERROR | ROBOTRACONTEURLITE_STATUS_FLAGS_CLOSED |
                      ROBOTRACONTEURLITE_STATUS_FLAGS_CLOSE_REQUESTED | ROBOTRACONTEURLITE_STATUS_FLAGS_IDLE)) ||
@@ -130,6 +434,20 @@ robotraconteurlite_status robotraconteurlite_connection_begin_send_message(
         return ROBOTRACONTEURLITE_ERROR_RETRY;
     }
 
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status robotraconteurlite_connection_begin_send_message(
+    struct robotraconteurlite_connection* connection, struct robotraconteurlite_message_writer* message_writer,
+    struct robotraconteurlite_buffer_vec* buffer_storage)
+{
+    uint16_t message_version = 2;
+    robotraconteurlite_status rv = robotraconteurlite_connection_check_send_ready(connection);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
     if (robotraconteurlite_buffer_init_scalar(&buffer_storage->buffer_vec[0], connection->send_buffer,
                                               connection->send_buffer_len) != 0)
     {
@@ -147,9 +465,104 @@ robotraconteurlite_status robotraconteurlite_connection_begin_send_message(
         return ROBOTRACONTEURLITE_ERROR_INTERNAL_ERROR;
     }
 
+    if ((message_version == 4U) &&
+        FLAGS_CHECK(connection->config_flags, ROBOTRACONTEURLITE_CONFIG_FLAGS_ENABLE_COMPACT_UINT_X4))
+    {
+        rv = robotraconteurlite_message_writer_enable_compact_uint_x(message_writer);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+    }
+
+    if ((message_version == 4U) &&
+        FLAGS_CHECK(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_STRING_TABLE4))
+    {
+        rv = robotraconteurlite_message_writer_set_string_table(message_writer, connection->send_string_table);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+    }
+
+    connection->send_buffer_vec = NULL;
+
     return ROBOTRACONTEURLITE_ERROR_SUCCESS;
 }
 
+robotraconteurlite_status robotraconteurlite_connection_begin_send_message_ex(
+    struct robotraconteurlite_connection* connection, struct robotraconteurlite_message_writer* message_writer,
+    struct robotraconteurlite_buffer_vec* buffer_storage, size_t external_min_len)
+{
+    robotraconteurlite_status rv = -1;
+    size_t segment_capacity = buffer_storage->buffer_vec_cnt;
+
+    /* Need room for the send buffer plus at least one payload and the remaining send buffer */
+    if (segment_capacity < 3U)
+    {
+        return ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER;
+    }
+
+    buffer_storage->buffer_vec_cnt = 1U;
+    rv = robotraconteurlite_connection_begin_send_message(connection, message_writer, buffer_storage);
+    if (FAILED(rv))
+    {
+        buffer_storage->buffer_vec_cnt = segment_capacity;
+        return rv;
+    }
+
+    if (FLAGS_CHECK(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_SEND_COPY_ONLY))
+    {
+        /* Arrays are copied into the send buffer instead */
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    }
+
+    rv = robotraconteurlite_message_writer_enable_external_segments(message_writer, segment_capacity,
+                                                                    external_min_len);
+    if (FAILED(rv))
+    {
+        buffer_storage->buffer_vec_cnt = segment_capacity;
+        (void)robotraconteurlite_connection_abort_send_message(connection);
+        return rv;
+    }
+
+    connection->send_buffer_vec = buffer_storage;
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status robotraconteurlite_connection_send_message_template(
+    struct robotraconteurlite_connection* connection,
+    const struct robotraconteurlite_message_template* message_template)
+{
+    uint16_t message_version = 2;
+    robotraconteurlite_status rv = robotraconteurlite_connection_check_send_ready(connection);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    if (FLAGS_CHECK(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_SEND_MESSAGE4))
+    {
+        message_version = 4;
+    }
+
+    if (message_template->message_version != message_version)
+    {
+        return ROBOTRACONTEURLITE_ERROR_INVALID_VERSION;
+    }
+
+    if (message_template->message_len > connection->send_buffer_len)
+    {
+        return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+    }
+
+    (void)memcpy(connection->send_buffer, message_template->data, message_template->message_len);
+    connection->send_buffer_vec = NULL;
+
+    return robotraconteurlite_connection_end_send_message(connection, message_template->message_len);
+}
+
 robotraconteurlite_status robotraconteurlite_connection_end_send_message(
     struct robotraconteurlite_connection* connection, size_t message_len)
 {
@@ -162,8 +575,8 @@ robotraconteurlite_status robotraconteurlite_connection_end_send_message(
 robotraconteurlite_status robotraconteurlite_connection_abort_send_message(
     struct robotraconteurlite_connection* connection)
 {
-    ROBOTRACONTEURLITE_UNUSED(connection);
-    /* Don't need to do anything, for future use */
+    /* Release any scatter-gather segments */
+    connection->send_buffer_vec = NULL;
     return ROBOTRACONTEURLITE_ERROR_SUCCESS;
 }
 
@@ -205,6 +618,42 @@ struct robotraconteurlite_connection* robotraconteurlite_connections_init_from_a
     return &connections_fixed_storage[0];
 }
 
+robotraconteurlite_status robotraconteurlite_connection_buffer_pool_init(
+    struct robotraconteurlite_connection_buffer_pool* pool,
+    struct robotraconteurlite_connection_buffer_pool_entry entries[], size_t entries_len, uint8_t buffers[],
+    size_t buffer_size)
+{
+    size_t i = 0;
+    assert(pool != NULL);
+    assert((entries != NULL) || (entries_len == 0U));
+    assert((buffers != NULL) || (entries_len == 0U));
+
+    for (i = 0; i < entries_len; i++)
+    {
+        entries[i].data = &buffers[i * buffer_size];
+        entries[i].len = buffer_size;
+        entries[i].owner = NULL;
+    }
+    pool->entries = entries;
+    pool->entries_len = entries_len;
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status
+robotraconteurlite_connections_set_recv_buffer_pool(struct robotraconteurlite_connection* connections_head,
+                                                    struct robotraconteurlite_connection_buffer_pool* pool)
+{
+    struct robotraconteurlite_connection* c = connections_head;
+    while (c != NULL)
+    {
+        c->recv_buffer_pool = pool;
+        c = c->next;
+    }
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
 robotraconteurlite_status robotraconteurlite_connection_next_wake(struct robotraconteurlite_connection* connection,
                                                                   robotraconteurlite_timespec now,
                                                                   robotraconteurlite_timespec* next_wake)
@@ -233,6 +682,13 @@ robotraconteurlite_status robotraconteurlite_connection_next_wake(struct robotra
         return ROBOTRACONTEURLITE_ERROR_SUCCESS;
     }
 
+    if ((robotraconteurlite_connection_is_message_header_received_event(connection) != 0) ||
+        (robotraconteurlite_connection_is_message_chunk_received_event(connection) != 0))
+    {
+        *next_wake = now;
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    }
+
     if (connection->heartbeat_next_check_ms > 0)
     {
         if ((now > connection->heartbeat_next_check_ms) ||
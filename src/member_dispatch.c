@@ -0,0 +1,279 @@
+/* Copyright 2011-2024 Wason Technology, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "robotraconteurlite/member_dispatch.h"
+#include "robotraconteurlite/message.h"
+#include "robotraconteurlite/util.h"
+#include <string.h>
+#include <assert.h>
+
+#define FAILED ROBOTRACONTEURLITE_FAILED
+
+#define MEMBER_DISPATCH_FNV_PRIME 16777619U
+
+static uint32_t robotraconteurlite_member_dispatch_hash_bytes(uint32_t hash, const char* data, size_t len)
+{
+    uint32_t h = hash;
+    size_t i = 0;
+
+    for (i = 0; i < len; i++)
+    {
+        h ^= (uint32_t)(uint8_t)data[i];
+        h *= MEMBER_DISPATCH_FNV_PRIME;
+    }
+    return h;
+}
+
+/* Seeded FNV-1a over the key, followed by a final mix so that the low bits pick the bucket and the high bits the
+   slot */
+static uint32_t robotraconteurlite_member_dispatch_hash(uint32_t seed, uint16_t entry_type, const char* service_path,
+                                                        size_t service_path_len, const char* member_name,
+                                                        size_t member_name_len)
+{
+    uint32_t h = 2166136261U ^ (seed * 0x9E3779B9U);
+
+    h ^= (uint32_t)entry_type & 0xFFU;
+    h *= MEMBER_DISPATCH_FNV_PRIME;
+    h ^= (uint32_t)entry_type >> 8U;
+    h *= MEMBER_DISPATCH_FNV_PRIME;
+    h = robotraconteurlite_member_dispatch_hash_bytes(h, member_name, member_name_len);
+    /* 0xFF does not occur in UTF-8, so it separates the member name from the service path */
+    h ^= 0xFFU;
+    h *= MEMBER_DISPATCH_FNV_PRIME;
+    h = robotraconteurlite_member_dispatch_hash_bytes(h, service_path, service_path_len);
+
+    h ^= h >> 16U;
+    h *= 0x85EBCA6BU;
+    h ^= h >> 13U;
+    h *= 0xC2B2AE35U;
+    h ^= h >> 16U;
+    return h;
+}
+
+static uint32_t robotraconteurlite_member_dispatch_entry_hash(
+    const struct robotraconteurlite_member_dispatch_entry* entry, uint32_t seed)
+{
+    return robotraconteurlite_member_dispatch_hash(seed, entry->entry_type, entry->service_path,
+                                                   strlen(entry->service_path), entry->member_name,
+                                                   strlen(entry->member_name));
+}
+
+static size_t robotraconteurlite_member_dispatch_slot(const struct robotraconteurlite_member_dispatch* dispatch,
+                                                      uint32_t hash, uint32_t displacement)
+{
+    uint32_t f1 = (hash >> 16U) | (hash << 16U);
+    uint32_t f2 = ((hash * 0x9E3779B1U) >> 8U) | 1U;
+    return (size_t)((f1 + (displacement * f2)) % (uint32_t)dispatch->slots_len);
+}
+
+static size_t robotraconteurlite_member_dispatch_bucket_count(const struct robotraconteurlite_member_dispatch* dispatch,
+                                                              uint32_t seed, size_t bucket)
+{
+    size_t count = 0;
+    size_t i = 0;
+
+    for (i = 0; i < dispatch->entries_len; i++)
+    {
+        uint32_t h = robotraconteurlite_member_dispatch_entry_hash(&dispatch->entries[i], seed);
+        if ((h % (uint32_t)dispatch->displacements_len) == bucket)
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+/* Try to place all entries of bucket in free slots with displacement. The slots are left unchanged on failure. */
+static robotraconteurlite_status robotraconteurlite_member_dispatch_place_bucket(
+    struct robotraconteurlite_member_dispatch* dispatch, uint32_t seed, size_t bucket, uint32_t displacement)
+{
+    size_t i = 0;
+    size_t j = 0;
+
+    for (i = 0; i < dispatch->entries_len; i++)
+    {
+        uint32_t h = robotraconteurlite_member_dispatch_entry_hash(&dispatch->entries[i], seed);
+        size_t slot = 0;
+        if ((h % (uint32_t)dispatch->displacements_len) != bucket)
+        {
+            continue;
+        }
+
+        slot = robotraconteurlite_member_dispatch_slot(dispatch, h, displacement);
+        if (dispatch->slots[slot] != 0U)
+        {
+            /* Undo the entries of this bucket placed so far */
+            for (j = 0; j < i; j++)
+            {
+                uint32_t h2 = robotraconteurlite_member_dispatch_entry_hash(&dispatch->entries[j], seed);
+                size_t slot2 = robotraconteurlite_member_dispatch_slot(dispatch, h2, displacement);
+                if (((h2 % (uint32_t)dispatch->displacements_len) == bucket) && (dispatch->slots[slot2] == (j + 1U)))
+                {
+                    dispatch->slots[slot2] = 0U;
+                }
+            }
+            return ROBOTRACONTEURLITE_ERROR_RETRY;
+        }
+        dispatch->slots[slot] = (uint16_t)(i + 1U);
+    }
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+static robotraconteurlite_status robotraconteurlite_member_dispatch_build(
+    struct robotraconteurlite_member_dispatch* dispatch, uint32_t seed)
+{
+    size_t max_count = 0;
+    size_t count = 0;
+    size_t bucket = 0;
+
+    (void)memset(dispatch->slots, 0, dispatch->slots_len * sizeof(uint16_t));
+    (void)memset(dispatch->displacements, 0, dispatch->displacements_len * sizeof(uint16_t));
+
+    for (bucket = 0; bucket < dispatch->displacements_len; bucket++)
+    {
+        size_t c = robotraconteurlite_member_dispatch_bucket_count(dispatch, seed, bucket);
+        if (c > max_count)
+        {
+            max_count = c;
+        }
+    }
+
+    /* Largest buckets first, while most slots are still free */
+    for (count = max_count; count > 0U; count--)
+    {
+        for (bucket = 0; bucket < dispatch->displacements_len; bucket++)
+        {
+            uint32_t displacement = 0;
+            robotraconteurlite_status rv = ROBOTRACONTEURLITE_ERROR_RETRY;
+
+            if (robotraconteurlite_member_dispatch_bucket_count(dispatch, seed, bucket) != count)
+            {
+                continue;
+            }
+
+            for (displacement = 0; displacement < ROBOTRACONTEURLITE_MEMBER_DISPATCH_MAX_DISPLACEMENT; displacement++)
+            {
+                rv = robotraconteurlite_member_dispatch_place_bucket(dispatch, seed, bucket, displacement);
+                if (rv == ROBOTRACONTEURLITE_ERROR_SUCCESS)
+                {
+                    break;
+                }
+            }
+
+            if (rv != ROBOTRACONTEURLITE_ERROR_SUCCESS)
+            {
+                return ROBOTRACONTEURLITE_ERROR_RETRY;
+            }
+            dispatch->displacements[bucket] = (uint16_t)displacement;
+        }
+    }
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status robotraconteurlite_member_dispatch_init(
+    struct robotraconteurlite_member_dispatch* dispatch, const struct robotraconteurlite_member_dispatch_entry* entries,
+    size_t entries_len, uint16_t slots[], size_t slots_len, uint16_t displacements[], size_t displacements_len)
+{
+    uint32_t seed = 0;
+    size_t i = 0;
+    size_t j = 0;
+
+    assert(dispatch != NULL);
+    assert((entries != NULL) || (entries_len == 0U));
+    assert(slots != NULL);
+    assert(displacements != NULL);
+
+    if ((entries_len >= UINT16_MAX) || (slots_len < entries_len) || (slots_len == 0U) || (displacements_len == 0U))
+    {
+        return ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER;
+    }
+
+    for (i = 0; i < entries_len; i++)
+    {
+        for (j = i + 1U; j < entries_len; j++)
+        {
+            if ((entries[i].entry_type == entries[j].entry_type) &&
+                (strcmp(entries[i].service_path, entries[j].service_path) == 0) &&
+                (strcmp(entries[i].member_name, entries[j].member_name) == 0))
+            {
+                return ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER;
+            }
+        }
+    }
+
+    dispatch->entries = entries;
+    dispatch->entries_len = entries_len;
+    dispatch->slots = slots;
+    dispatch->slots_len = slots_len;
+    dispatch->displacements = displacements;
+    dispatch->displacements_len = displacements_len;
+
+    for (seed = 0; seed < ROBOTRACONTEURLITE_MEMBER_DISPATCH_MAX_SEEDS; seed++)
+    {
+        if (robotraconteurlite_member_dispatch_build(dispatch, seed) == ROBOTRACONTEURLITE_ERROR_SUCCESS)
+        {
+            dispatch->seed = seed;
+            return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+        }
+    }
+
+    dispatch->entries_len = 0;
+    (void)memset(slots, 0, slots_len * sizeof(uint16_t));
+    return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+}
+
+robotraconteurlite_status robotraconteurlite_member_dispatch_find(
+    const struct robotraconteurlite_member_dispatch* dispatch,
+    const struct robotraconteurlite_messageentry_header* entry_header, uint32_t* handler_id)
+{
+    const struct robotraconteurlite_member_dispatch_entry* entry = NULL;
+    uint32_t h = 0;
+    size_t slot = 0;
+    uint16_t index = 0;
+
+    assert(dispatch != NULL);
+    assert(entry_header != NULL);
+    assert(handler_id != NULL);
+
+    if (dispatch->entries_len == 0U)
+    {
+        return ROBOTRACONTEURLITE_ERROR_KEY_NOT_FOUND;
+    }
+
+    h = robotraconteurlite_member_dispatch_hash(dispatch->seed, entry_header->entry_type,
+                                                entry_header->service_path.data, entry_header->service_path.len,
+                                                entry_header->member_name.data, entry_header->member_name.len);
+    slot = robotraconteurlite_member_dispatch_slot(
+        dispatch, h, dispatch->displacements[h % (uint32_t)dispatch->displacements_len]);
+    index = dispatch->slots[slot];
+    if (index == 0U)
+    {
+        return ROBOTRACONTEURLITE_ERROR_KEY_NOT_FOUND;
+    }
+
+    /* The slot holds the only entry that can match, confirm it is not a different key */
+    entry = &dispatch->entries[index - 1U];
+    if ((entry->entry_type != entry_header->entry_type) ||
+        (robotraconteurlite_string_cmp_c_str(&entry_header->member_name, entry->member_name) != 0) ||
+        (robotraconteurlite_string_cmp_c_str(&entry_header->service_path, entry->service_path) != 0))
+    {
+        return ROBOTRACONTEURLITE_ERROR_KEY_NOT_FOUND;
+    }
+
+    *handler_id = entry->handler_id;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
@@ -25,15 +25,16 @@
 #define FLAGS_CLEAR ROBOTRACONTEURLITE_FLAGS_CLEAR
 
 #define FAILED ROBOTRACONTEURLITE_FAILED
+#define SUCCEEDED ROBOTRACONTEURLITE_SUCCEEDED
 #define NO_MORE ROBOTRACONTEURLITE_NO_MORE
 
 static const char rrac_magic[4] = {'R', 'R', 'A', 'C'};
 
 /* Message Reader */
 
-robotraconteurlite_status robotraconteurlite_message_reader_init(struct robotraconteurlite_message_reader* reader,
-                                                                 struct robotraconteurlite_buffer_vec* buffer,
-                                                                 size_t offset, size_t count)
+static robotraconteurlite_status robotraconteurlite_message_reader_init_ex(
+    struct robotraconteurlite_message_reader* reader, struct robotraconteurlite_buffer_vec* buffer, size_t offset,
+    size_t count, uint8_t partial)
 {
     size_t buffer_len = 0;
     robotraconteurlite_status rv = -1;
@@ -50,7 +51,8 @@ robotraconteurlite_status robotraconteurlite_message_reader_init(struct robotrac
         return rv;
     }
 
-    if (buffer_len < (offset + count))
+    /* A partial message only needs the preamble, reads past the end of the buffer fail with OUT_OF_RANGE */
+    if (buffer_len < (offset + ((partial != 0U) ? 10U : count)))
     {
         return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
     }
@@ -83,14 +85,52 @@ robotraconteurlite_status robotraconteurlite_message_reader_init(struct robotrac
     }
 
     reader->buffer = buffer;
+    (void)robotraconteurlite_buffer_vec_cursor_init(&reader->cursor, buffer);
     reader->buffer_offset = offset;
     reader->buffer_count = count;
+    reader->string_table = NULL;
+    reader->string_views = 0U;
+    reader->validated = 0U;
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status robotraconteurlite_message_reader_init(struct robotraconteurlite_message_reader* reader,
+                                                                 struct robotraconteurlite_buffer_vec* buffer,
+                                                                 size_t offset, size_t count)
+{
+    return robotraconteurlite_message_reader_init_ex(reader, buffer, offset, count, 0U);
+}
+
+robotraconteurlite_status robotraconteurlite_message_reader_init_partial(
+    struct robotraconteurlite_message_reader* reader, struct robotraconteurlite_buffer_vec* buffer, size_t offset,
+    size_t count)
+{
+    return robotraconteurlite_message_reader_init_ex(reader, buffer, offset, count, 1U);
+}
+
+robotraconteurlite_status robotraconteurlite_message_reader_set_string_table(
+    struct robotraconteurlite_message_reader* reader, const struct robotraconteurlite_string_table* table)
+{
+    assert(reader != NULL);
+
+    reader->string_table = table;
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status robotraconteurlite_message_reader_set_string_views(
+    struct robotraconteurlite_message_reader* reader, uint8_t string_views)
+{
+    assert(reader != NULL);
+
+    reader->string_views = string_views;
 
     return ROBOTRACONTEURLITE_ERROR_SUCCESS;
 }
 
 static robotraconteurlite_status robotraconteurlite_message_read_header_string(
-    struct robotraconteurlite_buffer_vec* buffer, size_t offset, uint16_t str_len,
+    struct robotraconteurlite_buffer_vec_cursor* cursor, size_t offset, uint16_t str_len,
     struct robotraconteurlite_string* str)
 {
     robotraconteurlite_status rv = -1;
@@ -114,7 +154,7 @@ static robotraconteurlite_status robotraconteurlite_message_read_header_string(
             return ROBOTRACONTEURLITE_ERROR_INVALID_ARGUMENT;
         }
 
-        rv = robotraconteurlite_buffer_vec_copy_to_string(buffer, offset, str, 0, str_len);
+        rv = robotraconteurlite_buffer_vec_cursor_read(cursor, offset, str->data, str_len);
         if (FAILED(rv))
         {
             return rv;
@@ -125,11 +165,60 @@ static robotraconteurlite_status robotraconteurlite_message_read_header_string(
     }
 }
 
-static robotraconteurlite_status robotraconteurlite_message_read_uint32(struct robotraconteurlite_buffer_vec* buffer,
-                                                                        size_t* offset, uint32_t* val)
+/* Resolve a string sent as a code, using the same copy semantics as robotraconteurlite_message_read_header_string.
+   With string_views set, str is pointed at the table storage instead. */
+static robotraconteurlite_status robotraconteurlite_message_read_header_string_code(
+    const struct robotraconteurlite_string_table* table, uint32_t code, uint8_t string_views,
+    struct robotraconteurlite_string* str)
+{
+    struct robotraconteurlite_string value;
+    robotraconteurlite_status rv = -1;
+
+    (void)memset(&value, 0, sizeof(value));
+    if ((table != NULL) && (code != 0U))
+    {
+        rv = robotraconteurlite_string_table_find_string(table, code, &value);
+        if (FAILED(rv) && (rv != ROBOTRACONTEURLITE_ERROR_KEY_NOT_FOUND))
+        {
+            return rv;
+        }
+    }
+
+    if (value.len == 0U)
+    {
+        str->data = NULL;
+        str->len = 0;
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    }
+
+    if (string_views != 0U)
+    {
+        *str = value;
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    }
+
+    if ((str->data == NULL) && (str->len == 0U))
+    {
+        str->len = value.len;
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    }
+
+    assert(str->data != NULL);
+    if (str->len < value.len)
+    {
+        return ROBOTRACONTEURLITE_ERROR_INVALID_ARGUMENT;
+    }
+
+    (void)memcpy(str->data, value.data, value.len);
+    str->len = value.len;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+static robotraconteurlite_status robotraconteurlite_message_read_uint32(
+    struct robotraconteurlite_buffer_vec_cursor* cursor, size_t* offset, uint32_t* val)
 {
     robotraconteurlite_status rv = -1;
-    rv = robotraconteurlite_buffer_vec_copy_to_uint32(buffer, *offset, val);
+    rv = robotraconteurlite_buffer_vec_cursor_read(cursor, *offset, val, 4U);
     if (FAILED(rv))
     {
         return rv;
@@ -138,11 +227,11 @@ static robotraconteurlite_status robotraconteurlite_message_read_uint32(struct r
     return ROBOTRACONTEURLITE_ERROR_SUCCESS;
 }
 
-static robotraconteurlite_status robotraconteurlite_message_read_uint16(struct robotraconteurlite_buffer_vec* buffer,
-                                                                        size_t* offset, uint16_t* val)
+static robotraconteurlite_status robotraconteurlite_message_read_uint16(
+    struct robotraconteurlite_buffer_vec_cursor* cursor, size_t* offset, uint16_t* val)
 {
     robotraconteurlite_status rv = -1;
-    rv = robotraconteurlite_buffer_vec_copy_to_uint16(buffer, *offset, val);
+    rv = robotraconteurlite_buffer_vec_cursor_read(cursor, *offset, val, 2U);
     if (FAILED(rv))
     {
         return rv;
@@ -151,11 +240,11 @@ static robotraconteurlite_status robotraconteurlite_message_read_uint16(struct r
     return rv;
 }
 
-static robotraconteurlite_status robotraconteurlite_message_read_uint8(struct robotraconteurlite_buffer_vec* buffer,
-                                                                       size_t* offset, uint8_t* val)
+static robotraconteurlite_status robotraconteurlite_message_read_uint8(
+    struct robotraconteurlite_buffer_vec_cursor* cursor, size_t* offset, uint8_t* val)
 {
     robotraconteurlite_status rv = -1;
-    rv = robotraconteurlite_buffer_vec_copy_to_uint8(buffer, *offset, val);
+    rv = robotraconteurlite_buffer_vec_cursor_read(cursor, *offset, val, 1U);
     if (FAILED(rv))
     {
         return rv;
@@ -164,12 +253,12 @@ static robotraconteurlite_status robotraconteurlite_message_read_uint8(struct ro
     return rv;
 }
 
-static robotraconteurlite_status robotraconteurlite_message_read_uint_x(struct robotraconteurlite_buffer_vec* buffer,
-                                                                        size_t* offset, uint32_t* val)
+static robotraconteurlite_status robotraconteurlite_message_read_uint_x(
+    struct robotraconteurlite_buffer_vec_cursor* cursor, size_t* offset, uint32_t* val)
 {
     robotraconteurlite_status rv = 0;
     uint8_t b = 0;
-    rv = robotraconteurlite_message_read_uint8(buffer, offset, &b);
+    rv = robotraconteurlite_message_read_uint8(cursor, offset, &b);
     if (FAILED(rv))
     {
         return rv;
@@ -184,7 +273,7 @@ static robotraconteurlite_status robotraconteurlite_message_read_uint_x(struct r
     {
     case 253: {
         uint16_t val16 = 0;
-        rv = robotraconteurlite_message_read_uint16(buffer, offset, &val16);
+        rv = robotraconteurlite_message_read_uint16(cursor, offset, &val16);
         if (FAILED(rv))
         {
             return rv;
@@ -193,18 +282,18 @@ static robotraconteurlite_status robotraconteurlite_message_read_uint_x(struct r
         return ROBOTRACONTEURLITE_ERROR_SUCCESS;
     }
     case 254:
-        return robotraconteurlite_message_read_uint32(buffer, offset, val);
+        return robotraconteurlite_message_read_uint32(cursor, offset, val);
     default:
         return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
     }
 }
 
-static robotraconteurlite_status robotraconteurlite_message_read_int_x(struct robotraconteurlite_buffer_vec* buffer,
-                                                                       size_t* offset, int32_t* val)
+static robotraconteurlite_status robotraconteurlite_message_read_int_x(
+    struct robotraconteurlite_buffer_vec_cursor* cursor, size_t* offset, int32_t* val)
 {
     robotraconteurlite_status rv = 0;
     int8_t b = 0;
-    rv = robotraconteurlite_buffer_vec_copy_to_int8(buffer, *offset, &b);
+    rv = robotraconteurlite_buffer_vec_cursor_read(cursor, *offset, &b, 1U);
     if (FAILED(rv))
     {
         return rv;
@@ -220,7 +309,7 @@ static robotraconteurlite_status robotraconteurlite_message_read_int_x(struct ro
     {
     case 125: {
         int16_t val16 = 0;
-        rv = robotraconteurlite_buffer_vec_copy_to_int16(buffer, *offset, &val16);
+        rv = robotraconteurlite_buffer_vec_cursor_read(cursor, *offset, &val16, 2U);
         if (FAILED(rv))
         {
             return rv;
@@ -231,7 +320,7 @@ static robotraconteurlite_status robotraconteurlite_message_read_int_x(struct ro
     }
     case 126: {
         int32_t val32 = 0;
-        rv = robotraconteurlite_buffer_vec_copy_to_int32(buffer, *offset, &val32);
+        rv = robotraconteurlite_buffer_vec_cursor_read(cursor, *offset, &val32, 4U);
         if (FAILED(rv))
         {
             return rv;
@@ -245,28 +334,170 @@ static robotraconteurlite_status robotraconteurlite_message_read_int_x(struct ro
     }
 }
 
-static robotraconteurlite_status robotraconteurlite_message_read_count(struct robotraconteurlite_buffer_vec* buffer,
-                                                                       uint16_t ver, size_t* offset, uint32_t* val)
+/* Contiguous view of a Message 4 header. The span is looked up once per header, then fields inside the view are
+   decoded directly from memory. Fields that are not fully inside the view, for example when the header straddles
+   buffer segments, fall back to the cursor. */
+struct robotraconteurlite_message_header_view
+{
+    struct robotraconteurlite_buffer_vec_cursor* cursor;
+    const uint8_t* data;
+    size_t offset;
+    size_t len;
+};
+
+static void robotraconteurlite_message_header_view_init(struct robotraconteurlite_message_header_view* view,
+                                                        struct robotraconteurlite_buffer_vec_cursor* cursor,
+                                                        size_t offset, size_t max_len)
+{
+    struct robotraconteurlite_buffer span;
+
+    view->cursor = cursor;
+    view->data = NULL;
+    view->offset = offset;
+    view->len = 0;
+
+    (void)memset(&span, 0, sizeof(span));
+    if (robotraconteurlite_buffer_vec_cursor_peek(cursor, offset, &span) == ROBOTRACONTEURLITE_ERROR_SUCCESS)
+    {
+        view->data = span.data;
+        view->len = (span.len < max_len) ? span.len : max_len;
+    }
+}
+
+/* Returns a pointer to len bytes at offset, or NULL if they are not inside the view */
+static const uint8_t* robotraconteurlite_message_header_view_get(
+    const struct robotraconteurlite_message_header_view* view, size_t offset, size_t len)
+{
+    size_t p = offset - view->offset;
+    if ((view->data == NULL) || (offset < view->offset) || (p > view->len) || ((view->len - p) < len))
+    {
+        return NULL;
+    }
+    return &view->data[p];
+}
+
+static robotraconteurlite_status robotraconteurlite_message_view_read_uint8(
+    struct robotraconteurlite_message_header_view* view, size_t* offset, uint8_t* val)
+{
+    const uint8_t* d = robotraconteurlite_message_header_view_get(view, *offset, 1U);
+    if (d == NULL)
+    {
+        return robotraconteurlite_message_read_uint8(view->cursor, offset, val);
+    }
+    *val = d[0];
+    *offset += 1U;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+static robotraconteurlite_status robotraconteurlite_message_view_read_uint16(
+    struct robotraconteurlite_message_header_view* view, size_t* offset, uint16_t* val)
+{
+    const uint8_t* d = robotraconteurlite_message_header_view_get(view, *offset, 2U);
+    if (d == NULL)
+    {
+        return robotraconteurlite_message_read_uint16(view->cursor, offset, val);
+    }
+    (void)memcpy(val, d, 2U);
+    *offset += 2U;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+static robotraconteurlite_status robotraconteurlite_message_view_read_uint32(
+    struct robotraconteurlite_message_header_view* view, size_t* offset, uint32_t* val)
+{
+    const uint8_t* d = robotraconteurlite_message_header_view_get(view, *offset, 4U);
+    if (d == NULL)
+    {
+        return robotraconteurlite_message_read_uint32(view->cursor, offset, val);
+    }
+    (void)memcpy(val, d, 4U);
+    *offset += 4U;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+static robotraconteurlite_status robotraconteurlite_message_view_read_uint_x(
+    struct robotraconteurlite_message_header_view* view, size_t* offset, uint32_t* val)
+{
+    /* Load the code byte and the widest payload at once, then select the result without per-width branches */
+    const uint8_t* d = robotraconteurlite_message_header_view_get(view, *offset, 5U);
+    uint8_t b = 0;
+    uint16_t v16 = 0;
+    uint32_t v32 = 0;
+    size_t is16 = 0;
+    size_t is32 = 0;
+
+    if (d == NULL)
+    {
+        return robotraconteurlite_message_read_uint_x(view->cursor, offset, val);
+    }
+
+    b = d[0];
+    if (b == 255U)
+    {
+        return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
+    }
+    (void)memcpy(&v16, &d[1], 2U);
+    (void)memcpy(&v32, &d[1], 4U);
+    is16 = (b == 253U) ? 1U : 0U;
+    is32 = (b == 254U) ? 1U : 0U;
+
+    *val = (b <= 252U) ? (uint32_t)b : ((is32 != 0U) ? v32 : (uint32_t)v16);
+    *offset += 1U + (is16 * 2U) + (is32 * 4U);
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+static robotraconteurlite_status robotraconteurlite_message_view_read_int_x(
+    struct robotraconteurlite_message_header_view* view, size_t* offset, int32_t* val)
+{
+    const uint8_t* d = robotraconteurlite_message_header_view_get(view, *offset, 5U);
+    int8_t b = 0;
+    int16_t v16 = 0;
+    int32_t v32 = 0;
+    size_t is16 = 0;
+    size_t is32 = 0;
+
+    if (d == NULL)
+    {
+        return robotraconteurlite_message_read_int_x(view->cursor, offset, val);
+    }
+
+    (void)memcpy(&b, d, 1U);
+    if (b == 127)
+    {
+        return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
+    }
+    (void)memcpy(&v16, &d[1], 2U);
+    (void)memcpy(&v32, &d[1], 4U);
+    is16 = (b == 125) ? 1U : 0U;
+    is32 = (b == 126) ? 1U : 0U;
+
+    *val = (b <= 124) ? (int32_t)b : ((is32 != 0U) ? v32 : (int32_t)v16);
+    *offset += 1U + (is16 * 2U) + (is32 * 4U);
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+static robotraconteurlite_status robotraconteurlite_message_read_count(
+    struct robotraconteurlite_buffer_vec_cursor* cursor, uint16_t ver, size_t* offset, uint32_t* val)
 {
     switch (ver)
     {
     case 2:
-        return robotraconteurlite_message_read_uint32(buffer, offset, val);
+        return robotraconteurlite_message_read_uint32(cursor, offset, val);
     case 4:
-        return robotraconteurlite_message_read_uint_x(buffer, offset, val);
+        return robotraconteurlite_message_read_uint_x(cursor, offset, val);
     default:
         return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
     }
 }
 
-static robotraconteurlite_status robotraconteurlite_message_read_count2(struct robotraconteurlite_buffer_vec* buffer,
-                                                                        uint16_t ver, size_t* offset, uint32_t* val)
+static robotraconteurlite_status robotraconteurlite_message_read_count2(
+    struct robotraconteurlite_buffer_vec_cursor* cursor, uint16_t ver, size_t* offset, uint32_t* val)
 {
     switch (ver)
     {
     case 2: {
         uint16_t val16 = 0;
-        robotraconteurlite_status rv = robotraconteurlite_message_read_uint16(buffer, offset, &val16);
+        robotraconteurlite_status rv = robotraconteurlite_message_read_uint16(cursor, offset, &val16);
         if (FAILED(rv))
         {
             return rv;
@@ -275,18 +506,21 @@ static robotraconteurlite_status robotraconteurlite_message_read_count2(struct r
         return rv;
     }
     case 4:
-        return robotraconteurlite_message_read_uint_x(buffer, offset, val);
+        return robotraconteurlite_message_read_uint_x(cursor, offset, val);
     default:
         return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
     }
 }
 
-static robotraconteurlite_status robotraconteurlite_message_read_nodeid(struct robotraconteurlite_buffer_vec* buffer,
-                                                                        size_t* offset,
-                                                                        struct robotraconteurlite_array_uint8* val)
+static robotraconteurlite_status robotraconteurlite_message_read_nodeid(
+    struct robotraconteurlite_buffer_vec_cursor* cursor, size_t* offset, struct robotraconteurlite_array_uint8* val)
 {
     robotraconteurlite_status rv = -1;
-    rv = robotraconteurlite_buffer_vec_copy_to_uint8_array(buffer, *offset, val, 0, 16);
+    if (val->len < 16U)
+    {
+        return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+    }
+    rv = robotraconteurlite_buffer_vec_cursor_read(cursor, *offset, val->data, 16U);
     if (FAILED(rv))
     {
         return rv;
@@ -302,12 +536,12 @@ struct robotraconteurlite_message_read_header_string_info
 };
 
 static robotraconteurlite_status robotraconteurlite_message_read_header_string_with_len_prefix2_1(
-    struct robotraconteurlite_buffer_vec* buffer, size_t* offset,
+    struct robotraconteurlite_buffer_vec_cursor* cursor, size_t* offset,
     struct robotraconteurlite_message_read_header_string_info* str_info)
 {
     robotraconteurlite_status rv = -1;
     uint16_t str_len = 0;
-    rv = robotraconteurlite_message_read_uint16(buffer, offset, &str_len);
+    rv = robotraconteurlite_message_read_uint16(cursor, offset, &str_len);
     if (FAILED(rv))
     {
         return rv;
@@ -319,19 +553,19 @@ static robotraconteurlite_status robotraconteurlite_message_read_header_string_w
 }
 
 static robotraconteurlite_status robotraconteurlite_message_read_header_string_with_len_prefix2_2(
-    struct robotraconteurlite_buffer_vec* buffer, struct robotraconteurlite_message_read_header_string_info* str_info,
-    struct robotraconteurlite_string* str)
+    struct robotraconteurlite_buffer_vec_cursor* cursor,
+    struct robotraconteurlite_message_read_header_string_info* str_info, struct robotraconteurlite_string* str)
 {
-    return robotraconteurlite_message_read_header_string(buffer, str_info->offset, str_info->str_len, str);
+    return robotraconteurlite_message_read_header_string(cursor, str_info->offset, str_info->str_len, str);
 }
 
 static robotraconteurlite_status robotraconteurlite_message_read_header_string_with_len_prefix4_1(
-    struct robotraconteurlite_buffer_vec* buffer, size_t* offset,
+    struct robotraconteurlite_message_header_view* view, size_t* offset,
     struct robotraconteurlite_message_read_header_string_info* str_info)
 {
     robotraconteurlite_status rv = -1;
     uint32_t str_len = 0;
-    rv = robotraconteurlite_message_read_uint_x(buffer, offset, &str_len);
+    rv = robotraconteurlite_message_view_read_uint_x(view, offset, &str_len);
     if (FAILED(rv))
     {
         return rv;
@@ -343,10 +577,34 @@ static robotraconteurlite_status robotraconteurlite_message_read_header_string_w
 }
 
 static robotraconteurlite_status robotraconteurlite_message_read_header_string_with_len_prefix4_2(
-    struct robotraconteurlite_buffer_vec* buffer, struct robotraconteurlite_message_read_header_string_info* str_info,
-    struct robotraconteurlite_string* str)
+    struct robotraconteurlite_buffer_vec_cursor* cursor,
+    struct robotraconteurlite_message_read_header_string_info* str_info, struct robotraconteurlite_string* str)
+{
+    return robotraconteurlite_message_read_header_string(cursor, str_info->offset, str_info->str_len, str);
+}
+
+/* Read a message or entry header string. With string_views set, a string that is contiguous in the buffer is
+   returned as a view into the buffer instead of being copied into the storage of str. */
+static robotraconteurlite_status robotraconteurlite_message_read_header_string_ex(
+    struct robotraconteurlite_buffer_vec_cursor* cursor, uint8_t string_views,
+    const struct robotraconteurlite_message_read_header_string_info* str_info, struct robotraconteurlite_string* str)
 {
-    return robotraconteurlite_message_read_header_string(buffer, str_info->offset, str_info->str_len, str);
+    struct robotraconteurlite_buffer span;
+    robotraconteurlite_status rv = -1;
+
+    if ((string_views != 0U) && (str_info->str_len > 0U))
+    {
+        (void)memset(&span, 0, sizeof(span));
+        rv = robotraconteurlite_buffer_vec_cursor_peek(cursor, str_info->offset, &span);
+        if (SUCCEEDED(rv) && (span.len >= str_info->str_len))
+        {
+            str->data = (char*)span.data;
+            str->len = str_info->str_len;
+            return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+        }
+    }
+
+    return robotraconteurlite_message_read_header_string(cursor, str_info->offset, str_info->str_len, str);
 }
 
 robotraconteurlite_status robotraconteurlite_message_reader_read_header(
@@ -370,6 +628,7 @@ robotraconteurlite_status robotraconteurlite_message_reader_read_header4_ex(
     size_t o = reader->buffer_offset;
     size_t start_o = o;
     robotraconteurlite_status rv = -1;
+    struct robotraconteurlite_message_header_view view;
     struct robotraconteurlite_array_uint8 sender_nodeid_array;
     struct robotraconteurlite_array_uint8 recv_nodeid_array;
     struct robotraconteurlite_message_read_header_string_info sender_nodename_info;
@@ -385,22 +644,26 @@ robotraconteurlite_status robotraconteurlite_message_reader_read_header4_ex(
     (void)memset(&meta_info, 0, sizeof(meta_info));
 
     temp_buffer_info.start_buffer_offset = reader->buffer_offset;
+    temp_buffer_info.sender_endpoint_offset = SIZE_MAX;
+    temp_buffer_info.receiver_endpoint_offset = SIZE_MAX;
 
     sender_nodeid_array.data = header->sender_nodeid.data;
     sender_nodeid_array.len = 16;
     recv_nodeid_array.data = header->receiver_nodeid.data;
     recv_nodeid_array.len = 16;
 
+    robotraconteurlite_message_header_view_init(&view, &reader->cursor, reader->buffer_offset, reader->buffer_count);
+
     /* skip RRAC magic */
     o += 4U;
 
-    rv = robotraconteurlite_message_read_uint32(reader->buffer, &o, &header->message_size);
+    rv = robotraconteurlite_message_read_uint32(&reader->cursor, &o, &header->message_size);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    rv = robotraconteurlite_message_read_uint16(reader->buffer, &o, &header->message_version);
+    rv = robotraconteurlite_message_view_read_uint16(&view, &o, &header->message_version);
     if (FAILED(rv))
     {
         return rv;
@@ -411,7 +674,7 @@ robotraconteurlite_status robotraconteurlite_message_reader_read_header4_ex(
         return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
     }
 
-    rv = robotraconteurlite_message_read_uint_x(reader->buffer, &o, &header->header_size);
+    rv = robotraconteurlite_message_view_read_uint_x(&view, &o, &header->header_size);
     if (FAILED(rv))
     {
         return rv;
@@ -419,7 +682,7 @@ robotraconteurlite_status robotraconteurlite_message_reader_read_header4_ex(
 
     temp_buffer_info.header_size = header->header_size;
 
-    rv = robotraconteurlite_message_read_uint8(reader->buffer, &o, &flags);
+    rv = robotraconteurlite_message_view_read_uint8(&view, &o, &flags);
     if (FAILED(rv))
     {
         return rv;
@@ -427,26 +690,27 @@ robotraconteurlite_status robotraconteurlite_message_reader_read_header4_ex(
 
     if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGE_FLAGS_ROUTING_INFO))
     {
-        rv = robotraconteurlite_message_read_nodeid(reader->buffer, &o, &sender_nodeid_array);
+        rv = robotraconteurlite_message_read_nodeid(&reader->cursor, &o, &sender_nodeid_array);
         if (FAILED(rv))
         {
             return rv;
         }
 
-        rv = robotraconteurlite_message_read_nodeid(reader->buffer, &o, &recv_nodeid_array);
+        rv = robotraconteurlite_message_read_nodeid(&reader->cursor, &o, &recv_nodeid_array);
         if (FAILED(rv))
         {
             return rv;
         }
 
         rv =
-            robotraconteurlite_message_read_header_string_with_len_prefix4_1(reader->buffer, &o, &sender_nodename_info);
+            robotraconteurlite_message_read_header_string_with_len_prefix4_1(&view, &o,
+                                                                             &sender_nodename_info);
         if (FAILED(rv))
         {
             return rv;
         }
 
-        rv = robotraconteurlite_message_read_header_string_with_len_prefix4_1(reader->buffer, &o,
+        rv = robotraconteurlite_message_read_header_string_with_len_prefix4_1(&view, &o,
                                                                               &receiver_nodename_info);
         if (FAILED(rv))
         {
@@ -461,13 +725,15 @@ robotraconteurlite_status robotraconteurlite_message_reader_read_header4_ex(
 
     if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGE_FLAGS_ENDPOINT_INFO))
     {
-        rv = robotraconteurlite_message_read_uint_x(reader->buffer, &o, &header->sender_endpoint);
+        temp_buffer_info.sender_endpoint_offset = o;
+        rv = robotraconteurlite_message_view_read_uint_x(&view, &o, &header->sender_endpoint);
         if (FAILED(rv))
         {
             return rv;
         }
 
-        rv = robotraconteurlite_message_read_uint_x(reader->buffer, &o, &header->receiver_endpoint);
+        temp_buffer_info.receiver_endpoint_offset = o;
+        rv = robotraconteurlite_message_view_read_uint_x(&view, &o, &header->receiver_endpoint);
         if (FAILED(rv))
         {
             return rv;
@@ -481,7 +747,7 @@ robotraconteurlite_status robotraconteurlite_message_reader_read_header4_ex(
 
     if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGE_FLAGS_PRIORITY))
     {
-        rv = robotraconteurlite_message_read_uint16(reader->buffer, &o, &header->priority);
+        rv = robotraconteurlite_message_view_read_uint16(&view, &o, &header->priority);
         if (FAILED(rv))
         {
             return rv;
@@ -494,19 +760,19 @@ robotraconteurlite_status robotraconteurlite_message_reader_read_header4_ex(
 
     if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGE_FLAGS_META_INFO))
     {
-        rv = robotraconteurlite_message_read_header_string_with_len_prefix4_1(reader->buffer, &o, &meta_info);
+        rv = robotraconteurlite_message_read_header_string_with_len_prefix4_1(&view, &o, &meta_info);
         if (FAILED(rv))
         {
             return rv;
         }
 
-        rv = robotraconteurlite_message_read_uint16(reader->buffer, &o, &header->message_id);
+        rv = robotraconteurlite_message_view_read_uint16(&view, &o, &header->message_id);
         if (FAILED(rv))
         {
             return rv;
         }
 
-        rv = robotraconteurlite_message_read_uint16(reader->buffer, &o, &header->message_res_id);
+        rv = robotraconteurlite_message_view_read_uint16(&view, &o, &header->message_res_id);
         if (FAILED(rv))
         {
             return rv;
@@ -521,7 +787,7 @@ robotraconteurlite_status robotraconteurlite_message_reader_read_header4_ex(
     if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGE_FLAGS_STRING_TABLE))
     {
         uint32_t string_table_size = 0;
-        rv = robotraconteurlite_message_read_uint_x(reader->buffer, &o, &string_table_size);
+        rv = robotraconteurlite_message_view_read_uint_x(&view, &o, &string_table_size);
         if (FAILED(rv))
         {
             return rv;
@@ -532,7 +798,7 @@ robotraconteurlite_status robotraconteurlite_message_reader_read_header4_ex(
     if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGE_FLAGS_MULTIPLE_ENTRIES))
     {
         temp_buffer_info.entry_count_offset = o;
-        rv = robotraconteurlite_message_read_uint_x(reader->buffer, &o, &header->entry_count);
+        rv = robotraconteurlite_message_view_read_uint_x(&view, &o, &header->entry_count);
         if (FAILED(rv))
         {
             return rv;
@@ -547,7 +813,7 @@ robotraconteurlite_status robotraconteurlite_message_reader_read_header4_ex(
     if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGE_FLAGS_EXTENDED))
     {
         uint32_t extended_size = 0;
-        rv = robotraconteurlite_message_read_uint_x(reader->buffer, &o, &extended_size);
+        rv = robotraconteurlite_message_view_read_uint_x(&view, &o, &extended_size);
         if (FAILED(rv))
         {
             return rv;
@@ -562,15 +828,15 @@ robotraconteurlite_status robotraconteurlite_message_reader_read_header4_ex(
 
     if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGE_FLAGS_ROUTING_INFO))
     {
-        rv = robotraconteurlite_message_read_header_string_with_len_prefix4_2(reader->buffer, &sender_nodename_info,
-                                                                              &header->sender_nodename);
+        rv = robotraconteurlite_message_read_header_string_ex(
+            &reader->cursor, reader->string_views, &sender_nodename_info, &header->sender_nodename);
         if (FAILED(rv))
         {
             return rv;
         }
 
-        rv = robotraconteurlite_message_read_header_string_with_len_prefix4_2(reader->buffer, &receiver_nodename_info,
-                                                                              &header->receiver_nodename);
+        rv = robotraconteurlite_message_read_header_string_ex(
+            &reader->cursor, reader->string_views, &receiver_nodename_info, &header->receiver_nodename);
         if (FAILED(rv))
         {
             return rv;
@@ -586,8 +852,8 @@ robotraconteurlite_status robotraconteurlite_message_reader_read_header4_ex(
 
     if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGE_FLAGS_META_INFO))
     {
-        rv = robotraconteurlite_message_read_header_string_with_len_prefix4_2(reader->buffer, &meta_info,
-                                                                              &header->metadata);
+        rv = robotraconteurlite_message_read_header_string_ex(
+            &reader->cursor, reader->string_views, &meta_info, &header->metadata);
         if (FAILED(rv))
         {
             return rv;
@@ -624,6 +890,8 @@ robotraconteurlite_status robotraconteurlite_message_reader_read_header2_ex(
     struct robotraconteurlite_message_buffer_info temp_buffer_info;
 
     temp_buffer_info.start_buffer_offset = reader->buffer_offset;
+    temp_buffer_info.sender_endpoint_offset = SIZE_MAX;
+    temp_buffer_info.receiver_endpoint_offset = SIZE_MAX;
 
     sender_nodeid_array.data = header->sender_nodeid.data;
     sender_nodeid_array.len = 16;
@@ -633,20 +901,20 @@ robotraconteurlite_status robotraconteurlite_message_reader_read_header2_ex(
     /* skip RRAC magic */
     o += 4U;
 
-    rv = robotraconteurlite_message_read_uint32(reader->buffer, &o, &header->message_size);
+    rv = robotraconteurlite_message_read_uint32(&reader->cursor, &o, &header->message_size);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    rv = robotraconteurlite_message_read_uint16(reader->buffer, &o, &header->message_version);
+    rv = robotraconteurlite_message_read_uint16(&reader->cursor, &o, &header->message_version);
     if (FAILED(rv))
     {
         return rv;
     }
     {
         uint16_t header_size_16 = 0;
-        rv = robotraconteurlite_message_read_uint16(reader->buffer, &o, &header_size_16);
+        rv = robotraconteurlite_message_read_uint16(&reader->cursor, &o, &header_size_16);
         if (FAILED(rv))
         {
             return rv;
@@ -656,43 +924,45 @@ robotraconteurlite_status robotraconteurlite_message_reader_read_header2_ex(
 
     temp_buffer_info.header_size = header->header_size;
 
-    rv = robotraconteurlite_message_read_nodeid(reader->buffer, &o, &sender_nodeid_array);
+    rv = robotraconteurlite_message_read_nodeid(&reader->cursor, &o, &sender_nodeid_array);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    rv = robotraconteurlite_message_read_nodeid(reader->buffer, &o, &recv_nodeid_array);
+    rv = robotraconteurlite_message_read_nodeid(&reader->cursor, &o, &recv_nodeid_array);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    rv = robotraconteurlite_message_read_uint32(reader->buffer, &o, &header->sender_endpoint);
+    temp_buffer_info.sender_endpoint_offset = o;
+    rv = robotraconteurlite_message_read_uint32(&reader->cursor, &o, &header->sender_endpoint);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    rv = robotraconteurlite_message_read_uint32(reader->buffer, &o, &header->receiver_endpoint);
+    temp_buffer_info.receiver_endpoint_offset = o;
+    rv = robotraconteurlite_message_read_uint32(&reader->cursor, &o, &header->receiver_endpoint);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    rv = robotraconteurlite_message_read_header_string_with_len_prefix2_1(reader->buffer, &o, &sender_nodename_info);
+    rv = robotraconteurlite_message_read_header_string_with_len_prefix2_1(&reader->cursor, &o, &sender_nodename_info);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    rv = robotraconteurlite_message_read_header_string_with_len_prefix2_1(reader->buffer, &o, &receiver_nodename_info);
+    rv = robotraconteurlite_message_read_header_string_with_len_prefix2_1(&reader->cursor, &o, &receiver_nodename_info);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    rv = robotraconteurlite_message_read_header_string_with_len_prefix2_1(reader->buffer, &o, &meta_info);
+    rv = robotraconteurlite_message_read_header_string_with_len_prefix2_1(&reader->cursor, &o, &meta_info);
     if (FAILED(rv))
     {
         return rv;
@@ -702,7 +972,7 @@ robotraconteurlite_status robotraconteurlite_message_reader_read_header2_ex(
 
     {
         uint16_t entry_count_16 = 0;
-        rv = robotraconteurlite_message_read_uint16(reader->buffer, &o, &entry_count_16);
+        rv = robotraconteurlite_message_read_uint16(&reader->cursor, &o, &entry_count_16);
         if (FAILED(rv))
         {
             return rv;
@@ -710,13 +980,13 @@ robotraconteurlite_status robotraconteurlite_message_reader_read_header2_ex(
         header->entry_count = entry_count_16;
     }
 
-    rv = robotraconteurlite_message_read_uint16(reader->buffer, &o, &header->message_id);
+    rv = robotraconteurlite_message_read_uint16(&reader->cursor, &o, &header->message_id);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    rv = robotraconteurlite_message_read_uint16(reader->buffer, &o, &header->message_res_id);
+    rv = robotraconteurlite_message_read_uint16(&reader->cursor, &o, &header->message_res_id);
     if (FAILED(rv))
     {
         return rv;
@@ -727,22 +997,22 @@ robotraconteurlite_status robotraconteurlite_message_reader_read_header2_ex(
         return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
     }
 
-    rv = robotraconteurlite_message_read_header_string_with_len_prefix2_2(reader->buffer, &sender_nodename_info,
-                                                                          &header->sender_nodename);
+    rv = robotraconteurlite_message_read_header_string_ex(
+        &reader->cursor, reader->string_views, &sender_nodename_info, &header->sender_nodename);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    rv = robotraconteurlite_message_read_header_string_with_len_prefix2_2(reader->buffer, &receiver_nodename_info,
-                                                                          &header->receiver_nodename);
+    rv = robotraconteurlite_message_read_header_string_ex(
+        &reader->cursor, reader->string_views, &receiver_nodename_info, &header->receiver_nodename);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    rv =
-        robotraconteurlite_message_read_header_string_with_len_prefix2_2(reader->buffer, &meta_info, &header->metadata);
+    rv = robotraconteurlite_message_read_header_string_ex(
+        &reader->cursor, reader->string_views, &meta_info, &header->metadata);
     if (FAILED(rv))
     {
         return rv;
@@ -767,7 +1037,7 @@ robotraconteurlite_status robotraconteurlite_message_reader_read_header_ex(
 
     o += 8U;
 
-    rv = robotraconteurlite_message_read_uint16(reader->buffer, &o, &header->message_version);
+    rv = robotraconteurlite_message_read_uint16(&reader->cursor, &o, &header->message_version);
     if (FAILED(rv))
     {
         return rv;
@@ -803,7 +1073,7 @@ robotraconteurlite_status robotraconteurlite_message_reader_begin_read_entries(
 
     o += message_header.header_size;
     o2 = o;
-    rv = robotraconteurlite_message_read_count(reader->buffer, reader->message_version, &o2, &entry_size);
+    rv = robotraconteurlite_message_read_count(&reader->cursor, reader->message_version, &o2, &entry_size);
     if (FAILED(rv))
     {
         return rv;
@@ -815,12 +1085,17 @@ robotraconteurlite_status robotraconteurlite_message_reader_begin_read_entries(
     }
 
     entry_reader->buffer = reader->buffer;
+    entry_reader->cursor = reader->cursor;
     entry_reader->buffer_offset = reader->buffer_offset + o;
     entry_reader->buffer_count = entry_size;
     entry_reader->buffer_remaining = reader->buffer_count - o - entry_size;
     entry_reader->current_entry = 0;
     entry_reader->entry_count_offset = message_buffer_info.entry_count_offset;
     entry_reader->message_version = reader->message_version;
+    entry_reader->string_table = reader->string_table;
+    entry_reader->string_views = reader->string_views;
+    entry_reader->validated = reader->validated;
+    entry_reader->element_index = NULL;
 
     return ROBOTRACONTEURLITE_ERROR_SUCCESS;
 }
@@ -839,7 +1114,8 @@ robotraconteurlite_status robotraconteurlite_messageentry_reader_move_next(
     {
         return ROBOTRACONTEURLITE_ERROR_NO_MORE;
     }
-    rv = robotraconteurlite_message_read_count2(entry_reader->buffer, entry_reader->message_version, &o2, &entry_count);
+    rv = robotraconteurlite_message_read_count2(&entry_reader->cursor, entry_reader->message_version, &o2,
+                                                &entry_count);
     if (FAILED(rv))
     {
         return rv;
@@ -851,7 +1127,7 @@ robotraconteurlite_status robotraconteurlite_messageentry_reader_move_next(
     }
 
     o2 = o;
-    rv = robotraconteurlite_message_read_count(entry_reader->buffer, entry_reader->message_version, &o2, &entry_size);
+    rv = robotraconteurlite_message_read_count(&entry_reader->cursor, entry_reader->message_version, &o2, &entry_size);
     if (FAILED(rv))
     {
         return rv;
@@ -866,160 +1142,416 @@ robotraconteurlite_status robotraconteurlite_messageentry_reader_move_next(
     entry_reader->buffer_count = entry_size;
     entry_reader->buffer_remaining -= entry_size;
     entry_reader->current_entry++;
+    entry_reader->element_index = NULL;
 
     return ROBOTRACONTEURLITE_ERROR_SUCCESS;
 }
 
-robotraconteurlite_status robotraconteurlite_messageentry_reader_find_element(
-    struct robotraconteurlite_messageentry_reader* entry_reader, const struct robotraconteurlite_string* element_name,
-    struct robotraconteurlite_messageelement_reader* element_reader)
+robotraconteurlite_status robotraconteurlite_messageentry_reader_seek(
+    struct robotraconteurlite_messageentry_reader* entry_reader, size_t entry_offset, size_t entry_index)
 {
-    char temp_str_data[16];
+    size_t list_end = entry_reader->buffer_offset + entry_reader->buffer_count + entry_reader->buffer_remaining;
+    size_t o2 = entry_reader->entry_count_offset;
+    uint32_t entry_count = 0;
+    uint32_t entry_size = 0;
     robotraconteurlite_status rv = -1;
 
-    assert(element_name != NULL);
-    assert(element_name->data != NULL);
+    if (entry_index == entry_reader->current_entry)
+    {
+        return (entry_offset == entry_reader->buffer_offset) ? ROBOTRACONTEURLITE_ERROR_SUCCESS
+                                                             : ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER;
+    }
 
-    rv = robotraconteurlite_messageentry_reader_begin_read_elements(entry_reader, element_reader);
+    if ((entry_reader->current_entry != 0U) || (o2 == SIZE_MAX))
+    {
+        return ROBOTRACONTEURLITE_ERROR_INVALID_OPERATION;
+    }
+
+    rv = robotraconteurlite_message_read_count2(&entry_reader->cursor, entry_reader->message_version, &o2,
+                                                &entry_count);
     if (FAILED(rv))
     {
-        if (NO_MORE(rv))
-        {
-            return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_NOT_FOUND;
-        }
         return rv;
     }
-    while (1)
+
+    if (entry_index >= entry_count)
     {
-        struct robotraconteurlite_messageelement_header element_header;
-        struct robotraconteurlite_messageelement_buffer_info element_buffer_info;
-        size_t str_len = 0;
-        size_t str_offset = 0;
-        (void)memset(&element_header, 0, sizeof(element_header));
-        (void)memset(&element_buffer_info, 0, sizeof(element_buffer_info));
+        return ROBOTRACONTEURLITE_ERROR_NO_MORE;
+    }
 
-        rv = robotraconteurlite_messageelement_reader_read_header_ex(element_reader, &element_header,
-                                                                     &element_buffer_info);
+    /* Later entries start after the end of the first */
+    if ((entry_offset < (entry_reader->buffer_offset + entry_reader->buffer_count)) || (entry_offset >= list_end))
+    {
+        return ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER;
+    }
 
-        if (FAILED(rv))
-        {
-            return rv;
-        }
-        str_len = element_header.element_name.len;
+    o2 = entry_offset;
+    rv = robotraconteurlite_message_read_count(&entry_reader->cursor, entry_reader->message_version, &o2, &entry_size);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
 
-        if (str_len == element_name->len)
-        {
-            struct robotraconteurlite_string temp_str;
-            temp_str.data = temp_str_data;
-            temp_str.len = sizeof(temp_str_data);
+    if (entry_size > (list_end - entry_offset))
+    {
+        return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
+    }
 
-            do
-            {
-                size_t str_read = ((str_len <= temp_str.len) ? str_len : temp_str.len);
-                rv = robotraconteurlite_buffer_vec_copy_to_string(
-                    element_reader->buffer, element_buffer_info.element_name_str_offset + str_offset, &temp_str, 0,
-                    str_read);
-                if (FAILED(rv))
-                {
-                    return rv;
-                }
+    entry_reader->buffer_offset = entry_offset;
+    entry_reader->buffer_count = entry_size;
+    entry_reader->buffer_remaining = list_end - entry_offset - entry_size;
+    entry_reader->current_entry = entry_index;
+    entry_reader->element_index = NULL;
 
-                if (memcmp(temp_str.data, &element_name->data[str_offset], str_read) != 0)
-                {
-                    break;
-                }
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
 
-                str_len -= str_read;
-                if (str_len == 0U)
-                {
-                    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
-                }
-                str_offset += str_read;
+static robotraconteurlite_status robotraconteurlite_message_buffer_string_equal(
+    struct robotraconteurlite_buffer_vec* buffer, size_t offset, const struct robotraconteurlite_string* str,
+    uint8_t* equal)
+{
+    char temp_str_data[16];
+    struct robotraconteurlite_string temp_str;
+    struct robotraconteurlite_buffer span;
+    size_t str_len = str->len;
+    size_t str_offset = 0;
+    robotraconteurlite_status rv = -1;
+
+    *equal = 0;
 
-            } while (str_len > 0U);
+    /* Compare in place when the string is contiguous in the buffer */
+    (void)memset(&span, 0, sizeof(span));
+    rv = robotraconteurlite_buffer_vec_get_span(buffer, offset, str_len, &span);
+    if (rv == ROBOTRACONTEURLITE_ERROR_SUCCESS)
+    {
+        if ((str_len == 0U) || (memcmp(span.data, str->data, str_len) == 0))
+        {
+            *equal = 1;
         }
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    }
 
-        rv = robotraconteurlite_messageelement_reader_move_next(element_reader);
+    temp_str.data = temp_str_data;
+    temp_str.len = sizeof(temp_str_data);
+
+    while (str_len > 0U)
+    {
+        size_t str_read = ((str_len <= temp_str.len) ? str_len : temp_str.len);
+        rv = robotraconteurlite_buffer_vec_copy_to_string(buffer, offset + str_offset, &temp_str, 0, str_read);
         if (FAILED(rv))
         {
-            if (NO_MORE(rv))
-            {
-                return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_NOT_FOUND;
-            }
             return rv;
         }
+
+        if (memcmp(temp_str.data, &str->data[str_offset], str_read) != 0)
+        {
+            return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+        }
+
+        str_len -= str_read;
+        str_offset += str_read;
     }
+
+    *equal = 1;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
 }
 
-robotraconteurlite_status robotraconteurlite_messageentry_reader_find_element_verify_scalar(
-    struct robotraconteurlite_messageentry_reader* entry_reader, const struct robotraconteurlite_string* element_name,
-    struct robotraconteurlite_messageelement_reader* element_reader, uint16_t expected_data_type)
+/* Compare an element name that was either written as a string at name_offset or as name_code */
+static robotraconteurlite_status robotraconteurlite_messageelement_name_equal(
+    const struct robotraconteurlite_messageelement_reader* element_reader, size_t name_offset, uint32_t name_code,
+    const struct robotraconteurlite_string* name, uint8_t* equal)
 {
-    struct robotraconteurlite_messageelement_header header;
+    struct robotraconteurlite_string value;
     robotraconteurlite_status rv = -1;
 
-    rv = robotraconteurlite_messageentry_reader_find_element(entry_reader, element_name, element_reader);
-    if (FAILED(rv))
+    if (name_offset != SIZE_MAX)
     {
-        return rv;
+        return robotraconteurlite_message_buffer_string_equal(element_reader->buffer, name_offset, name, equal);
     }
 
-    (void)memset(&header, 0, sizeof(header));
-    rv = robotraconteurlite_messageelement_reader_read_header(element_reader, &header);
-    if (FAILED(rv))
+    *equal = 0;
+    if ((name_code == 0U) || (element_reader->string_table == NULL))
     {
-        return rv;
+        if (name->len == 0U)
+        {
+            *equal = 1;
+        }
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
     }
 
-    if (header.element_type != expected_data_type)
+    rv = robotraconteurlite_string_table_find_string(element_reader->string_table, name_code, &value);
+    if (FAILED(rv))
     {
-        return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_TYPE_MISMATCH;
+        if (rv == ROBOTRACONTEURLITE_ERROR_KEY_NOT_FOUND)
+        {
+            return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+        }
+        return rv;
     }
 
-    if (header.data_count != 1U)
+    if ((value.len == name->len) && ((name->len == 0U) || (memcmp(value.data, name->data, name->len) == 0)))
     {
-        return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_TYPE_MISMATCH;
+        *equal = 1;
     }
-
     return ROBOTRACONTEURLITE_ERROR_SUCCESS;
 }
 
-robotraconteurlite_status robotraconteurlite_messageentry_reader_find_element_verify_array(
-    struct robotraconteurlite_messageentry_reader* entry_reader, const struct robotraconteurlite_string* element_name,
-    struct robotraconteurlite_messageelement_reader* element_reader, uint16_t expected_data_type, uint32_t expected_len,
-    uint8_t var_length)
+/* Check whether the current element of element_reader is named element_name */
+static robotraconteurlite_status robotraconteurlite_messageelement_reader_name_is(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    const struct robotraconteurlite_string* element_name,
+    struct robotraconteurlite_messageelement_header* element_header, uint8_t* equal)
 {
-    struct robotraconteurlite_messageelement_header header;
+    struct robotraconteurlite_messageelement_buffer_info element_buffer_info;
     robotraconteurlite_status rv = -1;
 
-    rv = robotraconteurlite_messageentry_reader_find_element(entry_reader, element_name, element_reader);
-    if (FAILED(rv))
-    {
-        return rv;
-    }
+    *equal = 0;
+    (void)memset(element_header, 0, sizeof(*element_header));
+    (void)memset(&element_buffer_info, 0, sizeof(element_buffer_info));
 
-    (void)memset(&header, 0, sizeof(header));
-    rv = robotraconteurlite_messageelement_reader_read_header(element_reader, &header);
+    rv = robotraconteurlite_messageelement_reader_read_header_ex(element_reader, element_header, &element_buffer_info);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    if (header.element_type != expected_data_type)
+    if (element_header->element_name.len != element_name->len)
     {
-        return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_TYPE_MISMATCH;
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
     }
 
-    if (!var_length)
+    return robotraconteurlite_messageelement_name_equal(element_reader, element_buffer_info.element_name_str_offset,
+                                                        element_header->element_name_code, element_name, equal);
+}
+
+/* Scan from the current element of element_reader for an element named element_name */
+static robotraconteurlite_status robotraconteurlite_messageelement_reader_scan_find(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    const struct robotraconteurlite_string* element_name, uint16_t* element_type, uint32_t* data_count)
+{
+    robotraconteurlite_status rv = -1;
+
+    while (1)
     {
-        if (header.data_count != expected_len)
-        {
+        struct robotraconteurlite_messageelement_header element_header;
+        uint8_t equal = 0;
+
+        rv = robotraconteurlite_messageelement_reader_name_is(element_reader, element_name, &element_header, &equal);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+        if (equal != 0U)
+        {
+            *element_type = element_header.element_type;
+            *data_count = element_header.data_count;
+            return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+        }
+
+        rv = robotraconteurlite_messageelement_reader_move_next(element_reader);
+        if (FAILED(rv))
+        {
+            if (NO_MORE(rv))
+            {
+                return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_NOT_FOUND;
+            }
+            return rv;
+        }
+    }
+}
+
+/* Fill index from the element list starting at the current element of element_reader */
+static robotraconteurlite_status robotraconteurlite_messageelement_index_build(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_messageelement_index* index)
+{
+    robotraconteurlite_status rv = -1;
+    size_t i = 0;
+
+    assert(index != NULL);
+    assert(index->entries != NULL);
+
+    for (i = 0; i < index->entries_len; i++)
+    {
+        (void)memset(&index->entries[i], 0, sizeof(index->entries[i]));
+    }
+    index->entries_count = 0;
+    index->total_elements = element_reader->total_elements;
+
+    if (element_reader->total_elements > index->entries_len)
+    {
+        return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+    }
+
+    if (element_reader->total_elements == 0U)
+    {
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    }
+
+    while (1)
+    {
+        struct robotraconteurlite_messageelement_header element_header;
+        struct robotraconteurlite_messageelement_buffer_info element_buffer_info;
+        struct robotraconteurlite_messageelement_index_entry* entry = NULL;
+        uint32_t name_hash = 0;
+        (void)memset(&element_header, 0, sizeof(element_header));
+        (void)memset(&element_buffer_info, 0, sizeof(element_buffer_info));
+
+        rv = robotraconteurlite_messageelement_reader_read_header_ex(element_reader, &element_header,
+                                                                     &element_buffer_info);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+
+        if ((element_buffer_info.element_name_str_offset == SIZE_MAX) && (element_header.element_name.len != 0U))
+        {
+            /* Name was sent as a code and resolved from the string table */
+            struct robotraconteurlite_string name_value;
+            rv = robotraconteurlite_string_table_find_string(element_reader->string_table,
+                                                             element_header.element_name_code, &name_value);
+            if (FAILED(rv))
+            {
+                return rv;
+            }
+            name_hash = robotraconteurlite_string_hash(&name_value);
+        }
+        else
+        {
+            rv = robotraconteurlite_buffer_vec_string_hash(element_reader->buffer,
+                                                           element_buffer_info.element_name_str_offset,
+                                                           element_header.element_name.len, &name_hash);
+            if (FAILED(rv))
+            {
+                return rv;
+            }
+        }
+
+        /* Linear probing, capacity was checked above so a free slot always exists */
+        i = name_hash % index->entries_len;
+        while (index->entries[i].element_size != 0U)
+        {
+            i = (i + 1U) % index->entries_len;
+        }
+
+        entry = &index->entries[i];
+        entry->name_hash = name_hash;
+        entry->name_offset = element_buffer_info.element_name_str_offset;
+        entry->name_len = element_header.element_name.len;
+        entry->name_code = element_header.element_name_code;
+        entry->element_type = element_header.element_type;
+        entry->data_count = element_header.data_count;
+        entry->data_offset = element_buffer_info.data_start_offset;
+        entry->element_offset = element_reader->buffer_offset;
+        entry->element_size = element_reader->buffer_count;
+        entry->element_remaining = element_reader->buffer_remaining;
+        entry->element_number = element_reader->current_element;
+        index->entries_count++;
+
+        rv = robotraconteurlite_messageelement_reader_move_next(element_reader);
+        if (FAILED(rv))
+        {
+            if (NO_MORE(rv))
+            {
+                return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+            }
+            return rv;
+        }
+    }
+}
+
+static robotraconteurlite_status robotraconteurlite_messageelement_index_find(
+    const struct robotraconteurlite_messageelement_index* index, const struct robotraconteurlite_string* element_name,
+    struct robotraconteurlite_messageelement_reader* element_reader, uint16_t* element_type, uint32_t* data_count)
+{
+    uint32_t name_hash = 0;
+    size_t i = 0;
+    size_t j = 0;
+    robotraconteurlite_status rv = -1;
+
+    if (index->entries_count == 0U)
+    {
+        return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_NOT_FOUND;
+    }
+
+    name_hash = robotraconteurlite_string_hash(element_name);
+    i = name_hash % index->entries_len;
+
+    for (j = 0; j < index->entries_len; j++)
+    {
+        const struct robotraconteurlite_messageelement_index_entry* entry = &index->entries[i];
+        if (entry->element_size == 0U)
+        {
+            break;
+        }
+
+        if ((entry->name_hash == name_hash) && (entry->name_len == element_name->len))
+        {
+            uint8_t equal = 0;
+            rv = robotraconteurlite_messageelement_name_equal(element_reader, entry->name_offset, entry->name_code,
+                                                              element_name, &equal);
+            if (FAILED(rv))
+            {
+                return rv;
+            }
+            if (equal != 0U)
+            {
+                element_reader->buffer_offset = entry->element_offset;
+                element_reader->buffer_count = entry->element_size;
+                element_reader->buffer_remaining = entry->element_remaining;
+                element_reader->current_element = entry->element_number;
+                element_reader->total_elements = index->total_elements;
+                element_reader->nested_element_index = NULL;
+                *element_type = entry->element_type;
+                *data_count = entry->data_count;
+                return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+            }
+        }
+
+        i = (i + 1U) % index->entries_len;
+    }
+
+    return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_NOT_FOUND;
+}
+
+static robotraconteurlite_status robotraconteurlite_messageelement_check_scalar(uint16_t element_type,
+                                                                                uint32_t data_count,
+                                                                                uint16_t expected_data_type)
+{
+    if (element_type != expected_data_type)
+    {
+        return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_TYPE_MISMATCH;
+    }
+
+    if (data_count != 1U)
+    {
+        return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_TYPE_MISMATCH;
+    }
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+static robotraconteurlite_status robotraconteurlite_messageelement_check_array(uint16_t element_type,
+                                                                               uint32_t data_count,
+                                                                               uint16_t expected_data_type,
+                                                                               uint32_t expected_len,
+                                                                               uint8_t var_length)
+{
+    if (element_type != expected_data_type)
+    {
+        return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_TYPE_MISMATCH;
+    }
+
+    if (!var_length)
+    {
+        if (data_count != expected_len)
+        {
             return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_TYPE_MISMATCH;
         }
     }
     else
     {
-        if (header.data_count > expected_len)
+        if (data_count > expected_len)
         {
             return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
         }
@@ -1028,37 +1560,148 @@ robotraconteurlite_status robotraconteurlite_messageentry_reader_find_element_ve
     return ROBOTRACONTEURLITE_ERROR_SUCCESS;
 }
 
-robotraconteurlite_status robotraconteurlite_messageentry_reader_find_element_verify_string(
+static robotraconteurlite_status robotraconteurlite_messageelement_check_string(uint16_t element_type,
+                                                                                uint32_t data_count,
+                                                                                uint32_t expected_max_len)
+{
+    if (element_type != ROBOTRACONTEURLITE_DATATYPE_STRING)
+    {
+        return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_TYPE_MISMATCH;
+    }
+
+    if (data_count > expected_max_len)
+    {
+        return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+    }
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+static robotraconteurlite_status robotraconteurlite_messageentry_reader_find_element_ex(
     struct robotraconteurlite_messageentry_reader* entry_reader, const struct robotraconteurlite_string* element_name,
-    struct robotraconteurlite_messageelement_reader* element_reader, uint32_t expected_max_len)
+    struct robotraconteurlite_messageelement_reader* element_reader, uint16_t* element_type, uint32_t* data_count)
 {
-    struct robotraconteurlite_messageelement_header header;
     robotraconteurlite_status rv = -1;
 
-    rv = robotraconteurlite_messageentry_reader_find_element(entry_reader, element_name, element_reader);
+    assert(element_name != NULL);
+    assert(element_name->data != NULL);
+
+    if (entry_reader->element_index != NULL)
+    {
+        element_reader->buffer = entry_reader->buffer;
+        element_reader->cursor = entry_reader->cursor;
+        element_reader->message_version = entry_reader->message_version;
+        element_reader->string_table = entry_reader->string_table;
+        element_reader->validated = entry_reader->validated;
+        return robotraconteurlite_messageelement_index_find(entry_reader->element_index, element_name, element_reader,
+                                                            element_type, data_count);
+    }
+
+    rv = robotraconteurlite_messageentry_reader_begin_read_elements(entry_reader, element_reader);
     if (FAILED(rv))
     {
+        if (NO_MORE(rv))
+        {
+            return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_NOT_FOUND;
+        }
         return rv;
     }
 
-    (void)memset(&header, 0, sizeof(header));
-    rv = robotraconteurlite_messageelement_reader_read_header(element_reader, &header);
+    return robotraconteurlite_messageelement_reader_scan_find(element_reader, element_name, element_type, data_count);
+}
+
+robotraconteurlite_status robotraconteurlite_messageentry_reader_find_element(
+    struct robotraconteurlite_messageentry_reader* entry_reader, const struct robotraconteurlite_string* element_name,
+    struct robotraconteurlite_messageelement_reader* element_reader)
+{
+    uint16_t element_type = 0;
+    uint32_t data_count = 0;
+    return robotraconteurlite_messageentry_reader_find_element_ex(entry_reader, element_name, element_reader,
+                                                                  &element_type, &data_count);
+}
+
+robotraconteurlite_status robotraconteurlite_messageentry_reader_build_element_index(
+    struct robotraconteurlite_messageentry_reader* entry_reader, struct robotraconteurlite_messageelement_index* index)
+{
+    struct robotraconteurlite_messageelement_reader element_reader;
+    robotraconteurlite_status rv = -1;
+
+    assert(entry_reader != NULL);
+    assert(index != NULL);
+
+    entry_reader->element_index = NULL;
+
+    (void)memset(&element_reader, 0, sizeof(element_reader));
+    rv = robotraconteurlite_messageentry_reader_begin_read_elements(entry_reader, &element_reader);
+    if (FAILED(rv) && !NO_MORE(rv))
+    {
+        return rv;
+    }
+
+    rv = robotraconteurlite_messageelement_index_build(&element_reader, index);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    if (header.element_type != ROBOTRACONTEURLITE_DATATYPE_STRING)
+    entry_reader->element_index = index;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status robotraconteurlite_messageentry_reader_find_element_verify_scalar(
+    struct robotraconteurlite_messageentry_reader* entry_reader, const struct robotraconteurlite_string* element_name,
+    struct robotraconteurlite_messageelement_reader* element_reader, uint16_t expected_data_type)
+{
+    uint16_t element_type = 0;
+    uint32_t data_count = 0;
+    robotraconteurlite_status rv = -1;
+
+    rv = robotraconteurlite_messageentry_reader_find_element_ex(entry_reader, element_name, element_reader,
+                                                                &element_type, &data_count);
+    if (FAILED(rv))
     {
-        return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_TYPE_MISMATCH;
+        return rv;
+    }
+
+    return robotraconteurlite_messageelement_check_scalar(element_type, data_count, expected_data_type);
+}
+
+robotraconteurlite_status robotraconteurlite_messageentry_reader_find_element_verify_array(
+    struct robotraconteurlite_messageentry_reader* entry_reader, const struct robotraconteurlite_string* element_name,
+    struct robotraconteurlite_messageelement_reader* element_reader, uint16_t expected_data_type, uint32_t expected_len,
+    uint8_t var_length)
+{
+    uint16_t element_type = 0;
+    uint32_t data_count = 0;
+    robotraconteurlite_status rv = -1;
+
+    rv = robotraconteurlite_messageentry_reader_find_element_ex(entry_reader, element_name, element_reader,
+                                                                &element_type, &data_count);
+    if (FAILED(rv))
+    {
+        return rv;
     }
 
-    if (header.data_count > expected_max_len)
+    return robotraconteurlite_messageelement_check_array(element_type, data_count, expected_data_type, expected_len,
+                                                         var_length);
+}
+
+robotraconteurlite_status robotraconteurlite_messageentry_reader_find_element_verify_string(
+    struct robotraconteurlite_messageentry_reader* entry_reader, const struct robotraconteurlite_string* element_name,
+    struct robotraconteurlite_messageelement_reader* element_reader, uint32_t expected_max_len)
+{
+    uint16_t element_type = 0;
+    uint32_t data_count = 0;
+    robotraconteurlite_status rv = -1;
+
+    rv = robotraconteurlite_messageentry_reader_find_element_ex(entry_reader, element_name, element_reader,
+                                                                &element_type, &data_count);
+    if (FAILED(rv))
     {
-        return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+        return rv;
     }
 
-    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    return robotraconteurlite_messageelement_check_string(element_type, data_count, expected_max_len);
 }
 
 robotraconteurlite_status robotraconteurlite_messageentry_reader_read_header(
@@ -1086,14 +1729,15 @@ robotraconteurlite_status robotraconteurlite_messageentry_reader_read_header2_ex
 
     temp_buffer_info.start_buffer_offset = entry_reader->buffer_offset;
     temp_buffer_info.entry_size_offset = o;
+    temp_buffer_info.request_id_offset = SIZE_MAX;
 
-    rv = robotraconteurlite_message_read_uint32(entry_reader->buffer, &o, &header->entry_size);
+    rv = robotraconteurlite_message_read_uint32(&entry_reader->cursor, &o, &header->entry_size);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    rv = robotraconteurlite_message_read_uint16(entry_reader->buffer, &o, &header->entry_type);
+    rv = robotraconteurlite_message_read_uint16(&entry_reader->cursor, &o, &header->entry_type);
     if (FAILED(rv))
     {
         return rv;
@@ -1102,31 +1746,33 @@ robotraconteurlite_status robotraconteurlite_messageentry_reader_read_header2_ex
     /* reserved */
     o += 2U;
 
-    rv = robotraconteurlite_message_read_header_string_with_len_prefix2_1(entry_reader->buffer, &o, &service_path_info);
+    rv = robotraconteurlite_message_read_header_string_with_len_prefix2_1(&entry_reader->cursor, &o,
+                                                                          &service_path_info);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    rv = robotraconteurlite_message_read_header_string_with_len_prefix2_1(entry_reader->buffer, &o, &member_name_info);
+    rv = robotraconteurlite_message_read_header_string_with_len_prefix2_1(&entry_reader->cursor, &o, &member_name_info);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    rv = robotraconteurlite_message_read_uint32(entry_reader->buffer, &o, &header->request_id);
+    temp_buffer_info.request_id_offset = o;
+    rv = robotraconteurlite_message_read_uint32(&entry_reader->cursor, &o, &header->request_id);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    rv = robotraconteurlite_message_read_uint16(entry_reader->buffer, &o, &header->error);
+    rv = robotraconteurlite_message_read_uint16(&entry_reader->cursor, &o, &header->error);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    rv = robotraconteurlite_message_read_header_string_with_len_prefix2_1(entry_reader->buffer, &o, &meta_info);
+    rv = robotraconteurlite_message_read_header_string_with_len_prefix2_1(&entry_reader->cursor, &o, &meta_info);
     if (FAILED(rv))
     {
         return rv;
@@ -1135,7 +1781,7 @@ robotraconteurlite_status robotraconteurlite_messageentry_reader_read_header2_ex
     temp_buffer_info.element_count_offset = o;
     {
         uint16_t element_count_16 = 0;
-        rv = robotraconteurlite_message_read_uint16(entry_reader->buffer, &o, &element_count_16);
+        rv = robotraconteurlite_message_read_uint16(&entry_reader->cursor, &o, &element_count_16);
 
         if (FAILED(rv))
         {
@@ -1144,22 +1790,22 @@ robotraconteurlite_status robotraconteurlite_messageentry_reader_read_header2_ex
         header->element_count = element_count_16;
     }
 
-    rv = robotraconteurlite_message_read_header_string_with_len_prefix2_2(entry_reader->buffer, &service_path_info,
-                                                                          &header->service_path);
+    rv = robotraconteurlite_message_read_header_string_ex(
+        &entry_reader->cursor, entry_reader->string_views, &service_path_info, &header->service_path);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    rv = robotraconteurlite_message_read_header_string_with_len_prefix2_2(entry_reader->buffer, &member_name_info,
-                                                                          &header->member_name);
+    rv = robotraconteurlite_message_read_header_string_ex(
+        &entry_reader->cursor, entry_reader->string_views, &member_name_info, &header->member_name);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    rv = robotraconteurlite_message_read_header_string_with_len_prefix2_2(entry_reader->buffer, &meta_info,
-                                                                          &header->metadata);
+    rv = robotraconteurlite_message_read_header_string_ex(
+        &entry_reader->cursor, entry_reader->string_views, &meta_info, &header->metadata);
     if (FAILED(rv))
     {
         return rv;
@@ -1179,6 +1825,7 @@ robotraconteurlite_status robotraconteurlite_messageentry_reader_read_header4_ex
 {
     size_t o = entry_reader->buffer_offset;
     robotraconteurlite_status rv = -1;
+    struct robotraconteurlite_message_header_view view;
     struct robotraconteurlite_message_read_header_string_info service_path_info;
     struct robotraconteurlite_message_read_header_string_info member_name_info;
     struct robotraconteurlite_message_read_header_string_info meta_info;
@@ -1192,20 +1839,24 @@ robotraconteurlite_status robotraconteurlite_messageentry_reader_read_header4_ex
 
     temp_buffer_info.start_buffer_offset = entry_reader->buffer_offset;
     temp_buffer_info.entry_size_offset = o;
+    temp_buffer_info.request_id_offset = SIZE_MAX;
 
-    rv = robotraconteurlite_message_read_uint_x(entry_reader->buffer, &o, &header->entry_size);
+    robotraconteurlite_message_header_view_init(&view, &entry_reader->cursor, entry_reader->buffer_offset,
+                                                entry_reader->buffer_count);
+
+    rv = robotraconteurlite_message_view_read_uint_x(&view, &o, &header->entry_size);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    rv = robotraconteurlite_message_read_uint8(entry_reader->buffer, &o, &flags);
+    rv = robotraconteurlite_message_view_read_uint8(&view, &o, &flags);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    rv = robotraconteurlite_message_read_uint16(entry_reader->buffer, &o, &header->entry_type);
+    rv = robotraconteurlite_message_view_read_uint16(&view, &o, &header->entry_type);
     if (FAILED(rv))
     {
         return rv;
@@ -1213,7 +1864,7 @@ robotraconteurlite_status robotraconteurlite_messageentry_reader_read_header4_ex
 
     if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEENTRY_FLAGS_SERVICE_PATH_STR))
     {
-        rv = robotraconteurlite_message_read_header_string_with_len_prefix4_1(entry_reader->buffer, &o,
+        rv = robotraconteurlite_message_read_header_string_with_len_prefix4_1(&view, &o,
                                                                               &service_path_info);
         if (FAILED(rv))
         {
@@ -1223,7 +1874,7 @@ robotraconteurlite_status robotraconteurlite_messageentry_reader_read_header4_ex
 
     if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEENTRY_FLAGS_SERVICE_PATH_CODE))
     {
-        rv = robotraconteurlite_message_read_uint_x(entry_reader->buffer, &o, &header->service_path_code);
+        rv = robotraconteurlite_message_view_read_uint_x(&view, &o, &header->service_path_code);
         if (FAILED(rv))
         {
             return rv;
@@ -1236,7 +1887,7 @@ robotraconteurlite_status robotraconteurlite_messageentry_reader_read_header4_ex
 
     if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEENTRY_FLAGS_MEMBER_NAME_STR))
     {
-        rv = robotraconteurlite_message_read_header_string_with_len_prefix4_1(entry_reader->buffer, &o,
+        rv = robotraconteurlite_message_read_header_string_with_len_prefix4_1(&view, &o,
                                                                               &member_name_info);
         if (FAILED(rv))
         {
@@ -1246,7 +1897,7 @@ robotraconteurlite_status robotraconteurlite_messageentry_reader_read_header4_ex
 
     if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEENTRY_FLAGS_MEMBER_NAME_CODE))
     {
-        rv = robotraconteurlite_message_read_uint_x(entry_reader->buffer, &o, &header->member_name_code);
+        rv = robotraconteurlite_message_view_read_uint_x(&view, &o, &header->member_name_code);
         if (FAILED(rv))
         {
             return rv;
@@ -1259,7 +1910,8 @@ robotraconteurlite_status robotraconteurlite_messageentry_reader_read_header4_ex
 
     if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEENTRY_FLAGS_REQUEST_ID))
     {
-        rv = robotraconteurlite_message_read_uint_x(entry_reader->buffer, &o, &header->request_id);
+        temp_buffer_info.request_id_offset = o;
+        rv = robotraconteurlite_message_view_read_uint_x(&view, &o, &header->request_id);
         if (FAILED(rv))
         {
             return rv;
@@ -1272,7 +1924,7 @@ robotraconteurlite_status robotraconteurlite_messageentry_reader_read_header4_ex
 
     if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEENTRY_FLAGS_ERROR))
     {
-        rv = robotraconteurlite_message_read_uint16(entry_reader->buffer, &o, &header->error);
+        rv = robotraconteurlite_message_view_read_uint16(&view, &o, &header->error);
         if (FAILED(rv))
         {
             return rv;
@@ -1285,7 +1937,7 @@ robotraconteurlite_status robotraconteurlite_messageentry_reader_read_header4_ex
 
     if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEENTRY_FLAGS_META_INFO))
     {
-        rv = robotraconteurlite_message_read_header_string_with_len_prefix4_1(entry_reader->buffer, &o, &meta_info);
+        rv = robotraconteurlite_message_read_header_string_with_len_prefix4_1(&view, &o, &meta_info);
         if (FAILED(rv))
         {
             return rv;
@@ -1295,7 +1947,7 @@ robotraconteurlite_status robotraconteurlite_messageentry_reader_read_header4_ex
     if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEENTRY_FLAGS_EXTENDED))
     {
         uint32_t extended_size = 0;
-        rv = robotraconteurlite_message_read_uint_x(entry_reader->buffer, &o, &extended_size);
+        rv = robotraconteurlite_message_view_read_uint_x(&view, &o, &extended_size);
         if (FAILED(rv))
         {
             return rv;
@@ -1304,7 +1956,7 @@ robotraconteurlite_status robotraconteurlite_messageentry_reader_read_header4_ex
     }
 
     temp_buffer_info.element_count_offset = o;
-    rv = robotraconteurlite_message_read_uint_x(entry_reader->buffer, &o, &header->element_count);
+    rv = robotraconteurlite_message_view_read_uint_x(&view, &o, &header->element_count);
     if (FAILED(rv))
     {
         return rv;
@@ -1312,8 +1964,8 @@ robotraconteurlite_status robotraconteurlite_messageentry_reader_read_header4_ex
 
     if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEENTRY_FLAGS_SERVICE_PATH_STR))
     {
-        rv = robotraconteurlite_message_read_header_string_with_len_prefix4_2(entry_reader->buffer, &service_path_info,
-                                                                              &header->service_path);
+        rv = robotraconteurlite_message_read_header_string_ex(
+            &entry_reader->cursor, entry_reader->string_views, &service_path_info, &header->service_path);
         if (FAILED(rv))
         {
             return rv;
@@ -1321,14 +1973,18 @@ robotraconteurlite_status robotraconteurlite_messageentry_reader_read_header4_ex
     }
     else
     {
-        header->service_path.data = NULL;
-        header->service_path.len = 0;
+        rv = robotraconteurlite_message_read_header_string_code(
+            entry_reader->string_table, header->service_path_code, entry_reader->string_views, &header->service_path);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
     }
 
     if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEENTRY_FLAGS_MEMBER_NAME_STR))
     {
-        rv = robotraconteurlite_message_read_header_string_with_len_prefix4_2(entry_reader->buffer, &member_name_info,
-                                                                              &header->member_name);
+        rv = robotraconteurlite_message_read_header_string_ex(
+            &entry_reader->cursor, entry_reader->string_views, &member_name_info, &header->member_name);
         if (FAILED(rv))
         {
             return rv;
@@ -1336,13 +1992,17 @@ robotraconteurlite_status robotraconteurlite_messageentry_reader_read_header4_ex
     }
     else
     {
-        header->member_name.data = NULL;
-        header->member_name.len = 0;
+        rv = robotraconteurlite_message_read_header_string_code(
+            entry_reader->string_table, header->member_name_code, entry_reader->string_views, &header->member_name);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
     }
     if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEENTRY_FLAGS_META_INFO))
     {
-        rv = robotraconteurlite_message_read_header_string_with_len_prefix4_2(entry_reader->buffer, &meta_info,
-                                                                              &header->metadata);
+        rv = robotraconteurlite_message_read_header_string_ex(
+            &entry_reader->cursor, entry_reader->string_views, &meta_info, &header->metadata);
         if (FAILED(rv))
         {
             return rv;
@@ -1405,7 +2065,8 @@ robotraconteurlite_status robotraconteurlite_messageentry_reader_begin_read_elem
     o = entry_buffer_info.element_start_offset;
     o2 = o;
 
-    rv = robotraconteurlite_message_read_count(entry_reader->buffer, entry_reader->message_version, &o2, &element_size);
+    rv = robotraconteurlite_message_read_count(&entry_reader->cursor, entry_reader->message_version, &o2,
+                                               &element_size);
     if (FAILED(rv))
     {
         return rv;
@@ -1417,12 +2078,16 @@ robotraconteurlite_status robotraconteurlite_messageentry_reader_begin_read_elem
     }
 
     element_reader->buffer = entry_reader->buffer;
+    element_reader->cursor = entry_reader->cursor;
     element_reader->buffer_offset = o;
     element_reader->buffer_count = element_size;
     element_reader->buffer_remaining = entry_reader->buffer_count - entry_buffer_info.header_size - element_size;
     element_reader->current_element = 0;
     element_reader->total_elements = entry_header.element_count;
     element_reader->message_version = entry_reader->message_version;
+    element_reader->string_table = entry_reader->string_table;
+    element_reader->validated = entry_reader->validated;
+    element_reader->nested_element_index = NULL;
 
     return ROBOTRACONTEURLITE_ERROR_SUCCESS;
 }
@@ -1443,7 +2108,7 @@ robotraconteurlite_status robotraconteurlite_messageelement_reader_move_next(
     }
 
     o2 = o;
-    rv = robotraconteurlite_message_read_count(element_reader->buffer, element_reader->message_version, &o2,
+    rv = robotraconteurlite_message_read_count(&element_reader->cursor, element_reader->message_version, &o2,
                                                &element_size);
     if (FAILED(rv))
     {
@@ -1459,6 +2124,7 @@ robotraconteurlite_status robotraconteurlite_messageelement_reader_move_next(
     element_reader->buffer_count = element_size;
     element_reader->buffer_remaining -= element_size;
     element_reader->current_element++;
+    element_reader->nested_element_index = NULL;
 
     return ROBOTRACONTEURLITE_ERROR_SUCCESS;
 }
@@ -1490,33 +2156,34 @@ robotraconteurlite_status robotraconteurlite_messageelement_reader_read_header2_
     temp_buffer_info.start_buffer_offset = element_reader->buffer_offset;
     temp_buffer_info.element_size_offset = o;
 
-    rv = robotraconteurlite_message_read_uint32(element_reader->buffer, &o, &header->element_size);
+    rv = robotraconteurlite_message_read_uint32(&element_reader->cursor, &o, &header->element_size);
     if (FAILED(rv))
     {
         return rv;
     }
 
     rv =
-        robotraconteurlite_message_read_header_string_with_len_prefix2_1(element_reader->buffer, &o, &elementname_info);
+        robotraconteurlite_message_read_header_string_with_len_prefix2_1(&element_reader->cursor, &o,
+                                                                         &elementname_info);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    rv = robotraconteurlite_message_read_uint16(element_reader->buffer, &o, &header->element_type);
+    rv = robotraconteurlite_message_read_uint16(&element_reader->cursor, &o, &header->element_type);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    rv = robotraconteurlite_message_read_header_string_with_len_prefix2_1(element_reader->buffer, &o,
+    rv = robotraconteurlite_message_read_header_string_with_len_prefix2_1(&element_reader->cursor, &o,
                                                                           &elementtypename_info);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    rv = robotraconteurlite_message_read_header_string_with_len_prefix2_1(element_reader->buffer, &o, &meta_info);
+    rv = robotraconteurlite_message_read_header_string_with_len_prefix2_1(&element_reader->cursor, &o, &meta_info);
     if (FAILED(rv))
     {
         return rv;
@@ -1524,13 +2191,13 @@ robotraconteurlite_status robotraconteurlite_messageelement_reader_read_header2_
 
     temp_buffer_info.element_count_offset = o;
 
-    rv = robotraconteurlite_message_read_uint32(element_reader->buffer, &o, &header->data_count);
+    rv = robotraconteurlite_message_read_uint32(&element_reader->cursor, &o, &header->data_count);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    rv = robotraconteurlite_message_read_header_string_with_len_prefix2_2(element_reader->buffer, &elementname_info,
+    rv = robotraconteurlite_message_read_header_string_with_len_prefix2_2(&element_reader->cursor, &elementname_info,
                                                                           &header->element_name);
     if (FAILED(rv))
     {
@@ -1538,14 +2205,15 @@ robotraconteurlite_status robotraconteurlite_messageelement_reader_read_header2_
     }
     temp_buffer_info.element_name_str_offset = elementname_info.offset;
 
-    rv = robotraconteurlite_message_read_header_string_with_len_prefix2_2(element_reader->buffer, &elementtypename_info,
+    rv = robotraconteurlite_message_read_header_string_with_len_prefix2_2(&element_reader->cursor,
+                                                                          &elementtypename_info,
                                                                           &header->element_type_name);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    rv = robotraconteurlite_message_read_header_string_with_len_prefix2_2(element_reader->buffer, &meta_info,
+    rv = robotraconteurlite_message_read_header_string_with_len_prefix2_2(&element_reader->cursor, &meta_info,
                                                                           &header->metadata);
     if (FAILED(rv))
     {
@@ -1567,6 +2235,7 @@ robotraconteurlite_status robotraconteurlite_messageelement_reader_read_header4_
 {
     size_t o = element_reader->buffer_offset;
     robotraconteurlite_status rv = -1;
+    struct robotraconteurlite_message_header_view view;
     struct robotraconteurlite_message_read_header_string_info elementname_info;
     struct robotraconteurlite_message_read_header_string_info elementtypename_info;
     struct robotraconteurlite_message_read_header_string_info meta_info;
@@ -1582,13 +2251,16 @@ robotraconteurlite_status robotraconteurlite_messageelement_reader_read_header4_
     temp_buffer_info.start_buffer_offset = element_reader->buffer_offset;
     temp_buffer_info.element_size_offset = o;
 
-    rv = robotraconteurlite_message_read_uint_x(element_reader->buffer, &o, &header->element_size);
+    robotraconteurlite_message_header_view_init(&view, &element_reader->cursor, element_reader->buffer_offset,
+                                                element_reader->buffer_count);
+
+    rv = robotraconteurlite_message_view_read_uint_x(&view, &o, &header->element_size);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    rv = robotraconteurlite_message_read_uint8(element_reader->buffer, &o, &flags);
+    rv = robotraconteurlite_message_view_read_uint8(&view, &o, &flags);
     if (FAILED(rv))
     {
         return rv;
@@ -1596,7 +2268,7 @@ robotraconteurlite_status robotraconteurlite_messageelement_reader_read_header4_
 
     if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_ELEMENT_NAME_STR))
     {
-        rv = robotraconteurlite_message_read_header_string_with_len_prefix4_1(element_reader->buffer, &o,
+        rv = robotraconteurlite_message_read_header_string_with_len_prefix4_1(&view, &o,
                                                                               &elementname_info);
         if (FAILED(rv))
         {
@@ -1606,7 +2278,7 @@ robotraconteurlite_status robotraconteurlite_messageelement_reader_read_header4_
 
     if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_ELEMENT_NAME_CODE))
     {
-        rv = robotraconteurlite_message_read_uint_x(element_reader->buffer, &o, &header->element_name_code);
+        rv = robotraconteurlite_message_view_read_uint_x(&view, &o, &header->element_name_code);
         if (FAILED(rv))
         {
             return rv;
@@ -1619,7 +2291,7 @@ robotraconteurlite_status robotraconteurlite_messageelement_reader_read_header4_
 
     if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_ELEMENT_NUMBER))
     {
-        rv = robotraconteurlite_message_read_int_x(element_reader->buffer, &o, &header->element_number);
+        rv = robotraconteurlite_message_view_read_int_x(&view, &o, &header->element_number);
         if (FAILED(rv))
         {
             return rv;
@@ -1630,7 +2302,7 @@ robotraconteurlite_status robotraconteurlite_messageelement_reader_read_header4_
         header->element_number = 0;
     }
 
-    rv = robotraconteurlite_message_read_uint16(element_reader->buffer, &o, &header->element_type);
+    rv = robotraconteurlite_message_view_read_uint16(&view, &o, &header->element_type);
     if (FAILED(rv))
     {
         return rv;
@@ -1638,7 +2310,7 @@ robotraconteurlite_status robotraconteurlite_messageelement_reader_read_header4_
 
     if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_ELEMENT_TYPE_NAME_STR))
     {
-        rv = robotraconteurlite_message_read_header_string_with_len_prefix4_1(element_reader->buffer, &o,
+        rv = robotraconteurlite_message_read_header_string_with_len_prefix4_1(&view, &o,
                                                                               &elementtypename_info);
         if (FAILED(rv))
         {
@@ -1648,7 +2320,7 @@ robotraconteurlite_status robotraconteurlite_messageelement_reader_read_header4_
 
     if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_ELEMENT_TYPE_NAME_CODE))
     {
-        rv = robotraconteurlite_message_read_uint_x(element_reader->buffer, &o, &header->element_type_name_code);
+        rv = robotraconteurlite_message_view_read_uint_x(&view, &o, &header->element_type_name_code);
         if (FAILED(rv))
         {
             return rv;
@@ -1661,7 +2333,7 @@ robotraconteurlite_status robotraconteurlite_messageelement_reader_read_header4_
 
     if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_META_INFO))
     {
-        rv = robotraconteurlite_message_read_header_string_with_len_prefix4_1(element_reader->buffer, &o, &meta_info);
+        rv = robotraconteurlite_message_read_header_string_with_len_prefix4_1(&view, &o, &meta_info);
         if (FAILED(rv))
         {
             return rv;
@@ -1671,7 +2343,7 @@ robotraconteurlite_status robotraconteurlite_messageelement_reader_read_header4_
     if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_EXTENDED))
     {
         uint32_t extended_size = 0;
-        rv = robotraconteurlite_message_read_uint_x(element_reader->buffer, &o, &extended_size);
+        rv = robotraconteurlite_message_view_read_uint_x(&view, &o, &extended_size);
         if (FAILED(rv))
         {
             return rv;
@@ -1681,7 +2353,7 @@ robotraconteurlite_status robotraconteurlite_messageelement_reader_read_header4_
 
     temp_buffer_info.element_count_offset = o;
 
-    rv = robotraconteurlite_message_read_uint_x(element_reader->buffer, &o, &header->data_count);
+    rv = robotraconteurlite_message_view_read_uint_x(&view, &o, &header->data_count);
     if (FAILED(rv))
     {
         return rv;
@@ -1689,7 +2361,8 @@ robotraconteurlite_status robotraconteurlite_messageelement_reader_read_header4_
 
     if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_ELEMENT_NAME_STR))
     {
-        rv = robotraconteurlite_message_read_header_string_with_len_prefix4_2(element_reader->buffer, &elementname_info,
+        rv = robotraconteurlite_message_read_header_string_with_len_prefix4_2(&element_reader->cursor,
+                                                                              &elementname_info,
                                                                               &header->element_name);
         if (FAILED(rv))
         {
@@ -1701,14 +2374,18 @@ robotraconteurlite_status robotraconteurlite_messageelement_reader_read_header4_
     {
         temp_buffer_info.element_name_str_offset = SIZE_MAX;
 
-        header->element_name.data = NULL;
-        header->element_name.len = 0;
+        rv = robotraconteurlite_message_read_header_string_code(
+            element_reader->string_table, header->element_name_code, 0U, &header->element_name);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
     }
 
     if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_ELEMENT_TYPE_NAME_STR))
     {
         rv = robotraconteurlite_message_read_header_string_with_len_prefix4_2(
-            element_reader->buffer, &elementtypename_info, &header->element_type_name);
+            &element_reader->cursor, &elementtypename_info, &header->element_type_name);
         if (FAILED(rv))
         {
             return rv;
@@ -1716,13 +2393,17 @@ robotraconteurlite_status robotraconteurlite_messageelement_reader_read_header4_
     }
     else
     {
-        header->element_type_name.data = NULL;
-        header->element_type_name.len = 0;
+        rv = robotraconteurlite_message_read_header_string_code(
+            element_reader->string_table, header->element_type_name_code, 0U, &header->element_type_name);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
     }
 
     if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_META_INFO))
     {
-        rv = robotraconteurlite_message_read_header_string_with_len_prefix4_2(element_reader->buffer, &meta_info,
+        rv = robotraconteurlite_message_read_header_string_with_len_prefix4_2(&element_reader->cursor, &meta_info,
                                                                               &header->metadata);
         if (FAILED(rv))
         {
@@ -1759,2023 +2440,5085 @@ robotraconteurlite_status robotraconteurlite_messageelement_reader_read_header_e
     }
 }
 
-robotraconteurlite_status robotraconteurlite_messageelement_reader_get_data_info(
-    struct robotraconteurlite_messageelement_reader* element_reader, size_t* data_offset, size_t* data_size,
-    uint32_t* data_count, uint16_t data_type, size_t data_element_size)
+/* Skip a Message 2 header string by its length prefix */
+static robotraconteurlite_status robotraconteurlite_message_view_skip_string2(
+    struct robotraconteurlite_message_header_view* view, size_t* offset)
 {
-    struct robotraconteurlite_messageelement_header element_header;
-    struct robotraconteurlite_messageelement_buffer_info element_buffer_info;
-    robotraconteurlite_status rv = -1;
-
-    assert(element_reader != NULL);
-
-    (void)memset(&element_header, 0, sizeof(element_header));
-    (void)memset(&element_buffer_info, 0, sizeof(element_buffer_info));
-    rv = robotraconteurlite_messageelement_reader_read_header_ex(element_reader, &element_header, &element_buffer_info);
+    uint16_t str_len = 0;
+    robotraconteurlite_status rv = robotraconteurlite_message_view_read_uint16(view, offset, &str_len);
     if (FAILED(rv))
     {
         return rv;
     }
+    *offset += str_len;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
 
-    if (element_header.element_type != data_type)
+/* Skip a Message 4 header string by its length prefix */
+static robotraconteurlite_status robotraconteurlite_message_view_skip_string4(
+    struct robotraconteurlite_message_header_view* view, size_t* offset)
+{
+    uint32_t str_len = 0;
+    robotraconteurlite_status rv = robotraconteurlite_message_view_read_uint_x(view, offset, &str_len);
+    if (FAILED(rv))
     {
-        return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_TYPE_MISMATCH;
+        return rv;
     }
+    *offset += str_len;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
 
-    *data_offset = element_buffer_info.data_start_offset;
-    *data_size = element_header.element_size - element_buffer_info.header_size;
-    *data_count = element_header.data_count;
-
-    if ((data_element_size != 0U) && ((data_element_size * element_header.data_count) != *data_size))
-    {
-        return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
-    }
-
-    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
-}
-
-robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_ex(
-    struct robotraconteurlite_messageelement_reader* element_reader, uint8_t* dest_buf, size_t* dest_len,
-    uint16_t dest_elem_type, size_t dest_elem_size)
+static robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_header2_trusted(
+    struct robotraconteurlite_message_header_view* view, size_t* offset, uint16_t* element_type, uint32_t* data_count)
 {
-    size_t data_offset = 0;
-    size_t data_size = 0;
-    uint32_t data_count = 0;
     robotraconteurlite_status rv = -1;
 
-    assert(dest_buf != NULL);
-    assert(dest_len != NULL);
-
-    rv = robotraconteurlite_messageelement_reader_get_data_info(element_reader, &data_offset, &data_size, &data_count,
-                                                                dest_elem_type, dest_elem_size);
+    /* element_size was checked against the reader by validation */
+    *offset += 4U;
+    rv = robotraconteurlite_message_view_skip_string2(view, offset);
     if (FAILED(rv))
     {
         return rv;
     }
-
-    rv = robotraconteurlite_buffer_vec_copy_to_mem(element_reader->buffer, data_offset, dest_buf, *dest_len, 0,
-                                                   dest_elem_size, data_count);
-
+    rv = robotraconteurlite_message_view_read_uint16(view, offset, element_type);
     if (FAILED(rv))
     {
         return rv;
     }
-
-    *dest_len = data_count;
-
-    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
-}
-
-robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_scalar_ex(
-    struct robotraconteurlite_messageelement_reader* element_reader, uint8_t* dest_scalar, uint16_t dest_elem_type,
-    size_t dest_elem_size)
-{
-    size_t data_offset = 0;
-    size_t data_size = 0;
-    uint32_t data_count = 0;
-    robotraconteurlite_status rv = -1;
-
-    struct robotraconteurlite_buffer dest_buf;
-    struct robotraconteurlite_buffer_vec dest_vec;
-
-    dest_buf.data = dest_scalar;
-    dest_buf.len = 1;
-    dest_vec.buffer_vec = &dest_buf;
-    dest_vec.buffer_vec_cnt = 1;
-
-    rv = robotraconteurlite_messageelement_reader_get_data_info(element_reader, &data_offset, &data_size, &data_count,
-                                                                dest_elem_type, dest_elem_size);
+    rv = robotraconteurlite_message_view_skip_string2(view, offset);
     if (FAILED(rv))
     {
         return rv;
     }
-
-    if (data_count != 1U)
+    rv = robotraconteurlite_message_view_skip_string2(view, offset);
+    if (FAILED(rv))
     {
-        return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
+        return rv;
     }
-
-    return robotraconteurlite_buffer_vec_copy_vec_ex(element_reader->buffer, data_offset, 1, dest_elem_size, &dest_vec,
-                                                     0, dest_elem_size, 1);
+    return robotraconteurlite_message_view_read_uint32(view, offset, data_count);
 }
 
-robotraconteurlite_status robotraconteurlite_messageelement_reader_begin_read_nested_elements(
-    struct robotraconteurlite_messageelement_reader* element_reader,
-    struct robotraconteurlite_messageelement_reader* nested_element_reader)
+static robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_header4_trusted(
+    struct robotraconteurlite_message_header_view* view, size_t* offset, uint16_t* element_type, uint32_t* data_count)
 {
+    uint32_t val = 0;
+    int32_t number = 0;
+    uint8_t flags = 0;
     robotraconteurlite_status rv = -1;
-    struct robotraconteurlite_messageelement_header header;
-    struct robotraconteurlite_messageelement_buffer_info buffer_info;
-    size_t o = 0;
-    uint32_t nested_element_size = 0;
 
-    (void)memset(&header, 0, sizeof(header));
-    (void)memset(&buffer_info, 0, sizeof(buffer_info));
-    rv = robotraconteurlite_messageelement_reader_read_header_ex(element_reader, &header, &buffer_info);
+    rv = robotraconteurlite_message_view_read_uint_x(view, offset, &val);
     if (FAILED(rv))
     {
         return rv;
     }
-
-    switch (header.element_type)
+    rv = robotraconteurlite_message_view_read_uint8(view, offset, &flags);
+    if (FAILED(rv))
     {
-    case ROBOTRACONTEURLITE_DATATYPE_STRUCTURE:
-    case ROBOTRACONTEURLITE_DATATYPE_MAP_INT32:
-    case ROBOTRACONTEURLITE_DATATYPE_MAP_STRING:
-    case ROBOTRACONTEURLITE_DATATYPE_LIST:
-    case ROBOTRACONTEURLITE_DATATYPE_MULTIDIMARRAY:
-    case ROBOTRACONTEURLITE_DATATYPE_POD:
-    case ROBOTRACONTEURLITE_DATATYPE_POD_ARRAY:
-    case ROBOTRACONTEURLITE_DATATYPE_POD_MULTIDIMARRAY:
-    case ROBOTRACONTEURLITE_DATATYPE_NAMEDARRAY_ARRAY:
-    case ROBOTRACONTEURLITE_DATATYPE_NAMEDARRAY_MULTIDIMARRAY:
-        break;
-    default:
-        return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_TYPE_MISMATCH;
+        return rv;
     }
-
-    if (header.data_count == 0U)
+    if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_ELEMENT_NAME_STR))
     {
-        return ROBOTRACONTEURLITE_ERROR_NO_MORE;
+        rv = robotraconteurlite_message_view_skip_string4(view, offset);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
     }
-
-    o = buffer_info.data_start_offset;
-    rv = robotraconteurlite_message_read_count(element_reader->buffer, element_reader->message_version, &o,
-                                               &nested_element_size);
-    if (FAILED(rv))
+    if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_ELEMENT_NAME_CODE))
     {
-        return rv;
+        rv = robotraconteurlite_message_view_read_uint_x(view, offset, &val);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
     }
-
-    if ((o + nested_element_size) > element_reader->buffer_count)
+    if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_ELEMENT_NUMBER))
     {
-        return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
+        rv = robotraconteurlite_message_view_read_int_x(view, offset, &number);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
     }
-
-    nested_element_reader->buffer = element_reader->buffer;
-    nested_element_reader->buffer_offset = buffer_info.data_start_offset;
-    nested_element_reader->buffer_count = nested_element_size;
-    nested_element_reader->buffer_remaining =
-        element_reader->buffer_count - buffer_info.header_size - nested_element_size;
-    nested_element_reader->current_element = 0;
-    nested_element_reader->total_elements = header.data_count;
-    nested_element_reader->message_version = element_reader->message_version;
-
-    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
-}
-
-robotraconteurlite_status robotraconteurlite_messageelement_reader_find_nested_element(
-    struct robotraconteurlite_messageelement_reader* element_reader,
-    const struct robotraconteurlite_string* nested_element_name,
-    struct robotraconteurlite_messageelement_reader* nested_element_reader)
-{
-    char temp_str_data[16];
-    robotraconteurlite_status rv = -1;
-
-    assert(nested_element_name != NULL);
-    assert(nested_element_name->data != NULL);
-
-    rv = robotraconteurlite_messageelement_reader_begin_read_nested_elements(element_reader, nested_element_reader);
+    rv = robotraconteurlite_message_view_read_uint16(view, offset, element_type);
     if (FAILED(rv))
     {
-        if (NO_MORE(rv))
+        return rv;
+    }
+    if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_ELEMENT_TYPE_NAME_STR))
+    {
+        rv = robotraconteurlite_message_view_skip_string4(view, offset);
+        if (FAILED(rv))
         {
-            return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_NOT_FOUND;
+            return rv;
         }
-        return rv;
     }
-    while (1)
+    if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_ELEMENT_TYPE_NAME_CODE))
     {
-        struct robotraconteurlite_messageelement_header element_header;
-        struct robotraconteurlite_messageelement_buffer_info element_buffer_info;
-        size_t str_len = 0;
-        size_t str_offset = 0;
-        (void)memset(&element_header, 0, sizeof(element_header));
-        (void)memset(&element_buffer_info, 0, sizeof(element_buffer_info));
-
-        rv = robotraconteurlite_messageelement_reader_read_header_ex(nested_element_reader, &element_header,
-                                                                     &element_buffer_info);
+        rv = robotraconteurlite_message_view_read_uint_x(view, offset, &val);
         if (FAILED(rv))
         {
             return rv;
         }
-
-        str_len = element_header.element_name.len;
-
-        if (str_len == nested_element_name->len)
+    }
+    if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_META_INFO))
+    {
+        rv = robotraconteurlite_message_view_skip_string4(view, offset);
+        if (FAILED(rv))
         {
-            struct robotraconteurlite_string temp_str;
-            temp_str.data = temp_str_data;
-            temp_str.len = sizeof(temp_str_data);
-
-            do
-            {
-                size_t str_read = ((str_len <= temp_str.len) ? str_len : temp_str.len);
-                rv = robotraconteurlite_buffer_vec_copy_to_string(
-                    nested_element_reader->buffer, element_buffer_info.element_name_str_offset + str_offset, &temp_str,
-                    0, str_read);
-                if (FAILED(rv))
-                {
-                    return rv;
-                }
-
-                if (memcmp(temp_str.data, &nested_element_name->data[str_offset], str_read) != 0)
-                {
-                    break;
-                }
-
-                str_len -= str_read;
-                if (str_len == 0U)
-                {
-                    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
-                }
-                str_offset += str_read;
-
-            } while (str_len > 0U);
+            return rv;
         }
-
-        rv = robotraconteurlite_messageelement_reader_move_next(nested_element_reader);
+    }
+    if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_EXTENDED))
+    {
+        rv = robotraconteurlite_message_view_skip_string4(view, offset);
         if (FAILED(rv))
         {
-            if (NO_MORE(rv))
-            {
-                return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_NOT_FOUND;
-            }
             return rv;
         }
     }
+    return robotraconteurlite_message_view_read_uint_x(view, offset, data_count);
 }
 
-robotraconteurlite_status robotraconteurlite_messageelement_reader_find_nested_element_verify_scalar(
-    struct robotraconteurlite_messageelement_reader* element_reader,
-    const struct robotraconteurlite_string* nested_element_name,
-    struct robotraconteurlite_messageelement_reader* nested_element_reader, uint16_t expected_data_type)
+/* Decode only the element type, data count and data offset of an element of a validated message. Name, type name and
+   metadata strings are skipped by their length prefix instead of being resolved or copied. */
+static robotraconteurlite_status robotraconteurlite_messageelement_reader_get_data_info_trusted(
+    struct robotraconteurlite_messageelement_reader* element_reader, size_t* data_offset, size_t* data_size,
+    uint32_t* data_count, uint16_t data_type)
 {
+    struct robotraconteurlite_message_header_view view;
+    size_t o = element_reader->buffer_offset;
+    uint16_t element_type = 0;
     robotraconteurlite_status rv = -1;
-    struct robotraconteurlite_messageelement_header header;
-    rv = robotraconteurlite_messageelement_reader_find_nested_element(element_reader, nested_element_name,
-                                                                      nested_element_reader);
-    if (FAILED(rv))
+
+    robotraconteurlite_message_header_view_init(&view, &element_reader->cursor, element_reader->buffer_offset,
+                                                element_reader->buffer_count);
+
+    if (element_reader->message_version == 2U)
     {
-        return rv;
+        rv = robotraconteurlite_messageelement_reader_read_data_header2_trusted(&view, &o, &element_type, data_count);
     }
-
-    (void)memset(&header, 0, sizeof(header));
-    rv = robotraconteurlite_messageelement_reader_read_header(nested_element_reader, &header);
-    if (FAILED(rv))
+    else
     {
-        return rv;
+        rv = robotraconteurlite_messageelement_reader_read_data_header4_trusted(&view, &o, &element_type, data_count);
     }
-
-    if (header.element_type != expected_data_type)
+    if (FAILED(rv))
     {
-        return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_TYPE_MISMATCH;
+        return rv;
     }
 
-    if (header.data_count != 1U)
+    if (element_type != data_type)
     {
         return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_TYPE_MISMATCH;
     }
 
+    *data_offset = o;
+    *data_size = element_reader->buffer_count - (o - element_reader->buffer_offset);
     return ROBOTRACONTEURLITE_ERROR_SUCCESS;
 }
 
-robotraconteurlite_status robotraconteurlite_messageelement_reader_find_nested_element_verify_array(
-    struct robotraconteurlite_messageelement_reader* element_reader,
-    const struct robotraconteurlite_string* nested_element_name,
-    struct robotraconteurlite_messageelement_reader* nested_element_reader, uint16_t expected_data_type,
-    uint32_t expected_len, uint8_t var_length)
+static size_t robotraconteurlite_message_data_type_size(uint16_t element_type)
 {
-    struct robotraconteurlite_messageelement_header header;
-    robotraconteurlite_status rv = -1;
-
-    rv = robotraconteurlite_messageelement_reader_find_nested_element(element_reader, nested_element_name,
-                                                                      nested_element_reader);
-    if (FAILED(rv))
-    {
-        return rv;
+    switch (element_type)
+    {
+    case ROBOTRACONTEURLITE_DATATYPE_INT8:
+    case ROBOTRACONTEURLITE_DATATYPE_UINT8:
+    case ROBOTRACONTEURLITE_DATATYPE_STRING:
+    case ROBOTRACONTEURLITE_DATATYPE_BOOL:
+        return 1U;
+    case ROBOTRACONTEURLITE_DATATYPE_INT16:
+    case ROBOTRACONTEURLITE_DATATYPE_UINT16:
+        return 2U;
+    case ROBOTRACONTEURLITE_DATATYPE_SINGLE:
+    case ROBOTRACONTEURLITE_DATATYPE_INT32:
+    case ROBOTRACONTEURLITE_DATATYPE_UINT32:
+        return 4U;
+    case ROBOTRACONTEURLITE_DATATYPE_DOUBLE:
+    case ROBOTRACONTEURLITE_DATATYPE_INT64:
+    case ROBOTRACONTEURLITE_DATATYPE_UINT64:
+    case ROBOTRACONTEURLITE_DATATYPE_CSINGLE:
+        return 8U;
+    case ROBOTRACONTEURLITE_DATATYPE_CDOUBLE:
+        return 16U;
+    default:
+        return 0U;
     }
+}
 
-    (void)memset(&header, 0, sizeof(header));
-    rv = robotraconteurlite_messageelement_reader_read_header(nested_element_reader, &header);
-    if (FAILED(rv))
-    {
-        return rv;
-    }
+robotraconteurlite_status robotraconteurlite_messageelement_reader_get_data_info(
+    struct robotraconteurlite_messageelement_reader* element_reader, size_t* data_offset, size_t* data_size,
+    uint32_t* data_count, uint16_t data_type, size_t data_element_size)
+{
+    struct robotraconteurlite_messageelement_header element_header;
+    struct robotraconteurlite_messageelement_buffer_info element_buffer_info;
+    robotraconteurlite_status rv = -1;
 
-    if (header.element_type != expected_data_type)
-    {
-        return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_TYPE_MISMATCH;
-    }
+    assert(element_reader != NULL);
 
-    if (!var_length)
+    if (element_reader->validated != 0U)
     {
-        if (header.data_count != expected_len)
+        /* The header layout was checked by robotraconteurlite_message_reader_validate */
+        rv = robotraconteurlite_messageelement_reader_get_data_info_trusted(element_reader, data_offset, data_size,
+                                                                            data_count, data_type);
+        if (FAILED(rv))
         {
-            return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_TYPE_MISMATCH;
+            return rv;
         }
     }
     else
     {
-        if (header.data_count > expected_len)
+        (void)memset(&element_header, 0, sizeof(element_header));
+        (void)memset(&element_buffer_info, 0, sizeof(element_buffer_info));
+        rv = robotraconteurlite_messageelement_reader_read_header_ex(element_reader, &element_header,
+                                                                     &element_buffer_info);
+        if (FAILED(rv))
         {
-            return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+            return rv;
         }
+
+        if (element_header.element_type != data_type)
+        {
+            return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_TYPE_MISMATCH;
+        }
+
+        *data_offset = element_buffer_info.data_start_offset;
+        *data_size = element_header.element_size - element_buffer_info.header_size;
+        *data_count = element_header.data_count;
+    }
+
+    if ((data_element_size != 0U) && ((data_element_size * *data_count) != *data_size))
+    {
+        return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
     }
 
     return ROBOTRACONTEURLITE_ERROR_SUCCESS;
 }
 
-robotraconteurlite_status robotraconteurlite_messageelement_reader_find_nested_element_verify_string(
-    struct robotraconteurlite_messageelement_reader* element_reader,
-    const struct robotraconteurlite_string* nested_element_name,
-    struct robotraconteurlite_messageelement_reader* nested_element_reader, uint32_t expected_max_len)
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_ex(
+    struct robotraconteurlite_messageelement_reader* element_reader, uint8_t* dest_buf, size_t* dest_len,
+    uint16_t dest_elem_type, size_t dest_elem_size)
 {
-    struct robotraconteurlite_messageelement_header header;
+    size_t data_offset = 0;
+    size_t data_size = 0;
+    uint32_t data_count = 0;
     robotraconteurlite_status rv = -1;
-    rv = robotraconteurlite_messageelement_reader_find_nested_element(element_reader, nested_element_name,
-                                                                      nested_element_reader);
+
+    assert(dest_buf != NULL);
+    assert(dest_len != NULL);
+
+    rv = robotraconteurlite_messageelement_reader_get_data_info(element_reader, &data_offset, &data_size, &data_count,
+                                                                dest_elem_type, dest_elem_size);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    (void)memset(&header, 0, sizeof(header));
-    rv = robotraconteurlite_messageelement_reader_read_header(nested_element_reader, &header);
-    if (FAILED(rv))
+    if (element_reader->validated != 0U)
     {
-        return rv;
+        /* The data is known to be inside the message, copy it through the cursor without re-walking the segments */
+        if (data_count > *dest_len)
+        {
+            return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+        }
+        rv = robotraconteurlite_buffer_vec_cursor_read(&element_reader->cursor, data_offset, dest_buf, data_size);
     }
-
-    if (header.element_type != ROBOTRACONTEURLITE_DATATYPE_STRING)
+    else
     {
-        return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_TYPE_MISMATCH;
+        rv = robotraconteurlite_buffer_vec_copy_to_mem(element_reader->buffer, data_offset, dest_buf, *dest_len, 0,
+                                                       dest_elem_size, data_count);
     }
 
-    if (header.data_count > expected_max_len)
+    if (FAILED(rv))
     {
-        return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+        return rv;
     }
 
+    *dest_len = data_count;
+
     return ROBOTRACONTEURLITE_ERROR_SUCCESS;
 }
 
-/* Message Writer */
-
-robotraconteurlite_status robotraconteurlite_message_writer_init(struct robotraconteurlite_message_writer* writer,
-                                                                 struct robotraconteurlite_buffer_vec* buffer,
-                                                                 size_t offset, size_t count, uint16_t message_version)
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_view_ex(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_buffer* dest,
+    uint16_t dest_elem_type, size_t dest_elem_size, size_t dest_elem_align)
 {
-    size_t buffer_len = 0;
+    size_t data_offset = 0;
+    size_t data_size = 0;
+    uint32_t data_count = 0;
+    struct robotraconteurlite_buffer span;
     robotraconteurlite_status rv = -1;
 
-    assert(writer != NULL);
-    assert(buffer != NULL);
+    assert(dest != NULL);
 
-    /*if (buffer->buffer_vec_cnt == 1 && (buffer->buffer_vec != NULL) && (buffer->buffer_vec->data == NULL) &&
-    (buffer->buffer_vec_cnt == 0))
-    {
-        writer->dry_run = 1;
-    }
-    else
-    {*/
-    rv = robotraconteurlite_buffer_vec_len(buffer, &buffer_len);
+    rv = robotraconteurlite_messageelement_reader_get_data_info(element_reader, &data_offset, &data_size, &data_count,
+                                                                dest_elem_type, dest_elem_size);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    if (buffer_len < (offset + count))
+    (void)memset(&span, 0, sizeof(span));
+    rv = robotraconteurlite_buffer_vec_get_span(element_reader->buffer, data_offset, data_size, &span);
+    if (rv == ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE)
     {
-        return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+        return rv;
     }
-    /*writer->dry_run = 0;
-}*/
-
-    writer->buffer = buffer;
-    writer->buffer_offset = offset;
-    writer->buffer_count = count;
-    writer->message_version = message_version;
 
-    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
-}
+    /* cppcheck-suppress misra-c2012-11.4 */
+    if (SUCCEEDED(rv) && ((dest_elem_align <= 1U) || ((((uintptr_t)span.data) % dest_elem_align) == 0U)))
+    {
+        dest->data = span.data;
+        dest->len = data_count;
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    }
 
-static robotraconteurlite_status robotraconteurlite_message_write_uint32(struct robotraconteurlite_buffer_vec* buffer,
+    /* Data straddles buffer segments or is misaligned for the element type. Copy into caller storage. */
+    if (dest->data == NULL)
+    {
+        return ROBOTRACONTEURLITE_ERROR_INVALID_OPERATION;
+    }
 
-                                                                         size_t* offset, uint32_t val)
-{
-    robotraconteurlite_status rv = robotraconteurlite_buffer_vec_copy_from_uint32(buffer, *offset, val);
+    rv = robotraconteurlite_buffer_vec_copy_to_mem(element_reader->buffer, data_offset, dest->data, dest->len, 0,
+                                                   dest_elem_size, data_count);
     if (FAILED(rv))
     {
         return rv;
     }
-    *offset += 4U;
-    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+
+    dest->len = data_count;
+
+    return ROBOTRACONTEURLITE_STATUS_COPIED;
 }
 
-static robotraconteurlite_status robotraconteurlite_message_write_uint16(struct robotraconteurlite_buffer_vec* buffer,
-                                                                         size_t* offset, uint16_t val)
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_strided_ex(
+    struct robotraconteurlite_messageelement_reader* element_reader, uint8_t* dest_buf, size_t dest_len,
+    size_t dest_stride, size_t source_offset, size_t count, uint16_t dest_elem_type, size_t dest_elem_size)
 {
-    robotraconteurlite_status rv = robotraconteurlite_buffer_vec_copy_from_uint16(buffer, *offset, val);
+    size_t data_offset = 0;
+    size_t data_size = 0;
+    uint32_t data_count = 0;
+    robotraconteurlite_status rv = -1;
+
+    assert(dest_buf != NULL);
+
+    rv = robotraconteurlite_messageelement_reader_get_data_info(element_reader, &data_offset, &data_size, &data_count,
+                                                                dest_elem_type, dest_elem_size);
     if (FAILED(rv))
     {
         return rv;
     }
-    *offset += 2U;
-    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
-}
 
-static robotraconteurlite_status robotraconteurlite_message_write_uint8(struct robotraconteurlite_buffer_vec* buffer,
-                                                                        size_t* offset, uint8_t val)
-{
-    robotraconteurlite_status rv = robotraconteurlite_buffer_vec_copy_from_uint8(buffer, *offset, val);
-    if (FAILED(rv))
+    if ((source_offset > data_count) || (count > (data_count - source_offset)))
     {
-        return rv;
+        return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
     }
-    *offset += 1U;
-    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
-}
 
-static robotraconteurlite_status robotraconteurlite_message_write_int32(struct robotraconteurlite_buffer_vec* buffer,
+    return robotraconteurlite_buffer_vec_copy_to_mem_strided(element_reader->buffer,
+                                                             data_offset + (source_offset * dest_elem_size), dest_buf,
+                                                             dest_len, dest_stride, dest_elem_size, count);
+}
 
-                                                                        size_t* offset, int32_t val)
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_scalar_ex(
+    struct robotraconteurlite_messageelement_reader* element_reader, uint8_t* dest_scalar, uint16_t dest_elem_type,
+    size_t dest_elem_size)
 {
-    robotraconteurlite_status rv = robotraconteurlite_buffer_vec_copy_from_int32(buffer, *offset, val);
+    size_t data_offset = 0;
+    size_t data_size = 0;
+    uint32_t data_count = 0;
+    robotraconteurlite_status rv = -1;
+
+    struct robotraconteurlite_buffer dest_buf;
+    struct robotraconteurlite_buffer_vec dest_vec;
+
+    dest_buf.data = dest_scalar;
+    dest_buf.len = 1;
+    dest_vec.buffer_vec = &dest_buf;
+    dest_vec.buffer_vec_cnt = 1;
+
+    rv = robotraconteurlite_messageelement_reader_get_data_info(element_reader, &data_offset, &data_size, &data_count,
+                                                                dest_elem_type, dest_elem_size);
     if (FAILED(rv))
     {
         return rv;
     }
-    *offset += 4U;
-    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
-}
 
-static robotraconteurlite_status robotraconteurlite_message_write_int16(struct robotraconteurlite_buffer_vec* buffer,
-                                                                        size_t* offset, int16_t val)
-{
-    robotraconteurlite_status rv = robotraconteurlite_buffer_vec_copy_from_int16(buffer, *offset, val);
-    if (FAILED(rv))
+    if (data_count != 1U)
     {
-        return rv;
+        return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
     }
-    *offset += 2U;
-    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
-}
 
-static robotraconteurlite_status robotraconteurlite_message_write_int8(struct robotraconteurlite_buffer_vec* buffer,
-                                                                       size_t* offset, int8_t val)
-{
-    robotraconteurlite_status rv = robotraconteurlite_buffer_vec_copy_from_int8(buffer, *offset, val);
-    if (FAILED(rv))
+    if (element_reader->validated != 0U)
     {
-        return rv;
+        return robotraconteurlite_buffer_vec_cursor_read(&element_reader->cursor, data_offset, dest_scalar,
+                                                         dest_elem_size);
     }
-    *offset += 1U;
-    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+
+    return robotraconteurlite_buffer_vec_copy_vec_ex(element_reader->buffer, data_offset, 1, dest_elem_size, &dest_vec,
+                                                     0, dest_elem_size, 1);
 }
 
-static robotraconteurlite_status robotraconteurlite_message_write_uint_x(struct robotraconteurlite_buffer_vec* buffer,
-                                                                         size_t* offset, uint32_t val)
+/* Convert count elements starting at pos in the buffer_vec directly into dest. Only elements that straddle segments
+   are staged, one at a time. */
+static robotraconteurlite_status robotraconteurlite_message_convert_from_buffer_vec(
+    struct robotraconteurlite_buffer_vec_cursor* cursor, size_t pos, uint16_t source_type, size_t source_elem_size,
+    uint8_t* dest, uint16_t dest_type, size_t dest_elem_size, size_t count)
 {
+    uint8_t straddle[16];
+    struct robotraconteurlite_buffer span;
+    size_t done = 0;
+    size_t n = 0;
     robotraconteurlite_status rv = -1;
-    if (val <= 252U)
-    {
-        return robotraconteurlite_message_write_uint8(buffer, offset, (uint8_t)val);
-    }
-    else if (val <= UINT16_MAX)
+
+    assert(source_elem_size <= sizeof(straddle));
+
+    while (done < count)
     {
-        rv = robotraconteurlite_message_write_uint8(buffer, offset, 253U);
+        rv = robotraconteurlite_buffer_vec_cursor_peek(cursor, pos, &span);
         if (FAILED(rv))
         {
             return rv;
         }
-        return robotraconteurlite_message_write_uint16(buffer, offset, (uint16_t)val);
-    }
-    else
-    {
-        rv = robotraconteurlite_message_write_uint8(buffer, offset, 254U);
+
+        n = span.len / source_elem_size;
+        n = (n < (count - done)) ? n : (count - done);
+        if (n == 0U)
+        {
+            rv = robotraconteurlite_buffer_vec_cursor_read(cursor, pos, straddle, source_elem_size);
+            if (FAILED(rv))
+            {
+                return rv;
+            }
+            n = 1U;
+            rv = robotraconteurlite_datatype_convert(straddle, source_type, &dest[done * dest_elem_size], dest_type, n);
+        }
+        else
+        {
+            rv = robotraconteurlite_datatype_convert(span.data, source_type, &dest[done * dest_elem_size], dest_type,
+                                                     n);
+        }
         if (FAILED(rv))
         {
             return rv;
         }
-        return robotraconteurlite_message_write_uint32(buffer, offset, val);
+
+        done += n;
+        pos += n * source_elem_size;
     }
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
 }
 
-static robotraconteurlite_status robotraconteurlite_message_uint_x_size(uint32_t val, size_t* size)
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_array_convert(
+    struct robotraconteurlite_messageelement_reader* element_reader, uint8_t* dest_buf, size_t* dest_len,
+    uint16_t dest_type)
 {
-    if (val <= 252U)
+    struct robotraconteurlite_messageelement_header element_header;
+    struct robotraconteurlite_messageelement_buffer_info element_buffer_info;
+    size_t source_elem_size = 0;
+    size_t dest_elem_size = 0;
+    size_t data_offset = 0;
+    size_t data_size = 0;
+    uint32_t data_count = 0;
+    robotraconteurlite_status rv = -1;
+
+    assert(element_reader != NULL);
+    assert(dest_buf != NULL);
+    assert(dest_len != NULL);
+
+    (void)memset(&element_header, 0, sizeof(element_header));
+    (void)memset(&element_buffer_info, 0, sizeof(element_buffer_info));
+    rv = robotraconteurlite_messageelement_reader_read_header_ex(element_reader, &element_header,
+                                                                 &element_buffer_info);
+    if (FAILED(rv))
     {
-        *size = 1U;
-        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+        return rv;
     }
-    else if (val <= UINT16_MAX)
+
+    /* An empty conversion checks that the pair is supported */
+    rv = robotraconteurlite_datatype_convert(NULL, element_header.element_type, NULL, dest_type, 0U);
+    if (FAILED(rv))
     {
-        *size = 3U;
-        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+        return rv;
     }
-    else
+
+    source_elem_size = robotraconteurlite_message_data_type_size(element_header.element_type);
+    dest_elem_size = robotraconteurlite_message_data_type_size(dest_type);
+    rv = robotraconteurlite_messageelement_reader_get_data_info(element_reader, &data_offset, &data_size, &data_count,
+                                                                element_header.element_type, source_elem_size);
+    if (FAILED(rv))
     {
-        *size = 5U;
-        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+        return rv;
     }
-}
 
-static robotraconteurlite_status robotraconteurlite_message_len_plus_uint_x(uint32_t data_len, uint32_t* data_len_out,
-                                                                            size_t* size)
-{
-    if (data_len <= 251U)
+    if (data_count > *dest_len)
     {
-        *size = 1U;
-        *data_len_out = data_len + 1U;
-        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+        return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
     }
-    else if (data_len <= (UINT16_MAX - 3U))
+
+    rv = robotraconteurlite_message_convert_from_buffer_vec(&element_reader->cursor, data_offset,
+                                                            element_header.element_type, source_elem_size, dest_buf,
+                                                            dest_type, dest_elem_size, data_count);
+    if (FAILED(rv))
     {
-        *size = 3U;
-        *data_len_out = data_len + 3U;
-        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+        return rv;
     }
-    else if (data_len <= (UINT32_MAX - 5U))
+
+    *dest_len = data_count;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+/* Deinterleave count complex values into separate real and imaginary planes. part_size is the size of each part,
+   sizeof(double) or sizeof(float). */
+static void robotraconteurlite_message_split_complex(const uint8_t* source, uint8_t* real, uint8_t* imag,
+                                                     size_t part_size, size_t count)
+{
+    size_t i = 0;
+    if (part_size == sizeof(double))
     {
-        *size = 5U;
-        *data_len_out = data_len + 5U;
-        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+        for (i = 0; i < count; i++)
+        {
+            double v[2];
+            (void)memcpy(v, &source[i * sizeof(v)], sizeof(v));
+            (void)memcpy(&real[i * sizeof(double)], &v[0], sizeof(double));
+            (void)memcpy(&imag[i * sizeof(double)], &v[1], sizeof(double));
+        }
     }
     else
     {
-        return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+        for (i = 0; i < count; i++)
+        {
+            float v[2];
+            (void)memcpy(v, &source[i * sizeof(v)], sizeof(v));
+            (void)memcpy(&real[i * sizeof(float)], &v[0], sizeof(float));
+            (void)memcpy(&imag[i * sizeof(float)], &v[1], sizeof(float));
+        }
     }
 }
 
-static robotraconteurlite_status robotraconteurlite_message_write_padded_uint_x(
-    struct robotraconteurlite_buffer_vec* buffer, size_t* offset, uint32_t count, size_t* count_offset)
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_split_ex(
+    struct robotraconteurlite_messageelement_reader* element_reader, uint8_t* real_buf, uint8_t* imag_buf,
+    size_t* dest_len, uint16_t dest_elem_type, size_t dest_elem_size)
 {
+    uint8_t straddle[16];
+    struct robotraconteurlite_buffer span;
+    size_t data_offset = 0;
+    size_t data_size = 0;
+    uint32_t data_count = 0;
+    size_t part_size = dest_elem_size / 2U;
+    size_t done = 0;
+    size_t n = 0;
     robotraconteurlite_status rv = -1;
-    rv = robotraconteurlite_message_write_uint8(buffer, offset, 254U);
+
+    assert(real_buf != NULL);
+    assert(imag_buf != NULL);
+    assert(dest_len != NULL);
+    assert(dest_elem_size <= sizeof(straddle));
+
+    rv = robotraconteurlite_messageelement_reader_get_data_info(element_reader, &data_offset, &data_size, &data_count,
+                                                                dest_elem_type, dest_elem_size);
     if (FAILED(rv))
     {
         return rv;
     }
-    *count_offset = *offset;
-    return robotraconteurlite_message_write_uint32(buffer, offset, count);
-}
-
-static robotraconteurlite_status robotraconteurlite_message_padded_uint_x_size(uint32_t count, size_t* size)
-{
-    ROBOTRACONTEURLITE_UNUSED(count);
-    *size = 5U;
-    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
-}
-
-static robotraconteurlite_status robotraconteurlite_message_write_padded_uint_x_val(
-    struct robotraconteurlite_buffer_vec* buffer, size_t count_offset, uint32_t count)
-{
-    robotraconteurlite_status rv = robotraconteurlite_buffer_vec_copy_from_uint32(buffer, count_offset, count);
-    return rv;
-}
 
-static robotraconteurlite_status robotraconteurlite_message_write_int_x(struct robotraconteurlite_buffer_vec* buffer,
-                                                                        size_t* offset, int32_t val)
-{
-    robotraconteurlite_status rv = -1;
-    if ((val >= INT8_MIN) && (val <= 124))
+    if (data_count > *dest_len)
     {
-        return robotraconteurlite_message_write_int8(buffer, offset, (int8_t)val);
+        return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
     }
-    else if ((val >= INT16_MIN) && (val <= INT16_MAX))
+
+    /* Deinterleave straight out of the receive buffer segments, staging only values that straddle segments */
+    while (done < data_count)
     {
-        rv = robotraconteurlite_message_write_int8(buffer, offset, 125);
+        rv = robotraconteurlite_buffer_vec_cursor_peek(&element_reader->cursor, data_offset, &span);
         if (FAILED(rv))
         {
             return rv;
         }
-        return robotraconteurlite_message_write_int16(buffer, offset, (int16_t)val);
-    }
-    else
-    {
-        rv = robotraconteurlite_message_write_int8(buffer, offset, 126);
-        if (FAILED(rv))
+
+        n = span.len / dest_elem_size;
+        n = (n < (data_count - done)) ? n : (data_count - done);
+        if (n == 0U)
         {
-            return rv;
+            rv = robotraconteurlite_buffer_vec_cursor_read(&element_reader->cursor, data_offset, straddle,
+                                                           dest_elem_size);
+            if (FAILED(rv))
+            {
+                return rv;
+            }
+            n = 1U;
+            robotraconteurlite_message_split_complex(straddle, &real_buf[done * part_size],
+                                                     &imag_buf[done * part_size], part_size, n);
+        }
+        else
+        {
+            robotraconteurlite_message_split_complex(span.data, &real_buf[done * part_size],
+                                                     &imag_buf[done * part_size], part_size, n);
         }
-        return robotraconteurlite_message_write_int32(buffer, offset, val);
+
+        done += n;
+        data_offset += n * dest_elem_size;
     }
+
+    *dest_len = data_count;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
 }
 
-static robotraconteurlite_status robotraconteurlite_message_int_x_size(uint32_t val, size_t* size)
+/* Pack n wire bools into words starting at bit bit_pos. Groups of four bytes are tested for nonzero and gathered
+   into a nibble with 32-bit SWAR arithmetic. The words must be zeroed first. */
+static void robotraconteurlite_message_pack_bools(const uint8_t* source, uint64_t* words, size_t bit_pos, size_t n)
 {
-    if (val <= 252U)
+    size_t i = 0;
+    while (i < n)
     {
-        *size = 1U;
-        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+        size_t pos = bit_pos + i;
+        if (((pos % 4U) == 0U) && ((n - i) >= 4U))
+        {
+            uint32_t x = (uint32_t)source[i] | ((uint32_t)source[i + 1U] << 8U) |
+                         ((uint32_t)source[i + 2U] << 16U) | ((uint32_t)source[i + 3U] << 24U);
+            /* Set the low bit of each byte that is nonzero, then gather the four low bits */
+            x = ((((x & 0x7F7F7F7FU) + 0x7F7F7F7FU) | x) & 0x80808080U) >> 7U;
+            x = ((x * 0x01020408U) >> 24U) & 0xFU;
+            words[pos / 64U] |= (uint64_t)x << (pos % 64U);
+            i += 4U;
+        }
+        else
+        {
+            if (source[i] != 0U)
+            {
+                words[pos / 64U] |= (uint64_t)1U << (pos % 64U);
+            }
+            i++;
+        }
     }
-    else if (val <= UINT16_MAX)
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_bool_bitset(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_uint64* dest,
+    size_t* bit_count)
+{
+    struct robotraconteurlite_buffer span;
+    size_t data_offset = 0;
+    size_t data_size = 0;
+    uint32_t data_count = 0;
+    size_t words = 0;
+    size_t done = 0;
+    size_t n = 0;
+    robotraconteurlite_status rv = -1;
+
+    assert(dest != NULL);
+    assert(bit_count != NULL);
+
+    rv = robotraconteurlite_messageelement_reader_get_data_info(element_reader, &data_offset, &data_size, &data_count,
+                                                                ROBOTRACONTEURLITE_DATATYPE_BOOL,
+                                                                sizeof(struct robotraconteurlite_bool));
+    if (FAILED(rv))
     {
-        *size = 3U;
-        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+        return rv;
     }
-    else
+
+    words = ((size_t)data_count + 63U) / 64U;
+    if (words > dest->len)
     {
-        *size = 5U;
-        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+        return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+    }
+
+    (void)memset(dest->data, 0, words * sizeof(uint64_t));
+    while (done < data_count)
+    {
+        rv = robotraconteurlite_buffer_vec_cursor_peek(&element_reader->cursor, data_offset + done, &span);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+
+        n = (span.len < (data_count - done)) ? span.len : (data_count - done);
+        if (n == 0U)
+        {
+            return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+        }
+
+        robotraconteurlite_message_pack_bools(span.data, dest->data, done, n);
+        done += n;
     }
+
+    dest->len = words;
+    *bit_count = data_count;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
 }
 
-static robotraconteurlite_status robotraconteurlite_message_header_string_with_len_prefix_size4(
-    const struct robotraconteurlite_string* str, size_t* size)
+static robotraconteurlite_status robotraconteurlite_messageelement_reader_begin_read_nested_elements_ex(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_messageelement_reader* nested_element_reader, uint16_t* element_type)
 {
-    size_t s1 = 0;
-    robotraconteurlite_status rv = robotraconteurlite_message_uint_x_size(str->len, &s1);
+    robotraconteurlite_status rv = -1;
+    struct robotraconteurlite_messageelement_header header;
+    struct robotraconteurlite_messageelement_buffer_info buffer_info;
+    size_t o = 0;
+    uint32_t nested_element_size = 0;
+
+    (void)memset(&header, 0, sizeof(header));
+    (void)memset(&buffer_info, 0, sizeof(buffer_info));
+    rv = robotraconteurlite_messageelement_reader_read_header_ex(element_reader, &header, &buffer_info);
     if (FAILED(rv))
     {
         return rv;
     }
+    *element_type = header.element_type;
+
+    switch (header.element_type)
+    {
+    case ROBOTRACONTEURLITE_DATATYPE_STRUCTURE:
+    case ROBOTRACONTEURLITE_DATATYPE_MAP_INT32:
+    case ROBOTRACONTEURLITE_DATATYPE_MAP_STRING:
+    case ROBOTRACONTEURLITE_DATATYPE_LIST:
+    case ROBOTRACONTEURLITE_DATATYPE_MULTIDIMARRAY:
+    case ROBOTRACONTEURLITE_DATATYPE_POD:
+    case ROBOTRACONTEURLITE_DATATYPE_POD_ARRAY:
+    case ROBOTRACONTEURLITE_DATATYPE_POD_MULTIDIMARRAY:
+    case ROBOTRACONTEURLITE_DATATYPE_NAMEDARRAY_ARRAY:
+    case ROBOTRACONTEURLITE_DATATYPE_NAMEDARRAY_MULTIDIMARRAY:
+        break;
+    default:
+        return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_TYPE_MISMATCH;
+    }
+
+    if (header.data_count == 0U)
+    {
+        return ROBOTRACONTEURLITE_ERROR_NO_MORE;
+    }
+
+    o = buffer_info.data_start_offset;
+    rv = robotraconteurlite_message_read_count(&element_reader->cursor, element_reader->message_version, &o,
+                                               &nested_element_size);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    if ((buffer_info.data_start_offset + nested_element_size) >
+        (element_reader->buffer_offset + element_reader->buffer_count))
+    {
+        return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
+    }
+
+    nested_element_reader->buffer = element_reader->buffer;
+    nested_element_reader->cursor = element_reader->cursor;
+    nested_element_reader->buffer_offset = buffer_info.data_start_offset;
+    nested_element_reader->buffer_count = nested_element_size;
+    nested_element_reader->buffer_remaining =
+        element_reader->buffer_count - buffer_info.header_size - nested_element_size;
+    nested_element_reader->current_element = 0;
+    nested_element_reader->total_elements = header.data_count;
+    nested_element_reader->message_version = element_reader->message_version;
+    nested_element_reader->string_table = element_reader->string_table;
+    nested_element_reader->validated = element_reader->validated;
+    nested_element_reader->nested_element_index = NULL;
 
-    s1 += str->len;
-    *size = s1;
     return ROBOTRACONTEURLITE_ERROR_SUCCESS;
 }
 
-static robotraconteurlite_status robotraconteurlite_message_write_header_string_with_len_prefix2(
-    struct robotraconteurlite_buffer_vec* buffer, size_t* offset, const struct robotraconteurlite_string* str)
+robotraconteurlite_status robotraconteurlite_messageelement_reader_begin_read_nested_elements(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_messageelement_reader* nested_element_reader)
+{
+    uint16_t element_type = 0;
+    return robotraconteurlite_messageelement_reader_begin_read_nested_elements_ex(element_reader,
+                                                                                  nested_element_reader, &element_type);
+}
+
+static robotraconteurlite_status robotraconteurlite_messageelement_reader_find_nested_element_ex(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    const struct robotraconteurlite_string* nested_element_name,
+    struct robotraconteurlite_messageelement_reader* nested_element_reader, uint16_t* element_type,
+    uint32_t* data_count)
 {
     robotraconteurlite_status rv = -1;
-    rv = robotraconteurlite_message_write_uint16(buffer, offset, str->len);
-    if (FAILED(rv))
+
+    assert(nested_element_name != NULL);
+    assert(nested_element_name->data != NULL);
+
+    if (element_reader->nested_element_index != NULL)
     {
-        return rv;
+        nested_element_reader->buffer = element_reader->buffer;
+        nested_element_reader->cursor = element_reader->cursor;
+        nested_element_reader->message_version = element_reader->message_version;
+        nested_element_reader->string_table = element_reader->string_table;
+        nested_element_reader->validated = element_reader->validated;
+        return robotraconteurlite_messageelement_index_find(element_reader->nested_element_index, nested_element_name,
+                                                            nested_element_reader, element_type, data_count);
     }
 
-    if (str->len > 0U)
+    rv = robotraconteurlite_messageelement_reader_begin_read_nested_elements(element_reader, nested_element_reader);
+    if (FAILED(rv))
     {
-        rv = robotraconteurlite_buffer_vec_copy_from_string(buffer, *offset, str, 0, str->len);
-        if (FAILED(rv))
+        if (NO_MORE(rv))
         {
-            return rv;
+            return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_NOT_FOUND;
         }
+        return rv;
+    }
 
-        *offset += str->len;
+    return robotraconteurlite_messageelement_reader_scan_find(nested_element_reader, nested_element_name, element_type,
+                                                              data_count);
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_reader_find_nested_element(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    const struct robotraconteurlite_string* nested_element_name,
+    struct robotraconteurlite_messageelement_reader* nested_element_reader)
+{
+    uint16_t element_type = 0;
+    uint32_t data_count = 0;
+    return robotraconteurlite_messageelement_reader_find_nested_element_ex(
+        element_reader, nested_element_name, nested_element_reader, &element_type, &data_count);
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_reader_begin_read_fields(
+    struct robotraconteurlite_messageelement_reader* element_reader, uint16_t expected_element_type,
+    struct robotraconteurlite_messageelement_field_reader* field_reader)
+{
+    robotraconteurlite_status rv = -1;
+    uint16_t element_type = 0;
+
+    assert(element_reader != NULL);
+    assert(field_reader != NULL);
+
+    (void)memset(field_reader, 0, sizeof(*field_reader));
+    rv = robotraconteurlite_messageelement_reader_begin_read_nested_elements_ex(element_reader, &field_reader->first,
+                                                                                &element_type);
+    if (FAILED(rv) && (!NO_MORE(rv)))
+    {
+        return rv;
+    }
+    if (element_type != expected_element_type)
+    {
+        return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_TYPE_MISMATCH;
+    }
+    if (NO_MORE(rv))
+    {
+        /* No fields, first.total_elements stays zero */
+        (void)memset(&field_reader->first, 0, sizeof(field_reader->first));
+        field_reader->at_end = 1U;
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
     }
 
+    field_reader->next = field_reader->first;
     return ROBOTRACONTEURLITE_ERROR_SUCCESS;
 }
 
-static robotraconteurlite_status robotraconteurlite_message_write_header_string_with_len_prefix4(
-    struct robotraconteurlite_buffer_vec* buffer, size_t* offset, const struct robotraconteurlite_string* str)
+static robotraconteurlite_status robotraconteurlite_messageelement_field_reader_advance(
+    struct robotraconteurlite_messageelement_field_reader* field_reader,
+    struct robotraconteurlite_messageelement_reader* element_reader)
 {
     robotraconteurlite_status rv = -1;
-    rv = robotraconteurlite_message_write_uint_x(buffer, offset, str->len);
+
+    *element_reader = field_reader->next;
+    rv = robotraconteurlite_messageelement_reader_move_next(&field_reader->next);
     if (FAILED(rv))
     {
+        if (NO_MORE(rv))
+        {
+            field_reader->at_end = 1U;
+            return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+        }
         return rv;
     }
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
 
-    if (str->len > 0U)
+robotraconteurlite_status robotraconteurlite_messageelement_field_reader_next(
+    struct robotraconteurlite_messageelement_field_reader* field_reader,
+    const struct robotraconteurlite_string* field_name, struct robotraconteurlite_messageelement_reader* element_reader)
+{
+    struct robotraconteurlite_messageelement_header header;
+    robotraconteurlite_status rv = -1;
+    uint8_t equal = 0;
+
+    assert(field_reader != NULL);
+    assert(field_name != NULL);
+    assert(element_reader != NULL);
+
+    /* Fields written in declared order match the next element without a search */
+    if (field_reader->at_end == 0U)
     {
-        rv = robotraconteurlite_buffer_vec_copy_from_string(buffer, *offset, str, 0, str->len);
+        rv = robotraconteurlite_messageelement_reader_name_is(&field_reader->next, field_name, &header, &equal);
         if (FAILED(rv))
         {
             return rv;
         }
+    }
 
-        *offset += str->len;
+    if (equal == 0U)
+    {
+        uint16_t element_type = 0;
+        uint32_t data_count = 0;
+
+        /* Out of order or repeated field, search from the first field */
+        if (field_reader->first.total_elements == 0U)
+        {
+            return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_NOT_FOUND;
+        }
+        field_reader->next = field_reader->first;
+        field_reader->at_end = 0U;
+        rv = robotraconteurlite_messageelement_reader_scan_find(&field_reader->next, field_name, &element_type,
+                                                                &data_count);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
     }
 
-    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    return robotraconteurlite_messageelement_field_reader_advance(field_reader, element_reader);
 }
 
-robotraconteurlite_status robotraconteurlite_message_writer_write_header2_ex(
-    struct robotraconteurlite_message_writer* writer, size_t* offset, struct robotraconteurlite_message_header* header,
-    struct robotraconteurlite_message_buffer_info* buffer_info)
+robotraconteurlite_status robotraconteurlite_messageelement_field_reader_next_element(
+    struct robotraconteurlite_messageelement_field_reader* field_reader,
+    struct robotraconteurlite_messageelement_reader* element_reader)
 {
-    size_t str1_len = header->sender_nodename.len;
-    size_t str2_len = header->receiver_nodename.len;
-    size_t str3_len = header->metadata.len;
-    size_t str4_len = str1_len + str2_len + str3_len;
-    uint16_t header_size = 0;
+    assert(field_reader != NULL);
+    assert(element_reader != NULL);
+
+    if (field_reader->at_end != 0U)
+    {
+        return ROBOTRACONTEURLITE_ERROR_NO_MORE;
+    }
+
+    return robotraconteurlite_messageelement_field_reader_advance(field_reader, element_reader);
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_namedarray_ex(
+    struct robotraconteurlite_messageelement_reader* element_reader, uint8_t* dest_buf, size_t* dest_len,
+    uint16_t dest_elem_type, size_t dest_elem_size, size_t dest_elem_count)
+{
+    struct robotraconteurlite_messageelement_field_reader fields;
+    struct robotraconteurlite_messageelement_reader array_reader;
+    struct robotraconteurlite_string array_name;
     robotraconteurlite_status rv = -1;
-    struct robotraconteurlite_array_uint8 sender_nodeid_array;
-    struct robotraconteurlite_array_uint8 recv_nodeid_array;
+    size_t len = 0;
 
-    if ((str1_len > UINT16_MAX) || (str2_len > UINT16_MAX) || (str3_len > UINT16_MAX) ||
-        ((str4_len + 64U) > UINT16_MAX))
+    assert(dest_len != NULL);
+    assert(dest_elem_count > 0U);
+
+    if (*dest_len > (SIZE_MAX / dest_elem_count))
     {
-        return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+        return ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER;
     }
 
-    header_size = (uint16_t)(str4_len + 64U);
+    rv = robotraconteurlite_messageelement_reader_begin_read_fields(
+        element_reader, ROBOTRACONTEURLITE_DATATYPE_NAMEDARRAY_ARRAY, &fields);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
 
-    buffer_info->start_buffer_offset = *offset;
+    robotraconteurlite_string_from_c_str("array", &array_name);
+    rv = robotraconteurlite_messageelement_field_reader_next(&fields, &array_name, &array_reader);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
 
-    rv = robotraconteurlite_buffer_vec_copy_from_mem(writer->buffer, *offset, (const uint8_t*)rrac_magic, 4, 0, 1, 4);
+    /* The namedarrays are stored as one flat numeric array, copy straight into the destination structs */
+    len = *dest_len * dest_elem_count;
+    rv = robotraconteurlite_messageelement_reader_read_data_ex(&array_reader, dest_buf, &len, dest_elem_type,
+                                                               dest_elem_size);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    *offset += 4U;
+    if ((len % dest_elem_count) != 0U)
+    {
+        return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
+    }
+
+    *dest_len = len / dest_elem_count;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+static robotraconteurlite_status robotraconteurlite_messageelement_reader_begin_read_multidimarray(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_messageelement_reader* dims_reader,
+    struct robotraconteurlite_messageelement_reader* array_reader)
+{
+    struct robotraconteurlite_messageelement_field_reader fields;
+    struct robotraconteurlite_string field_name;
+    robotraconteurlite_status rv = -1;
+
+    rv = robotraconteurlite_messageelement_reader_begin_read_fields(
+        element_reader, ROBOTRACONTEURLITE_DATATYPE_MULTIDIMARRAY, &fields);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
 
-    rv = robotraconteurlite_message_write_uint32(writer->buffer, offset, 0);
+    /* dims is written before array, so both are found in one forward pass */
+    robotraconteurlite_string_from_c_str("dims", &field_name);
+    rv = robotraconteurlite_messageelement_field_reader_next(&fields, &field_name, dims_reader);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    rv = robotraconteurlite_message_write_uint16(writer->buffer, offset, 2);
+    robotraconteurlite_string_from_c_str("array", &field_name);
+    return robotraconteurlite_messageelement_field_reader_next(&fields, &field_name, array_reader);
+}
+
+static robotraconteurlite_status robotraconteurlite_multidimarray_check_count(
+    const struct robotraconteurlite_array_uint32* dims, size_t count)
+{
+    size_t expected_count = 1U;
+    size_t i = 0;
+
+    for (i = 0; i < dims->len; i++)
+    {
+        if ((dims->data[i] != 0U) && (expected_count > (SIZE_MAX / dims->data[i])))
+        {
+            return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
+        }
+        expected_count *= dims->data[i];
+    }
+
+    if (expected_count != count)
+    {
+        return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
+    }
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_ex(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_uint32* dims,
+    uint8_t* dest_buf, size_t* dest_len, uint16_t dest_elem_type, size_t dest_elem_size)
+{
+    struct robotraconteurlite_messageelement_reader dims_reader;
+    struct robotraconteurlite_messageelement_reader array_reader;
+    robotraconteurlite_status rv = -1;
+
+    assert(dims != NULL);
+    assert(dest_len != NULL);
+
+    rv = robotraconteurlite_messageelement_reader_begin_read_multidimarray(element_reader, &dims_reader,
+                                                                           &array_reader);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    rv = robotraconteurlite_message_write_uint16(writer->buffer, offset, header_size);
+    rv = robotraconteurlite_messageelement_reader_read_data_uint32_array(&dims_reader, dims);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    sender_nodeid_array.data = header->sender_nodeid.data;
-    sender_nodeid_array.len = 16;
-    recv_nodeid_array.data = header->receiver_nodeid.data;
-    recv_nodeid_array.len = 16;
+    rv = robotraconteurlite_messageelement_reader_read_data_ex(&array_reader, dest_buf, dest_len, dest_elem_type,
+                                                               dest_elem_size);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    return robotraconteurlite_multidimarray_check_count(dims, *dest_len);
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_view_ex(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_uint32* dims,
+    struct robotraconteurlite_buffer* dest, uint16_t dest_elem_type, size_t dest_elem_size, size_t dest_elem_align)
+{
+    struct robotraconteurlite_messageelement_reader dims_reader;
+    struct robotraconteurlite_messageelement_reader array_reader;
+    robotraconteurlite_status rv = -1;
+    robotraconteurlite_status dims_rv = -1;
+    robotraconteurlite_status array_rv = -1;
+
+    assert(dims != NULL);
+    assert(dest != NULL);
+
+    rv = robotraconteurlite_messageelement_reader_begin_read_multidimarray(element_reader, &dims_reader,
+                                                                           &array_reader);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    dims_rv = robotraconteurlite_messageelement_reader_read_data_uint32_view(&dims_reader, dims);
+    if (FAILED(dims_rv))
+    {
+        return dims_rv;
+    }
+
+    array_rv = robotraconteurlite_messageelement_reader_read_data_view_ex(&array_reader, dest, dest_elem_type,
+                                                                          dest_elem_size, dest_elem_align);
+    if (FAILED(array_rv))
+    {
+        return array_rv;
+    }
+
+    rv = robotraconteurlite_multidimarray_check_count(dims, dest->len);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    /* Report COPIED if either part had to be copied into caller storage */
+    if (dims_rv != ROBOTRACONTEURLITE_ERROR_SUCCESS)
+    {
+        return dims_rv;
+    }
+    return array_rv;
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_reader_build_nested_element_index(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_messageelement_index* index)
+{
+    struct robotraconteurlite_messageelement_reader nested_element_reader;
+    robotraconteurlite_status rv = -1;
+
+    assert(element_reader != NULL);
+    assert(index != NULL);
+
+    element_reader->nested_element_index = NULL;
+
+    (void)memset(&nested_element_reader, 0, sizeof(nested_element_reader));
+    rv = robotraconteurlite_messageelement_reader_begin_read_nested_elements(element_reader, &nested_element_reader);
+    if (FAILED(rv) && !NO_MORE(rv))
+    {
+        return rv;
+    }
+
+    rv = robotraconteurlite_messageelement_index_build(&nested_element_reader, index);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    element_reader->nested_element_index = index;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_reader_find_nested_element_verify_scalar(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    const struct robotraconteurlite_string* nested_element_name,
+    struct robotraconteurlite_messageelement_reader* nested_element_reader, uint16_t expected_data_type)
+{
+    uint16_t element_type = 0;
+    uint32_t data_count = 0;
+    robotraconteurlite_status rv = -1;
+
+    rv = robotraconteurlite_messageelement_reader_find_nested_element_ex(
+        element_reader, nested_element_name, nested_element_reader, &element_type, &data_count);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    return robotraconteurlite_messageelement_check_scalar(element_type, data_count, expected_data_type);
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_reader_find_nested_element_verify_array(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    const struct robotraconteurlite_string* nested_element_name,
+    struct robotraconteurlite_messageelement_reader* nested_element_reader, uint16_t expected_data_type,
+    uint32_t expected_len, uint8_t var_length)
+{
+    uint16_t element_type = 0;
+    uint32_t data_count = 0;
+    robotraconteurlite_status rv = -1;
+
+    rv = robotraconteurlite_messageelement_reader_find_nested_element_ex(
+        element_reader, nested_element_name, nested_element_reader, &element_type, &data_count);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    return robotraconteurlite_messageelement_check_array(element_type, data_count, expected_data_type, expected_len,
+                                                         var_length);
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_reader_find_nested_element_verify_string(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    const struct robotraconteurlite_string* nested_element_name,
+    struct robotraconteurlite_messageelement_reader* nested_element_reader, uint32_t expected_max_len)
+{
+    uint16_t element_type = 0;
+    uint32_t data_count = 0;
+    robotraconteurlite_status rv = -1;
+
+    rv = robotraconteurlite_messageelement_reader_find_nested_element_ex(
+        element_reader, nested_element_name, nested_element_reader, &element_type, &data_count);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    return robotraconteurlite_messageelement_check_string(element_type, data_count, expected_max_len);
+}
+
+/* Parse the [n] element number of a path starting at *i */
+static robotraconteurlite_status robotraconteurlite_messageelement_path_parse_number(
+    const struct robotraconteurlite_string* path, size_t* i,
+    struct robotraconteurlite_messageelement_path_token* token)
+{
+    size_t start = *i;
+    uint32_t value = 0;
+    uint8_t negative = 0;
+
+    if ((*i < path->len) && (path->data[*i] == '-'))
+    {
+        negative = 1U;
+        (*i)++;
+    }
+
+    if ((*i >= path->len) || (path->data[*i] < '0') || (path->data[*i] > '9'))
+    {
+        return ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER;
+    }
+
+    while ((*i < path->len) && (path->data[*i] >= '0') && (path->data[*i] <= '9'))
+    {
+        uint32_t digit = (uint32_t)(path->data[*i] - '0');
+        if (value > ((INT32_MAX - digit) / 10U))
+        {
+            return ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER;
+        }
+        value = (value * 10U) + digit;
+        (*i)++;
+    }
+
+    token->token_type = ROBOTRACONTEURLITE_MESSAGEELEMENT_PATH_TOKEN_NUMBER;
+    token->element_name.data = &path->data[start];
+    token->element_name.len = *i - start;
+    token->element_number = (negative != 0U) ? -(int32_t)value : (int32_t)value;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_path_compile(
+    const struct robotraconteurlite_string* path, struct robotraconteurlite_messageelement_path_token tokens[],
+    size_t tokens_len, struct robotraconteurlite_messageelement_path* compiled_path)
+{
+    size_t i = 0;
+    size_t count = 0;
+    robotraconteurlite_status rv = -1;
+
+    assert(path != NULL);
+    assert((tokens != NULL) || (tokens_len == 0U));
+    assert(compiled_path != NULL);
+
+    compiled_path->tokens = tokens;
+    compiled_path->tokens_count = 0;
+
+    if (path->len == 0U)
+    {
+        return ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER;
+    }
+
+    while (i < path->len)
+    {
+        struct robotraconteurlite_messageelement_path_token* token = NULL;
+        size_t start = 0;
+
+        if (count >= tokens_len)
+        {
+            return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+        }
+        token = &tokens[count];
+        (void)memset(token, 0, sizeof(*token));
+        token->cached_offset = SIZE_MAX;
+
+        if (path->data[i] == '[')
+        {
+            i++;
+            if ((i < path->len) && (path->data[i] == '"'))
+            {
+                /* String map key */
+                i++;
+                start = i;
+                while ((i < path->len) && (path->data[i] != '"'))
+                {
+                    i++;
+                }
+                if (i >= path->len)
+                {
+                    return ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER;
+                }
+                token->token_type = ROBOTRACONTEURLITE_MESSAGEELEMENT_PATH_TOKEN_NAME;
+                token->element_name.data = &path->data[start];
+                token->element_name.len = i - start;
+                i++;
+            }
+            else
+            {
+                rv = robotraconteurlite_messageelement_path_parse_number(path, &i, token);
+                if (FAILED(rv))
+                {
+                    return rv;
+                }
+            }
+
+            if ((i >= path->len) || (path->data[i] != ']'))
+            {
+                return ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER;
+            }
+            i++;
+        }
+        else
+        {
+            if (count > 0U)
+            {
+                if (path->data[i] != '.')
+                {
+                    return ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER;
+                }
+                i++;
+            }
+            start = i;
+            while ((i < path->len) && (path->data[i] != '.') && (path->data[i] != '[') && (path->data[i] != ']'))
+            {
+                i++;
+            }
+            if (i == start)
+            {
+                return ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER;
+            }
+            token->token_type = ROBOTRACONTEURLITE_MESSAGEELEMENT_PATH_TOKEN_NAME;
+            token->element_name.data = &path->data[start];
+            token->element_name.len = i - start;
+        }
+
+        count++;
+    }
+
+    compiled_path->tokens_count = count;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+/* Check whether the current element of element_reader is the element selected by token */
+static robotraconteurlite_status robotraconteurlite_messageelement_path_token_match(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    const struct robotraconteurlite_messageelement_path_token* token, uint8_t* equal)
+{
+    struct robotraconteurlite_messageelement_header element_header;
+    robotraconteurlite_status rv = -1;
+
+    rv = robotraconteurlite_messageelement_reader_name_is(element_reader, &token->element_name, &element_header,
+                                                          equal);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    /* Message 4 list and int32 map elements are numbered instead of named */
+    if ((*equal == 0U) && (token->token_type == ROBOTRACONTEURLITE_MESSAGEELEMENT_PATH_TOKEN_NUMBER) &&
+        (element_header.element_name.len == 0U) && (element_header.element_number == token->element_number))
+    {
+        *equal = 1U;
+    }
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+/* Position element_reader at the element where token was found by the last lookup, list_reader is at the first
+   element of the list. Returns MESSAGEELEMENT_NOT_FOUND if the element is not there. */
+static robotraconteurlite_status robotraconteurlite_messageelement_path_token_seek(
+    const struct robotraconteurlite_messageelement_reader* list_reader,
+    const struct robotraconteurlite_messageelement_path_token* token,
+    struct robotraconteurlite_messageelement_reader* element_reader)
+{
+    size_t list_end = list_reader->buffer_offset + list_reader->buffer_count + list_reader->buffer_remaining;
+    size_t o = 0;
+    size_t o2 = 0;
+    uint32_t element_size = 0;
+    uint8_t equal = 0;
+    robotraconteurlite_status rv = -1;
+
+    if ((token->cached_offset == SIZE_MAX) || (token->cached_element >= list_reader->total_elements) ||
+        (token->cached_offset >= (list_end - list_reader->buffer_offset)))
+    {
+        return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_NOT_FOUND;
+    }
+
+    o = list_reader->buffer_offset + token->cached_offset;
+    o2 = o;
+    rv = robotraconteurlite_message_read_count(&element_reader->cursor, list_reader->message_version, &o2,
+                                               &element_size);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+    if (element_size > (list_end - o))
+    {
+        return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_NOT_FOUND;
+    }
+
+    element_reader->buffer_offset = o;
+    element_reader->buffer_count = element_size;
+    element_reader->buffer_remaining = list_end - o - element_size;
+    element_reader->current_element = token->cached_element;
+
+    rv = robotraconteurlite_messageelement_path_token_match(element_reader, token, &equal);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    return (equal != 0U) ? ROBOTRACONTEURLITE_ERROR_SUCCESS : ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_NOT_FOUND;
+}
+
+/* Find the element selected by token in the list starting at list_reader, trying the cached position first */
+static robotraconteurlite_status robotraconteurlite_messageelement_path_token_find(
+    const struct robotraconteurlite_messageelement_reader* list_reader,
+    struct robotraconteurlite_messageelement_path_token* token,
+    struct robotraconteurlite_messageelement_reader* element_reader)
+{
+    robotraconteurlite_status rv = -1;
+
+    *element_reader = *list_reader;
+    rv = robotraconteurlite_messageelement_path_token_seek(list_reader, token, element_reader);
+    if (rv != ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_NOT_FOUND)
+    {
+        return rv;
+    }
+
+    *element_reader = *list_reader;
+    while (1)
+    {
+        uint8_t equal = 0;
+        rv = robotraconteurlite_messageelement_path_token_match(element_reader, token, &equal);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+        if (equal != 0U)
+        {
+            token->cached_offset = element_reader->buffer_offset - list_reader->buffer_offset;
+            token->cached_element = element_reader->current_element;
+            return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+        }
+
+        rv = robotraconteurlite_messageelement_reader_move_next(element_reader);
+        if (FAILED(rv))
+        {
+            if (NO_MORE(rv))
+            {
+                token->cached_offset = SIZE_MAX;
+                return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_NOT_FOUND;
+            }
+            return rv;
+        }
+    }
+}
+
+robotraconteurlite_status robotraconteurlite_messageentry_reader_find_compiled_path(
+    struct robotraconteurlite_messageentry_reader* entry_reader,
+    struct robotraconteurlite_messageelement_path* compiled_path,
+    struct robotraconteurlite_messageelement_reader* element_reader)
+{
+    struct robotraconteurlite_messageelement_reader list_reader;
+    robotraconteurlite_status rv = -1;
+    size_t i = 0;
+
+    assert(entry_reader != NULL);
+    assert(compiled_path != NULL);
+    assert(element_reader != NULL);
+
+    if (compiled_path->tokens_count == 0U)
+    {
+        return ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER;
+    }
+
+    rv = robotraconteurlite_messageentry_reader_begin_read_elements(entry_reader, &list_reader);
+    if (FAILED(rv))
+    {
+        if (NO_MORE(rv))
+        {
+            return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_NOT_FOUND;
+        }
+        return rv;
+    }
+
+    for (i = 0; i < compiled_path->tokens_count; i++)
+    {
+        if (i > 0U)
+        {
+            rv = robotraconteurlite_messageelement_reader_begin_read_nested_elements(element_reader, &list_reader);
+            if (FAILED(rv))
+            {
+                if (NO_MORE(rv))
+                {
+                    return ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_NOT_FOUND;
+                }
+                return rv;
+            }
+        }
+
+        rv = robotraconteurlite_messageelement_path_token_find(&list_reader, &compiled_path->tokens[i],
+                                                               element_reader);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+    }
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status robotraconteurlite_messageentry_reader_find_path(
+    struct robotraconteurlite_messageentry_reader* entry_reader, const struct robotraconteurlite_string* path,
+    struct robotraconteurlite_messageelement_reader* element_reader)
+{
+    struct robotraconteurlite_messageelement_path_token tokens[ROBOTRACONTEURLITE_MESSAGEELEMENT_PATH_MAX_TOKENS];
+    struct robotraconteurlite_messageelement_path compiled_path;
+    robotraconteurlite_status rv = -1;
+
+    rv = robotraconteurlite_messageelement_path_compile(path, tokens, ROBOTRACONTEURLITE_MESSAGEELEMENT_PATH_MAX_TOKENS,
+                                                        &compiled_path);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    return robotraconteurlite_messageentry_reader_find_compiled_path(entry_reader, &compiled_path, element_reader);
+}
+
+/* Message Writer */
+
+/* Size of one element of a numeric or string data type, or zero for other types */
+/* Same container types as accepted by robotraconteurlite_messageelement_reader_begin_read_nested_elements */
+static uint8_t robotraconteurlite_message_data_type_is_nested(uint16_t element_type)
+{
+    switch (element_type)
+    {
+    case ROBOTRACONTEURLITE_DATATYPE_STRUCTURE:
+    case ROBOTRACONTEURLITE_DATATYPE_MAP_INT32:
+    case ROBOTRACONTEURLITE_DATATYPE_MAP_STRING:
+    case ROBOTRACONTEURLITE_DATATYPE_LIST:
+    case ROBOTRACONTEURLITE_DATATYPE_MULTIDIMARRAY:
+    case ROBOTRACONTEURLITE_DATATYPE_POD:
+    case ROBOTRACONTEURLITE_DATATYPE_POD_ARRAY:
+    case ROBOTRACONTEURLITE_DATATYPE_POD_MULTIDIMARRAY:
+    case ROBOTRACONTEURLITE_DATATYPE_NAMEDARRAY_ARRAY:
+    case ROBOTRACONTEURLITE_DATATYPE_NAMEDARRAY_MULTIDIMARRAY:
+        return 1U;
+    default:
+        return 0U;
+    }
+}
+
+static robotraconteurlite_status robotraconteurlite_messageelement_reader_validate_header(
+    struct robotraconteurlite_messageelement_reader* element_reader, uint16_t* element_type, uint32_t* data_count,
+    size_t* data_size)
+{
+    struct robotraconteurlite_messageelement_header header;
+    struct robotraconteurlite_messageelement_buffer_info buffer_info;
+    size_t elem_size = 0;
+    robotraconteurlite_status rv = -1;
+
+    (void)memset(&header, 0, sizeof(header));
+    (void)memset(&buffer_info, 0, sizeof(buffer_info));
+    rv = robotraconteurlite_messageelement_reader_read_header_ex(element_reader, &header, &buffer_info);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    if (buffer_info.header_size > element_reader->buffer_count)
+    {
+        return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
+    }
+
+    *element_type = header.element_type;
+    *data_count = header.data_count;
+    *data_size = element_reader->buffer_count - buffer_info.header_size;
+
+    elem_size = robotraconteurlite_message_data_type_size(header.element_type);
+    if (elem_size != 0U)
+    {
+        if (((*data_size % elem_size) != 0U) || ((*data_size / elem_size) != header.data_count))
+        {
+            return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
+        }
+    }
+    else if ((header.element_type == ROBOTRACONTEURLITE_DATATYPE_VOID) ||
+             (robotraconteurlite_message_data_type_is_nested(header.element_type) && (header.data_count == 0U)))
+    {
+        if (*data_size != 0U)
+        {
+            return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
+        }
+    }
+    else
+    {
+        /* Nested elements are checked by the caller, other types are opaque */
+    }
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+/* Walk an element list and all nested element lists depth first. The readers of the enclosing lists are kept on a
+   fixed size stack instead of recursing. */
+static robotraconteurlite_status robotraconteurlite_messageelement_reader_validate_elements(
+    const struct robotraconteurlite_messageelement_reader* element_reader, size_t elements_size)
+{
+    struct robotraconteurlite_messageelement_reader stack[ROBOTRACONTEURLITE_MESSAGE_VALIDATE_MAX_DEPTH];
+    size_t stack_size[ROBOTRACONTEURLITE_MESSAGE_VALIDATE_MAX_DEPTH];
+    size_t stack_used[ROBOTRACONTEURLITE_MESSAGE_VALIDATE_MAX_DEPTH];
+    size_t depth = 0;
+    uint16_t element_type = 0;
+    uint32_t data_count = 0;
+    size_t data_size = 0;
+    robotraconteurlite_status rv = -1;
+
+    stack[0] = *element_reader;
+    stack_size[0] = elements_size;
+    stack_used[0] = 0;
+
+    for (;;)
+    {
+        struct robotraconteurlite_messageelement_reader* current = &stack[depth];
+        rv = robotraconteurlite_messageelement_reader_validate_header(current, &element_type, &data_count, &data_size);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+        stack_used[depth] += current->buffer_count;
+
+        if (robotraconteurlite_message_data_type_is_nested(element_type) && (data_count != 0U))
+        {
+            if ((depth + 1U) >= ROBOTRACONTEURLITE_MESSAGE_VALIDATE_MAX_DEPTH)
+            {
+                return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+            }
+            rv = robotraconteurlite_messageelement_reader_begin_read_nested_elements(current, &stack[depth + 1U]);
+            if (FAILED(rv))
+            {
+                return rv;
+            }
+            depth++;
+            stack_size[depth] = data_size;
+            stack_used[depth] = 0;
+            continue;
+        }
+
+        /* Move to the next element, returning to the enclosing list at the end of each nested list */
+        for (;;)
+        {
+            rv = robotraconteurlite_messageelement_reader_move_next(&stack[depth]);
+            if (!FAILED(rv))
+            {
+                break;
+            }
+            if (!NO_MORE(rv))
+            {
+                return rv;
+            }
+            if (stack_used[depth] != stack_size[depth])
+            {
+                return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
+            }
+            if (depth == 0U)
+            {
+                return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+            }
+            depth--;
+        }
+    }
+}
+
+static robotraconteurlite_status
+robotraconteurlite_messageentry_reader_validate(struct robotraconteurlite_messageentry_reader* entry_reader)
+{
+    struct robotraconteurlite_messageentry_header header;
+    struct robotraconteurlite_messageentry_buffer_info buffer_info;
+    struct robotraconteurlite_messageelement_reader element_reader;
+    robotraconteurlite_status rv = -1;
+
+    (void)memset(&header, 0, sizeof(header));
+    (void)memset(&buffer_info, 0, sizeof(buffer_info));
+    rv = robotraconteurlite_messageentry_reader_read_header_ex(entry_reader, &header, &buffer_info);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    if (buffer_info.header_size > entry_reader->buffer_count)
+    {
+        return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
+    }
+
+    if (header.element_count == 0U)
+    {
+        if (buffer_info.header_size != entry_reader->buffer_count)
+        {
+            return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
+        }
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    }
+
+    rv = robotraconteurlite_messageentry_reader_begin_read_elements(entry_reader, &element_reader);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    return robotraconteurlite_messageelement_reader_validate_elements(
+        &element_reader, entry_reader->buffer_count - buffer_info.header_size);
+}
+
+robotraconteurlite_status robotraconteurlite_message_reader_validate(struct robotraconteurlite_message_reader* reader)
+{
+    struct robotraconteurlite_message_header header;
+    struct robotraconteurlite_messageentry_reader entry_reader;
+    size_t message_used = 0;
+    uint32_t entry_count = 0;
+    robotraconteurlite_status rv = -1;
+
+    assert(reader != NULL);
+
+    reader->validated = 0U;
+
+    (void)memset(&header, 0, sizeof(header));
+    rv = robotraconteurlite_message_reader_read_header(reader, &header);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    if ((header.message_size > reader->buffer_count) || (header.header_size > header.message_size))
+    {
+        return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
+    }
+
+    message_used = header.header_size;
+    if (header.entry_count != 0U)
+    {
+        rv = robotraconteurlite_message_reader_begin_read_entries(reader, &entry_reader);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+
+        for (;;)
+        {
+            rv = robotraconteurlite_messageentry_reader_validate(&entry_reader);
+            if (FAILED(rv))
+            {
+                return rv;
+            }
+            message_used += entry_reader.buffer_count;
+            entry_count++;
+
+            rv = robotraconteurlite_messageentry_reader_move_next(&entry_reader);
+            if (FAILED(rv))
+            {
+                if (NO_MORE(rv))
+                {
+                    break;
+                }
+                return rv;
+            }
+        }
+    }
+
+    if ((entry_count != header.entry_count) || (message_used != header.message_size))
+    {
+        return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
+    }
+
+    reader->validated = 1U;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status robotraconteurlite_message_writer_init(struct robotraconteurlite_message_writer* writer,
+                                                                 struct robotraconteurlite_buffer_vec* buffer,
+                                                                 size_t offset, size_t count, uint16_t message_version)
+{
+    size_t buffer_len = 0;
+    robotraconteurlite_status rv = -1;
+
+    assert(writer != NULL);
+    assert(buffer != NULL);
+
+    /*if (buffer->buffer_vec_cnt == 1 && (buffer->buffer_vec != NULL) && (buffer->buffer_vec->data == NULL) &&
+    (buffer->buffer_vec_cnt == 0))
+    {
+        writer->dry_run = 1;
+    }
+    else
+    {*/
+    rv = robotraconteurlite_buffer_vec_len(buffer, &buffer_len);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    if (buffer_len < (offset + count))
+    {
+        return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+    }
+    /*writer->dry_run = 0;
+}*/
+
+    writer->buffer = buffer;
+    (void)robotraconteurlite_buffer_vec_cursor_init(&writer->cursor, buffer);
+    writer->buffer_offset = offset;
+    writer->buffer_count = count;
+    writer->message_version = message_version;
+    writer->external_segment_capacity = 0;
+    writer->external_min_len = 0;
+    writer->compact_uint_x = 0;
+    writer->string_table = NULL;
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status robotraconteurlite_message_writer_enable_external_segments(
+    struct robotraconteurlite_message_writer* writer, size_t segment_capacity, size_t min_len)
+{
+    assert(writer != NULL);
+    assert(writer->buffer != NULL);
+
+    if (segment_capacity < writer->buffer->buffer_vec_cnt)
+    {
+        return ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER;
+    }
+
+    writer->external_segment_capacity = segment_capacity;
+    writer->external_min_len = min_len;
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status robotraconteurlite_message_writer_enable_compact_uint_x(
+    struct robotraconteurlite_message_writer* writer)
+{
+    assert(writer != NULL);
+
+    if (writer->message_version != 4U)
+    {
+        return ROBOTRACONTEURLITE_ERROR_INVALID_VERSION;
+    }
+
+    writer->compact_uint_x = 1;
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status robotraconteurlite_message_writer_set_string_table(
+    struct robotraconteurlite_message_writer* writer, const struct robotraconteurlite_string_table* table)
+{
+    assert(writer != NULL);
+
+    if (writer->message_version != 4U)
+    {
+        return ROBOTRACONTEURLITE_ERROR_INVALID_VERSION;
+    }
+
+    writer->string_table = table;
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+static robotraconteurlite_status robotraconteurlite_message_write_uint32(
+    struct robotraconteurlite_buffer_vec_cursor* cursor, size_t* offset, uint32_t val)
+{
+    robotraconteurlite_status rv = robotraconteurlite_buffer_vec_cursor_write(cursor, *offset, &val, 4U);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+    *offset += 4U;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+static robotraconteurlite_status robotraconteurlite_message_write_uint16(
+    struct robotraconteurlite_buffer_vec_cursor* cursor, size_t* offset, uint16_t val)
+{
+    robotraconteurlite_status rv = robotraconteurlite_buffer_vec_cursor_write(cursor, *offset, &val, 2U);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+    *offset += 2U;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+static robotraconteurlite_status robotraconteurlite_message_write_uint8(
+    struct robotraconteurlite_buffer_vec_cursor* cursor, size_t* offset, uint8_t val)
+{
+    robotraconteurlite_status rv = robotraconteurlite_buffer_vec_cursor_write(cursor, *offset, &val, 1U);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+    *offset += 1U;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+static robotraconteurlite_status robotraconteurlite_message_write_int32(
+    struct robotraconteurlite_buffer_vec_cursor* cursor, size_t* offset, int32_t val)
+{
+    robotraconteurlite_status rv = robotraconteurlite_buffer_vec_cursor_write(cursor, *offset, &val, 4U);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+    *offset += 4U;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+static robotraconteurlite_status robotraconteurlite_message_write_int16(
+    struct robotraconteurlite_buffer_vec_cursor* cursor, size_t* offset, int16_t val)
+{
+    robotraconteurlite_status rv = robotraconteurlite_buffer_vec_cursor_write(cursor, *offset, &val, 2U);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+    *offset += 2U;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+static robotraconteurlite_status robotraconteurlite_message_write_int8(
+    struct robotraconteurlite_buffer_vec_cursor* cursor, size_t* offset, int8_t val)
+{
+    robotraconteurlite_status rv = robotraconteurlite_buffer_vec_cursor_write(cursor, *offset, &val, 1U);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+    *offset += 1U;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+static robotraconteurlite_status robotraconteurlite_message_write_uint_x(
+    struct robotraconteurlite_buffer_vec_cursor* cursor, size_t* offset, uint32_t val)
+{
+    robotraconteurlite_status rv = -1;
+    if (val <= 252U)
+    {
+        return robotraconteurlite_message_write_uint8(cursor, offset, (uint8_t)val);
+    }
+    else if (val <= UINT16_MAX)
+    {
+        rv = robotraconteurlite_message_write_uint8(cursor, offset, 253U);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+        return robotraconteurlite_message_write_uint16(cursor, offset, (uint16_t)val);
+    }
+    else
+    {
+        rv = robotraconteurlite_message_write_uint8(cursor, offset, 254U);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+        return robotraconteurlite_message_write_uint32(cursor, offset, val);
+    }
+}
+
+static robotraconteurlite_status robotraconteurlite_message_uint_x_size(uint32_t val, size_t* size)
+{
+    if (val <= 252U)
+    {
+        *size = 1U;
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    }
+    else if (val <= UINT16_MAX)
+    {
+        *size = 3U;
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    }
+    else
+    {
+        *size = 5U;
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    }
+}
+
+static robotraconteurlite_status robotraconteurlite_message_len_plus_uint_x(uint32_t data_len, uint32_t* data_len_out,
+                                                                            size_t* size)
+{
+    if (data_len <= 251U)
+    {
+        *size = 1U;
+        *data_len_out = data_len + 1U;
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    }
+    else if (data_len <= (UINT16_MAX - 3U))
+    {
+        *size = 3U;
+        *data_len_out = data_len + 3U;
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    }
+    else if (data_len <= (UINT32_MAX - 5U))
+    {
+        *size = 5U;
+        *data_len_out = data_len + 5U;
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    }
+    else
+    {
+        return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+    }
+}
+
+static robotraconteurlite_status robotraconteurlite_message_write_padded_uint_x(
+    struct robotraconteurlite_buffer_vec_cursor* cursor, size_t* offset, uint32_t count, size_t* count_offset)
+{
+    robotraconteurlite_status rv = -1;
+    rv = robotraconteurlite_message_write_uint8(cursor, offset, 254U);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+    *count_offset = *offset;
+    return robotraconteurlite_message_write_uint32(cursor, offset, count);
+}
+
+static robotraconteurlite_status robotraconteurlite_message_padded_uint_x_size(uint32_t count, size_t* size)
+{
+    ROBOTRACONTEURLITE_UNUSED(count);
+    *size = 5U;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+static robotraconteurlite_status robotraconteurlite_message_write_padded_uint_x_val(
+    struct robotraconteurlite_buffer_vec_cursor* cursor, size_t count_offset, uint32_t count)
+{
+    robotraconteurlite_status rv = robotraconteurlite_buffer_vec_cursor_write(cursor, count_offset, &count, 4U);
+    return rv;
+}
+/* Moves len bytes from source_pos back to dest_pos. dest_pos must not be after source_pos. */
+static robotraconteurlite_status robotraconteurlite_message_move_back(
+    struct robotraconteurlite_buffer_vec_cursor* cursor, size_t dest_pos, size_t source_pos, size_t len)
+{
+    robotraconteurlite_status rv = -1;
+    uint8_t chunk[64];
+    size_t pos = 0;
+
+    assert(dest_pos <= source_pos);
+
+    if ((dest_pos == source_pos) || (len == 0U))
+    {
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    }
+
+    if ((cursor->buffer_vec->buffer_vec_cnt == 1U) && ((source_pos + len) <= cursor->buffer_vec->buffer_vec[0].len))
+    {
+        uint8_t* data = cursor->buffer_vec->buffer_vec[0].data;
+        (void)memmove(&data[dest_pos], &data[source_pos], len);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    }
+
+    /* Copying forward in chunks never overwrites bytes that have not been read yet */
+    while (pos < len)
+    {
+        size_t n = ((len - pos) < sizeof(chunk)) ? (len - pos) : sizeof(chunk);
+        rv = robotraconteurlite_buffer_vec_cursor_read(cursor, source_pos + pos, chunk, n);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+        rv = robotraconteurlite_buffer_vec_cursor_write(cursor, dest_pos + pos, chunk, n);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+        pos += n;
+    }
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+/* Rewrites the padded size and count of a finished message 4 entry or nested element with minimal uint_x widths.
+   The header fields between the size and the count and the contents after the count are moved back over the
+   freed bytes. container_size is updated to the compacted size. */
+static robotraconteurlite_status robotraconteurlite_message_compact_container4(
+    struct robotraconteurlite_buffer_vec_cursor* cursor, size_t start_offset, size_t count_offset, uint32_t count,
+    size_t* container_size)
+{
+    robotraconteurlite_status rv = -1;
+    size_t header_fields_offset = start_offset + 5U;
+    size_t header_fields_len = (count_offset - 1U) - header_fields_offset;
+    size_t contents_offset = count_offset + 4U;
+    size_t contents_len = (start_offset + *container_size) - contents_offset;
+    size_t count_width = 0;
+    size_t size_width = 0;
+    uint32_t compact_size = 0;
+    size_t o = start_offset;
+
+    rv = robotraconteurlite_message_uint_x_size(count, &count_width);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    rv = robotraconteurlite_message_len_plus_uint_x((uint32_t)(*container_size - 10U + count_width), &compact_size,
+                                                    &size_width);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    if ((size_width == 5U) && (count_width == 5U))
+    {
+        /* Nothing to gain, keep the padded fields and fill in the placeholders */
+        rv = robotraconteurlite_message_write_padded_uint_x_val(cursor, start_offset + 1U, (uint32_t)*container_size);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+        return robotraconteurlite_message_write_padded_uint_x_val(cursor, count_offset, count);
+    }
+
+    rv = robotraconteurlite_message_write_uint_x(cursor, &o, compact_size);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    rv = robotraconteurlite_message_move_back(cursor, o, header_fields_offset, header_fields_len);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+    o += header_fields_len;
+
+    rv = robotraconteurlite_message_write_uint_x(cursor, &o, count);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    rv = robotraconteurlite_message_move_back(cursor, o, contents_offset, contents_len);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    *container_size = compact_size;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+
+static robotraconteurlite_status robotraconteurlite_message_write_int_x(
+    struct robotraconteurlite_buffer_vec_cursor* cursor, size_t* offset, int32_t val)
+{
+    robotraconteurlite_status rv = -1;
+    if ((val >= INT8_MIN) && (val <= 124))
+    {
+        return robotraconteurlite_message_write_int8(cursor, offset, (int8_t)val);
+    }
+    else if ((val >= INT16_MIN) && (val <= INT16_MAX))
+    {
+        rv = robotraconteurlite_message_write_int8(cursor, offset, 125);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+        return robotraconteurlite_message_write_int16(cursor, offset, (int16_t)val);
+    }
+    else
+    {
+        rv = robotraconteurlite_message_write_int8(cursor, offset, 126);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+        return robotraconteurlite_message_write_int32(cursor, offset, val);
+    }
+}
+
+static robotraconteurlite_status robotraconteurlite_message_int_x_size(int32_t val, size_t* size)
+{
+    if ((val >= INT8_MIN) && (val <= 124))
+    {
+        *size = 1U;
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    }
+    else if ((val >= INT16_MIN) && (val <= INT16_MAX))
+    {
+        *size = 3U;
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    }
+    else
+    {
+        *size = 5U;
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    }
+}
+
+static robotraconteurlite_status robotraconteurlite_message_header_string_with_len_prefix_size4(
+    const struct robotraconteurlite_string* str, size_t* size)
+{
+    size_t s1 = 0;
+    robotraconteurlite_status rv = robotraconteurlite_message_uint_x_size(str->len, &s1);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    s1 += str->len;
+    *size = s1;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+static robotraconteurlite_status robotraconteurlite_message_write_header_string_with_len_prefix2(
+    struct robotraconteurlite_buffer_vec_cursor* cursor, size_t* offset, const struct robotraconteurlite_string* str)
+{
+    robotraconteurlite_status rv = -1;
+    rv = robotraconteurlite_message_write_uint16(cursor, offset, str->len);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    if (str->len > 0U)
+    {
+        rv = robotraconteurlite_buffer_vec_cursor_write(cursor, *offset, str->data, str->len);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+
+        *offset += str->len;
+    }
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+static robotraconteurlite_status robotraconteurlite_message_write_header_string_with_len_prefix4(
+    struct robotraconteurlite_buffer_vec_cursor* cursor, size_t* offset, const struct robotraconteurlite_string* str)
+{
+    robotraconteurlite_status rv = -1;
+    rv = robotraconteurlite_message_write_uint_x(cursor, offset, str->len);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    if (str->len > 0U)
+    {
+        rv = robotraconteurlite_buffer_vec_cursor_write(cursor, *offset, str->data, str->len);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+
+        *offset += str->len;
+    }
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status robotraconteurlite_message_writer_write_header2_ex(
+    struct robotraconteurlite_message_writer* writer, size_t* offset, struct robotraconteurlite_message_header* header,
+    struct robotraconteurlite_message_buffer_info* buffer_info)
+{
+    size_t str1_len = header->sender_nodename.len;
+    size_t str2_len = header->receiver_nodename.len;
+    size_t str3_len = header->metadata.len;
+    size_t str4_len = str1_len + str2_len + str3_len;
+    uint16_t header_size = 0;
+    robotraconteurlite_status rv = -1;
+    struct robotraconteurlite_array_uint8 sender_nodeid_array;
+    struct robotraconteurlite_array_uint8 recv_nodeid_array;
+
+    if ((str1_len > UINT16_MAX) || (str2_len > UINT16_MAX) || (str3_len > UINT16_MAX) ||
+        ((str4_len + 64U) > UINT16_MAX))
+    {
+        return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+    }
+
+    header_size = (uint16_t)(str4_len + 64U);
+
+    buffer_info->start_buffer_offset = *offset;
+    buffer_info->sender_endpoint_offset = SIZE_MAX;
+    buffer_info->receiver_endpoint_offset = SIZE_MAX;
+
+    rv = robotraconteurlite_buffer_vec_copy_from_mem(writer->buffer, *offset, (const uint8_t*)rrac_magic, 4, 0, 1, 4);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    *offset += 4U;
+
+    rv = robotraconteurlite_message_write_uint32(&writer->cursor, offset, 0);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    rv = robotraconteurlite_message_write_uint16(&writer->cursor, offset, 2);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    rv = robotraconteurlite_message_write_uint16(&writer->cursor, offset, header_size);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    sender_nodeid_array.data = header->sender_nodeid.data;
+    sender_nodeid_array.len = 16;
+    recv_nodeid_array.data = header->receiver_nodeid.data;
+    recv_nodeid_array.len = 16;
+
+    rv = robotraconteurlite_buffer_vec_copy_from_uint8_array(writer->buffer, *offset, &sender_nodeid_array, 0, 16);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+    *offset += 16U;
+
+    rv = robotraconteurlite_buffer_vec_copy_from_uint8_array(writer->buffer, *offset, &recv_nodeid_array, 0, 16);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+    *offset += 16U;
+
+    buffer_info->sender_endpoint_offset = *offset;
+    rv = robotraconteurlite_message_write_uint32(&writer->cursor, offset, header->sender_endpoint);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    buffer_info->receiver_endpoint_offset = *offset;
+    rv = robotraconteurlite_message_write_uint32(&writer->cursor, offset, header->receiver_endpoint);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    rv = robotraconteurlite_message_write_header_string_with_len_prefix2(&writer->cursor, offset,
+                                                                         &header->sender_nodename);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    rv = robotraconteurlite_message_write_header_string_with_len_prefix2(&writer->cursor, offset,
+                                                                         &header->receiver_nodename);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    rv = robotraconteurlite_message_write_header_string_with_len_prefix2(&writer->cursor, offset, &header->metadata);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    buffer_info->entry_count_offset = *offset;
+    rv = robotraconteurlite_message_write_uint16(&writer->cursor, offset, header->entry_count);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    rv = robotraconteurlite_message_write_uint16(&writer->cursor, offset, header->message_id);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    rv = robotraconteurlite_message_write_uint16(&writer->cursor, offset, header->message_res_id);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+    buffer_info->entry_start_offset = *offset;
+    header->header_size = header_size;
+    buffer_info->header_size = header_size;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+static robotraconteurlite_status robotraconteurlite_message_header4_size(
+    const struct robotraconteurlite_message_header* header, uint8_t message_flags_mask, uint8_t* flags_out,
+    size_t* header_size_out)
+{
+    size_t header_size = 11U;
+    uint8_t flags = 0;
+    robotraconteurlite_status rv = -1;
+
+    if (FLAGS_CHECK(message_flags_mask, ROBOTRACONTEURLITE_MESSAGE_FLAGS_ROUTING_INFO))
+    {
+        if ((robotraconteurlite_nodeid_isany(&header->sender_nodeid) == 0) ||
+            (robotraconteurlite_nodeid_isany(&header->receiver_nodeid) == 0) || (header->sender_nodename.len != 0U) ||
+            (header->receiver_nodename.len != 0U))
+        {
+            size_t s = 0;
+            header_size += 32U;
+            rv = robotraconteurlite_message_header_string_with_len_prefix_size4(&header->sender_nodename, &s);
+            if (FAILED(rv))
+            {
+                return rv;
+            }
+            header_size += s;
+            rv = robotraconteurlite_message_header_string_with_len_prefix_size4(&header->receiver_nodename, &s);
+            if (FAILED(rv))
+            {
+                return rv;
+            }
+            header_size += s;
+            FLAGS_SET(flags, ROBOTRACONTEURLITE_MESSAGE_FLAGS_ROUTING_INFO);
+        }
+    }
+
+    if (FLAGS_CHECK(message_flags_mask, ROBOTRACONTEURLITE_MESSAGE_FLAGS_ENDPOINT_INFO))
+    {
+        if ((header->sender_endpoint != 0U) || (header->receiver_endpoint != 0U))
+        {
+            size_t s = 0;
+            rv = robotraconteurlite_message_uint_x_size(header->sender_endpoint, &s);
+            if (FAILED(rv))
+            {
+                return rv;
+            }
+            header_size += s;
+            rv = robotraconteurlite_message_uint_x_size(header->receiver_endpoint, &s);
+            if (FAILED(rv))
+            {
+                return rv;
+            }
+            header_size += s;
+            FLAGS_SET(flags, ROBOTRACONTEURLITE_MESSAGE_FLAGS_ENDPOINT_INFO);
+        }
+    }
+
+    if (FLAGS_CHECK(message_flags_mask, ROBOTRACONTEURLITE_MESSAGE_FLAGS_PRIORITY))
+    {
+        if (header->priority != 0U)
+        {
+            FLAGS_SET(flags, ROBOTRACONTEURLITE_MESSAGE_FLAGS_PRIORITY);
+            header_size += 2U;
+        }
+    }
+
+    if (FLAGS_CHECK(message_flags_mask, ROBOTRACONTEURLITE_MESSAGE_FLAGS_META_INFO))
+    {
+        if ((header->metadata.len != 0U) || (header->message_id != 0U) || (header->message_res_id != 0U))
+        {
+            size_t s = 0;
+            rv = robotraconteurlite_message_header_string_with_len_prefix_size4(&header->metadata, &s);
+            if (FAILED(rv))
+            {
+                return rv;
+            }
+            header_size += s;
+            header_size += 4U;
+            FLAGS_SET(flags, ROBOTRACONTEURLITE_MESSAGE_FLAGS_META_INFO);
+        }
+    }
+
+    if (FLAGS_CHECK(message_flags_mask, ROBOTRACONTEURLITE_MESSAGE_FLAGS_MULTIPLE_ENTRIES))
+    {
+        if (header->entry_count != 1U)
+        {
+            size_t s = 0;
+            rv = robotraconteurlite_message_padded_uint_x_size(header->entry_count, &s);
+            if (FAILED(rv))
+            {
+                return rv;
+            }
+            header_size += s;
+            FLAGS_SET(flags, ROBOTRACONTEURLITE_MESSAGE_FLAGS_MULTIPLE_ENTRIES);
+        }
+    }
+
+    flags |= ((message_flags_mask & ROBOTRACONTEURLITE_MESSAGE_FLAGS_UNRELIABLE) & flags);
+    {
+        size_t s = 0;
+        uint32_t header_size2 = 0;
+        rv = robotraconteurlite_message_len_plus_uint_x(header_size, &header_size2, &s);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+        header_size += s;
+    }
+
+    if (header_size > UINT32_MAX)
+    {
+        return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+    }
+
+    *flags_out = flags;
+    *header_size_out = header_size;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status robotraconteurlite_message_writer_write_header4_ex(
+    struct robotraconteurlite_message_writer* writer, size_t* offset, struct robotraconteurlite_message_header* header,
+    uint8_t message_flags_mask, struct robotraconteurlite_message_buffer_info* buffer_info)
+{
+    size_t header_size = 0;
+    uint8_t flags = 0;
+    robotraconteurlite_status rv = -1;
+
+    rv = robotraconteurlite_message_header4_size(header, message_flags_mask, &flags, &header_size);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    buffer_info->start_buffer_offset = *offset;
+    buffer_info->sender_endpoint_offset = SIZE_MAX;
+    buffer_info->receiver_endpoint_offset = SIZE_MAX;
+
+    rv = robotraconteurlite_buffer_vec_copy_from_mem(writer->buffer, *offset, (const uint8_t*)rrac_magic, 4, 0, 1, 4);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    *offset += 4U;
+
+    rv = robotraconteurlite_message_write_uint32(&writer->cursor, offset, 0);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    rv = robotraconteurlite_message_write_uint16(&writer->cursor, offset, 4);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    rv = robotraconteurlite_message_write_uint_x(&writer->cursor, offset, (uint32_t)header_size);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    rv = robotraconteurlite_message_write_uint8(&writer->cursor, offset, flags);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGE_FLAGS_ROUTING_INFO))
+    {
+        struct robotraconteurlite_array_uint8 sender_nodeid_array;
+        struct robotraconteurlite_array_uint8 recv_nodeid_array;
+        sender_nodeid_array.data = header->sender_nodeid.data;
+        sender_nodeid_array.len = 16;
+        recv_nodeid_array.data = header->receiver_nodeid.data;
+        recv_nodeid_array.len = 16;
+
+        rv = robotraconteurlite_buffer_vec_copy_from_uint8_array(writer->buffer, *offset, &sender_nodeid_array, 0, 16);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+        *offset += 16U;
+
+        rv = robotraconteurlite_buffer_vec_copy_from_uint8_array(writer->buffer, *offset, &recv_nodeid_array, 0, 16);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+        *offset += 16U;
+
+        rv = robotraconteurlite_message_write_header_string_with_len_prefix4(&writer->cursor, offset,
+                                                                             &header->sender_nodename);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+
+        rv = robotraconteurlite_message_write_header_string_with_len_prefix4(&writer->cursor, offset,
+                                                                             &header->receiver_nodename);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+    }
+
+    if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGE_FLAGS_ENDPOINT_INFO))
+    {
+        buffer_info->sender_endpoint_offset = *offset;
+        rv = robotraconteurlite_message_write_uint_x(&writer->cursor, offset, header->sender_endpoint);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+
+        buffer_info->receiver_endpoint_offset = *offset;
+        rv = robotraconteurlite_message_write_uint_x(&writer->cursor, offset, header->receiver_endpoint);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+    }
+
+    if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGE_FLAGS_PRIORITY))
+    {
+        rv = robotraconteurlite_message_write_uint16(&writer->cursor, offset, header->priority);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+    }
+
+    if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGE_FLAGS_META_INFO))
+    {
+        rv = robotraconteurlite_message_write_header_string_with_len_prefix4(&writer->cursor, offset,
+                                                                             &header->metadata);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+
+        rv = robotraconteurlite_message_write_uint16(&writer->cursor, offset, header->message_id);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+
+        rv = robotraconteurlite_message_write_uint16(&writer->cursor, offset, header->message_res_id);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+    }
+
+    if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGE_FLAGS_MULTIPLE_ENTRIES))
+    {
+        rv = robotraconteurlite_message_write_padded_uint_x(&writer->cursor, offset, header->entry_count,
+                                                            &buffer_info->entry_count_offset);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+    }
+    else
+    {
+        buffer_info->entry_count_offset = SIZE_MAX;
+    }
+
+    if ((*offset - buffer_info->start_buffer_offset) != header_size)
+    {
+        return ROBOTRACONTEURLITE_ERROR_INTERNAL_ERROR;
+    }
+
+    buffer_info->entry_start_offset = *offset;
+    header->header_size = header_size;
+    buffer_info->header_size = header_size;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status robotraconteurlite_message_writer_begin_message(
+    struct robotraconteurlite_message_writer* writer, struct robotraconteurlite_message_header* header,
+    struct robotraconteurlite_messageentry_writer* entry_writer)
+{
+    return robotraconteurlite_message_writer_begin_message_ex(writer, header, entry_writer, 0xFFU);
+}
+
+robotraconteurlite_status robotraconteurlite_message_writer_begin_message_ex(
+    struct robotraconteurlite_message_writer* writer, struct robotraconteurlite_message_header* header,
+    struct robotraconteurlite_messageentry_writer* entry_writer, uint8_t message_flags_mask)
+{
+    robotraconteurlite_status rv = -1;
+    struct robotraconteurlite_message_buffer_info message_buffer_info;
+    size_t o = writer->buffer_offset;
+
+    assert(header != NULL);
+    assert(writer != NULL);
+    assert(entry_writer != NULL);
+
+    switch (writer->message_version)
+    {
+    case 2:
+        rv = robotraconteurlite_message_writer_write_header2_ex(writer, &o, header, &message_buffer_info);
+        break;
+    case 4:
+        rv = robotraconteurlite_message_writer_write_header4_ex(writer, &o, header, message_flags_mask,
+                                                                &message_buffer_info);
+        break;
+    default:
+        return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
+    }
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    entry_writer->buffer = writer->buffer;
+    entry_writer->cursor = writer->cursor;
+    entry_writer->external_segment_capacity = writer->external_segment_capacity;
+    entry_writer->external_min_len = writer->external_min_len;
+    entry_writer->compact_uint_x = writer->compact_uint_x;
+    entry_writer->string_table = writer->string_table;
+    entry_writer->buffer_offset = writer->buffer_offset + message_buffer_info.header_size;
+    entry_writer->buffer_count = writer->buffer_count - message_buffer_info.header_size;
+    entry_writer->entries_written_count = 0;
+    entry_writer->entries_written_size = 0;
+    entry_writer->external_written_size = 0;
+    entry_writer->message_version = writer->message_version;
+    writer->message_size_offset = message_buffer_info.start_buffer_offset + 4U;
+    writer->entry_count_offset = message_buffer_info.entry_count_offset;
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status robotraconteurlite_message_writer_end_message(
+    struct robotraconteurlite_message_writer* writer, struct robotraconteurlite_message_header* header,
+    struct robotraconteurlite_messageentry_writer* entry_writer)
+{
+    size_t message_size = 0;
+    robotraconteurlite_status rv = -1;
+    uint16_t ver = writer->message_version;
+
+    assert(writer != NULL);
+    assert(header != NULL);
+    assert(entry_writer != NULL);
+
+    message_size = entry_writer->entries_written_size + header->header_size;
+
+    rv = robotraconteurlite_buffer_vec_copy_from_uint32(writer->buffer, writer->message_size_offset, message_size);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    if (writer->entry_count_offset != SIZE_MAX)
+    {
+        switch (ver)
+        {
+        case 2: {
+            size_t o = writer->entry_count_offset;
+            rv = robotraconteurlite_message_write_uint16(&writer->cursor, &o,
+                                                         (uint16_t)entry_writer->entries_written_count);
+            break;
+        }
+        case 4:
+            rv = robotraconteurlite_message_write_padded_uint_x_val(&writer->cursor, writer->entry_count_offset,
+                                                                    (uint32_t)entry_writer->entries_written_count);
+            break;
+        default:
+            return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
+        }
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+    }
+    else
+    {
+        if (entry_writer->entries_written_count != 1U)
+        {
+            return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
+        }
+    }
+
+    header->message_size = message_size;
+    header->entry_count = (uint32_t)entry_writer->entries_written_count;
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status robotraconteurlite_messageentry_writer_write_header2_ex(
+    struct robotraconteurlite_messageentry_writer* entry_writer, size_t* offset,
+    struct robotraconteurlite_messageentry_header* header,
+    struct robotraconteurlite_messageentry_buffer_info* buffer_info)
+{
+    robotraconteurlite_status rv = -1;
+    buffer_info->entry_size_offset = *offset;
+    buffer_info->request_id_offset = SIZE_MAX;
+    rv = robotraconteurlite_message_write_uint32(&entry_writer->cursor, offset, 0);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    rv = robotraconteurlite_message_write_uint16(&entry_writer->cursor, offset, header->entry_type);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    /* pad */
+    rv = robotraconteurlite_message_write_uint16(&entry_writer->cursor, offset, 0);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+    rv = robotraconteurlite_message_write_header_string_with_len_prefix2(&entry_writer->cursor, offset,
+                                                                         &header->service_path);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    rv = robotraconteurlite_message_write_header_string_with_len_prefix2(&entry_writer->cursor, offset,
+                                                                         &header->member_name);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    buffer_info->request_id_offset = *offset;
+    rv = robotraconteurlite_message_write_uint32(&entry_writer->cursor, offset, header->request_id);
+
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    rv = robotraconteurlite_message_write_uint16(&entry_writer->cursor, offset, header->error);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    rv = robotraconteurlite_message_write_header_string_with_len_prefix2(&entry_writer->cursor, offset,
+                                                                         &header->metadata);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    buffer_info->element_count_offset = *offset;
+    rv = robotraconteurlite_message_write_uint16(&entry_writer->cursor, offset, 0);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    buffer_info->header_size = *offset - entry_writer->buffer_offset;
+    buffer_info->element_start_offset = *offset;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+/* Replace str with its confirmed code from table. str and code are unchanged if there is no table, a code is
+   already set or str has not been confirmed. */
+static void robotraconteurlite_message_string_table_encode(const struct robotraconteurlite_string_table* table,
+                                                           struct robotraconteurlite_string* str, uint32_t* code)
+{
+    uint32_t c = 0;
+
+    if ((table == NULL) || (*code != 0U) || (str->len == 0U))
+    {
+        return;
+    }
+
+    if (robotraconteurlite_string_table_find_code(table, str, 1, &c) == ROBOTRACONTEURLITE_ERROR_SUCCESS)
+    {
+        *code = c;
+        str->data = NULL;
+        str->len = 0;
+    }
+}
+
+robotraconteurlite_status robotraconteurlite_messageentry_writer_write_header4_ex(
+    struct robotraconteurlite_messageentry_writer* entry_writer, size_t* offset,
+    struct robotraconteurlite_messageentry_header* header,
+    struct robotraconteurlite_messageentry_buffer_info* buffer_info)
+{
+    robotraconteurlite_status rv = -1;
+    uint8_t flags = 0;
+    struct robotraconteurlite_messageentry_header coded_header;
+
+    coded_header = *header;
+    robotraconteurlite_message_string_table_encode(entry_writer->string_table, &coded_header.service_path,
+                                                   &coded_header.service_path_code);
+    robotraconteurlite_message_string_table_encode(entry_writer->string_table, &coded_header.member_name,
+                                                   &coded_header.member_name_code);
+
+    if (coded_header.service_path.len > 0U)
+    {
+        FLAGS_SET(flags, ROBOTRACONTEURLITE_MESSAGEENTRY_FLAGS_SERVICE_PATH_STR);
+    }
+
+    if (coded_header.service_path_code != 0U)
+    {
+        FLAGS_SET(flags, ROBOTRACONTEURLITE_MESSAGEENTRY_FLAGS_SERVICE_PATH_CODE);
+    }
+
+    if (coded_header.member_name.len > 0U)
+    {
+        FLAGS_SET(flags, ROBOTRACONTEURLITE_MESSAGEENTRY_FLAGS_MEMBER_NAME_STR);
+    }
+
+    if (coded_header.member_name_code != 0U)
+    {
+        FLAGS_SET(flags, ROBOTRACONTEURLITE_MESSAGEENTRY_FLAGS_MEMBER_NAME_CODE);
+    }
+
+    if (coded_header.request_id != 0U)
+    {
+        FLAGS_SET(flags, ROBOTRACONTEURLITE_MESSAGEENTRY_FLAGS_REQUEST_ID);
+    }
+
+    if (coded_header.error != 0U)
+    {
+        FLAGS_SET(flags, ROBOTRACONTEURLITE_MESSAGEENTRY_FLAGS_ERROR);
+    }
+
+    if (coded_header.metadata.len > 0U)
+    {
+        FLAGS_SET(flags, ROBOTRACONTEURLITE_MESSAGEENTRY_FLAGS_META_INFO);
+    }
+
+    buffer_info->request_id_offset = SIZE_MAX;
+
+    rv = robotraconteurlite_message_write_padded_uint_x(&entry_writer->cursor, offset, 0,
+                                                        &buffer_info->entry_size_offset);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    rv = robotraconteurlite_message_write_uint8(&entry_writer->cursor, offset, flags);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    rv = robotraconteurlite_message_write_uint16(&entry_writer->cursor, offset, coded_header.entry_type);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEENTRY_FLAGS_SERVICE_PATH_STR))
+    {
+        rv = robotraconteurlite_message_write_header_string_with_len_prefix4(&entry_writer->cursor, offset,
+                                                                             &coded_header.service_path);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+    }
+
+    if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEENTRY_FLAGS_SERVICE_PATH_CODE))
+    {
+        rv = robotraconteurlite_message_write_uint_x(&entry_writer->cursor, offset, coded_header.service_path_code);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+    }
+
+    if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEENTRY_FLAGS_MEMBER_NAME_STR))
+    {
+        rv = robotraconteurlite_message_write_header_string_with_len_prefix4(&entry_writer->cursor, offset,
+                                                                             &coded_header.member_name);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+    }
+
+    if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEENTRY_FLAGS_MEMBER_NAME_CODE))
+    {
+        rv = robotraconteurlite_message_write_uint_x(&entry_writer->cursor, offset, coded_header.member_name_code);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+    }
+
+    if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEENTRY_FLAGS_REQUEST_ID))
+    {
+        buffer_info->request_id_offset = *offset;
+        rv = robotraconteurlite_message_write_uint_x(&entry_writer->cursor, offset, coded_header.request_id);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+    }
+
+    if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEENTRY_FLAGS_ERROR))
+    {
+        rv = robotraconteurlite_message_write_uint16(&entry_writer->cursor, offset, coded_header.error);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+    }
+
+    if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEENTRY_FLAGS_META_INFO))
+    {
+        rv = robotraconteurlite_message_write_header_string_with_len_prefix4(&entry_writer->cursor, offset,
+                                                                             &coded_header.metadata);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+    }
+
+    rv = robotraconteurlite_message_write_padded_uint_x(&entry_writer->cursor, offset, 0,
+                                                        &buffer_info->element_count_offset);
+
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    buffer_info->header_size = *offset - entry_writer->buffer_offset;
+    buffer_info->element_start_offset = *offset;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status robotraconteurlite_messageentry_writer_begin_entry(
+    struct robotraconteurlite_messageentry_writer* entry_writer, struct robotraconteurlite_messageentry_header* header,
+    struct robotraconteurlite_messageelement_writer* element_writer)
+{
+
+    robotraconteurlite_status rv = -1;
+    size_t o = entry_writer->buffer_offset;
+    struct robotraconteurlite_messageentry_buffer_info buffer_info;
+
+    assert(entry_writer != NULL);
+    assert(header != NULL);
+    assert(element_writer != NULL);
+
+    if (!(entry_writer->entries_written_count < UINT16_MAX))
+    {
+        return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
+    }
+    switch (entry_writer->message_version)
+    {
+    case 2:
+        rv = robotraconteurlite_messageentry_writer_write_header2_ex(entry_writer, &o, header, &buffer_info);
+        break;
+    case 4:
+        rv = robotraconteurlite_messageentry_writer_write_header4_ex(entry_writer, &o, header, &buffer_info);
+        break;
+    default:
+        return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
+    }
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    element_writer->buffer = entry_writer->buffer;
+    element_writer->cursor = entry_writer->cursor;
+    element_writer->external_segment_capacity = entry_writer->external_segment_capacity;
+    element_writer->external_min_len = entry_writer->external_min_len;
+    element_writer->compact_uint_x = entry_writer->compact_uint_x;
+    element_writer->string_table = entry_writer->string_table;
+    element_writer->buffer_offset = entry_writer->buffer_offset + buffer_info.header_size;
+    element_writer->buffer_count = entry_writer->buffer_count - buffer_info.header_size;
+    element_writer->elements_written_count = 0;
+    element_writer->elements_written_size = 0;
+    element_writer->external_written_size = 0;
+    element_writer->reserved_offset = 0;
+    element_writer->reserved_size = 0;
+    element_writer->message_version = entry_writer->message_version;
+    entry_writer->entry_size_offset = buffer_info.entry_size_offset;
+    entry_writer->element_count_offset = buffer_info.element_count_offset;
+    entry_writer->entry_header_size = buffer_info.header_size;
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status robotraconteurlite_messageentry_writer_end_entry(
+    struct robotraconteurlite_messageentry_writer* entry_writer, struct robotraconteurlite_messageentry_header* header,
+    struct robotraconteurlite_messageelement_writer* element_writer)
+{
+
+    robotraconteurlite_status rv = -1;
+    uint32_t entry_size = 0;
+
+    assert(entry_writer != NULL);
+    assert(header != NULL);
+    assert(element_writer != NULL);
+
+    entry_size = (uint32_t)(entry_writer->entry_header_size + element_writer->elements_written_size);
+
+    switch (entry_writer->message_version)
+    {
+    case 2: {
+        size_t o = entry_writer->entry_size_offset;
+        rv = robotraconteurlite_message_write_uint32(&entry_writer->cursor, &o, entry_size);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+        o = entry_writer->element_count_offset;
+        rv = robotraconteurlite_message_write_uint16(&entry_writer->cursor, &o,
+                                                     (uint16_t)element_writer->elements_written_count);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+        break;
+    }
+    case 4: {
+        if ((entry_writer->compact_uint_x != 0U) && (entry_writer->external_segment_capacity == 0U))
+        {
+            size_t compact_size = entry_size;
+            rv = robotraconteurlite_message_compact_container4(&entry_writer->cursor, entry_writer->buffer_offset,
+                                                               entry_writer->element_count_offset,
+                                                               (uint32_t)element_writer->elements_written_count,
+                                                               &compact_size);
+            if (FAILED(rv))
+            {
+                return rv;
+            }
+            entry_size = (uint32_t)compact_size;
+            break;
+        }
+        rv = robotraconteurlite_message_write_padded_uint_x_val(&entry_writer->cursor, entry_writer->entry_size_offset,
+                                                                entry_size);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+        rv = robotraconteurlite_message_write_padded_uint_x_val(
+            &entry_writer->cursor, entry_writer->element_count_offset,
+            (uint32_t)element_writer->elements_written_count);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+        break;
+    }
+    default:
+        return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
+    }
+
+    /* Only the bytes written to the send buffer use up buffer_count */
+    assert((entry_size - element_writer->external_written_size) <= entry_writer->buffer_count);
+    entry_writer->entries_written_count++;
+    entry_writer->entries_written_size += entry_size;
+    entry_writer->external_written_size += element_writer->external_written_size;
+    entry_writer->buffer_offset += entry_size;
+    entry_writer->buffer_count -= entry_size - element_writer->external_written_size;
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_writer_write_header4_ex(
+    struct robotraconteurlite_messageelement_writer* element_writer, size_t* offset,
+    struct robotraconteurlite_messageelement_header* header,
+    struct robotraconteurlite_messageelement_buffer_info* buffer_info)
+{
+    robotraconteurlite_status rv = -1;
+    uint8_t flags = 0;
+    struct robotraconteurlite_messageelement_header coded_header;
+
+    coded_header = *header;
+    robotraconteurlite_message_string_table_encode(element_writer->string_table, &coded_header.element_name,
+                                                   &coded_header.element_name_code);
+    robotraconteurlite_message_string_table_encode(element_writer->string_table, &coded_header.element_type_name,
+                                                   &coded_header.element_type_name_code);
+
+    if (coded_header.element_name.len > 0U)
+    {
+        FLAGS_SET(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_ELEMENT_NAME_STR);
+    }
+
+    if (coded_header.element_name_code != 0U)
+    {
+        FLAGS_SET(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_ELEMENT_NAME_CODE);
+    }
+
+    if (coded_header.element_number != 0)
+    {
+        FLAGS_SET(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_ELEMENT_NUMBER);
+    }
+
+    if (coded_header.element_type_name.len > 0U)
+    {
+        FLAGS_SET(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_ELEMENT_TYPE_NAME_STR);
+    }
+
+    if (coded_header.element_type_name_code != 0U)
+    {
+        FLAGS_SET(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_ELEMENT_TYPE_NAME_CODE);
+    }
+
+    if (coded_header.metadata.len > 0U)
+    {
+        FLAGS_SET(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_META_INFO);
+    }
+
+    buffer_info->start_buffer_offset = *offset;
+    rv = robotraconteurlite_message_write_padded_uint_x(&element_writer->cursor, offset, 0,
+                                                        &buffer_info->element_size_offset);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    rv = robotraconteurlite_message_write_uint8(&element_writer->cursor, offset, flags);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_ELEMENT_NAME_STR))
+    {
+        buffer_info->element_name_str_offset = *offset;
+        rv = robotraconteurlite_message_write_header_string_with_len_prefix4(&element_writer->cursor, offset,
+                                                                             &coded_header.element_name);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+    }
+    else
+    {
+        buffer_info->element_name_str_offset = SIZE_MAX;
+    }
+
+    if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_ELEMENT_NAME_CODE))
+    {
+        rv = robotraconteurlite_message_write_uint_x(&element_writer->cursor, offset, coded_header.element_name_code);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+    }
+
+    if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_ELEMENT_NUMBER))
+    {
+        rv = robotraconteurlite_message_write_int_x(&element_writer->cursor, offset, coded_header.element_number);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+    }
+
+    rv = robotraconteurlite_message_write_uint16(&element_writer->cursor, offset, coded_header.element_type);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_ELEMENT_TYPE_NAME_STR))
+    {
+        rv = robotraconteurlite_message_write_header_string_with_len_prefix4(&element_writer->cursor, offset,
+                                                                             &coded_header.element_type_name);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+    }
+
+    if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_ELEMENT_TYPE_NAME_CODE))
+    {
+        rv = robotraconteurlite_message_write_uint_x(&element_writer->cursor, offset,
+                                                     coded_header.element_type_name_code);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+    }
+
+    if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_META_INFO))
+    {
+        rv = robotraconteurlite_message_write_header_string_with_len_prefix4(&element_writer->cursor, offset,
+                                                                             &coded_header.metadata);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+    }
 
-    rv = robotraconteurlite_buffer_vec_copy_from_uint8_array(writer->buffer, *offset, &sender_nodeid_array, 0, 16);
     if (FAILED(rv))
     {
         return rv;
     }
-    *offset += 16U;
 
-    rv = robotraconteurlite_buffer_vec_copy_from_uint8_array(writer->buffer, *offset, &recv_nodeid_array, 0, 16);
+    rv = robotraconteurlite_message_write_padded_uint_x(&element_writer->cursor, offset, 0,
+                                                        &buffer_info->element_count_offset);
     if (FAILED(rv))
     {
         return rv;
     }
-    *offset += 16U;
 
-    rv = robotraconteurlite_message_write_uint32(writer->buffer, offset, header->sender_endpoint);
+    buffer_info->header_size = *offset - element_writer->buffer_offset;
+    buffer_info->data_start_offset = *offset;
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_writer_write_header2_ex(
+    struct robotraconteurlite_messageelement_writer* element_writer, size_t* offset,
+    struct robotraconteurlite_messageelement_header* header,
+    struct robotraconteurlite_messageelement_buffer_info* buffer_info)
+{
+    robotraconteurlite_status rv = -1;
+    buffer_info->start_buffer_offset = *offset;
+    buffer_info->element_size_offset = *offset;
+    rv = robotraconteurlite_message_write_uint32(&element_writer->cursor, offset, 0);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    rv = robotraconteurlite_message_write_uint32(writer->buffer, offset, header->receiver_endpoint);
+    buffer_info->element_name_str_offset = *offset;
+    rv = robotraconteurlite_message_write_header_string_with_len_prefix2(&element_writer->cursor, offset,
+                                                                         &header->element_name);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    rv = robotraconteurlite_message_write_header_string_with_len_prefix2(writer->buffer, offset,
-                                                                         &header->sender_nodename);
+    rv = robotraconteurlite_message_write_uint16(&element_writer->cursor, offset, header->element_type);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    rv = robotraconteurlite_message_write_header_string_with_len_prefix2(writer->buffer, offset,
-                                                                         &header->receiver_nodename);
+    rv = robotraconteurlite_message_write_header_string_with_len_prefix2(&element_writer->cursor, offset,
+                                                                         &header->element_type_name);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    rv = robotraconteurlite_message_write_header_string_with_len_prefix2(writer->buffer, offset, &header->metadata);
+    rv = robotraconteurlite_message_write_header_string_with_len_prefix2(&element_writer->cursor, offset,
+                                                                         &header->metadata);
+
     if (FAILED(rv))
     {
         return rv;
     }
 
-    buffer_info->entry_count_offset = *offset;
-    rv = robotraconteurlite_message_write_uint16(writer->buffer, offset, header->entry_count);
+    buffer_info->element_count_offset = *offset;
+    rv = robotraconteurlite_message_write_uint32(&element_writer->cursor, offset, 0);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    rv = robotraconteurlite_message_write_uint16(writer->buffer, offset, header->message_id);
-    if (FAILED(rv))
+    buffer_info->header_size = *offset - element_writer->buffer_offset;
+    buffer_info->data_start_offset = *offset;
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_writer_begin_nested_element(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    struct robotraconteurlite_messageelement_header* header,
+    struct robotraconteurlite_messageelement_writer* nested_element_writer)
+{
+
+    robotraconteurlite_status rv = -1;
+    size_t o = element_writer->buffer_offset;
+    struct robotraconteurlite_messageelement_buffer_info buffer_info;
+
+    assert(element_writer != NULL);
+    assert(header != NULL);
+    assert(nested_element_writer != NULL);
+
+    if (!(element_writer->elements_written_count < UINT32_MAX))
     {
-        return rv;
+        return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
+    }
+
+    switch (element_writer->message_version)
+    {
+    case 2:
+        rv = robotraconteurlite_messageelement_writer_write_header2_ex(element_writer, &o, header, &buffer_info);
+        break;
+    case 4:
+        rv = robotraconteurlite_messageelement_writer_write_header4_ex(element_writer, &o, header, &buffer_info);
+        break;
+    default:
+        return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
     }
 
-    rv = robotraconteurlite_message_write_uint16(writer->buffer, offset, header->message_res_id);
     if (FAILED(rv))
     {
         return rv;
     }
-    buffer_info->entry_start_offset = *offset;
-    header->header_size = header_size;
-    buffer_info->header_size = header_size;
+
+    nested_element_writer->buffer = element_writer->buffer;
+    nested_element_writer->cursor = element_writer->cursor;
+    nested_element_writer->external_segment_capacity = element_writer->external_segment_capacity;
+    nested_element_writer->external_min_len = element_writer->external_min_len;
+    nested_element_writer->compact_uint_x = element_writer->compact_uint_x;
+    nested_element_writer->string_table = element_writer->string_table;
+    nested_element_writer->buffer_offset = buffer_info.data_start_offset;
+    nested_element_writer->buffer_count = element_writer->buffer_count - buffer_info.header_size;
+    nested_element_writer->elements_written_count = 0;
+    nested_element_writer->elements_written_size = 0;
+    nested_element_writer->external_written_size = 0;
+    nested_element_writer->reserved_offset = 0;
+    nested_element_writer->reserved_size = 0;
+    nested_element_writer->message_version = element_writer->message_version;
+    element_writer->element_size_offset = buffer_info.element_size_offset;
+    element_writer->data_count_offset = buffer_info.element_count_offset;
+    element_writer->element_header_size = buffer_info.header_size;
+
     return ROBOTRACONTEURLITE_ERROR_SUCCESS;
 }
 
-robotraconteurlite_status robotraconteurlite_message_writer_write_header4_ex(
-    struct robotraconteurlite_message_writer* writer, size_t* offset, struct robotraconteurlite_message_header* header,
-    uint8_t message_flags_mask, struct robotraconteurlite_message_buffer_info* buffer_info)
+robotraconteurlite_status robotraconteurlite_messageelement_writer_end_nested_element(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    struct robotraconteurlite_messageelement_header* header,
+    struct robotraconteurlite_messageelement_writer* nested_element_writer)
 {
-    size_t header_size = 11U;
-    uint8_t flags = 0;
     robotraconteurlite_status rv = -1;
+    size_t element_size = 0;
+    size_t o = 0;
 
-    if (FLAGS_CHECK(message_flags_mask, ROBOTRACONTEURLITE_MESSAGE_FLAGS_ROUTING_INFO))
-    {
-        if ((robotraconteurlite_nodeid_isany(&header->sender_nodeid) == 0) ||
-            (robotraconteurlite_nodeid_isany(&header->receiver_nodeid) == 0) || (header->sender_nodename.len != 0U) ||
-            (header->receiver_nodename.len != 0U))
-        {
-            size_t s = 0;
-            header_size += 32U;
-            rv = robotraconteurlite_message_header_string_with_len_prefix_size4(&header->sender_nodename, &s);
-            if (FAILED(rv))
-            {
-                return rv;
-            }
-            header_size += s;
-            rv = robotraconteurlite_message_header_string_with_len_prefix_size4(&header->receiver_nodename, &s);
-            if (FAILED(rv))
-            {
-                return rv;
-            }
-            header_size += s;
-            FLAGS_SET(flags, ROBOTRACONTEURLITE_MESSAGE_FLAGS_ROUTING_INFO);
-        }
-    }
+    assert(element_writer != NULL);
+    assert(header != NULL);
+    assert(nested_element_writer != NULL);
 
-    if (FLAGS_CHECK(message_flags_mask, ROBOTRACONTEURLITE_MESSAGE_FLAGS_ENDPOINT_INFO))
+    element_size = element_writer->element_header_size + nested_element_writer->elements_written_size;
+
+    switch (element_writer->message_version)
     {
-        if ((header->sender_endpoint != 0U) || (header->receiver_endpoint != 0U))
+    case 2: {
+        o = element_writer->element_size_offset;
+        rv = robotraconteurlite_message_write_uint32(&element_writer->cursor, &o, element_size);
+        if (FAILED(rv))
         {
-            size_t s = 0;
-            rv = robotraconteurlite_message_uint_x_size(header->sender_endpoint, &s);
-            if (FAILED(rv))
-            {
-                return rv;
-            }
-            header_size += s;
-            rv = robotraconteurlite_message_uint_x_size(header->receiver_endpoint, &s);
-            if (FAILED(rv))
-            {
-                return rv;
-            }
-            header_size += s;
-            FLAGS_SET(flags, ROBOTRACONTEURLITE_MESSAGE_FLAGS_ENDPOINT_INFO);
+            return rv;
         }
-    }
 
-    if (FLAGS_CHECK(message_flags_mask, ROBOTRACONTEURLITE_MESSAGE_FLAGS_PRIORITY))
-    {
-        if (header->priority != 0U)
+        o = element_writer->data_count_offset;
+        rv = robotraconteurlite_message_write_uint32(&element_writer->cursor, &o,
+                                                     (uint32_t)nested_element_writer->elements_written_count);
+
+        if (FAILED(rv))
         {
-            FLAGS_SET(flags, ROBOTRACONTEURLITE_MESSAGE_FLAGS_PRIORITY);
-            header_size += 2U;
+            return rv;
         }
+        break;
     }
-
-    if (FLAGS_CHECK(message_flags_mask, ROBOTRACONTEURLITE_MESSAGE_FLAGS_META_INFO))
-    {
-        if ((header->metadata.len != 0U) || (header->message_id != 0U) || (header->message_res_id != 0U))
+    case 4: {
+        if ((element_writer->compact_uint_x != 0U) && (element_writer->external_segment_capacity == 0U))
         {
-            size_t s = 0;
-            rv = robotraconteurlite_message_header_string_with_len_prefix_size4(&header->metadata, &s);
+            rv = robotraconteurlite_message_compact_container4(
+                &element_writer->cursor, element_writer->buffer_offset, element_writer->data_count_offset,
+                (uint32_t)nested_element_writer->elements_written_count, &element_size);
             if (FAILED(rv))
             {
                 return rv;
             }
-            header_size += s;
-            header_size += 4U;
-            FLAGS_SET(flags, ROBOTRACONTEURLITE_MESSAGE_FLAGS_META_INFO);
+            break;
         }
-    }
-
-    if (FLAGS_CHECK(message_flags_mask, ROBOTRACONTEURLITE_MESSAGE_FLAGS_MULTIPLE_ENTRIES))
-    {
-        if (header->entry_count != 1U)
+        rv = robotraconteurlite_message_write_padded_uint_x_val(&element_writer->cursor,
+                                                                element_writer->element_size_offset, element_size);
+        if (FAILED(rv))
         {
-            size_t s = 0;
-            rv = robotraconteurlite_message_padded_uint_x_size(header->entry_count, &s);
-            if (FAILED(rv))
-            {
-                return rv;
-            }
-            header_size += s;
-            FLAGS_SET(flags, ROBOTRACONTEURLITE_MESSAGE_FLAGS_MULTIPLE_ENTRIES);
+            return rv;
         }
-    }
 
-    flags |= ((message_flags_mask & ROBOTRACONTEURLITE_MESSAGE_FLAGS_UNRELIABLE) & flags);
-    {
-        size_t s = 0;
-        uint32_t header_size2 = 0;
-        rv = robotraconteurlite_message_len_plus_uint_x(header_size, &header_size2, &s);
+        rv = robotraconteurlite_message_write_padded_uint_x_val(
+            &element_writer->cursor, element_writer->data_count_offset,
+            (uint32_t)nested_element_writer->elements_written_count);
         if (FAILED(rv))
         {
             return rv;
         }
-        header_size += s;
+        break;
+    }
+    default:
+        return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
     }
 
-    if (header_size > UINT32_MAX)
+    /* Only the bytes written to the send buffer use up buffer_count */
+    assert((element_size - nested_element_writer->external_written_size) <= element_writer->buffer_count);
+    element_writer->elements_written_count++;
+    element_writer->elements_written_size += element_size;
+    element_writer->external_written_size += nested_element_writer->external_written_size;
+    element_writer->buffer_offset += element_size;
+    element_writer->buffer_count -= element_size - nested_element_writer->external_written_size;
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_writer_begin_indexed_element(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    struct robotraconteurlite_messageelement_header* header, uint32_t index, char name_storage[],
+    size_t name_storage_len, struct robotraconteurlite_messageelement_writer* nested_element_writer)
+{
+    char digits[10];
+    uint32_t v = index;
+    size_t n = 0;
+    size_t i = 0;
+
+    assert(header != NULL);
+    assert(name_storage != NULL);
+
+    do
     {
-        return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+        digits[n] = (char)('0' + (char)(v % 10U));
+        v /= 10U;
+        n++;
+    } while (v != 0U);
+
+    if (n > name_storage_len)
+    {
+        return ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER;
     }
 
-    buffer_info->start_buffer_offset = *offset;
+    for (i = 0; i < n; i++)
+    {
+        name_storage[i] = digits[n - 1U - i];
+    }
+    header->element_name.data = name_storage;
+    header->element_name.len = n;
 
-    rv = robotraconteurlite_buffer_vec_copy_from_mem(writer->buffer, *offset, (const uint8_t*)rrac_magic, 4, 0, 1, 4);
+    return robotraconteurlite_messageelement_writer_begin_nested_element(element_writer, header,
+                                                                         nested_element_writer);
+}
+
+/* Read an element header with its strings copied into string_storage. The header is read once to size the strings
+   and again to fill them in. Name codes that resolved to a string are cleared so they are encoded again for the
+   destination. */
+static robotraconteurlite_status robotraconteurlite_messageelement_reader_read_header_storage(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_messageelement_header* header,
+    struct robotraconteurlite_messageelement_buffer_info* buffer_info, char string_storage[],
+    size_t string_storage_len)
+{
+    size_t name_len = 0;
+    size_t type_name_len = 0;
+    size_t metadata_len = 0;
+    robotraconteurlite_status rv = -1;
+
+    (void)memset(header, 0, sizeof(*header));
+    rv = robotraconteurlite_messageelement_reader_read_header_ex(element_reader, header, buffer_info);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    *offset += 4U;
+    name_len = header->element_name.len;
+    type_name_len = header->element_type_name.len;
+    metadata_len = header->metadata.len;
+    if ((name_len > string_storage_len) || (type_name_len > (string_storage_len - name_len)) ||
+        (metadata_len > (string_storage_len - name_len - type_name_len)))
+    {
+        return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+    }
 
-    rv = robotraconteurlite_message_write_uint32(writer->buffer, offset, 0);
-    if (FAILED(rv))
+    (void)memset(header, 0, sizeof(*header));
+    if (name_len > 0U)
     {
-        return rv;
+        header->element_name.data = string_storage;
+        header->element_name.len = name_len;
+    }
+    if (type_name_len > 0U)
+    {
+        header->element_type_name.data = &string_storage[name_len];
+        header->element_type_name.len = type_name_len;
+    }
+    if (metadata_len > 0U)
+    {
+        header->metadata.data = &string_storage[name_len + type_name_len];
+        header->metadata.len = metadata_len;
     }
 
-    rv = robotraconteurlite_message_write_uint16(writer->buffer, offset, 4);
+    rv = robotraconteurlite_messageelement_reader_read_header_ex(element_reader, header, buffer_info);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    rv = robotraconteurlite_message_write_uint_x(writer->buffer, offset, (uint32_t)header_size);
-    if (FAILED(rv))
+    if (buffer_info->header_size > element_reader->buffer_count)
     {
-        return rv;
+        return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
     }
 
-    rv = robotraconteurlite_message_write_uint8(writer->buffer, offset, flags);
-    if (FAILED(rv))
+    if (header->element_name.len > 0U)
     {
-        return rv;
+        header->element_name_code = 0;
+    }
+    if (header->element_type_name.len > 0U)
+    {
+        header->element_type_name_code = 0;
     }
 
-    if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGE_FLAGS_ROUTING_INFO))
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+/* Copy an element list and all nested element lists depth first, writing each element header in the version of
+   element_writer and copying the element data untouched. The enclosing readers and writers are kept on fixed size
+   stacks instead of recursing. The writer stack has one more level for the element being written at the deepest
+   list. */
+static robotraconteurlite_status robotraconteurlite_messageelement_writer_copy_elements(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_messageelement_reader* element_reader, char string_storage[],
+    size_t string_storage_len)
+{
+    struct robotraconteurlite_messageelement_reader reader_stack[ROBOTRACONTEURLITE_MESSAGE_VALIDATE_MAX_DEPTH];
+    struct robotraconteurlite_messageelement_writer writer_stack[ROBOTRACONTEURLITE_MESSAGE_VALIDATE_MAX_DEPTH + 1U];
+    struct robotraconteurlite_messageelement_header header;
+    struct robotraconteurlite_messageelement_buffer_info buffer_info;
+    size_t depth = 0;
+    size_t data_size = 0;
+    robotraconteurlite_status rv = -1;
+
+    reader_stack[0] = *element_reader;
+    writer_stack[0] = *element_writer;
+
+    for (;;)
     {
-        struct robotraconteurlite_array_uint8 sender_nodeid_array;
-        struct robotraconteurlite_array_uint8 recv_nodeid_array;
-        sender_nodeid_array.data = header->sender_nodeid.data;
-        sender_nodeid_array.len = 16;
-        recv_nodeid_array.data = header->receiver_nodeid.data;
-        recv_nodeid_array.len = 16;
+        struct robotraconteurlite_messageelement_reader* current = &reader_stack[depth];
+        struct robotraconteurlite_messageelement_writer* nested = &writer_stack[depth + 1U];
 
-        rv = robotraconteurlite_buffer_vec_copy_from_uint8_array(writer->buffer, *offset, &sender_nodeid_array, 0, 16);
+        rv = robotraconteurlite_messageelement_reader_read_header_storage(current, &header, &buffer_info,
+                                                                         string_storage, string_storage_len);
         if (FAILED(rv))
         {
             return rv;
         }
-        *offset += 16U;
+        data_size = current->buffer_count - buffer_info.header_size;
 
-        rv = robotraconteurlite_buffer_vec_copy_from_uint8_array(writer->buffer, *offset, &recv_nodeid_array, 0, 16);
+        rv = robotraconteurlite_messageelement_writer_begin_nested_element(&writer_stack[depth], &header, nested);
         if (FAILED(rv))
         {
             return rv;
         }
-        *offset += 16U;
 
-        rv = robotraconteurlite_message_write_header_string_with_len_prefix4(writer->buffer, offset,
-                                                                             &header->sender_nodename);
-        if (FAILED(rv))
+        if (robotraconteurlite_message_data_type_is_nested(header.element_type) && (header.data_count != 0U))
         {
-            return rv;
+            if ((depth + 1U) >= ROBOTRACONTEURLITE_MESSAGE_VALIDATE_MAX_DEPTH)
+            {
+                return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+            }
+            rv = robotraconteurlite_messageelement_reader_begin_read_nested_elements(current,
+                                                                                     &reader_stack[depth + 1U]);
+            if (FAILED(rv))
+            {
+                return rv;
+            }
+            depth++;
+            continue;
         }
 
-        rv = robotraconteurlite_message_write_header_string_with_len_prefix4(writer->buffer, offset,
-                                                                             &header->receiver_nodename);
+        if (data_size > nested->buffer_count)
+        {
+            return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+        }
+        rv = robotraconteurlite_buffer_vec_copy_vec(current->buffer, buffer_info.data_start_offset, nested->buffer,
+                                                    nested->buffer_offset, data_size);
         if (FAILED(rv))
         {
             return rv;
         }
-    }
-
-    if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGE_FLAGS_ENDPOINT_INFO))
-    {
-        rv = robotraconteurlite_message_write_uint_x(writer->buffer, offset, header->sender_endpoint);
+        nested->elements_written_count = header.data_count;
+        nested->elements_written_size = data_size;
+        rv = robotraconteurlite_messageelement_writer_end_nested_element(&writer_stack[depth], &header, nested);
         if (FAILED(rv))
         {
             return rv;
         }
 
-        rv = robotraconteurlite_message_write_uint_x(writer->buffer, offset, header->receiver_endpoint);
-        if (FAILED(rv))
+        /* Move to the next element, closing the nested element at the end of each nested list */
+        for (;;)
         {
-            return rv;
+            rv = robotraconteurlite_messageelement_reader_move_next(&reader_stack[depth]);
+            if (!FAILED(rv))
+            {
+                break;
+            }
+            if (!NO_MORE(rv))
+            {
+                return rv;
+            }
+            if (depth == 0U)
+            {
+                *element_writer = writer_stack[0];
+                return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+            }
+            depth--;
+            rv = robotraconteurlite_messageelement_writer_end_nested_element(&writer_stack[depth], &header,
+                                                                             &writer_stack[depth + 1U]);
+            if (FAILED(rv))
+            {
+                return rv;
+            }
         }
     }
+}
 
-    if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGE_FLAGS_PRIORITY))
+robotraconteurlite_status robotraconteurlite_messageentry_writer_copy_entry(
+    struct robotraconteurlite_messageentry_writer* entry_writer, struct robotraconteurlite_messageentry_header* header,
+    struct robotraconteurlite_messageentry_reader* entry_reader, char string_storage[], size_t string_storage_len)
+{
+    struct robotraconteurlite_messageentry_header source_header;
+    struct robotraconteurlite_messageentry_buffer_info source_buffer_info;
+    struct robotraconteurlite_messageelement_writer element_writer;
+    struct robotraconteurlite_messageelement_reader element_reader;
+    size_t elements_size = 0;
+    robotraconteurlite_status rv = -1;
+
+    assert(entry_writer != NULL);
+    assert(header != NULL);
+    assert(entry_reader != NULL);
+
+    /* Only the sizes of the source header strings are read */
+    (void)memset(&source_header, 0, sizeof(source_header));
+    (void)memset(&source_buffer_info, 0, sizeof(source_buffer_info));
+    rv = robotraconteurlite_messageentry_reader_read_header_ex(entry_reader, &source_header, &source_buffer_info);
+    if (FAILED(rv))
     {
-        rv = robotraconteurlite_message_write_uint16(writer->buffer, offset, header->priority);
-        if (FAILED(rv))
-        {
-            return rv;
-        }
+        return rv;
     }
 
-    if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGE_FLAGS_META_INFO))
+    if (source_buffer_info.header_size > entry_reader->buffer_count)
     {
-        rv = robotraconteurlite_message_write_header_string_with_len_prefix4(writer->buffer, offset, &header->metadata);
-        if (FAILED(rv))
+        return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
+    }
+    elements_size = entry_reader->buffer_count - source_buffer_info.header_size;
+
+    rv = robotraconteurlite_messageentry_writer_begin_entry(entry_writer, header, &element_writer);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    if (source_header.element_count == 0U)
+    {
+        /* No elements to copy */
+    }
+    else if ((entry_reader->message_version == entry_writer->message_version) &&
+             ((entry_reader->message_version == 2U) || (entry_reader->string_table == entry_writer->string_table)))
+    {
+        /* The element encoding is unchanged, so the whole element list is copied in one pass */
+        if (elements_size > element_writer.buffer_count)
         {
-            return rv;
+            return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
         }
-
-        rv = robotraconteurlite_message_write_uint16(writer->buffer, offset, header->message_id);
+        rv = robotraconteurlite_buffer_vec_copy_vec(entry_reader->buffer, source_buffer_info.element_start_offset,
+                                                    element_writer.buffer, element_writer.buffer_offset,
+                                                    elements_size);
         if (FAILED(rv))
         {
             return rv;
         }
-
-        rv = robotraconteurlite_message_write_uint16(writer->buffer, offset, header->message_res_id);
+        element_writer.elements_written_count = source_header.element_count;
+        element_writer.elements_written_size = elements_size;
+        element_writer.buffer_offset += elements_size;
+        element_writer.buffer_count -= elements_size;
+    }
+    else
+    {
+        rv = robotraconteurlite_messageentry_reader_begin_read_elements(entry_reader, &element_reader);
         if (FAILED(rv))
         {
             return rv;
         }
-    }
-
-    if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGE_FLAGS_MULTIPLE_ENTRIES))
-    {
-        rv = robotraconteurlite_message_write_padded_uint_x(writer->buffer, offset, header->entry_count,
-                                                            &buffer_info->entry_count_offset);
+        rv = robotraconteurlite_messageelement_writer_copy_elements(&element_writer, &element_reader, string_storage,
+                                                                    string_storage_len);
         if (FAILED(rv))
         {
             return rv;
         }
     }
-    else
+
+    return robotraconteurlite_messageentry_writer_end_entry(entry_writer, header, &element_writer);
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_writer_write_namedarray_ex(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name, const struct robotraconteurlite_string* element_type_name,
+    const uint8_t* source_buf, size_t source_len, uint16_t source_elem_type, size_t source_elem_size,
+    size_t source_elem_count)
+{
+    struct robotraconteurlite_messageelement_header header;
+    struct robotraconteurlite_messageelement_writer nested_writer;
+    struct robotraconteurlite_string array_name;
+    robotraconteurlite_status rv = -1;
+
+    assert(element_name != NULL);
+    assert(element_type_name != NULL);
+    assert(source_elem_count > 0U);
+
+    if (source_len > (SIZE_MAX / source_elem_count))
     {
-        buffer_info->entry_count_offset = SIZE_MAX;
+        return ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER;
     }
 
-    if ((*offset - buffer_info->start_buffer_offset) != header_size)
+    (void)memset(&header, 0, sizeof(header));
+    header.element_type = ROBOTRACONTEURLITE_DATATYPE_NAMEDARRAY_ARRAY;
+    header.element_name = *element_name;
+    header.element_type_name = *element_type_name;
+    rv = robotraconteurlite_messageelement_writer_begin_nested_element(element_writer, &header, &nested_writer);
+    if (FAILED(rv))
     {
-        return ROBOTRACONTEURLITE_ERROR_INTERNAL_ERROR;
+        return rv;
     }
 
-    buffer_info->entry_start_offset = *offset;
-    header->header_size = header_size;
-    buffer_info->header_size = header_size;
-    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
-}
+    robotraconteurlite_string_from_c_str("array", &array_name);
+    rv = robotraconteurlite_messageelement_writer_write_raw(&nested_writer, &array_name, source_buf,
+                                                            source_len * source_elem_count, source_elem_type,
+                                                            source_elem_size);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
 
-robotraconteurlite_status robotraconteurlite_message_writer_begin_message(
-    struct robotraconteurlite_message_writer* writer, struct robotraconteurlite_message_header* header,
-    struct robotraconteurlite_messageentry_writer* entry_writer)
-{
-    return robotraconteurlite_message_writer_begin_message_ex(writer, header, entry_writer, 0xFFU);
+    return robotraconteurlite_messageelement_writer_end_nested_element(element_writer, &header, &nested_writer);
 }
 
-robotraconteurlite_status robotraconteurlite_message_writer_begin_message_ex(
-    struct robotraconteurlite_message_writer* writer, struct robotraconteurlite_message_header* header,
-    struct robotraconteurlite_messageentry_writer* entry_writer, uint8_t message_flags_mask)
+robotraconteurlite_status robotraconteurlite_messageelement_writer_write_multidimarray_ex(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name, const struct robotraconteurlite_array_uint32* dims,
+    const uint8_t* source_buf, size_t source_len, uint16_t source_elem_type, size_t source_elem_size)
 {
+    struct robotraconteurlite_messageelement_header header;
+    struct robotraconteurlite_messageelement_writer nested_writer;
+    struct robotraconteurlite_string field_name;
     robotraconteurlite_status rv = -1;
-    struct robotraconteurlite_message_buffer_info message_buffer_info;
-    size_t o = writer->buffer_offset;
 
-    assert(header != NULL);
-    assert(writer != NULL);
-    assert(entry_writer != NULL);
+    assert(element_name != NULL);
+    assert(dims != NULL);
 
-    switch (writer->message_version)
+    rv = robotraconteurlite_multidimarray_check_count(dims, source_len);
+    if (FAILED(rv))
     {
-    case 2:
-        rv = robotraconteurlite_message_writer_write_header2_ex(writer, &o, header, &message_buffer_info);
-        break;
-    case 4:
-        rv = robotraconteurlite_message_writer_write_header4_ex(writer, &o, header, message_flags_mask,
-                                                                &message_buffer_info);
-        break;
-    default:
-        return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
+        return ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER;
+    }
+
+    (void)memset(&header, 0, sizeof(header));
+    header.element_type = ROBOTRACONTEURLITE_DATATYPE_MULTIDIMARRAY;
+    header.element_name = *element_name;
+    rv = robotraconteurlite_messageelement_writer_begin_nested_element(element_writer, &header, &nested_writer);
+    if (FAILED(rv))
+    {
+        return rv;
     }
+
+    robotraconteurlite_string_from_c_str("dims", &field_name);
+    rv = robotraconteurlite_messageelement_writer_write_uint32_array(&nested_writer, &field_name, dims);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    entry_writer->buffer = writer->buffer;
-    entry_writer->buffer_offset = writer->buffer_offset + message_buffer_info.header_size;
-    entry_writer->buffer_count = writer->buffer_count - message_buffer_info.header_size;
-    entry_writer->entries_written_count = 0;
-    entry_writer->entries_written_size = 0;
-    entry_writer->message_version = writer->message_version;
-    writer->message_size_offset = message_buffer_info.start_buffer_offset + 4U;
-    writer->entry_count_offset = message_buffer_info.entry_count_offset;
+    /* The data is written straight from the caller buffer into the send buffer */
+    robotraconteurlite_string_from_c_str("array", &field_name);
+    rv = robotraconteurlite_messageelement_writer_write_raw(&nested_writer, &field_name, source_buf, source_len,
+                                                            source_elem_type, source_elem_size);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    return robotraconteurlite_messageelement_writer_end_nested_element(element_writer, &header, &nested_writer);
+}
+
+static robotraconteurlite_status robotraconteurlite_messageelement_data_size2(
+    const struct robotraconteurlite_string* element_name, size_t data_len, size_t data_elem_size, size_t* element_size)
+{
+    size_t elem_size = 0;
+
+    if (element_name->len > UINT16_MAX)
+    {
+        return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+    }
+
+    if ((data_elem_size != 0U) && (data_len > (UINT32_MAX / data_elem_size)))
+    {
+        return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+    }
 
+    elem_size = 16U + element_name->len + (data_len * data_elem_size);
+    if (elem_size > UINT32_MAX)
+    {
+        return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+    }
+
+    *element_size = elem_size;
     return ROBOTRACONTEURLITE_ERROR_SUCCESS;
 }
 
-robotraconteurlite_status robotraconteurlite_message_writer_end_message(
-    struct robotraconteurlite_message_writer* writer, struct robotraconteurlite_message_header* header,
-    struct robotraconteurlite_messageentry_writer* entry_writer)
+static robotraconteurlite_status robotraconteurlite_messageelement_data_size4(
+    const struct robotraconteurlite_string* element_name, uint32_t element_name_code, size_t data_len,
+    size_t data_elem_size, uint8_t* flags_out, size_t* element_size)
 {
-    size_t message_size = 0;
     robotraconteurlite_status rv = -1;
-    uint16_t ver = writer->message_version;
-
-    assert(writer != NULL);
-    assert(header != NULL);
-    assert(entry_writer != NULL);
 
-    message_size = entry_writer->entries_written_size + header->header_size;
+    size_t data_size = 0;
+    size_t elem_size = 3;
+    uint32_t elem_size2 = 0;
+    uint8_t flags = 0;
 
-    rv = robotraconteurlite_buffer_vec_copy_from_uint32(writer->buffer, writer->message_size_offset, message_size);
-    if (FAILED(rv))
+    if ((data_elem_size != 0U) && (data_len > (UINT32_MAX / data_elem_size)))
     {
-        return rv;
+        return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
     }
 
-    if (writer->entry_count_offset != SIZE_MAX)
+    if (element_name_code != 0U)
     {
-        switch (ver)
+        size_t s = 0;
+        FLAGS_SET(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_ELEMENT_NAME_CODE);
+        rv = robotraconteurlite_message_uint_x_size(element_name_code, &s);
+        if (FAILED(rv))
         {
-        case 2: {
-            size_t o = writer->entry_count_offset;
-            rv = robotraconteurlite_message_write_uint16(writer->buffer, &o,
-                                                         (uint16_t)entry_writer->entries_written_count);
-            break;
-        }
-        case 4:
-            rv = robotraconteurlite_message_write_padded_uint_x_val(writer->buffer, writer->entry_count_offset,
-                                                                    (uint32_t)entry_writer->entries_written_count);
-            break;
-        default:
-            return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
+            return rv;
         }
+        elem_size += s;
+    }
+    else if (element_name->len != 0U)
+    {
+        size_t s = 0;
+        FLAGS_SET(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_ELEMENT_NAME_STR);
+        rv = robotraconteurlite_message_header_string_with_len_prefix_size4(element_name, &s);
         if (FAILED(rv))
         {
             return rv;
         }
+        elem_size += s;
     }
-    else
+
     {
-        if (entry_writer->entries_written_count != 1U)
+        size_t s = 0;
+        rv = robotraconteurlite_message_uint_x_size(data_len, &s);
+        if (FAILED(rv))
         {
-            return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
+            return rv;
         }
+        elem_size += s;
     }
 
-    header->message_size = message_size;
-    header->entry_count = (uint32_t)entry_writer->entries_written_count;
+    data_size = data_len * data_elem_size;
+    elem_size += data_size;
 
-    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
-}
+    if (elem_size > UINT32_MAX)
+    {
+        return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+    }
 
-robotraconteurlite_status robotraconteurlite_messageentry_writer_write_header2_ex(
-    struct robotraconteurlite_messageentry_writer* entry_writer, size_t* offset,
-    struct robotraconteurlite_messageentry_header* header,
-    struct robotraconteurlite_messageentry_buffer_info* buffer_info)
-{
-    robotraconteurlite_status rv = -1;
-    buffer_info->entry_size_offset = *offset;
-    rv = robotraconteurlite_message_write_uint32(entry_writer->buffer, offset, 0);
-    if (FAILED(rv))
     {
-        return rv;
+        size_t s = 0;
+        rv = robotraconteurlite_message_len_plus_uint_x(elem_size, &elem_size2, &s);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+        elem_size += s;
     }
 
-    rv = robotraconteurlite_message_write_uint16(entry_writer->buffer, offset, header->entry_type);
-    if (FAILED(rv))
+    if (elem_size > UINT32_MAX)
     {
-        return rv;
+        return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
     }
 
-    /* pad */
-    rv = robotraconteurlite_message_write_uint16(entry_writer->buffer, offset, 0);
+    *flags_out = flags;
+    *element_size = elem_size;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_writer_write_data_header2_ex(
+    struct robotraconteurlite_messageelement_writer* element_writer, size_t* offset,
+    const struct robotraconteurlite_string* element_name, size_t data_len, uint16_t data_type, size_t data_elem_size,
+    struct robotraconteurlite_messageelement_buffer_info* buffer_info, size_t* element_size)
+{
+    robotraconteurlite_status rv = -1;
+    size_t elem_size = 0;
+
+    rv = robotraconteurlite_messageelement_data_size2(element_name, data_len, data_elem_size, &elem_size);
     if (FAILED(rv))
     {
         return rv;
     }
-    rv = robotraconteurlite_message_write_header_string_with_len_prefix2(entry_writer->buffer, offset,
-                                                                         &header->service_path);
+
+    buffer_info->start_buffer_offset = *offset;
+    buffer_info->element_size_offset = *offset;
+    rv = robotraconteurlite_message_write_uint32(&element_writer->cursor, offset, (uint32_t)elem_size);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    rv = robotraconteurlite_message_write_header_string_with_len_prefix2(entry_writer->buffer, offset,
-                                                                         &header->member_name);
+    buffer_info->element_name_str_offset = *offset;
+    rv = robotraconteurlite_message_write_header_string_with_len_prefix2(&element_writer->cursor, offset, element_name);
+
     if (FAILED(rv))
     {
         return rv;
     }
 
-    rv = robotraconteurlite_message_write_uint32(entry_writer->buffer, offset, header->request_id);
-
+    rv = robotraconteurlite_message_write_uint16(&element_writer->cursor, offset, data_type);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    rv = robotraconteurlite_message_write_uint16(entry_writer->buffer, offset, header->error);
+    /* No element type name */
+    rv = robotraconteurlite_message_write_uint16(&element_writer->cursor, offset, 0);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    rv = robotraconteurlite_message_write_header_string_with_len_prefix2(entry_writer->buffer, offset,
-                                                                         &header->metadata);
+    /* No metadata */
+
+    rv = robotraconteurlite_message_write_uint16(&element_writer->cursor, offset, 0);
     if (FAILED(rv))
     {
         return rv;
     }
 
     buffer_info->element_count_offset = *offset;
-    rv = robotraconteurlite_message_write_uint16(entry_writer->buffer, offset, 0);
+    rv = robotraconteurlite_message_write_uint32(&element_writer->cursor, offset, data_len);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    buffer_info->header_size = *offset - entry_writer->buffer_offset;
-    buffer_info->element_start_offset = *offset;
+    buffer_info->data_start_offset = *offset;
+    buffer_info->header_size = *offset - buffer_info->start_buffer_offset;
+    *element_size = elem_size;
+
     return ROBOTRACONTEURLITE_ERROR_SUCCESS;
 }
 
-robotraconteurlite_status robotraconteurlite_messageentry_writer_write_header4_ex(
-    struct robotraconteurlite_messageentry_writer* entry_writer, size_t* offset,
-    struct robotraconteurlite_messageentry_header* header,
-    struct robotraconteurlite_messageentry_buffer_info* buffer_info)
+robotraconteurlite_status robotraconteurlite_messageelement_writer_write_data_header4_ex(
+    struct robotraconteurlite_messageelement_writer* element_writer, size_t* offset,
+    const struct robotraconteurlite_string* element_name, size_t data_len, uint16_t data_type, size_t data_elem_size,
+    struct robotraconteurlite_messageelement_buffer_info* buffer_info, size_t* element_size)
 {
     robotraconteurlite_status rv = -1;
+    size_t elem_size = 0;
     uint8_t flags = 0;
+    struct robotraconteurlite_string name;
+    uint32_t name_code = 0;
 
-    if (header->service_path.len > 0U)
-    {
-        FLAGS_SET(flags, ROBOTRACONTEURLITE_MESSAGEENTRY_FLAGS_SERVICE_PATH_STR);
-    }
+    name = *element_name;
+    robotraconteurlite_message_string_table_encode(element_writer->string_table, &name, &name_code);
 
-    if (header->service_path_code != 0U)
+    rv = robotraconteurlite_messageelement_data_size4(&name, name_code, data_len, data_elem_size, &flags, &elem_size);
+    if (FAILED(rv))
     {
-        FLAGS_SET(flags, ROBOTRACONTEURLITE_MESSAGEENTRY_FLAGS_SERVICE_PATH_CODE);
+        return rv;
     }
 
-    if (header->member_name.len > 0U)
+    buffer_info->start_buffer_offset = *offset;
+    buffer_info->element_size_offset = SIZE_MAX;
+    rv = robotraconteurlite_message_write_uint_x(&element_writer->cursor, offset, (uint32_t)elem_size);
+    if (FAILED(rv))
     {
-        FLAGS_SET(flags, ROBOTRACONTEURLITE_MESSAGEENTRY_FLAGS_MEMBER_NAME_STR);
+        return rv;
     }
 
-    if (header->request_id != 0U)
+    rv = robotraconteurlite_message_write_uint8(&element_writer->cursor, offset, flags);
+    if (FAILED(rv))
     {
-        FLAGS_SET(flags, ROBOTRACONTEURLITE_MESSAGEENTRY_FLAGS_REQUEST_ID);
+        return rv;
     }
 
-    if (header->error != 0U)
+    buffer_info->element_name_str_offset = SIZE_MAX;
+    if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_ELEMENT_NAME_STR))
     {
-        FLAGS_SET(flags, ROBOTRACONTEURLITE_MESSAGEENTRY_FLAGS_ERROR);
+        rv = robotraconteurlite_message_write_header_string_with_len_prefix4(&element_writer->cursor, offset, &name);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
     }
 
-    if (header->metadata.len > 0U)
+    if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_ELEMENT_NAME_CODE))
     {
-        FLAGS_SET(flags, ROBOTRACONTEURLITE_MESSAGEENTRY_FLAGS_META_INFO);
+        rv = robotraconteurlite_message_write_uint_x(&element_writer->cursor, offset, name_code);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
     }
 
-    rv = robotraconteurlite_message_write_padded_uint_x(entry_writer->buffer, offset, 0,
-                                                        &buffer_info->entry_size_offset);
+    rv = robotraconteurlite_message_write_uint16(&element_writer->cursor, offset, data_type);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    rv = robotraconteurlite_message_write_uint8(entry_writer->buffer, offset, flags);
+    buffer_info->element_count_offset = SIZE_MAX;
+    rv = robotraconteurlite_message_write_uint_x(&element_writer->cursor, offset, data_len);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    rv = robotraconteurlite_message_write_uint16(entry_writer->buffer, offset, header->entry_type);
-    if (FAILED(rv))
+    buffer_info->data_start_offset = *offset;
+    buffer_info->header_size = *offset - buffer_info->start_buffer_offset;
+    *element_size = elem_size;
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+static robotraconteurlite_status robotraconteurlite_messageelement_writer_append_external(
+    struct robotraconteurlite_messageelement_writer* element_writer, size_t offset, const uint8_t* data_buf,
+    size_t data_size)
+{
+    struct robotraconteurlite_buffer_vec* buffer = element_writer->buffer;
+    struct robotraconteurlite_buffer* last = NULL;
+    size_t total_len = 0;
+    size_t last_start = 0;
+    size_t split = 0;
+    size_t cnt = buffer->buffer_vec_cnt;
+    robotraconteurlite_status rv = -1;
+
+    if ((cnt == 0U) || ((cnt + 2U) > element_writer->external_segment_capacity))
     {
-        return rv;
+        return ROBOTRACONTEURLITE_ERROR_NO_VALUE;
     }
 
-    if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEENTRY_FLAGS_SERVICE_PATH_STR))
+    rv = robotraconteurlite_buffer_vec_len(buffer, &total_len);
+    if (FAILED(rv))
     {
-        rv = robotraconteurlite_message_write_header_string_with_len_prefix4(entry_writer->buffer, offset,
-                                                                             &header->service_path);
-        if (FAILED(rv))
-        {
-            return rv;
-        }
+        return rv;
     }
 
-    if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEENTRY_FLAGS_SERVICE_PATH_CODE))
+    /* The payload must start in the last segment, which holds the unwritten tail of the send buffer */
+    last = &buffer->buffer_vec[cnt - 1U];
+    last_start = total_len - last->len;
+    if ((offset < last_start) || (offset > total_len))
     {
-        rv = robotraconteurlite_message_write_uint_x(entry_writer->buffer, offset, header->service_path_code);
-        if (FAILED(rv))
-        {
-            return rv;
-        }
+        return ROBOTRACONTEURLITE_ERROR_NO_VALUE;
     }
+    split = offset - last_start;
 
-    if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEENTRY_FLAGS_MEMBER_NAME_STR))
+    /* Split the tail segment and insert the payload between the two halves */
+    buffer->buffer_vec[cnt + 1U].data = &last->data[split];
+    buffer->buffer_vec[cnt + 1U].len = last->len - split;
+    /* Payload is never written through the buffer_vec */
+    /* cppcheck-suppress misra-c2012-11.8 */
+    buffer->buffer_vec[cnt].data = (uint8_t*)data_buf;
+    buffer->buffer_vec[cnt].len = data_size;
+    last->len = split;
+    buffer->buffer_vec_cnt = cnt + 2U;
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_writer_write_raw(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name, const uint8_t* data_buf, size_t data_len, uint16_t data_type,
+    size_t data_elem_size)
+{
+
+    robotraconteurlite_status rv = -1;
+    size_t o = 0;
+    struct robotraconteurlite_messageelement_buffer_info buffer_info;
+    size_t elem_size = 0;
+    size_t external_size = 0;
+
+    assert(element_writer != NULL);
+    assert(element_name != NULL);
+    assert(data_buf != NULL);
+
+    o = element_writer->buffer_offset;
+
+    if (!(element_writer->elements_written_count < UINT32_MAX))
     {
-        rv = robotraconteurlite_message_write_header_string_with_len_prefix4(entry_writer->buffer, offset,
-                                                                             &header->member_name);
-        if (FAILED(rv))
-        {
-            return rv;
-        }
+        return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
     }
 
-    if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEENTRY_FLAGS_MEMBER_NAME_CODE))
+    switch (element_writer->message_version)
     {
-        rv = robotraconteurlite_message_write_uint_x(entry_writer->buffer, offset, header->member_name_code);
-        if (FAILED(rv))
-        {
-            return rv;
-        }
+    case 2:
+        rv = robotraconteurlite_messageelement_writer_write_data_header2_ex(
+            element_writer, &o, element_name, data_len, data_type, data_elem_size, &buffer_info, &elem_size);
+        break;
+    case 4:
+        rv = robotraconteurlite_messageelement_writer_write_data_header4_ex(
+            element_writer, &o, element_name, data_len, data_type, data_elem_size, &buffer_info, &elem_size);
+        break;
+    default:
+        return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
     }
 
-    if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEENTRY_FLAGS_REQUEST_ID))
+    if (FAILED(rv))
     {
-        rv = robotraconteurlite_message_write_uint_x(entry_writer->buffer, offset, header->request_id);
-        if (FAILED(rv))
-        {
-            return rv;
-        }
+        return rv;
     }
 
-    if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEENTRY_FLAGS_ERROR))
+    o = buffer_info.data_start_offset;
+
+    rv = ROBOTRACONTEURLITE_ERROR_NO_VALUE;
+    if ((element_writer->external_segment_capacity > 0U) && (data_len > 0U) &&
+        ((data_len * data_elem_size) >= element_writer->external_min_len))
     {
-        rv = robotraconteurlite_message_write_uint16(entry_writer->buffer, offset, header->error);
-        if (FAILED(rv))
+        rv = robotraconteurlite_messageelement_writer_append_external(element_writer, o, data_buf,
+                                                                      data_len * data_elem_size);
+        if (!FAILED(rv))
         {
-            return rv;
+            external_size = data_len * data_elem_size;
         }
     }
 
-    if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEENTRY_FLAGS_META_INFO))
+    /* Fall back to copying if the payload is small or there is no room for more segments */
+    if (rv == ROBOTRACONTEURLITE_ERROR_NO_VALUE)
     {
-        rv = robotraconteurlite_message_write_header_string_with_len_prefix4(entry_writer->buffer, offset,
-                                                                             &header->metadata);
-        if (FAILED(rv))
-        {
-            return rv;
-        }
+        rv = robotraconteurlite_buffer_vec_copy_from_mem(element_writer->buffer, o, data_buf, data_len, 0,
+                                                         data_elem_size, data_len);
     }
 
-    rv = robotraconteurlite_message_write_padded_uint_x(entry_writer->buffer, offset, 0,
-                                                        &buffer_info->element_count_offset);
-
     if (FAILED(rv))
     {
         return rv;
     }
 
-    buffer_info->header_size = *offset - entry_writer->buffer_offset;
-    buffer_info->element_start_offset = *offset;
+    /* An external payload is counted in the element size but does not use up the send buffer */
+    assert((elem_size - external_size) <= element_writer->buffer_count);
+    element_writer->elements_written_count++;
+    element_writer->elements_written_size += elem_size;
+    element_writer->external_written_size += external_size;
+    element_writer->buffer_offset += elem_size;
+    element_writer->buffer_count -= elem_size - external_size;
+
     return ROBOTRACONTEURLITE_ERROR_SUCCESS;
 }
 
-robotraconteurlite_status robotraconteurlite_messageentry_writer_begin_entry(
-    struct robotraconteurlite_messageentry_writer* entry_writer, struct robotraconteurlite_messageentry_header* header,
-    struct robotraconteurlite_messageelement_writer* element_writer)
+robotraconteurlite_status robotraconteurlite_messageelement_writer_reserve_raw(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name, size_t data_len, uint16_t data_type, size_t data_elem_size,
+    size_t data_elem_align, struct robotraconteurlite_buffer* reserved)
 {
 
     robotraconteurlite_status rv = -1;
-    size_t o = entry_writer->buffer_offset;
-    struct robotraconteurlite_messageentry_buffer_info buffer_info;
+    size_t o = 0;
+    struct robotraconteurlite_messageelement_buffer_info buffer_info;
+    size_t elem_size = 0;
+    struct robotraconteurlite_buffer span;
 
-    assert(entry_writer != NULL);
-    assert(header != NULL);
     assert(element_writer != NULL);
+    assert(element_name != NULL);
+    assert(reserved != NULL);
 
-    if (!(entry_writer->entries_written_count < UINT16_MAX))
+    o = element_writer->buffer_offset;
+    element_writer->reserved_size = 0;
+
+    if (!(element_writer->elements_written_count < UINT32_MAX))
     {
         return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
     }
-    switch (entry_writer->message_version)
+
+    /* The count is known up front, so the header is written with its final sizes */
+    switch (element_writer->message_version)
     {
     case 2:
-        rv = robotraconteurlite_messageentry_writer_write_header2_ex(entry_writer, &o, header, &buffer_info);
+        rv = robotraconteurlite_messageelement_writer_write_data_header2_ex(
+            element_writer, &o, element_name, data_len, data_type, data_elem_size, &buffer_info, &elem_size);
         break;
     case 4:
-        rv = robotraconteurlite_messageentry_writer_write_header4_ex(entry_writer, &o, header, &buffer_info);
+        rv = robotraconteurlite_messageelement_writer_write_data_header4_ex(
+            element_writer, &o, element_name, data_len, data_type, data_elem_size, &buffer_info, &elem_size);
         break;
     default:
         return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
     }
+
     if (FAILED(rv))
     {
         return rv;
     }
 
-    element_writer->buffer = entry_writer->buffer;
-    element_writer->buffer_offset = entry_writer->buffer_offset + buffer_info.header_size;
-    element_writer->buffer_count = entry_writer->buffer_count - buffer_info.header_size;
-    element_writer->elements_written_count = 0;
-    element_writer->elements_written_size = 0;
-    element_writer->message_version = entry_writer->message_version;
-    entry_writer->entry_size_offset = buffer_info.entry_size_offset;
-    entry_writer->element_count_offset = buffer_info.element_count_offset;
-    entry_writer->entry_header_size = buffer_info.header_size;
+    /* The data must be one contiguous, aligned region of the send buffer. Otherwise the caller falls back to
+       writing the element from its own storage. */
+    (void)memset(&span, 0, sizeof(span));
+    rv = robotraconteurlite_buffer_vec_get_span(element_writer->buffer, buffer_info.data_start_offset,
+                                                data_len * data_elem_size, &span);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    /* cppcheck-suppress misra-c2012-11.4 */
+    if ((data_elem_align > 1U) && ((((uintptr_t)span.data) % data_elem_align) != 0U))
+    {
+        return ROBOTRACONTEURLITE_ERROR_NO_VALUE;
+    }
+
+    element_writer->reserved_offset = element_writer->buffer_offset;
+    element_writer->reserved_size = elem_size;
+    reserved->data = span.data;
+    reserved->len = data_len;
 
     return ROBOTRACONTEURLITE_ERROR_SUCCESS;
 }
 
-robotraconteurlite_status robotraconteurlite_messageentry_writer_end_entry(
-    struct robotraconteurlite_messageentry_writer* entry_writer, struct robotraconteurlite_messageentry_header* header,
+robotraconteurlite_status robotraconteurlite_messageelement_writer_commit_reserved(
     struct robotraconteurlite_messageelement_writer* element_writer)
 {
+    size_t elem_size = 0;
 
-    robotraconteurlite_status rv = -1;
-    uint32_t entry_size = 0;
-
-    assert(entry_writer != NULL);
-    assert(header != NULL);
     assert(element_writer != NULL);
 
-    entry_size = (uint32_t)(entry_writer->entry_header_size + element_writer->elements_written_size);
+    if ((element_writer->reserved_size == 0U) || (element_writer->reserved_offset != element_writer->buffer_offset))
+    {
+        return ROBOTRACONTEURLITE_ERROR_INVALID_OPERATION;
+    }
 
-    switch (entry_writer->message_version)
+    elem_size = element_writer->reserved_size;
+    element_writer->reserved_size = 0;
+
+    element_writer->elements_written_count++;
+    element_writer->elements_written_size += elem_size;
+    element_writer->buffer_offset += elem_size;
+    element_writer->buffer_count -= elem_size;
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+/* Convert count elements from source directly into the buffer_vec at pos. Only elements that straddle segments are
+   staged, one at a time. */
+static robotraconteurlite_status robotraconteurlite_message_convert_to_buffer_vec(
+    struct robotraconteurlite_buffer_vec_cursor* cursor, size_t pos, const uint8_t* source, uint16_t source_type,
+    size_t source_elem_size, uint16_t dest_type, size_t dest_elem_size, size_t count)
+{
+    uint8_t straddle[16];
+    struct robotraconteurlite_buffer span;
+    size_t done = 0;
+    size_t n = 0;
+    robotraconteurlite_status rv = -1;
+
+    assert(dest_elem_size <= sizeof(straddle));
+
+    while (done < count)
     {
-    case 2: {
-        size_t o = entry_writer->entry_size_offset;
-        rv = robotraconteurlite_message_write_uint32(entry_writer->buffer, &o, entry_size);
+        rv = robotraconteurlite_buffer_vec_cursor_peek(cursor, pos, &span);
         if (FAILED(rv))
         {
             return rv;
         }
-        o = entry_writer->element_count_offset;
-        rv = robotraconteurlite_message_write_uint16(entry_writer->buffer, &o,
-                                                     (uint16_t)element_writer->elements_written_count);
-        if (FAILED(rv))
+
+        n = span.len / dest_elem_size;
+        n = (n < (count - done)) ? n : (count - done);
+        if (n == 0U)
         {
-            return rv;
+            n = 1U;
+            rv = robotraconteurlite_datatype_convert(&source[done * source_elem_size], source_type, straddle,
+                                                     dest_type, n);
+            if (FAILED(rv))
+            {
+                return rv;
+            }
+            rv = robotraconteurlite_buffer_vec_cursor_write(cursor, pos, straddle, dest_elem_size);
         }
-        break;
-    }
-    case 4: {
-        rv = robotraconteurlite_message_write_padded_uint_x_val(entry_writer->buffer, entry_writer->entry_size_offset,
-                                                                entry_size);
-        if (FAILED(rv))
+        else
         {
-            return rv;
+            rv = robotraconteurlite_datatype_convert(&source[done * source_elem_size], source_type, span.data,
+                                                     dest_type, n);
         }
-        rv = robotraconteurlite_message_write_padded_uint_x_val(
-            entry_writer->buffer, entry_writer->element_count_offset, (uint32_t)element_writer->elements_written_count);
         if (FAILED(rv))
         {
             return rv;
         }
-        break;
-    }
-    default:
-        return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
-    }
-
-    entry_writer->entries_written_count++;
-    entry_writer->entries_written_size += entry_size;
-    entry_writer->buffer_offset += entry_size;
-    entry_writer->buffer_count -= entry_size;
 
-    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
-}
+        done += n;
+        pos += n * dest_elem_size;
+    }
 
-robotraconteurlite_status robotraconteurlite_messageelement_writer_write_header4_ex(
-    struct robotraconteurlite_messageelement_writer* element_writer, size_t* offset,
-    struct robotraconteurlite_messageelement_header* header,
-    struct robotraconteurlite_messageelement_buffer_info* buffer_info)
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_writer_write_array_convert(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name, const uint8_t* source_buf, size_t source_len,
+    uint16_t source_type, uint16_t data_type)
 {
     robotraconteurlite_status rv = -1;
-    uint8_t flags = 0;
+    size_t o = 0;
+    struct robotraconteurlite_messageelement_buffer_info buffer_info;
+    size_t elem_size = 0;
+    size_t source_elem_size = 0;
+    size_t data_elem_size = 0;
 
-    if (header->element_name.len > 0U)
-    {
-        FLAGS_SET(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_ELEMENT_NAME_STR);
-    }
+    assert(element_writer != NULL);
+    assert(element_name != NULL);
+    assert(source_buf != NULL);
 
-    if (header->element_name_code != 0U)
-    {
-        FLAGS_SET(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_ELEMENT_NAME_CODE);
-    }
+    o = element_writer->buffer_offset;
 
-    if (header->element_number != 0)
+    if (!(element_writer->elements_written_count < UINT32_MAX))
     {
-        FLAGS_SET(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_ELEMENT_NUMBER);
+        return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
     }
 
-    if (header->element_type_name.len > 0U)
+    /* An empty conversion checks that the pair is supported before anything is written */
+    rv = robotraconteurlite_datatype_convert(NULL, source_type, NULL, data_type, 0U);
+    if (FAILED(rv))
     {
-        FLAGS_SET(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_ELEMENT_TYPE_NAME_STR);
+        return rv;
     }
 
-    if (header->element_type_name_code != 0U)
-    {
-        FLAGS_SET(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_ELEMENT_TYPE_NAME_CODE);
-    }
+    source_elem_size = robotraconteurlite_message_data_type_size(source_type);
+    data_elem_size = robotraconteurlite_message_data_type_size(data_type);
 
-    if (header->metadata.len > 0U)
+    switch (element_writer->message_version)
     {
-        FLAGS_SET(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_META_INFO);
+    case 2:
+        rv = robotraconteurlite_messageelement_writer_write_data_header2_ex(
+            element_writer, &o, element_name, source_len, data_type, data_elem_size, &buffer_info, &elem_size);
+        break;
+    case 4:
+        rv = robotraconteurlite_messageelement_writer_write_data_header4_ex(
+            element_writer, &o, element_name, source_len, data_type, data_elem_size, &buffer_info, &elem_size);
+        break;
+    default:
+        return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
     }
 
-    buffer_info->start_buffer_offset = *offset;
-    rv = robotraconteurlite_message_write_padded_uint_x(element_writer->buffer, offset, 0,
-                                                        &buffer_info->element_size_offset);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    rv = robotraconteurlite_message_write_uint8(element_writer->buffer, offset, flags);
+    rv = robotraconteurlite_message_convert_to_buffer_vec(&element_writer->cursor, buffer_info.data_start_offset,
+                                                          source_buf, source_type, source_elem_size, data_type,
+                                                          data_elem_size, source_len);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_ELEMENT_NAME_STR))
+    element_writer->elements_written_count++;
+    element_writer->elements_written_size += elem_size;
+    element_writer->buffer_offset += elem_size;
+    element_writer->buffer_count -= elem_size;
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+/* Interleave count complex values from separate real and imaginary planes. part_size is the size of each part,
+   sizeof(double) or sizeof(float). */
+static void robotraconteurlite_message_interleave_complex(const uint8_t* real, const uint8_t* imag, uint8_t* dest,
+                                                          size_t part_size, size_t count)
+{
+    size_t i = 0;
+    if (part_size == sizeof(double))
     {
-        buffer_info->element_name_str_offset = *offset;
-        rv = robotraconteurlite_message_write_header_string_with_len_prefix4(element_writer->buffer, offset,
-                                                                             &header->element_name);
-        if (FAILED(rv))
+        for (i = 0; i < count; i++)
         {
-            return rv;
+            double v[2];
+            (void)memcpy(&v[0], &real[i * sizeof(double)], sizeof(double));
+            (void)memcpy(&v[1], &imag[i * sizeof(double)], sizeof(double));
+            (void)memcpy(&dest[i * sizeof(v)], v, sizeof(v));
         }
     }
     else
     {
-        buffer_info->element_name_str_offset = SIZE_MAX;
+        for (i = 0; i < count; i++)
+        {
+            float v[2];
+            (void)memcpy(&v[0], &real[i * sizeof(float)], sizeof(float));
+            (void)memcpy(&v[1], &imag[i * sizeof(float)], sizeof(float));
+            (void)memcpy(&dest[i * sizeof(v)], v, sizeof(v));
+        }
     }
+}
 
-    if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_ELEMENT_NAME_CODE))
+robotraconteurlite_status robotraconteurlite_messageelement_writer_write_split_ex(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name, const uint8_t* real_buf, const uint8_t* imag_buf,
+    size_t source_len, uint16_t data_type, size_t data_elem_size)
+{
+    uint8_t straddle[16];
+    struct robotraconteurlite_buffer span;
+    robotraconteurlite_status rv = -1;
+    size_t o = 0;
+    struct robotraconteurlite_messageelement_buffer_info buffer_info;
+    size_t elem_size = 0;
+    size_t part_size = data_elem_size / 2U;
+    size_t done = 0;
+    size_t n = 0;
+
+    assert(element_writer != NULL);
+    assert(element_name != NULL);
+    assert(real_buf != NULL);
+    assert(imag_buf != NULL);
+    assert(data_elem_size <= sizeof(straddle));
+
+    o = element_writer->buffer_offset;
+
+    if (!(element_writer->elements_written_count < UINT32_MAX))
     {
-        rv = robotraconteurlite_message_write_uint_x(element_writer->buffer, offset, header->element_name_code);
-        if (FAILED(rv))
-        {
-            return rv;
-        }
+        return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
     }
 
-    if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_ELEMENT_NUMBER))
+    switch (element_writer->message_version)
     {
-        rv = robotraconteurlite_message_write_int_x(element_writer->buffer, offset, header->element_number);
-        if (FAILED(rv))
-        {
-            return rv;
-        }
+    case 2:
+        rv = robotraconteurlite_messageelement_writer_write_data_header2_ex(
+            element_writer, &o, element_name, source_len, data_type, data_elem_size, &buffer_info, &elem_size);
+        break;
+    case 4:
+        rv = robotraconteurlite_messageelement_writer_write_data_header4_ex(
+            element_writer, &o, element_name, source_len, data_type, data_elem_size, &buffer_info, &elem_size);
+        break;
+    default:
+        return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
     }
 
-    rv = robotraconteurlite_message_write_uint16(element_writer->buffer, offset, header->element_type);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_ELEMENT_TYPE_NAME_STR))
+    /* Interleave straight into the send buffer segments, staging only values that straddle segments */
+    o = buffer_info.data_start_offset;
+    while (done < source_len)
     {
-        rv = robotraconteurlite_message_write_header_string_with_len_prefix4(element_writer->buffer, offset,
-                                                                             &header->element_type_name);
+        rv = robotraconteurlite_buffer_vec_cursor_peek(&element_writer->cursor, o, &span);
         if (FAILED(rv))
         {
             return rv;
         }
-    }
 
-    if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_ELEMENT_TYPE_NAME_CODE))
-    {
-        rv = robotraconteurlite_message_write_uint_x(element_writer->buffer, offset, header->element_type_name_code);
-        if (FAILED(rv))
+        n = span.len / data_elem_size;
+        n = (n < (source_len - done)) ? n : (source_len - done);
+        if (n == 0U)
         {
-            return rv;
+            n = 1U;
+            robotraconteurlite_message_interleave_complex(&real_buf[done * part_size], &imag_buf[done * part_size],
+                                                          straddle, part_size, n);
+            rv = robotraconteurlite_buffer_vec_cursor_write(&element_writer->cursor, o, straddle, data_elem_size);
+            if (FAILED(rv))
+            {
+                return rv;
+            }
+        }
+        else
+        {
+            robotraconteurlite_message_interleave_complex(&real_buf[done * part_size], &imag_buf[done * part_size],
+                                                          span.data, part_size, n);
         }
+
+        done += n;
+        o += n * data_elem_size;
     }
 
-    if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_META_INFO))
+    element_writer->elements_written_count++;
+    element_writer->elements_written_size += elem_size;
+    element_writer->buffer_offset += elem_size;
+    element_writer->buffer_count -= elem_size;
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+/* Unpack n bits starting at bit bit_pos of words into wire bools of 0 or 1. Nibbles are spread into four bytes with
+   one multiply. */
+static void robotraconteurlite_message_unpack_bools(const uint64_t* words, size_t bit_pos, uint8_t* dest, size_t n)
+{
+    size_t i = 0;
+    while (i < n)
     {
-        rv = robotraconteurlite_message_write_header_string_with_len_prefix4(element_writer->buffer, offset,
-                                                                             &header->metadata);
-        if (FAILED(rv))
+        size_t pos = bit_pos + i;
+        if (((pos % 4U) == 0U) && ((n - i) >= 4U))
         {
-            return rv;
+            uint32_t x = (uint32_t)(words[pos / 64U] >> (pos % 64U)) & 0xFU;
+            x = (x * 0x00204081U) & 0x01010101U;
+            dest[i] = (uint8_t)x;
+            dest[i + 1U] = (uint8_t)(x >> 8U);
+            dest[i + 2U] = (uint8_t)(x >> 16U);
+            dest[i + 3U] = (uint8_t)(x >> 24U);
+            i += 4U;
+        }
+        else
+        {
+            dest[i] = (uint8_t)((words[pos / 64U] >> (pos % 64U)) & 1U);
+            i++;
         }
     }
+}
 
-    if (FAILED(rv))
-    {
-        return rv;
-    }
+robotraconteurlite_status robotraconteurlite_messageelement_writer_write_bool_bitset(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name, const struct robotraconteurlite_array_uint64* source,
+    size_t bit_count)
+{
+    struct robotraconteurlite_buffer span;
+    robotraconteurlite_status rv = -1;
+    size_t o = 0;
+    struct robotraconteurlite_messageelement_buffer_info buffer_info;
+    size_t elem_size = 0;
+    size_t done = 0;
+    size_t n = 0;
 
-    rv = robotraconteurlite_message_write_padded_uint_x(element_writer->buffer, offset, 0,
-                                                        &buffer_info->element_count_offset);
-    if (FAILED(rv))
+    assert(element_writer != NULL);
+    assert(element_name != NULL);
+    assert(source != NULL);
+
+    if (((bit_count / 64U) + (((bit_count % 64U) != 0U) ? 1U : 0U)) > source->len)
     {
-        return rv;
+        return ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER;
     }
 
-    buffer_info->header_size = *offset - element_writer->buffer_offset;
-    buffer_info->data_start_offset = *offset;
-
-    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
-}
+    o = element_writer->buffer_offset;
 
-robotraconteurlite_status robotraconteurlite_messageelement_writer_write_header2_ex(
-    struct robotraconteurlite_messageelement_writer* element_writer, size_t* offset,
-    struct robotraconteurlite_messageelement_header* header,
-    struct robotraconteurlite_messageelement_buffer_info* buffer_info)
-{
-    robotraconteurlite_status rv = -1;
-    buffer_info->start_buffer_offset = *offset;
-    buffer_info->element_size_offset = *offset;
-    rv = robotraconteurlite_message_write_uint32(element_writer->buffer, offset, 0);
-    if (FAILED(rv))
+    if (!(element_writer->elements_written_count < UINT32_MAX))
     {
-        return rv;
+        return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
     }
 
-    buffer_info->element_name_str_offset = *offset;
-    rv = robotraconteurlite_message_write_header_string_with_len_prefix2(element_writer->buffer, offset,
-                                                                         &header->element_name);
-    if (FAILED(rv))
+    switch (element_writer->message_version)
     {
-        return rv;
+    case 2:
+        rv = robotraconteurlite_messageelement_writer_write_data_header2_ex(
+            element_writer, &o, element_name, bit_count, ROBOTRACONTEURLITE_DATATYPE_BOOL,
+            sizeof(struct robotraconteurlite_bool), &buffer_info, &elem_size);
+        break;
+    case 4:
+        rv = robotraconteurlite_messageelement_writer_write_data_header4_ex(
+            element_writer, &o, element_name, bit_count, ROBOTRACONTEURLITE_DATATYPE_BOOL,
+            sizeof(struct robotraconteurlite_bool), &buffer_info, &elem_size);
+        break;
+    default:
+        return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
     }
 
-    rv = robotraconteurlite_message_write_uint16(element_writer->buffer, offset, header->element_type);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    rv = robotraconteurlite_message_write_header_string_with_len_prefix2(element_writer->buffer, offset,
-                                                                         &header->element_type_name);
-    if (FAILED(rv))
+    while (done < bit_count)
     {
-        return rv;
+        rv = robotraconteurlite_buffer_vec_cursor_peek(&element_writer->cursor, buffer_info.data_start_offset + done,
+                                                       &span);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+
+        n = (span.len < (bit_count - done)) ? span.len : (bit_count - done);
+        if (n == 0U)
+        {
+            return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+        }
+
+        robotraconteurlite_message_unpack_bools(source->data, done, span.data, n);
+        done += n;
     }
 
-    rv = robotraconteurlite_message_write_header_string_with_len_prefix2(element_writer->buffer, offset,
-                                                                         &header->metadata);
+    element_writer->elements_written_count++;
+    element_writer->elements_written_size += elem_size;
+    element_writer->buffer_offset += elem_size;
+    element_writer->buffer_count -= elem_size;
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+static robotraconteurlite_status robotraconteurlite_message_add_size(size_t* total, size_t s)
+{
+    if ((*total > UINT32_MAX) || (s > (UINT32_MAX - *total)))
+    {
+        return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+    }
+    *total += s;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
 
+static robotraconteurlite_status robotraconteurlite_message_add_string_size4(size_t* total,
+                                                                           const struct robotraconteurlite_string* str)
+{
+    size_t s = 0;
+    robotraconteurlite_status rv = robotraconteurlite_message_header_string_with_len_prefix_size4(str, &s);
     if (FAILED(rv))
     {
         return rv;
     }
+    return robotraconteurlite_message_add_size(total, s);
+}
 
-    buffer_info->element_count_offset = *offset;
-    rv = robotraconteurlite_message_write_uint32(element_writer->buffer, offset, 0);
+static robotraconteurlite_status robotraconteurlite_message_add_uint_x_size(size_t* total, uint32_t val)
+{
+    size_t s = 0;
+    robotraconteurlite_status rv = robotraconteurlite_message_uint_x_size(val, &s);
     if (FAILED(rv))
     {
         return rv;
     }
-
-    buffer_info->header_size = *offset - element_writer->buffer_offset;
-    buffer_info->data_start_offset = *offset;
-
-    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    return robotraconteurlite_message_add_size(total, s);
 }
 
-robotraconteurlite_status robotraconteurlite_messageelement_writer_begin_nested_element(
-    struct robotraconteurlite_messageelement_writer* element_writer,
-    struct robotraconteurlite_messageelement_header* header,
-    struct robotraconteurlite_messageelement_writer* nested_element_writer)
+robotraconteurlite_status robotraconteurlite_message_writer_size_of_header(
+    uint16_t message_version, const struct robotraconteurlite_message_header* header, uint8_t message_flags_mask,
+    size_t* header_size)
 {
+    size_t str_len = 0;
+    uint8_t flags = 0;
 
-    robotraconteurlite_status rv = -1;
-    size_t o = element_writer->buffer_offset;
-    struct robotraconteurlite_messageelement_buffer_info buffer_info;
-
-    assert(element_writer != NULL);
     assert(header != NULL);
-    assert(nested_element_writer != NULL);
+    assert(header_size != NULL);
 
-    if (!(element_writer->elements_written_count < UINT32_MAX))
+    switch (message_version)
     {
+    case 2:
+        if ((header->sender_nodename.len > UINT16_MAX) || (header->receiver_nodename.len > UINT16_MAX) ||
+            (header->metadata.len > UINT16_MAX))
+        {
+            return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+        }
+        str_len = header->sender_nodename.len + header->receiver_nodename.len + header->metadata.len;
+        if ((str_len + 64U) > UINT16_MAX)
+        {
+            return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+        }
+        *header_size = str_len + 64U;
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case 4:
+        return robotraconteurlite_message_header4_size(header, message_flags_mask, &flags, header_size);
+    default:
         return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
     }
+}
 
-    switch (element_writer->message_version)
+robotraconteurlite_status robotraconteurlite_messageentry_writer_size_of_header(
+    uint16_t message_version, const struct robotraconteurlite_messageentry_header* header, size_t* header_size)
+{
+    robotraconteurlite_status rv = ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    size_t s = 0;
+
+    assert(header != NULL);
+    assert(header_size != NULL);
+
+    switch (message_version)
     {
     case 2:
-        rv = robotraconteurlite_messageelement_writer_write_header2_ex(element_writer, &o, header, &buffer_info);
-        break;
+        if ((header->service_path.len > UINT16_MAX) || (header->member_name.len > UINT16_MAX) ||
+            (header->metadata.len > UINT16_MAX))
+        {
+            return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+        }
+        *header_size = 22U + header->service_path.len + header->member_name.len + header->metadata.len;
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
     case 4:
-        rv = robotraconteurlite_messageelement_writer_write_header4_ex(element_writer, &o, header, &buffer_info);
-        break;
+        /* Padded entry size, flags, entry type and padded element count */
+        s = 13U;
+        if (header->service_path.len > 0U)
+        {
+            rv = robotraconteurlite_message_add_string_size4(&s, &header->service_path);
+        }
+        if ((!FAILED(rv)) && (header->service_path_code != 0U))
+        {
+            rv = robotraconteurlite_message_add_uint_x_size(&s, header->service_path_code);
+        }
+        if ((!FAILED(rv)) && (header->member_name.len > 0U))
+        {
+            rv = robotraconteurlite_message_add_string_size4(&s, &header->member_name);
+        }
+        if ((!FAILED(rv)) && (header->request_id != 0U))
+        {
+            rv = robotraconteurlite_message_add_uint_x_size(&s, header->request_id);
+        }
+        if ((!FAILED(rv)) && (header->error != 0U))
+        {
+            rv = robotraconteurlite_message_add_size(&s, 2U);
+        }
+        if ((!FAILED(rv)) && (header->metadata.len > 0U))
+        {
+            rv = robotraconteurlite_message_add_string_size4(&s, &header->metadata);
+        }
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+        *header_size = s;
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
     default:
         return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
     }
-
-    if (FAILED(rv))
-    {
-        return rv;
-    }
-
-    nested_element_writer->buffer = element_writer->buffer;
-    nested_element_writer->buffer_offset = buffer_info.data_start_offset;
-    nested_element_writer->buffer_count = element_writer->buffer_count - buffer_info.header_size;
-    nested_element_writer->elements_written_count = 0;
-    nested_element_writer->elements_written_size = 0;
-    nested_element_writer->message_version = element_writer->message_version;
-    element_writer->element_size_offset = buffer_info.element_size_offset;
-    element_writer->data_count_offset = buffer_info.element_count_offset;
-    element_writer->element_header_size = buffer_info.header_size;
-
-    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
 }
 
-robotraconteurlite_status robotraconteurlite_messageelement_writer_end_nested_element(
-    struct robotraconteurlite_messageelement_writer* element_writer,
-    struct robotraconteurlite_messageelement_header* header,
-    struct robotraconteurlite_messageelement_writer* nested_element_writer)
+robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_header(
+    uint16_t message_version, const struct robotraconteurlite_messageelement_header* header, size_t* header_size)
 {
-    robotraconteurlite_status rv = -1;
-    size_t element_size = 0;
-    size_t o = 0;
+    robotraconteurlite_status rv = ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    size_t s = 0;
 
-    assert(element_writer != NULL);
     assert(header != NULL);
-    assert(nested_element_writer != NULL);
-
-    element_size = element_writer->element_header_size + nested_element_writer->elements_written_size;
+    assert(header_size != NULL);
 
-    switch (element_writer->message_version)
+    switch (message_version)
     {
-    case 2: {
-        o = element_writer->element_size_offset;
-        rv = robotraconteurlite_message_write_uint32(element_writer->buffer, &o, element_size);
-        if (FAILED(rv))
+    case 2:
+        if ((header->element_name.len > UINT16_MAX) || (header->element_type_name.len > UINT16_MAX) ||
+            (header->metadata.len > UINT16_MAX))
         {
-            return rv;
+            return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
         }
-
-        o = element_writer->data_count_offset;
-        rv = robotraconteurlite_message_write_uint32(element_writer->buffer, &o,
-                                                     (uint32_t)nested_element_writer->elements_written_count);
-
-        if (FAILED(rv))
+        *header_size = 16U + header->element_name.len + header->element_type_name.len + header->metadata.len;
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case 4:
+        /* Padded element size, flags, element type and padded element count */
+        s = 13U;
+        if (header->element_name.len > 0U)
         {
-            return rv;
+            rv = robotraconteurlite_message_add_string_size4(&s, &header->element_name);
         }
-        break;
-    }
-    case 4: {
-        rv = robotraconteurlite_message_write_padded_uint_x_val(element_writer->buffer,
-                                                                element_writer->element_size_offset, element_size);
-        if (FAILED(rv))
+        if ((!FAILED(rv)) && (header->element_name_code != 0U))
         {
-            return rv;
+            rv = robotraconteurlite_message_add_uint_x_size(&s, header->element_name_code);
+        }
+        if ((!FAILED(rv)) && (header->element_number != 0))
+        {
+            size_t s1 = 0;
+            rv = robotraconteurlite_message_int_x_size(header->element_number, &s1);
+            if (!FAILED(rv))
+            {
+                rv = robotraconteurlite_message_add_size(&s, s1);
+            }
+        }
+        if ((!FAILED(rv)) && (header->element_type_name.len > 0U))
+        {
+            rv = robotraconteurlite_message_add_string_size4(&s, &header->element_type_name);
+        }
+        if ((!FAILED(rv)) && (header->element_type_name_code != 0U))
+        {
+            rv = robotraconteurlite_message_add_uint_x_size(&s, header->element_type_name_code);
+        }
+        if ((!FAILED(rv)) && (header->metadata.len > 0U))
+        {
+            rv = robotraconteurlite_message_add_string_size4(&s, &header->metadata);
         }
-
-        rv = robotraconteurlite_message_write_padded_uint_x_val(
-            element_writer->buffer, element_writer->data_count_offset,
-            (uint32_t)nested_element_writer->elements_written_count);
         if (FAILED(rv))
         {
             return rv;
         }
-        break;
-    }
+        *header_size = s;
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
     default:
         return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
     }
-
-    element_writer->elements_written_count++;
-    element_writer->elements_written_size += element_size;
-    element_writer->buffer_offset += element_size;
-    element_writer->buffer_count -= element_size;
-
-    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
 }
 
-robotraconteurlite_status robotraconteurlite_messageelement_writer_write_data_header2_ex(
-    struct robotraconteurlite_messageelement_writer* element_writer, size_t* offset,
-    const struct robotraconteurlite_string* element_name, size_t data_len, uint16_t data_type, size_t data_elem_size,
-    struct robotraconteurlite_messageelement_buffer_info* buffer_info, size_t* element_size)
+robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_raw(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t data_len,
+    size_t data_elem_size, size_t* element_size)
 {
-    robotraconteurlite_status rv = -1;
+    uint8_t flags = 0;
 
-    size_t str1_len = 0;
-    size_t data_size = 0;
-    size_t elem_size = 0;
+    assert(element_name != NULL);
+    assert(element_size != NULL);
 
-    if (element_name->len > UINT16_MAX)
+    switch (message_version)
     {
-        return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+    case 2:
+        return robotraconteurlite_messageelement_data_size2(element_name, data_len, data_elem_size, element_size);
+    case 4:
+        return robotraconteurlite_messageelement_data_size4(element_name, 0, data_len, data_elem_size, &flags,
+                                                            element_size);
+    default:
+        return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
     }
+}
 
-    str1_len = element_name->len;
-    data_size = data_len * data_elem_size;
-    elem_size = 16U + str1_len + data_size;
-    if (elem_size > UINT32_MAX)
-    {
-        return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
-    }
+robotraconteurlite_status robotraconteurlite_message_size_add(size_t* total_size, size_t size)
+{
+    assert(total_size != NULL);
+    return robotraconteurlite_message_add_size(total_size, size);
+}
 
-    buffer_info->start_buffer_offset = *offset;
-    buffer_info->element_size_offset = *offset;
-    rv = robotraconteurlite_message_write_uint32(element_writer->buffer, offset, (uint32_t)elem_size);
-    if (FAILED(rv))
-    {
-        return rv;
-    }
+robotraconteurlite_status robotraconteurlite_message_template_init(
+    struct robotraconteurlite_message_template* message_template, uint8_t* data, size_t message_len,
+    struct robotraconteurlite_message_template_slot* slots, size_t slots_len)
+{
+    struct robotraconteurlite_buffer buffer;
+    struct robotraconteurlite_buffer_vec buffer_vec;
+    struct robotraconteurlite_message_reader reader;
+    struct robotraconteurlite_messageentry_reader entry_reader;
+    struct robotraconteurlite_message_header header;
+    struct robotraconteurlite_messageentry_header entry_header;
+    struct robotraconteurlite_message_buffer_info buffer_info;
+    struct robotraconteurlite_messageentry_buffer_info entry_buffer_info;
+    robotraconteurlite_status rv = -1;
 
-    buffer_info->element_name_str_offset = *offset;
-    rv = robotraconteurlite_message_write_header_string_with_len_prefix2(element_writer->buffer, offset, element_name);
+    assert(message_template != NULL);
+    assert(data != NULL);
+    assert((slots != NULL) || (slots_len == 0U));
 
+    buffer.data = data;
+    buffer.len = message_len;
+    buffer_vec.buffer_vec = &buffer;
+    buffer_vec.buffer_vec_cnt = 1;
+
+    rv = robotraconteurlite_message_reader_init(&reader, &buffer_vec, 0, message_len);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    rv = robotraconteurlite_message_write_uint16(element_writer->buffer, offset, data_type);
+    (void)memset(&header, 0, sizeof(header));
+    rv = robotraconteurlite_message_reader_read_header_ex(&reader, &header, &buffer_info);
     if (FAILED(rv))
     {
         return rv;
     }
-
-    /* No element type name */
-    rv = robotraconteurlite_message_write_uint16(element_writer->buffer, offset, 0);
-    if (FAILED(rv))
+    if (header.message_size != message_len)
     {
-        return rv;
+        return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
     }
+    reader.message_version = header.message_version;
 
-    /* No metadata */
-
-    rv = robotraconteurlite_message_write_uint16(element_writer->buffer, offset, 0);
+    rv = robotraconteurlite_message_reader_begin_read_entries(&reader, &entry_reader);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    buffer_info->element_count_offset = *offset;
-    rv = robotraconteurlite_message_write_uint32(element_writer->buffer, offset, data_len);
+    (void)memset(&entry_header, 0, sizeof(entry_header));
+    rv = robotraconteurlite_messageentry_reader_read_header_ex(&entry_reader, &entry_header, &entry_buffer_info);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    buffer_info->data_start_offset = *offset;
-    buffer_info->header_size = *offset - buffer_info->start_buffer_offset;
-    *element_size = elem_size;
+    message_template->data = data;
+    message_template->message_len = message_len;
+    message_template->message_version = header.message_version;
+    message_template->sender_endpoint_offset = buffer_info.sender_endpoint_offset;
+    message_template->receiver_endpoint_offset = buffer_info.receiver_endpoint_offset;
+    message_template->request_id_offset = entry_buffer_info.request_id_offset;
+    message_template->slots = slots;
+    message_template->slots_len = slots_len;
+    message_template->slots_count = 0;
 
     return ROBOTRACONTEURLITE_ERROR_SUCCESS;
 }
 
-robotraconteurlite_status robotraconteurlite_messageelement_writer_write_data_header4_ex(
-    struct robotraconteurlite_messageelement_writer* element_writer, size_t* offset,
-    const struct robotraconteurlite_string* element_name, size_t data_len, uint16_t data_type, size_t data_elem_size,
-    struct robotraconteurlite_messageelement_buffer_info* buffer_info, size_t* element_size)
+robotraconteurlite_status robotraconteurlite_message_template_add_slot(
+    struct robotraconteurlite_message_template* message_template,
+    struct robotraconteurlite_messageelement_reader* element_reader, size_t* slot)
 {
+    struct robotraconteurlite_messageelement_header element_header;
+    struct robotraconteurlite_messageelement_buffer_info element_buffer_info;
+    struct robotraconteurlite_message_template_slot* s = NULL;
     robotraconteurlite_status rv = -1;
 
-    size_t data_size = 0;
-    size_t elem_size = 3;
-    uint32_t elem_size2 = 0;
-    uint8_t flags = 0;
-
-    if (element_name->len != 0U)
-    {
-        size_t s = 0;
-        FLAGS_SET(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_ELEMENT_NAME_STR);
-        rv = robotraconteurlite_message_header_string_with_len_prefix_size4(element_name, &s);
-        if (FAILED(rv))
-        {
-            return rv;
-        }
-        elem_size += s;
-    }
-
-    {
-        size_t s = 0;
-        rv = robotraconteurlite_message_uint_x_size(data_len, &s);
-        if (FAILED(rv))
-        {
-            return rv;
-        }
-        elem_size += s;
-    }
-
-    data_size = data_len * data_elem_size;
-    elem_size += data_size;
+    assert(message_template != NULL);
+    assert(element_reader != NULL);
+    assert(slot != NULL);
 
-    if (elem_size > UINT32_MAX)
+    if (message_template->slots_count >= message_template->slots_len)
     {
         return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
     }
 
+    (void)memset(&element_header, 0, sizeof(element_header));
+    (void)memset(&element_buffer_info, 0, sizeof(element_buffer_info));
+    rv = robotraconteurlite_messageelement_reader_read_header_ex(element_reader, &element_header, &element_buffer_info);
+    if (FAILED(rv))
     {
-        size_t s = 0;
-        rv = robotraconteurlite_message_len_plus_uint_x(elem_size, &elem_size2, &s);
-        if (FAILED(rv))
-        {
-            return rv;
-        }
-        elem_size += s;
+        return rv;
     }
 
-    if (elem_size > UINT32_MAX)
+    s = &message_template->slots[message_template->slots_count];
+    s->offset = element_buffer_info.data_start_offset;
+    s->len = element_header.element_size - element_buffer_info.header_size;
+    if ((s->len > message_template->message_len) || (s->offset > (message_template->message_len - s->len)))
     {
         return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
     }
 
-    buffer_info->start_buffer_offset = *offset;
-    buffer_info->element_size_offset = SIZE_MAX;
-    rv = robotraconteurlite_message_write_uint_x(element_writer->buffer, offset, (uint32_t)elem_size);
-    if (FAILED(rv))
-    {
-        return rv;
-    }
+    *slot = message_template->slots_count;
+    message_template->slots_count++;
 
-    rv = robotraconteurlite_message_write_uint8(element_writer->buffer, offset, flags);
-    if (FAILED(rv))
-    {
-        return rv;
-    }
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
 
-    buffer_info->element_name_str_offset = SIZE_MAX;
-    if (FLAGS_CHECK(flags, ROBOTRACONTEURLITE_MESSAGEELEMENT_FLAGS_ELEMENT_NAME_STR))
-    {
-        rv = robotraconteurlite_message_write_header_string_with_len_prefix4(element_writer->buffer, offset,
-                                                                             element_name);
-        if (FAILED(rv))
-        {
-            return rv;
-        }
-    }
+robotraconteurlite_status robotraconteurlite_message_template_set_slot(
+    struct robotraconteurlite_message_template* message_template, size_t slot, const void* data, size_t len)
+{
+    const struct robotraconteurlite_message_template_slot* s = NULL;
 
-    rv = robotraconteurlite_message_write_uint16(element_writer->buffer, offset, data_type);
-    if (FAILED(rv))
+    assert(message_template != NULL);
+    assert((data != NULL) || (len == 0U));
+
+    if (slot >= message_template->slots_count)
     {
-        return rv;
+        return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
     }
 
-    buffer_info->element_count_offset = SIZE_MAX;
-    rv = robotraconteurlite_message_write_uint_x(element_writer->buffer, offset, data_len);
-    if (FAILED(rv))
+    s = &message_template->slots[slot];
+    if (len != s->len)
     {
-        return rv;
+        return ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER;
     }
 
-    buffer_info->data_start_offset = *offset;
-    buffer_info->header_size = *offset - buffer_info->start_buffer_offset;
-    *element_size = elem_size;
+    (void)memcpy(&message_template->data[s->offset], data, len);
 
     return ROBOTRACONTEURLITE_ERROR_SUCCESS;
 }
 
-robotraconteurlite_status robotraconteurlite_messageelement_writer_write_raw(
-    struct robotraconteurlite_messageelement_writer* element_writer,
-    const struct robotraconteurlite_string* element_name, const uint8_t* data_buf, size_t data_len, uint16_t data_type,
-    size_t data_elem_size)
+static robotraconteurlite_status robotraconteurlite_message_template_patch_uint(
+    struct robotraconteurlite_message_template* message_template, size_t offset, uint32_t val)
 {
+    uint8_t* p = NULL;
 
-    robotraconteurlite_status rv = -1;
-    size_t o = 0;
-    struct robotraconteurlite_messageelement_buffer_info buffer_info;
-    size_t elem_size = 0;
-
-    assert(element_writer != NULL);
-    assert(element_name != NULL);
-    assert(data_buf != NULL);
-
-    o = element_writer->buffer_offset;
-
-    if (!(element_writer->elements_written_count < UINT32_MAX))
+    if (offset == SIZE_MAX)
     {
-        return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
+        return ROBOTRACONTEURLITE_ERROR_INVALID_OPERATION;
     }
 
-    switch (element_writer->message_version)
+    p = &message_template->data[offset];
+
+    if (message_template->message_version == 2U)
     {
-    case 2:
-        rv = robotraconteurlite_messageelement_writer_write_data_header2_ex(
-            element_writer, &o, element_name, data_len, data_type, data_elem_size, &buffer_info, &elem_size);
-        break;
-    case 4:
-        rv = robotraconteurlite_messageelement_writer_write_data_header4_ex(
-            element_writer, &o, element_name, data_len, data_type, data_elem_size, &buffer_info, &elem_size);
-        break;
-    default:
-        return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
+        (void)memcpy(p, &val, 4U);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
     }
 
-    if (FAILED(rv))
+    /* Message 4 uint_x, keep the width selected when the template was built */
+    switch (p[0])
     {
-        return rv;
+    case 254U:
+        (void)memcpy(&p[1], &val, 4U);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    case 253U: {
+        uint16_t val16 = (uint16_t)val;
+        if (val > UINT16_MAX)
+        {
+            return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+        }
+        (void)memcpy(&p[1], &val16, 2U);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    }
+    case 255U:
+        return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
+    default:
+        if (val > 252U)
+        {
+            return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+        }
+        p[0] = (uint8_t)val;
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
     }
+}
 
-    o = buffer_info.data_start_offset;
+robotraconteurlite_status robotraconteurlite_message_template_set_endpoints(
+    struct robotraconteurlite_message_template* message_template, uint32_t sender_endpoint,
+    uint32_t receiver_endpoint)
+{
+    robotraconteurlite_status rv = -1;
 
-    rv = robotraconteurlite_buffer_vec_copy_from_mem(element_writer->buffer, o, data_buf, data_len, 0, data_elem_size,
-                                                     data_len);
+    assert(message_template != NULL);
 
+    rv = robotraconteurlite_message_template_patch_uint(message_template, message_template->sender_endpoint_offset,
+                                                        sender_endpoint);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    element_writer->elements_written_count++;
-    element_writer->elements_written_size += elem_size;
-    element_writer->buffer_offset += elem_size;
-    element_writer->buffer_count -= elem_size;
+    return robotraconteurlite_message_template_patch_uint(message_template, message_template->receiver_endpoint_offset,
+                                                          receiver_endpoint);
+}
 
-    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+robotraconteurlite_status robotraconteurlite_message_template_set_request_id(
+    struct robotraconteurlite_message_template* message_template, uint32_t request_id)
+{
+    assert(message_template != NULL);
+
+    return robotraconteurlite_message_template_patch_uint(message_template, message_template->request_id_offset,
+                                                          request_id);
 }
@@ -14,6 +14,7 @@
  */
 
 #include <robotraconteurlite/message.h>
+#include "robotraconteurlite/util.h"
 #include <string.h>
 #include <assert.h>
 #include <math.h>
@@ -36,6 +37,29 @@ robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_dou
         /* cppcheck-suppress invalidPointerCast */
         element_reader, (uint8_t*)value, ROBOTRACONTEURLITE_DATATYPE_DOUBLE, sizeof(double));
 }
+
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_double_view(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_double* dest_array)
+{
+    struct robotraconteurlite_buffer view;
+    robotraconteurlite_status rv = -1;
+
+    /* cppcheck-suppress invalidPointerCast */
+    view.data = (uint8_t*)dest_array->data;
+    view.len = dest_array->len;
+    rv = robotraconteurlite_messageelement_reader_read_data_view_ex(
+        element_reader, &view, ROBOTRACONTEURLITE_DATATYPE_DOUBLE, sizeof(double), sizeof(double));
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    /* Alignment has been checked by read_data_view_ex */
+    /* cppcheck-suppress misra-c2012-11.3 */
+    dest_array->data = (double*)view.data;
+    dest_array->len = view.len;
+    return rv;
+}
 /* single */
 robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_single_array(
     struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_single* dest_array)
@@ -53,6 +77,29 @@ robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_sin
         /* cppcheck-suppress invalidPointerCast */
         element_reader, (uint8_t*)value, ROBOTRACONTEURLITE_DATATYPE_SINGLE, sizeof(float));
 }
+
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_single_view(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_single* dest_array)
+{
+    struct robotraconteurlite_buffer view;
+    robotraconteurlite_status rv = -1;
+
+    /* cppcheck-suppress invalidPointerCast */
+    view.data = (uint8_t*)dest_array->data;
+    view.len = dest_array->len;
+    rv = robotraconteurlite_messageelement_reader_read_data_view_ex(
+        element_reader, &view, ROBOTRACONTEURLITE_DATATYPE_SINGLE, sizeof(float), sizeof(float));
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    /* Alignment has been checked by read_data_view_ex */
+    /* cppcheck-suppress misra-c2012-11.3 */
+    dest_array->data = (float*)view.data;
+    dest_array->len = view.len;
+    return rv;
+}
 /* int8 */
 robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_int8_array(
     struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_int8* dest_array)
@@ -67,6 +114,28 @@ robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_int
     return robotraconteurlite_messageelement_reader_read_data_scalar_ex(
         element_reader, (uint8_t*)value, ROBOTRACONTEURLITE_DATATYPE_INT8, sizeof(int8_t));
 }
+
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_int8_view(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_int8* dest_array)
+{
+    struct robotraconteurlite_buffer view;
+    robotraconteurlite_status rv = -1;
+
+    view.data = (uint8_t*)dest_array->data;
+    view.len = dest_array->len;
+    rv = robotraconteurlite_messageelement_reader_read_data_view_ex(
+        element_reader, &view, ROBOTRACONTEURLITE_DATATYPE_INT8, sizeof(int8_t), sizeof(int8_t));
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    /* Alignment has been checked by read_data_view_ex */
+    /* cppcheck-suppress misra-c2012-11.3 */
+    dest_array->data = (int8_t*)view.data;
+    dest_array->len = view.len;
+    return rv;
+}
 /* uint8 */
 robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_uint8_array(
     struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_uint8* dest_array)
@@ -82,6 +151,28 @@ robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_uin
     return robotraconteurlite_messageelement_reader_read_data_scalar_ex(
         element_reader, (uint8_t*)value, ROBOTRACONTEURLITE_DATATYPE_UINT8, sizeof(uint8_t));
 }
+
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_uint8_view(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_uint8* dest_array)
+{
+    struct robotraconteurlite_buffer view;
+    robotraconteurlite_status rv = -1;
+
+    view.data = (uint8_t*)dest_array->data;
+    view.len = dest_array->len;
+    rv = robotraconteurlite_messageelement_reader_read_data_view_ex(
+        element_reader, &view, ROBOTRACONTEURLITE_DATATYPE_UINT8, sizeof(uint8_t), sizeof(uint8_t));
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    /* Alignment has been checked by read_data_view_ex */
+    /* cppcheck-suppress misra-c2012-11.3 */
+    dest_array->data = (uint8_t*)view.data;
+    dest_array->len = view.len;
+    return rv;
+}
 /* int16 */
 robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_int16_array(
     struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_int16* dest_array)
@@ -97,6 +188,28 @@ robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_int
     return robotraconteurlite_messageelement_reader_read_data_scalar_ex(
         element_reader, (uint8_t*)value, ROBOTRACONTEURLITE_DATATYPE_INT16, sizeof(int16_t));
 }
+
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_int16_view(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_int16* dest_array)
+{
+    struct robotraconteurlite_buffer view;
+    robotraconteurlite_status rv = -1;
+
+    view.data = (uint8_t*)dest_array->data;
+    view.len = dest_array->len;
+    rv = robotraconteurlite_messageelement_reader_read_data_view_ex(
+        element_reader, &view, ROBOTRACONTEURLITE_DATATYPE_INT16, sizeof(int16_t), sizeof(int16_t));
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    /* Alignment has been checked by read_data_view_ex */
+    /* cppcheck-suppress misra-c2012-11.3 */
+    dest_array->data = (int16_t*)view.data;
+    dest_array->len = view.len;
+    return rv;
+}
 /* uint16 */
 robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_uint16_array(
     struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_uint16* dest_array)
@@ -112,6 +225,28 @@ robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_uin
     return robotraconteurlite_messageelement_reader_read_data_scalar_ex(
         element_reader, (uint8_t*)value, ROBOTRACONTEURLITE_DATATYPE_UINT16, sizeof(uint16_t));
 }
+
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_uint16_view(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_uint16* dest_array)
+{
+    struct robotraconteurlite_buffer view;
+    robotraconteurlite_status rv = -1;
+
+    view.data = (uint8_t*)dest_array->data;
+    view.len = dest_array->len;
+    rv = robotraconteurlite_messageelement_reader_read_data_view_ex(
+        element_reader, &view, ROBOTRACONTEURLITE_DATATYPE_UINT16, sizeof(uint16_t), sizeof(uint16_t));
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    /* Alignment has been checked by read_data_view_ex */
+    /* cppcheck-suppress misra-c2012-11.3 */
+    dest_array->data = (uint16_t*)view.data;
+    dest_array->len = view.len;
+    return rv;
+}
 /* int32 */
 robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_int32_array(
     struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_int32* dest_array)
@@ -127,6 +262,28 @@ robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_int
     return robotraconteurlite_messageelement_reader_read_data_scalar_ex(
         element_reader, (uint8_t*)value, ROBOTRACONTEURLITE_DATATYPE_INT32, sizeof(int32_t));
 }
+
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_int32_view(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_int32* dest_array)
+{
+    struct robotraconteurlite_buffer view;
+    robotraconteurlite_status rv = -1;
+
+    view.data = (uint8_t*)dest_array->data;
+    view.len = dest_array->len;
+    rv = robotraconteurlite_messageelement_reader_read_data_view_ex(
+        element_reader, &view, ROBOTRACONTEURLITE_DATATYPE_INT32, sizeof(int32_t), sizeof(int32_t));
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    /* Alignment has been checked by read_data_view_ex */
+    /* cppcheck-suppress misra-c2012-11.3 */
+    dest_array->data = (int32_t*)view.data;
+    dest_array->len = view.len;
+    return rv;
+}
 /* uint32 */
 robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_uint32_array(
     struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_uint32* dest_array)
@@ -142,6 +299,28 @@ robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_uin
     return robotraconteurlite_messageelement_reader_read_data_scalar_ex(
         element_reader, (uint8_t*)value, ROBOTRACONTEURLITE_DATATYPE_UINT32, sizeof(uint32_t));
 }
+
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_uint32_view(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_uint32* dest_array)
+{
+    struct robotraconteurlite_buffer view;
+    robotraconteurlite_status rv = -1;
+
+    view.data = (uint8_t*)dest_array->data;
+    view.len = dest_array->len;
+    rv = robotraconteurlite_messageelement_reader_read_data_view_ex(
+        element_reader, &view, ROBOTRACONTEURLITE_DATATYPE_UINT32, sizeof(uint32_t), sizeof(uint32_t));
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    /* Alignment has been checked by read_data_view_ex */
+    /* cppcheck-suppress misra-c2012-11.3 */
+    dest_array->data = (uint32_t*)view.data;
+    dest_array->len = view.len;
+    return rv;
+}
 /* int64 */
 robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_int64_array(
     struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_int64* dest_array)
@@ -157,6 +336,28 @@ robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_int
     return robotraconteurlite_messageelement_reader_read_data_scalar_ex(
         element_reader, (uint8_t*)value, ROBOTRACONTEURLITE_DATATYPE_INT64, sizeof(int64_t));
 }
+
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_int64_view(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_int64* dest_array)
+{
+    struct robotraconteurlite_buffer view;
+    robotraconteurlite_status rv = -1;
+
+    view.data = (uint8_t*)dest_array->data;
+    view.len = dest_array->len;
+    rv = robotraconteurlite_messageelement_reader_read_data_view_ex(
+        element_reader, &view, ROBOTRACONTEURLITE_DATATYPE_INT64, sizeof(int64_t), sizeof(int64_t));
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    /* Alignment has been checked by read_data_view_ex */
+    /* cppcheck-suppress misra-c2012-11.3 */
+    dest_array->data = (int64_t*)view.data;
+    dest_array->len = view.len;
+    return rv;
+}
 /* uint64 */
 robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_uint64_array(
     struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_uint64* dest_array)
@@ -172,6 +373,28 @@ robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_uin
     return robotraconteurlite_messageelement_reader_read_data_scalar_ex(
         element_reader, (uint8_t*)value, ROBOTRACONTEURLITE_DATATYPE_UINT64, sizeof(uint64_t));
 }
+
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_uint64_view(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_uint64* dest_array)
+{
+    struct robotraconteurlite_buffer view;
+    robotraconteurlite_status rv = -1;
+
+    view.data = (uint8_t*)dest_array->data;
+    view.len = dest_array->len;
+    rv = robotraconteurlite_messageelement_reader_read_data_view_ex(
+        element_reader, &view, ROBOTRACONTEURLITE_DATATYPE_UINT64, sizeof(uint64_t), sizeof(uint64_t));
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    /* Alignment has been checked by read_data_view_ex */
+    /* cppcheck-suppress misra-c2012-11.3 */
+    dest_array->data = (uint64_t*)view.data;
+    dest_array->len = view.len;
+    return rv;
+}
 /* cdouble */
 robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_cdouble_array(
     struct robotraconteurlite_messageelement_reader* element_reader,
@@ -189,6 +412,31 @@ robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_cdo
                                                                         ROBOTRACONTEURLITE_DATATYPE_CDOUBLE,
                                                                         sizeof(struct robotraconteurlite_cdouble));
 }
+
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_cdouble_view(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_array_cdouble* dest_array)
+{
+    struct robotraconteurlite_buffer view;
+    robotraconteurlite_status rv = -1;
+
+    view.data = (uint8_t*)dest_array->data;
+    view.len = dest_array->len;
+    rv = robotraconteurlite_messageelement_reader_read_data_view_ex(element_reader, &view,
+                                                                    ROBOTRACONTEURLITE_DATATYPE_CDOUBLE,
+                                                                    sizeof(struct robotraconteurlite_cdouble),
+                                                                    sizeof(double));
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    /* Alignment has been checked by read_data_view_ex */
+    /* cppcheck-suppress misra-c2012-11.3 */
+    dest_array->data = (struct robotraconteurlite_cdouble*)view.data;
+    dest_array->len = view.len;
+    return rv;
+}
 /* csingle */
 robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_csingle_array(
     struct robotraconteurlite_messageelement_reader* element_reader,
@@ -206,6 +454,31 @@ robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_csi
                                                                         ROBOTRACONTEURLITE_DATATYPE_CSINGLE,
                                                                         sizeof(struct robotraconteurlite_csingle));
 }
+
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_csingle_view(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_array_csingle* dest_array)
+{
+    struct robotraconteurlite_buffer view;
+    robotraconteurlite_status rv = -1;
+
+    view.data = (uint8_t*)dest_array->data;
+    view.len = dest_array->len;
+    rv = robotraconteurlite_messageelement_reader_read_data_view_ex(element_reader, &view,
+                                                                    ROBOTRACONTEURLITE_DATATYPE_CSINGLE,
+                                                                    sizeof(struct robotraconteurlite_csingle),
+                                                                    sizeof(float));
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    /* Alignment has been checked by read_data_view_ex */
+    /* cppcheck-suppress misra-c2012-11.3 */
+    dest_array->data = (struct robotraconteurlite_csingle*)view.data;
+    dest_array->len = view.len;
+    return rv;
+}
 /* bool */
 robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_bool_array(
     struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_bool* dest_array)
@@ -222,6 +495,192 @@ robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_boo
         element_reader, (uint8_t*)value, ROBOTRACONTEURLITE_DATATYPE_BOOL, sizeof(struct robotraconteurlite_bool));
 }
 
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_bool_view(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_bool* dest_array)
+{
+    struct robotraconteurlite_buffer view;
+    robotraconteurlite_status rv = -1;
+
+    view.data = (uint8_t*)dest_array->data;
+    view.len = dest_array->len;
+    rv = robotraconteurlite_messageelement_reader_read_data_view_ex(
+        element_reader, &view, ROBOTRACONTEURLITE_DATATYPE_BOOL, sizeof(struct robotraconteurlite_bool), 1);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    /* Alignment has been checked by read_data_view_ex */
+    /* cppcheck-suppress misra-c2012-11.3 */
+    dest_array->data = (struct robotraconteurlite_bool*)view.data;
+    dest_array->len = view.len;
+    return rv;
+}
+
+/* strided */
+/* double */
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_double_strided(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_double* dest,
+    size_t dest_stride, size_t source_offset, size_t count)
+{
+    assert(dest != NULL);
+
+    return robotraconteurlite_messageelement_reader_read_data_strided_ex(
+        element_reader,
+        /* cppcheck-suppress invalidPointerCast */
+        (uint8_t*)dest->data, dest->len * sizeof(double), dest_stride * sizeof(double), source_offset, count,
+        ROBOTRACONTEURLITE_DATATYPE_DOUBLE, sizeof(double));
+}
+
+/* single */
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_single_strided(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_single* dest,
+    size_t dest_stride, size_t source_offset, size_t count)
+{
+    assert(dest != NULL);
+
+    return robotraconteurlite_messageelement_reader_read_data_strided_ex(
+        element_reader,
+        /* cppcheck-suppress invalidPointerCast */
+        (uint8_t*)dest->data, dest->len * sizeof(float), dest_stride * sizeof(float), source_offset, count,
+        ROBOTRACONTEURLITE_DATATYPE_SINGLE, sizeof(float));
+}
+
+/* int8 */
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_int8_strided(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_int8* dest,
+    size_t dest_stride, size_t source_offset, size_t count)
+{
+    assert(dest != NULL);
+
+    return robotraconteurlite_messageelement_reader_read_data_strided_ex(
+        element_reader, (uint8_t*)dest->data, dest->len * sizeof(int8_t), dest_stride * sizeof(int8_t), source_offset,
+        count, ROBOTRACONTEURLITE_DATATYPE_INT8, sizeof(int8_t));
+}
+
+/* uint8 */
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_uint8_strided(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_uint8* dest,
+    size_t dest_stride, size_t source_offset, size_t count)
+{
+    assert(dest != NULL);
+
+    return robotraconteurlite_messageelement_reader_read_data_strided_ex(
+        element_reader, (uint8_t*)dest->data, dest->len * sizeof(uint8_t), dest_stride * sizeof(uint8_t), source_offset,
+        count, ROBOTRACONTEURLITE_DATATYPE_UINT8, sizeof(uint8_t));
+}
+
+/* int16 */
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_int16_strided(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_int16* dest,
+    size_t dest_stride, size_t source_offset, size_t count)
+{
+    assert(dest != NULL);
+
+    return robotraconteurlite_messageelement_reader_read_data_strided_ex(
+        element_reader, (uint8_t*)dest->data, dest->len * sizeof(int16_t), dest_stride * sizeof(int16_t), source_offset,
+        count, ROBOTRACONTEURLITE_DATATYPE_INT16, sizeof(int16_t));
+}
+
+/* uint16 */
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_uint16_strided(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_uint16* dest,
+    size_t dest_stride, size_t source_offset, size_t count)
+{
+    assert(dest != NULL);
+
+    return robotraconteurlite_messageelement_reader_read_data_strided_ex(
+        element_reader, (uint8_t*)dest->data, dest->len * sizeof(uint16_t), dest_stride * sizeof(uint16_t),
+        source_offset, count, ROBOTRACONTEURLITE_DATATYPE_UINT16, sizeof(uint16_t));
+}
+
+/* int32 */
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_int32_strided(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_int32* dest,
+    size_t dest_stride, size_t source_offset, size_t count)
+{
+    assert(dest != NULL);
+
+    return robotraconteurlite_messageelement_reader_read_data_strided_ex(
+        element_reader, (uint8_t*)dest->data, dest->len * sizeof(int32_t), dest_stride * sizeof(int32_t), source_offset,
+        count, ROBOTRACONTEURLITE_DATATYPE_INT32, sizeof(int32_t));
+}
+
+/* uint32 */
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_uint32_strided(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_uint32* dest,
+    size_t dest_stride, size_t source_offset, size_t count)
+{
+    assert(dest != NULL);
+
+    return robotraconteurlite_messageelement_reader_read_data_strided_ex(
+        element_reader, (uint8_t*)dest->data, dest->len * sizeof(uint32_t), dest_stride * sizeof(uint32_t),
+        source_offset, count, ROBOTRACONTEURLITE_DATATYPE_UINT32, sizeof(uint32_t));
+}
+
+/* int64 */
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_int64_strided(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_int64* dest,
+    size_t dest_stride, size_t source_offset, size_t count)
+{
+    assert(dest != NULL);
+
+    return robotraconteurlite_messageelement_reader_read_data_strided_ex(
+        element_reader, (uint8_t*)dest->data, dest->len * sizeof(int64_t), dest_stride * sizeof(int64_t), source_offset,
+        count, ROBOTRACONTEURLITE_DATATYPE_INT64, sizeof(int64_t));
+}
+
+/* uint64 */
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_uint64_strided(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_uint64* dest,
+    size_t dest_stride, size_t source_offset, size_t count)
+{
+    assert(dest != NULL);
+
+    return robotraconteurlite_messageelement_reader_read_data_strided_ex(
+        element_reader, (uint8_t*)dest->data, dest->len * sizeof(uint64_t), dest_stride * sizeof(uint64_t),
+        source_offset, count, ROBOTRACONTEURLITE_DATATYPE_UINT64, sizeof(uint64_t));
+}
+
+/* cdouble */
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_cdouble_strided(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_cdouble* dest,
+    size_t dest_stride, size_t source_offset, size_t count)
+{
+    assert(dest != NULL);
+
+    return robotraconteurlite_messageelement_reader_read_data_strided_ex(
+        element_reader, (uint8_t*)dest->data, dest->len * sizeof(struct robotraconteurlite_cdouble),
+        dest_stride * sizeof(struct robotraconteurlite_cdouble), source_offset, count,
+        ROBOTRACONTEURLITE_DATATYPE_CDOUBLE, sizeof(struct robotraconteurlite_cdouble));
+}
+
+/* csingle */
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_csingle_strided(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_csingle* dest,
+    size_t dest_stride, size_t source_offset, size_t count)
+{
+    assert(dest != NULL);
+
+    return robotraconteurlite_messageelement_reader_read_data_strided_ex(
+        element_reader, (uint8_t*)dest->data, dest->len * sizeof(struct robotraconteurlite_csingle),
+        dest_stride * sizeof(struct robotraconteurlite_csingle), source_offset, count,
+        ROBOTRACONTEURLITE_DATATYPE_CSINGLE, sizeof(struct robotraconteurlite_csingle));
+}
+
+/* bool */
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_bool_strided(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_bool* dest,
+    size_t dest_stride, size_t source_offset, size_t count)
+{
+    assert(dest != NULL);
+
+    return robotraconteurlite_messageelement_reader_read_data_strided_ex(
+        element_reader, (uint8_t*)dest->data, dest->len * sizeof(struct robotraconteurlite_bool),
+        dest_stride * sizeof(struct robotraconteurlite_bool), source_offset, count, ROBOTRACONTEURLITE_DATATYPE_BOOL,
+        sizeof(struct robotraconteurlite_bool));
+}
+
 /* writers */
 /* double */
 robotraconteurlite_status robotraconteurlite_messageelement_writer_write_double(
@@ -500,20 +959,1232 @@ robotraconteurlite_status robotraconteurlite_messageelement_writer_write_bool_ar
                                                               sizeof(struct robotraconteurlite_bool));
 }
 
-/* string */
+/* reserve */
+/* double */
+robotraconteurlite_status robotraconteurlite_messageelement_writer_reserve_double_array(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name, size_t len, struct robotraconteurlite_array_double* array)
+{
+    struct robotraconteurlite_buffer reserved;
+    robotraconteurlite_status rv = -1;
 
-robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_string(
-    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_string* dest_str)
+    assert(array != NULL);
+
+    rv = robotraconteurlite_messageelement_writer_reserve_raw(element_writer, element_name, len,
+                                                              ROBOTRACONTEURLITE_DATATYPE_DOUBLE,
+                                                              sizeof(double), sizeof(double), &reserved);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    /* Alignment has been checked by reserve_raw */
+    /* cppcheck-suppress misra-c2012-11.3 */
+    array->data = (double*)reserved.data;
+    array->len = reserved.len;
+    return rv;
+}
+
+/* single */
+robotraconteurlite_status robotraconteurlite_messageelement_writer_reserve_single_array(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name, size_t len, struct robotraconteurlite_array_single* array)
 {
-    return robotraconteurlite_messageelement_reader_read_data_ex(
-        element_reader, (uint8_t*)dest_str->data, &dest_str->len, ROBOTRACONTEURLITE_DATATYPE_STRING, sizeof(char));
+    struct robotraconteurlite_buffer reserved;
+    robotraconteurlite_status rv = -1;
+
+    assert(array != NULL);
+
+    rv = robotraconteurlite_messageelement_writer_reserve_raw(
+        element_writer, element_name, len, ROBOTRACONTEURLITE_DATATYPE_SINGLE, sizeof(float), sizeof(float), &reserved);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    /* Alignment has been checked by reserve_raw */
+    /* cppcheck-suppress misra-c2012-11.3 */
+    array->data = (float*)reserved.data;
+    array->len = reserved.len;
+    return rv;
 }
 
-robotraconteurlite_status robotraconteurlite_messageelement_writer_write_data_string(
+/* int8 */
+robotraconteurlite_status robotraconteurlite_messageelement_writer_reserve_int8_array(
     struct robotraconteurlite_messageelement_writer* element_writer,
-    const struct robotraconteurlite_string* element_name, const struct robotraconteurlite_string* value)
+    const struct robotraconteurlite_string* element_name, size_t len, struct robotraconteurlite_array_int8* array)
 {
-    return robotraconteurlite_messageelement_writer_write_raw(element_writer, element_name, (const uint8_t*)value->data,
-                                                              value->len, ROBOTRACONTEURLITE_DATATYPE_STRING,
-                                                              sizeof(char));
+    struct robotraconteurlite_buffer reserved;
+    robotraconteurlite_status rv = -1;
+
+    assert(array != NULL);
+
+    rv = robotraconteurlite_messageelement_writer_reserve_raw(
+        element_writer, element_name, len, ROBOTRACONTEURLITE_DATATYPE_INT8, sizeof(int8_t), sizeof(int8_t), &reserved);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    /* Alignment has been checked by reserve_raw */
+    /* cppcheck-suppress misra-c2012-11.3 */
+    array->data = (int8_t*)reserved.data;
+    array->len = reserved.len;
+    return rv;
+}
+
+/* uint8 */
+robotraconteurlite_status robotraconteurlite_messageelement_writer_reserve_uint8_array(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name, size_t len, struct robotraconteurlite_array_uint8* array)
+{
+    struct robotraconteurlite_buffer reserved;
+    robotraconteurlite_status rv = -1;
+
+    assert(array != NULL);
+
+    rv = robotraconteurlite_messageelement_writer_reserve_raw(element_writer, element_name, len,
+                                                              ROBOTRACONTEURLITE_DATATYPE_UINT8,
+                                                              sizeof(uint8_t), sizeof(uint8_t), &reserved);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    /* Alignment has been checked by reserve_raw */
+    /* cppcheck-suppress misra-c2012-11.3 */
+    array->data = (uint8_t*)reserved.data;
+    array->len = reserved.len;
+    return rv;
+}
+
+/* int16 */
+robotraconteurlite_status robotraconteurlite_messageelement_writer_reserve_int16_array(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name, size_t len, struct robotraconteurlite_array_int16* array)
+{
+    struct robotraconteurlite_buffer reserved;
+    robotraconteurlite_status rv = -1;
+
+    assert(array != NULL);
+
+    rv = robotraconteurlite_messageelement_writer_reserve_raw(element_writer, element_name, len,
+                                                              ROBOTRACONTEURLITE_DATATYPE_INT16,
+                                                              sizeof(int16_t), sizeof(int16_t), &reserved);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    /* Alignment has been checked by reserve_raw */
+    /* cppcheck-suppress misra-c2012-11.3 */
+    array->data = (int16_t*)reserved.data;
+    array->len = reserved.len;
+    return rv;
+}
+
+/* uint16 */
+robotraconteurlite_status robotraconteurlite_messageelement_writer_reserve_uint16_array(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name, size_t len, struct robotraconteurlite_array_uint16* array)
+{
+    struct robotraconteurlite_buffer reserved;
+    robotraconteurlite_status rv = -1;
+
+    assert(array != NULL);
+
+    rv = robotraconteurlite_messageelement_writer_reserve_raw(element_writer, element_name, len,
+                                                              ROBOTRACONTEURLITE_DATATYPE_UINT16,
+                                                              sizeof(uint16_t), sizeof(uint16_t), &reserved);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    /* Alignment has been checked by reserve_raw */
+    /* cppcheck-suppress misra-c2012-11.3 */
+    array->data = (uint16_t*)reserved.data;
+    array->len = reserved.len;
+    return rv;
+}
+
+/* int32 */
+robotraconteurlite_status robotraconteurlite_messageelement_writer_reserve_int32_array(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name, size_t len, struct robotraconteurlite_array_int32* array)
+{
+    struct robotraconteurlite_buffer reserved;
+    robotraconteurlite_status rv = -1;
+
+    assert(array != NULL);
+
+    rv = robotraconteurlite_messageelement_writer_reserve_raw(element_writer, element_name, len,
+                                                              ROBOTRACONTEURLITE_DATATYPE_INT32,
+                                                              sizeof(int32_t), sizeof(int32_t), &reserved);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    /* Alignment has been checked by reserve_raw */
+    /* cppcheck-suppress misra-c2012-11.3 */
+    array->data = (int32_t*)reserved.data;
+    array->len = reserved.len;
+    return rv;
+}
+
+/* uint32 */
+robotraconteurlite_status robotraconteurlite_messageelement_writer_reserve_uint32_array(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name, size_t len, struct robotraconteurlite_array_uint32* array)
+{
+    struct robotraconteurlite_buffer reserved;
+    robotraconteurlite_status rv = -1;
+
+    assert(array != NULL);
+
+    rv = robotraconteurlite_messageelement_writer_reserve_raw(element_writer, element_name, len,
+                                                              ROBOTRACONTEURLITE_DATATYPE_UINT32,
+                                                              sizeof(uint32_t), sizeof(uint32_t), &reserved);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    /* Alignment has been checked by reserve_raw */
+    /* cppcheck-suppress misra-c2012-11.3 */
+    array->data = (uint32_t*)reserved.data;
+    array->len = reserved.len;
+    return rv;
+}
+
+/* int64 */
+robotraconteurlite_status robotraconteurlite_messageelement_writer_reserve_int64_array(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name, size_t len, struct robotraconteurlite_array_int64* array)
+{
+    struct robotraconteurlite_buffer reserved;
+    robotraconteurlite_status rv = -1;
+
+    assert(array != NULL);
+
+    rv = robotraconteurlite_messageelement_writer_reserve_raw(element_writer, element_name, len,
+                                                              ROBOTRACONTEURLITE_DATATYPE_INT64,
+                                                              sizeof(int64_t), sizeof(int64_t), &reserved);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    /* Alignment has been checked by reserve_raw */
+    /* cppcheck-suppress misra-c2012-11.3 */
+    array->data = (int64_t*)reserved.data;
+    array->len = reserved.len;
+    return rv;
+}
+
+/* uint64 */
+robotraconteurlite_status robotraconteurlite_messageelement_writer_reserve_uint64_array(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name, size_t len, struct robotraconteurlite_array_uint64* array)
+{
+    struct robotraconteurlite_buffer reserved;
+    robotraconteurlite_status rv = -1;
+
+    assert(array != NULL);
+
+    rv = robotraconteurlite_messageelement_writer_reserve_raw(element_writer, element_name, len,
+                                                              ROBOTRACONTEURLITE_DATATYPE_UINT64,
+                                                              sizeof(uint64_t), sizeof(uint64_t), &reserved);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    /* Alignment has been checked by reserve_raw */
+    /* cppcheck-suppress misra-c2012-11.3 */
+    array->data = (uint64_t*)reserved.data;
+    array->len = reserved.len;
+    return rv;
+}
+
+/* cdouble */
+robotraconteurlite_status robotraconteurlite_messageelement_writer_reserve_cdouble_array(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name, size_t len, struct robotraconteurlite_array_cdouble* array)
+{
+    struct robotraconteurlite_buffer reserved;
+    robotraconteurlite_status rv = -1;
+
+    assert(array != NULL);
+
+    rv = robotraconteurlite_messageelement_writer_reserve_raw(element_writer, element_name, len,
+                                                              ROBOTRACONTEURLITE_DATATYPE_CDOUBLE,
+                                                              sizeof(struct robotraconteurlite_cdouble),
+                                                              sizeof(double), &reserved);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    /* Alignment has been checked by reserve_raw */
+    /* cppcheck-suppress misra-c2012-11.3 */
+    array->data = (struct robotraconteurlite_cdouble*)reserved.data;
+    array->len = reserved.len;
+    return rv;
+}
+
+/* csingle */
+robotraconteurlite_status robotraconteurlite_messageelement_writer_reserve_csingle_array(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name, size_t len, struct robotraconteurlite_array_csingle* array)
+{
+    struct robotraconteurlite_buffer reserved;
+    robotraconteurlite_status rv = -1;
+
+    assert(array != NULL);
+
+    rv = robotraconteurlite_messageelement_writer_reserve_raw(element_writer, element_name, len,
+                                                              ROBOTRACONTEURLITE_DATATYPE_CSINGLE,
+                                                              sizeof(struct robotraconteurlite_csingle),
+                                                              sizeof(float), &reserved);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    /* Alignment has been checked by reserve_raw */
+    /* cppcheck-suppress misra-c2012-11.3 */
+    array->data = (struct robotraconteurlite_csingle*)reserved.data;
+    array->len = reserved.len;
+    return rv;
+}
+
+/* bool */
+robotraconteurlite_status robotraconteurlite_messageelement_writer_reserve_bool_array(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name, size_t len, struct robotraconteurlite_array_bool* array)
+{
+    struct robotraconteurlite_buffer reserved;
+    robotraconteurlite_status rv = -1;
+
+    assert(array != NULL);
+
+    rv = robotraconteurlite_messageelement_writer_reserve_raw(element_writer, element_name, len,
+                                                              ROBOTRACONTEURLITE_DATATYPE_BOOL,
+                                                              sizeof(struct robotraconteurlite_bool),
+                                                              1, &reserved);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    /* Alignment has been checked by reserve_raw */
+    /* cppcheck-suppress misra-c2012-11.3 */
+    array->data = (struct robotraconteurlite_bool*)reserved.data;
+    array->len = reserved.len;
+    return rv;
+}
+
+/* complex split */
+/* cdouble */
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_cdouble_array_split(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_double* real,
+    struct robotraconteurlite_array_double* imag)
+{
+    size_t len = 0;
+    robotraconteurlite_status rv = -1;
+
+    assert(real != NULL);
+    assert(imag != NULL);
+
+    len = (real->len < imag->len) ? real->len : imag->len;
+    rv = robotraconteurlite_messageelement_reader_read_data_split_ex(element_reader,
+                                                                     /* cppcheck-suppress invalidPointerCast */
+                                                                     (uint8_t*)real->data,
+                                                                     /* cppcheck-suppress invalidPointerCast */
+                                                                     (uint8_t*)imag->data, &len,
+                                                                     ROBOTRACONTEURLITE_DATATYPE_CDOUBLE,
+                                                                     sizeof(struct robotraconteurlite_cdouble));
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    real->len = len;
+    imag->len = len;
+    return rv;
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_writer_write_cdouble_array_split(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name, const struct robotraconteurlite_array_double* real,
+    const struct robotraconteurlite_array_double* imag)
+{
+    assert(real != NULL);
+    assert(imag != NULL);
+
+    if (real->len != imag->len)
+    {
+        return ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER;
+    }
+
+    return robotraconteurlite_messageelement_writer_write_split_ex(element_writer, element_name,
+                                                                   /* cppcheck-suppress invalidPointerCast */
+                                                                   (const uint8_t*)real->data,
+                                                                   /* cppcheck-suppress invalidPointerCast */
+                                                                   (const uint8_t*)imag->data, real->len,
+                                                                   ROBOTRACONTEURLITE_DATATYPE_CDOUBLE,
+                                                                   sizeof(struct robotraconteurlite_cdouble));
+}
+
+/* csingle */
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_csingle_array_split(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_array_single* real,
+    struct robotraconteurlite_array_single* imag)
+{
+    size_t len = 0;
+    robotraconteurlite_status rv = -1;
+
+    assert(real != NULL);
+    assert(imag != NULL);
+
+    len = (real->len < imag->len) ? real->len : imag->len;
+    rv = robotraconteurlite_messageelement_reader_read_data_split_ex(element_reader,
+                                                                     /* cppcheck-suppress invalidPointerCast */
+                                                                     (uint8_t*)real->data,
+                                                                     /* cppcheck-suppress invalidPointerCast */
+                                                                     (uint8_t*)imag->data, &len,
+                                                                     ROBOTRACONTEURLITE_DATATYPE_CSINGLE,
+                                                                     sizeof(struct robotraconteurlite_csingle));
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    real->len = len;
+    imag->len = len;
+    return rv;
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_writer_write_csingle_array_split(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name, const struct robotraconteurlite_array_single* real,
+    const struct robotraconteurlite_array_single* imag)
+{
+    assert(real != NULL);
+    assert(imag != NULL);
+
+    if (real->len != imag->len)
+    {
+        return ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER;
+    }
+
+    return robotraconteurlite_messageelement_writer_write_split_ex(element_writer, element_name,
+                                                                   /* cppcheck-suppress invalidPointerCast */
+                                                                   (const uint8_t*)real->data,
+                                                                   /* cppcheck-suppress invalidPointerCast */
+                                                                   (const uint8_t*)imag->data, real->len,
+                                                                   ROBOTRACONTEURLITE_DATATYPE_CSINGLE,
+                                                                   sizeof(struct robotraconteurlite_csingle));
+}
+
+/* sizes */
+/* double */
+robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_double(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t* element_size)
+{
+    return robotraconteurlite_messageelement_writer_size_of_raw(message_version, element_name, 1U, sizeof(double),
+                                                                element_size);
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_double_array(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t len, size_t* element_size)
+{
+    return robotraconteurlite_messageelement_writer_size_of_raw(message_version, element_name, len, sizeof(double),
+                                                                element_size);
+}
+/* single */
+robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_single(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t* element_size)
+{
+    return robotraconteurlite_messageelement_writer_size_of_raw(message_version, element_name, 1U, sizeof(float),
+                                                                element_size);
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_single_array(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t len, size_t* element_size)
+{
+    return robotraconteurlite_messageelement_writer_size_of_raw(message_version, element_name, len, sizeof(float),
+                                                                element_size);
+}
+/* int8 */
+robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_int8(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t* element_size)
+{
+    return robotraconteurlite_messageelement_writer_size_of_raw(message_version, element_name, 1U, sizeof(int8_t),
+                                                                element_size);
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_int8_array(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t len, size_t* element_size)
+{
+    return robotraconteurlite_messageelement_writer_size_of_raw(message_version, element_name, len, sizeof(int8_t),
+                                                                element_size);
+}
+/* uint8 */
+robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_uint8(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t* element_size)
+{
+    return robotraconteurlite_messageelement_writer_size_of_raw(message_version, element_name, 1U, sizeof(uint8_t),
+                                                                element_size);
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_uint8_array(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t len, size_t* element_size)
+{
+    return robotraconteurlite_messageelement_writer_size_of_raw(message_version, element_name, len, sizeof(uint8_t),
+                                                                element_size);
+}
+/* int16 */
+robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_int16(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t* element_size)
+{
+    return robotraconteurlite_messageelement_writer_size_of_raw(message_version, element_name, 1U, sizeof(int16_t),
+                                                                element_size);
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_int16_array(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t len, size_t* element_size)
+{
+    return robotraconteurlite_messageelement_writer_size_of_raw(message_version, element_name, len, sizeof(int16_t),
+                                                                element_size);
+}
+/* uint16 */
+robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_uint16(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t* element_size)
+{
+    return robotraconteurlite_messageelement_writer_size_of_raw(message_version, element_name, 1U, sizeof(uint16_t),
+                                                                element_size);
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_uint16_array(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t len, size_t* element_size)
+{
+    return robotraconteurlite_messageelement_writer_size_of_raw(message_version, element_name, len, sizeof(uint16_t),
+                                                                element_size);
+}
+/* int32 */
+robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_int32(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t* element_size)
+{
+    return robotraconteurlite_messageelement_writer_size_of_raw(message_version, element_name, 1U, sizeof(int32_t),
+                                                                element_size);
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_int32_array(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t len, size_t* element_size)
+{
+    return robotraconteurlite_messageelement_writer_size_of_raw(message_version, element_name, len, sizeof(int32_t),
+                                                                element_size);
+}
+/* uint32 */
+robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_uint32(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t* element_size)
+{
+    return robotraconteurlite_messageelement_writer_size_of_raw(message_version, element_name, 1U, sizeof(uint32_t),
+                                                                element_size);
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_uint32_array(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t len, size_t* element_size)
+{
+    return robotraconteurlite_messageelement_writer_size_of_raw(message_version, element_name, len, sizeof(uint32_t),
+                                                                element_size);
+}
+/* int64 */
+robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_int64(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t* element_size)
+{
+    return robotraconteurlite_messageelement_writer_size_of_raw(message_version, element_name, 1U, sizeof(int64_t),
+                                                                element_size);
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_int64_array(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t len, size_t* element_size)
+{
+    return robotraconteurlite_messageelement_writer_size_of_raw(message_version, element_name, len, sizeof(int64_t),
+                                                                element_size);
+}
+/* uint64 */
+robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_uint64(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t* element_size)
+{
+    return robotraconteurlite_messageelement_writer_size_of_raw(message_version, element_name, 1U, sizeof(uint64_t),
+                                                                element_size);
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_uint64_array(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t len, size_t* element_size)
+{
+    return robotraconteurlite_messageelement_writer_size_of_raw(message_version, element_name, len, sizeof(uint64_t),
+                                                                element_size);
+}
+/* cdouble */
+robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_cdouble(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t* element_size)
+{
+    return robotraconteurlite_messageelement_writer_size_of_raw(message_version, element_name, 1U,
+                                                                sizeof(struct robotraconteurlite_cdouble),
+                                                                element_size);
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_cdouble_array(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t len, size_t* element_size)
+{
+    return robotraconteurlite_messageelement_writer_size_of_raw(message_version, element_name, len,
+                                                                sizeof(struct robotraconteurlite_cdouble),
+                                                                element_size);
+}
+/* csingle */
+robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_csingle(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t* element_size)
+{
+    return robotraconteurlite_messageelement_writer_size_of_raw(message_version, element_name, 1U,
+                                                                sizeof(struct robotraconteurlite_csingle),
+                                                                element_size);
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_csingle_array(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t len, size_t* element_size)
+{
+    return robotraconteurlite_messageelement_writer_size_of_raw(message_version, element_name, len,
+                                                                sizeof(struct robotraconteurlite_csingle),
+                                                                element_size);
+}
+/* bool */
+robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_bool(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t* element_size)
+{
+    return robotraconteurlite_messageelement_writer_size_of_raw(message_version, element_name, 1U,
+                                                                sizeof(struct robotraconteurlite_bool), element_size);
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_bool_array(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name, size_t len, size_t* element_size)
+{
+    return robotraconteurlite_messageelement_writer_size_of_raw(message_version, element_name, len,
+                                                                sizeof(struct robotraconteurlite_bool), element_size);
+}
+
+/* string */
+
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_data_string(
+    struct robotraconteurlite_messageelement_reader* element_reader, struct robotraconteurlite_string* dest_str)
+{
+    return robotraconteurlite_messageelement_reader_read_data_ex(
+        element_reader, (uint8_t*)dest_str->data, &dest_str->len, ROBOTRACONTEURLITE_DATATYPE_STRING, sizeof(char));
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_writer_write_data_string(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name, const struct robotraconteurlite_string* value)
+{
+    return robotraconteurlite_messageelement_writer_write_raw(element_writer, element_name, (const uint8_t*)value->data,
+                                                              value->len, ROBOTRACONTEURLITE_DATATYPE_STRING,
+                                                              sizeof(char));
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_writer_size_of_data_string(
+    uint16_t message_version, const struct robotraconteurlite_string* element_name,
+    const struct robotraconteurlite_string* value, size_t* element_size)
+{
+    return robotraconteurlite_messageelement_writer_size_of_raw(message_version, element_name, value->len, sizeof(char),
+                                                                element_size);
+}
+
+/* multidimarrays */
+/* double */
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_double(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_double* dest_array)
+{
+    return robotraconteurlite_messageelement_reader_read_multidimarray_ex(
+        element_reader, &dest_array->dims,
+        /* cppcheck-suppress invalidPointerCast */
+        (uint8_t*)dest_array->array.data, &dest_array->array.len,
+        ROBOTRACONTEURLITE_DATATYPE_DOUBLE, sizeof(double));
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_double_view(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_double* dest_array)
+{
+    struct robotraconteurlite_buffer view;
+    robotraconteurlite_status rv = -1;
+
+    /* cppcheck-suppress invalidPointerCast */
+    view.data = (uint8_t*)dest_array->array.data;
+    view.len = dest_array->array.len;
+    rv = robotraconteurlite_messageelement_reader_read_multidimarray_view_ex(
+        element_reader, &dest_array->dims, &view, ROBOTRACONTEURLITE_DATATYPE_DOUBLE, sizeof(double), sizeof(double));
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    /* Alignment has been checked by read_data_view_ex */
+    /* cppcheck-suppress misra-c2012-11.3 */
+    dest_array->array.data = (double*)view.data;
+    dest_array->array.len = view.len;
+    return rv;
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_writer_write_multidimarray_double(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name,
+    const struct robotraconteurlite_multidimarray_double* value)
+{
+    return robotraconteurlite_messageelement_writer_write_multidimarray_ex(
+        element_writer, element_name, &value->dims,
+        /* cppcheck-suppress invalidPointerCast */
+        (const uint8_t*)value->array.data, value->array.len,
+        ROBOTRACONTEURLITE_DATATYPE_DOUBLE, sizeof(double));
+}
+/* single */
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_single(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_single* dest_array)
+{
+    return robotraconteurlite_messageelement_reader_read_multidimarray_ex(
+        element_reader, &dest_array->dims,
+        /* cppcheck-suppress invalidPointerCast */
+        (uint8_t*)dest_array->array.data, &dest_array->array.len,
+        ROBOTRACONTEURLITE_DATATYPE_SINGLE, sizeof(float));
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_single_view(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_single* dest_array)
+{
+    struct robotraconteurlite_buffer view;
+    robotraconteurlite_status rv = -1;
+
+    /* cppcheck-suppress invalidPointerCast */
+    view.data = (uint8_t*)dest_array->array.data;
+    view.len = dest_array->array.len;
+    rv = robotraconteurlite_messageelement_reader_read_multidimarray_view_ex(
+        element_reader, &dest_array->dims, &view, ROBOTRACONTEURLITE_DATATYPE_SINGLE, sizeof(float), sizeof(float));
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    /* Alignment has been checked by read_data_view_ex */
+    /* cppcheck-suppress misra-c2012-11.3 */
+    dest_array->array.data = (float*)view.data;
+    dest_array->array.len = view.len;
+    return rv;
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_writer_write_multidimarray_single(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name,
+    const struct robotraconteurlite_multidimarray_single* value)
+{
+    return robotraconteurlite_messageelement_writer_write_multidimarray_ex(
+        element_writer, element_name, &value->dims,
+        /* cppcheck-suppress invalidPointerCast */
+        (const uint8_t*)value->array.data, value->array.len,
+        ROBOTRACONTEURLITE_DATATYPE_SINGLE, sizeof(float));
+}
+/* int8 */
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_int8(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_int8* dest_array)
+{
+    return robotraconteurlite_messageelement_reader_read_multidimarray_ex(
+        element_reader, &dest_array->dims,
+        (uint8_t*)dest_array->array.data, &dest_array->array.len,
+        ROBOTRACONTEURLITE_DATATYPE_INT8, sizeof(int8_t));
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_int8_view(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_int8* dest_array)
+{
+    struct robotraconteurlite_buffer view;
+    robotraconteurlite_status rv = -1;
+
+    view.data = (uint8_t*)dest_array->array.data;
+    view.len = dest_array->array.len;
+    rv = robotraconteurlite_messageelement_reader_read_multidimarray_view_ex(
+        element_reader, &dest_array->dims, &view, ROBOTRACONTEURLITE_DATATYPE_INT8, sizeof(int8_t), sizeof(int8_t));
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    /* Alignment has been checked by read_data_view_ex */
+    /* cppcheck-suppress misra-c2012-11.3 */
+    dest_array->array.data = (int8_t*)view.data;
+    dest_array->array.len = view.len;
+    return rv;
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_writer_write_multidimarray_int8(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name,
+    const struct robotraconteurlite_multidimarray_int8* value)
+{
+    return robotraconteurlite_messageelement_writer_write_multidimarray_ex(
+        element_writer, element_name, &value->dims,
+        (const uint8_t*)value->array.data, value->array.len,
+        ROBOTRACONTEURLITE_DATATYPE_INT8, sizeof(int8_t));
+}
+/* uint8 */
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_uint8(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_uint8* dest_array)
+{
+    return robotraconteurlite_messageelement_reader_read_multidimarray_ex(
+        element_reader, &dest_array->dims,
+        (uint8_t*)dest_array->array.data, &dest_array->array.len,
+        ROBOTRACONTEURLITE_DATATYPE_UINT8, sizeof(uint8_t));
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_uint8_view(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_uint8* dest_array)
+{
+    struct robotraconteurlite_buffer view;
+    robotraconteurlite_status rv = -1;
+
+    view.data = (uint8_t*)dest_array->array.data;
+    view.len = dest_array->array.len;
+    rv = robotraconteurlite_messageelement_reader_read_multidimarray_view_ex(
+        element_reader, &dest_array->dims, &view, ROBOTRACONTEURLITE_DATATYPE_UINT8, sizeof(uint8_t), sizeof(uint8_t));
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    /* Alignment has been checked by read_data_view_ex */
+    /* cppcheck-suppress misra-c2012-11.3 */
+    dest_array->array.data = (uint8_t*)view.data;
+    dest_array->array.len = view.len;
+    return rv;
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_writer_write_multidimarray_uint8(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name,
+    const struct robotraconteurlite_multidimarray_uint8* value)
+{
+    return robotraconteurlite_messageelement_writer_write_multidimarray_ex(
+        element_writer, element_name, &value->dims,
+        (const uint8_t*)value->array.data, value->array.len,
+        ROBOTRACONTEURLITE_DATATYPE_UINT8, sizeof(uint8_t));
+}
+/* int16 */
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_int16(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_int16* dest_array)
+{
+    return robotraconteurlite_messageelement_reader_read_multidimarray_ex(
+        element_reader, &dest_array->dims,
+        (uint8_t*)dest_array->array.data, &dest_array->array.len,
+        ROBOTRACONTEURLITE_DATATYPE_INT16, sizeof(int16_t));
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_int16_view(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_int16* dest_array)
+{
+    struct robotraconteurlite_buffer view;
+    robotraconteurlite_status rv = -1;
+
+    view.data = (uint8_t*)dest_array->array.data;
+    view.len = dest_array->array.len;
+    rv = robotraconteurlite_messageelement_reader_read_multidimarray_view_ex(
+        element_reader, &dest_array->dims, &view, ROBOTRACONTEURLITE_DATATYPE_INT16, sizeof(int16_t), sizeof(int16_t));
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    /* Alignment has been checked by read_data_view_ex */
+    /* cppcheck-suppress misra-c2012-11.3 */
+    dest_array->array.data = (int16_t*)view.data;
+    dest_array->array.len = view.len;
+    return rv;
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_writer_write_multidimarray_int16(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name,
+    const struct robotraconteurlite_multidimarray_int16* value)
+{
+    return robotraconteurlite_messageelement_writer_write_multidimarray_ex(
+        element_writer, element_name, &value->dims,
+        (const uint8_t*)value->array.data, value->array.len,
+        ROBOTRACONTEURLITE_DATATYPE_INT16, sizeof(int16_t));
+}
+/* uint16 */
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_uint16(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_uint16* dest_array)
+{
+    return robotraconteurlite_messageelement_reader_read_multidimarray_ex(
+        element_reader, &dest_array->dims,
+        (uint8_t*)dest_array->array.data, &dest_array->array.len,
+        ROBOTRACONTEURLITE_DATATYPE_UINT16, sizeof(uint16_t));
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_uint16_view(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_uint16* dest_array)
+{
+    struct robotraconteurlite_buffer view;
+    robotraconteurlite_status rv = -1;
+
+    view.data = (uint8_t*)dest_array->array.data;
+    view.len = dest_array->array.len;
+    rv = robotraconteurlite_messageelement_reader_read_multidimarray_view_ex(
+        element_reader, &dest_array->dims, &view, ROBOTRACONTEURLITE_DATATYPE_UINT16, sizeof(uint16_t),
+        sizeof(uint16_t));
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    /* Alignment has been checked by read_data_view_ex */
+    /* cppcheck-suppress misra-c2012-11.3 */
+    dest_array->array.data = (uint16_t*)view.data;
+    dest_array->array.len = view.len;
+    return rv;
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_writer_write_multidimarray_uint16(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name,
+    const struct robotraconteurlite_multidimarray_uint16* value)
+{
+    return robotraconteurlite_messageelement_writer_write_multidimarray_ex(
+        element_writer, element_name, &value->dims,
+        (const uint8_t*)value->array.data, value->array.len,
+        ROBOTRACONTEURLITE_DATATYPE_UINT16, sizeof(uint16_t));
+}
+/* int32 */
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_int32(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_int32* dest_array)
+{
+    return robotraconteurlite_messageelement_reader_read_multidimarray_ex(
+        element_reader, &dest_array->dims,
+        (uint8_t*)dest_array->array.data, &dest_array->array.len,
+        ROBOTRACONTEURLITE_DATATYPE_INT32, sizeof(int32_t));
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_int32_view(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_int32* dest_array)
+{
+    struct robotraconteurlite_buffer view;
+    robotraconteurlite_status rv = -1;
+
+    view.data = (uint8_t*)dest_array->array.data;
+    view.len = dest_array->array.len;
+    rv = robotraconteurlite_messageelement_reader_read_multidimarray_view_ex(
+        element_reader, &dest_array->dims, &view, ROBOTRACONTEURLITE_DATATYPE_INT32, sizeof(int32_t), sizeof(int32_t));
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    /* Alignment has been checked by read_data_view_ex */
+    /* cppcheck-suppress misra-c2012-11.3 */
+    dest_array->array.data = (int32_t*)view.data;
+    dest_array->array.len = view.len;
+    return rv;
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_writer_write_multidimarray_int32(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name,
+    const struct robotraconteurlite_multidimarray_int32* value)
+{
+    return robotraconteurlite_messageelement_writer_write_multidimarray_ex(
+        element_writer, element_name, &value->dims,
+        (const uint8_t*)value->array.data, value->array.len,
+        ROBOTRACONTEURLITE_DATATYPE_INT32, sizeof(int32_t));
+}
+/* uint32 */
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_uint32(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_uint32* dest_array)
+{
+    return robotraconteurlite_messageelement_reader_read_multidimarray_ex(
+        element_reader, &dest_array->dims,
+        (uint8_t*)dest_array->array.data, &dest_array->array.len,
+        ROBOTRACONTEURLITE_DATATYPE_UINT32, sizeof(uint32_t));
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_uint32_view(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_uint32* dest_array)
+{
+    struct robotraconteurlite_buffer view;
+    robotraconteurlite_status rv = -1;
+
+    view.data = (uint8_t*)dest_array->array.data;
+    view.len = dest_array->array.len;
+    rv = robotraconteurlite_messageelement_reader_read_multidimarray_view_ex(
+        element_reader, &dest_array->dims, &view, ROBOTRACONTEURLITE_DATATYPE_UINT32, sizeof(uint32_t),
+        sizeof(uint32_t));
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    /* Alignment has been checked by read_data_view_ex */
+    /* cppcheck-suppress misra-c2012-11.3 */
+    dest_array->array.data = (uint32_t*)view.data;
+    dest_array->array.len = view.len;
+    return rv;
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_writer_write_multidimarray_uint32(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name,
+    const struct robotraconteurlite_multidimarray_uint32* value)
+{
+    return robotraconteurlite_messageelement_writer_write_multidimarray_ex(
+        element_writer, element_name, &value->dims,
+        (const uint8_t*)value->array.data, value->array.len,
+        ROBOTRACONTEURLITE_DATATYPE_UINT32, sizeof(uint32_t));
+}
+/* int64 */
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_int64(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_int64* dest_array)
+{
+    return robotraconteurlite_messageelement_reader_read_multidimarray_ex(
+        element_reader, &dest_array->dims,
+        (uint8_t*)dest_array->array.data, &dest_array->array.len,
+        ROBOTRACONTEURLITE_DATATYPE_INT64, sizeof(int64_t));
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_int64_view(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_int64* dest_array)
+{
+    struct robotraconteurlite_buffer view;
+    robotraconteurlite_status rv = -1;
+
+    view.data = (uint8_t*)dest_array->array.data;
+    view.len = dest_array->array.len;
+    rv = robotraconteurlite_messageelement_reader_read_multidimarray_view_ex(
+        element_reader, &dest_array->dims, &view, ROBOTRACONTEURLITE_DATATYPE_INT64, sizeof(int64_t), sizeof(int64_t));
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    /* Alignment has been checked by read_data_view_ex */
+    /* cppcheck-suppress misra-c2012-11.3 */
+    dest_array->array.data = (int64_t*)view.data;
+    dest_array->array.len = view.len;
+    return rv;
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_writer_write_multidimarray_int64(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name,
+    const struct robotraconteurlite_multidimarray_int64* value)
+{
+    return robotraconteurlite_messageelement_writer_write_multidimarray_ex(
+        element_writer, element_name, &value->dims,
+        (const uint8_t*)value->array.data, value->array.len,
+        ROBOTRACONTEURLITE_DATATYPE_INT64, sizeof(int64_t));
+}
+/* uint64 */
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_uint64(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_uint64* dest_array)
+{
+    return robotraconteurlite_messageelement_reader_read_multidimarray_ex(
+        element_reader, &dest_array->dims,
+        (uint8_t*)dest_array->array.data, &dest_array->array.len,
+        ROBOTRACONTEURLITE_DATATYPE_UINT64, sizeof(uint64_t));
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_uint64_view(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_uint64* dest_array)
+{
+    struct robotraconteurlite_buffer view;
+    robotraconteurlite_status rv = -1;
+
+    view.data = (uint8_t*)dest_array->array.data;
+    view.len = dest_array->array.len;
+    rv = robotraconteurlite_messageelement_reader_read_multidimarray_view_ex(
+        element_reader, &dest_array->dims, &view, ROBOTRACONTEURLITE_DATATYPE_UINT64, sizeof(uint64_t),
+        sizeof(uint64_t));
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    /* Alignment has been checked by read_data_view_ex */
+    /* cppcheck-suppress misra-c2012-11.3 */
+    dest_array->array.data = (uint64_t*)view.data;
+    dest_array->array.len = view.len;
+    return rv;
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_writer_write_multidimarray_uint64(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name,
+    const struct robotraconteurlite_multidimarray_uint64* value)
+{
+    return robotraconteurlite_messageelement_writer_write_multidimarray_ex(
+        element_writer, element_name, &value->dims,
+        (const uint8_t*)value->array.data, value->array.len,
+        ROBOTRACONTEURLITE_DATATYPE_UINT64, sizeof(uint64_t));
+}
+/* cdouble */
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_cdouble(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_cdouble* dest_array)
+{
+    return robotraconteurlite_messageelement_reader_read_multidimarray_ex(
+        element_reader, &dest_array->dims,
+        (uint8_t*)dest_array->array.data, &dest_array->array.len,
+        ROBOTRACONTEURLITE_DATATYPE_CDOUBLE, sizeof(struct robotraconteurlite_cdouble));
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_cdouble_view(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_cdouble* dest_array)
+{
+    struct robotraconteurlite_buffer view;
+    robotraconteurlite_status rv = -1;
+
+    view.data = (uint8_t*)dest_array->array.data;
+    view.len = dest_array->array.len;
+    rv = robotraconteurlite_messageelement_reader_read_multidimarray_view_ex(
+        element_reader, &dest_array->dims, &view, ROBOTRACONTEURLITE_DATATYPE_CDOUBLE,
+        sizeof(struct robotraconteurlite_cdouble), sizeof(double));
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    /* Alignment has been checked by read_data_view_ex */
+    /* cppcheck-suppress misra-c2012-11.3 */
+    dest_array->array.data = (struct robotraconteurlite_cdouble*)view.data;
+    dest_array->array.len = view.len;
+    return rv;
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_writer_write_multidimarray_cdouble(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name,
+    const struct robotraconteurlite_multidimarray_cdouble* value)
+{
+    return robotraconteurlite_messageelement_writer_write_multidimarray_ex(
+        element_writer, element_name, &value->dims,
+        (const uint8_t*)value->array.data, value->array.len,
+        ROBOTRACONTEURLITE_DATATYPE_CDOUBLE, sizeof(struct robotraconteurlite_cdouble));
+}
+/* csingle */
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_csingle(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_csingle* dest_array)
+{
+    return robotraconteurlite_messageelement_reader_read_multidimarray_ex(
+        element_reader, &dest_array->dims,
+        (uint8_t*)dest_array->array.data, &dest_array->array.len,
+        ROBOTRACONTEURLITE_DATATYPE_CSINGLE, sizeof(struct robotraconteurlite_csingle));
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_csingle_view(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_csingle* dest_array)
+{
+    struct robotraconteurlite_buffer view;
+    robotraconteurlite_status rv = -1;
+
+    view.data = (uint8_t*)dest_array->array.data;
+    view.len = dest_array->array.len;
+    rv = robotraconteurlite_messageelement_reader_read_multidimarray_view_ex(
+        element_reader, &dest_array->dims, &view, ROBOTRACONTEURLITE_DATATYPE_CSINGLE,
+        sizeof(struct robotraconteurlite_csingle), sizeof(float));
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    /* Alignment has been checked by read_data_view_ex */
+    /* cppcheck-suppress misra-c2012-11.3 */
+    dest_array->array.data = (struct robotraconteurlite_csingle*)view.data;
+    dest_array->array.len = view.len;
+    return rv;
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_writer_write_multidimarray_csingle(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name,
+    const struct robotraconteurlite_multidimarray_csingle* value)
+{
+    return robotraconteurlite_messageelement_writer_write_multidimarray_ex(
+        element_writer, element_name, &value->dims,
+        (const uint8_t*)value->array.data, value->array.len,
+        ROBOTRACONTEURLITE_DATATYPE_CSINGLE, sizeof(struct robotraconteurlite_csingle));
+}
+/* bool */
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_bool(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_bool* dest_array)
+{
+    return robotraconteurlite_messageelement_reader_read_multidimarray_ex(
+        element_reader, &dest_array->dims,
+        (uint8_t*)dest_array->array.data, &dest_array->array.len,
+        ROBOTRACONTEURLITE_DATATYPE_BOOL, sizeof(struct robotraconteurlite_bool));
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_reader_read_multidimarray_bool_view(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct robotraconteurlite_multidimarray_bool* dest_array)
+{
+    struct robotraconteurlite_buffer view;
+    robotraconteurlite_status rv = -1;
+
+    view.data = (uint8_t*)dest_array->array.data;
+    view.len = dest_array->array.len;
+    rv = robotraconteurlite_messageelement_reader_read_multidimarray_view_ex(
+        element_reader, &dest_array->dims, &view, ROBOTRACONTEURLITE_DATATYPE_BOOL,
+        sizeof(struct robotraconteurlite_bool), 1);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    /* Alignment has been checked by read_data_view_ex */
+    /* cppcheck-suppress misra-c2012-11.3 */
+    dest_array->array.data = (struct robotraconteurlite_bool*)view.data;
+    dest_array->array.len = view.len;
+    return rv;
+}
+
+robotraconteurlite_status robotraconteurlite_messageelement_writer_write_multidimarray_bool(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name,
+    const struct robotraconteurlite_multidimarray_bool* value)
+{
+    return robotraconteurlite_messageelement_writer_write_multidimarray_ex(
+        element_writer, element_name, &value->dims,
+        (const uint8_t*)value->array.data, value->array.len,
+        ROBOTRACONTEURLITE_DATATYPE_BOOL, sizeof(struct robotraconteurlite_bool));
 }
@@ -197,6 +197,27 @@ robotraconteurlite_status robotraconteurlite_node_next_event(struct robotraconte
             return ROBOTRACONTEURLITE_ERROR_SUCCESS;
         }
 
+        if (robotraconteurlite_connection_is_message_header_received_event(c) != 0)
+        {
+            robotraconteurlite_clear_event(event);
+            node->events_serviced++;
+            event->event_type = ROBOTRACONTEURLITE_EVENT_TYPE_MESSAGE_HEADER_RECEIVED;
+            event->connection = c;
+            event->received_message.node = node;
+            event->received_message.connection = c;
+            event->event_error_code = robotraconteurlite_node_receive_messageentry_header(&event->received_message);
+            return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+        }
+
+        if (robotraconteurlite_connection_is_message_chunk_received_event(c) != 0)
+        {
+            robotraconteurlite_clear_event(event);
+            node->events_serviced++;
+            event->event_type = ROBOTRACONTEURLITE_EVENT_TYPE_MESSAGE_CHUNK_RECEIVED;
+            event->connection = c;
+            return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+        }
+
         if (c->heartbeat_next_check_ms < now)
         {
             int heartbeat_ret = -1;
@@ -245,6 +266,17 @@ robotraconteurlite_status robotraconteurlite_node_consume_event(struct robotraco
         return ROBOTRACONTEURLITE_ERROR_SUCCESS;
     }
     case ROBOTRACONTEURLITE_EVENT_TYPE_MESSAGE_RECEIVED: {
+        /* Remaining entries of a multiple entry message are delivered as separate events before the message is
+           released */
+        if ((event->event_error_code == ROBOTRACONTEURLITE_ERROR_SUCCESS) &&
+            ((event->received_message.entry_index + 1U) <
+             event->received_message.received_message_header.entry_count))
+        {
+            event->connection->recv_message_entry_index = event->received_message.entry_index + 1U;
+            event->connection->recv_message_entry_offset = event->received_message.entry_reader.buffer_offset +
+                                                           event->received_message.entry_reader.buffer_count;
+            return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+        }
         robotraconteurlite_connection_consume_message_received(event->connection);
         return ROBOTRACONTEURLITE_ERROR_SUCCESS;
     }
@@ -252,6 +284,15 @@ robotraconteurlite_status robotraconteurlite_node_consume_event(struct robotraco
         robotraconteurlite_connection_consume_message_sent(event->connection);
         return ROBOTRACONTEURLITE_ERROR_SUCCESS;
     }
+    case ROBOTRACONTEURLITE_EVENT_TYPE_MESSAGE_HEADER_RECEIVED: {
+        /* The message keeps buffering unless the handler streamed or rejected it */
+        robotraconteurlite_connection_consume_message_header_received(event->connection);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    }
+    case ROBOTRACONTEURLITE_EVENT_TYPE_MESSAGE_CHUNK_RECEIVED: {
+        robotraconteurlite_connection_consume_message_chunk_received(event->connection);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    }
     case ROBOTRACONTEURLITE_EVENT_TYPE_CONNECTION_HEARTBEAT_TIMEOUT:
     case ROBOTRACONTEURLITE_EVENT_TYPE_CONNECTION_TIMEOUT: {
         /* Timeouts cannot be cleared or consumed */
@@ -280,6 +321,206 @@ static robotraconteurlite_status robotraconteurlite_node_event_special_request_h
     return ROBOTRACONTEURLITE_ERROR_CONSUMED;
 }
 
+/* Add the strings of a STRINGTABLEOP request to the receive string table. accepted_codes receives the codes that are
+   now known, which are returned to the sender. */
+static robotraconteurlite_status robotraconteurlite_node_string_table_op_read(
+    struct robotraconteurlite_connection* connection, struct robotraconteurlite_messageentry_reader* entry_reader,
+    uint32_t accepted_codes[], size_t* accepted_codes_len)
+{
+    uint32_t codes_data[ROBOTRACONTEURLITE_STRING_TABLE_OP_MAX_ENTRIES];
+    uint32_t lengths_data[ROBOTRACONTEURLITE_STRING_TABLE_OP_MAX_ENTRIES];
+    struct robotraconteurlite_array_uint32 codes;
+    struct robotraconteurlite_array_uint32 lengths;
+    struct robotraconteurlite_buffer strings;
+    struct robotraconteurlite_string element_name;
+    struct robotraconteurlite_messageelement_reader element_reader;
+    size_t strings_offset = 0;
+    size_t i = 0;
+    robotraconteurlite_status rv = -1;
+
+    *accepted_codes_len = 0;
+
+    if (connection->recv_string_table == NULL)
+    {
+        return ROBOTRACONTEURLITE_ERROR_INVALID_OPERATION;
+    }
+
+    codes.data = codes_data;
+    codes.len = ROBOTRACONTEURLITE_STRING_TABLE_OP_MAX_ENTRIES;
+    robotraconteurlite_string_from_c_str("codes", &element_name);
+    rv = robotraconteurlite_messageentry_reader_find_element_verify_array(
+        entry_reader, &element_name, &element_reader, ROBOTRACONTEURLITE_DATATYPE_UINT32,
+        ROBOTRACONTEURLITE_STRING_TABLE_OP_MAX_ENTRIES, 1);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+    rv = robotraconteurlite_messageelement_reader_read_data_uint32_array(&element_reader, &codes);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    lengths.data = lengths_data;
+    lengths.len = ROBOTRACONTEURLITE_STRING_TABLE_OP_MAX_ENTRIES;
+    robotraconteurlite_string_from_c_str("lengths", &element_name);
+    rv = robotraconteurlite_messageentry_reader_find_element_verify_array(
+        entry_reader, &element_name, &element_reader, ROBOTRACONTEURLITE_DATATYPE_UINT32,
+        ROBOTRACONTEURLITE_STRING_TABLE_OP_MAX_ENTRIES, 1);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+    rv = robotraconteurlite_messageelement_reader_read_data_uint32_array(&element_reader, &lengths);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    if (codes.len != lengths.len)
+    {
+        return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
+    }
+
+    /* Strings are concatenated, so they are referenced in the receive buffer rather than copied */
+    robotraconteurlite_string_from_c_str("strings", &element_name);
+    rv = robotraconteurlite_messageentry_reader_find_element_verify_string(entry_reader, &element_name,
+                                                                          &element_reader, UINT32_MAX);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+    (void)memset(&strings, 0, sizeof(strings));
+    rv = robotraconteurlite_messageelement_reader_read_data_view_ex(&element_reader, &strings,
+                                                                    ROBOTRACONTEURLITE_DATATYPE_STRING, 1, 1);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    for (i = 0; i < codes.len; i++)
+    {
+        struct robotraconteurlite_string value;
+        if (lengths.data[i] > (strings.len - strings_offset))
+        {
+            return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
+        }
+        /* cppcheck-suppress misra-c2012-11.3 */
+        value.data = (char*)&strings.data[strings_offset];
+        value.len = lengths.data[i];
+        strings_offset += lengths.data[i];
+
+        rv = robotraconteurlite_string_table_add(connection->recv_string_table, codes.data[i], &value);
+        if (rv == ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE)
+        {
+            /* Table is full, the remaining strings continue to be sent as strings */
+            break;
+        }
+        if (FAILED(rv))
+        {
+            continue;
+        }
+        accepted_codes[*accepted_codes_len] = codes.data[i];
+        (*accepted_codes_len)++;
+    }
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+static robotraconteurlite_status robotraconteurlite_node_event_string_table_op(struct robotraconteurlite_node* node,
+                                                                              struct robotraconteurlite_event* event)
+{
+    uint32_t accepted_codes_data[ROBOTRACONTEURLITE_STRING_TABLE_OP_MAX_ENTRIES];
+    struct robotraconteurlite_array_uint32 accepted_codes;
+    struct robotraconteurlite_string element_name;
+    struct robotraconteurlite_node_send_messageentry_data send_data;
+    robotraconteurlite_status rv = -1;
+
+    accepted_codes.data = accepted_codes_data;
+    accepted_codes.len = 0;
+    rv = robotraconteurlite_node_string_table_op_read(event->connection, &event->received_message.entry_reader,
+                                                      accepted_codes_data, &accepted_codes.len);
+    if (FAILED(rv))
+    {
+        rv = robotraconteurlite_connection_send_messageentry_error_response(
+            node, event->connection, &event->received_message.received_message_entry_header,
+            ROBOTRACONTEURLITE_ERROR_INVALID_OPERATION, "RobotRaconteur.InvalidOperation", "Invalid string table");
+        if (RETRY(rv))
+        {
+            return ROBOTRACONTEURLITE_ERROR_RETRY;
+        }
+        (void)robotraconteurlite_node_consume_event(node, event);
+        return ROBOTRACONTEURLITE_ERROR_CONSUMED;
+    }
+
+    send_data.node = node;
+    send_data.connection = event->connection;
+    rv = robotraconteurlite_node_begin_send_messageentry_response(
+        &send_data, &event->received_message.received_message_entry_header);
+    if (FAILED(rv))
+    {
+        return robotraconteurlite_node_event_special_request_handle_error(node, event, rv);
+    }
+
+    robotraconteurlite_string_from_c_str("codes", &element_name);
+    rv = robotraconteurlite_messageelement_writer_write_uint32_array(&send_data.element_writer, &element_name,
+                                                                     &accepted_codes);
+    if (FAILED(rv))
+    {
+        return robotraconteurlite_node_event_special_request_handle_error(node, event, rv);
+    }
+
+    rv = robotraconteurlite_node_end_send_messageentry(&send_data);
+    if (FAILED(rv))
+    {
+        return robotraconteurlite_node_event_special_request_handle_error(node, event, rv);
+    }
+
+    (void)robotraconteurlite_node_consume_event(node, event);
+    return ROBOTRACONTEURLITE_ERROR_CONSUMED;
+}
+
+/* Confirm the codes accepted by the peer in a STRINGTABLEOPRET */
+static robotraconteurlite_status robotraconteurlite_node_string_table_op_ret_read(
+    struct robotraconteurlite_connection* connection, struct robotraconteurlite_messageentry_reader* entry_reader)
+{
+    uint32_t codes_data[ROBOTRACONTEURLITE_STRING_TABLE_OP_MAX_ENTRIES];
+    struct robotraconteurlite_array_uint32 codes;
+    struct robotraconteurlite_string element_name;
+    struct robotraconteurlite_messageelement_reader element_reader;
+    size_t i = 0;
+    robotraconteurlite_status rv = -1;
+
+    if (connection->send_string_table == NULL)
+    {
+        return ROBOTRACONTEURLITE_ERROR_INVALID_OPERATION;
+    }
+
+    codes.data = codes_data;
+    codes.len = ROBOTRACONTEURLITE_STRING_TABLE_OP_MAX_ENTRIES;
+    robotraconteurlite_string_from_c_str("codes", &element_name);
+    rv = robotraconteurlite_messageentry_reader_find_element_verify_array(
+        entry_reader, &element_name, &element_reader, ROBOTRACONTEURLITE_DATATYPE_UINT32,
+        ROBOTRACONTEURLITE_STRING_TABLE_OP_MAX_ENTRIES, 1);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+    rv = robotraconteurlite_messageelement_reader_read_data_uint32_array(&element_reader, &codes);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    for (i = 0; i < codes.len; i++)
+    {
+        /* Ignore codes that are not in the table */
+        (void)robotraconteurlite_string_table_confirm(connection->send_string_table, codes.data[i]);
+    }
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
 robotraconteurlite_status robotraconteurlite_node_event_special_request(struct robotraconteurlite_node* node,
                                                                         struct robotraconteurlite_event* event)
 {
@@ -321,6 +562,16 @@ robotraconteurlite_status robotraconteurlite_node_event_special_request(struct r
                 {
                     FLAGS_SET(event->connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_SEND_MESSAGE4);
                 }
+                if ((!FLAGS_CHECK(caps_flags, ROBOTRACONTEURLITE_CONNECTION_PARSE_CAPABILITY_MESSAGE4)) ||
+                    (event->connection->recv_string_table == NULL))
+                {
+                    /* String tables require message 4 and a receive table */
+                    FLAGS_CLEAR(caps_flags, ROBOTRACONTEURLITE_CONNECTION_PARSE_CAPABILITY_STRING_TABLE4);
+                }
+                if (FLAGS_CHECK(caps_flags, ROBOTRACONTEURLITE_CONNECTION_PARSE_CAPABILITY_STRING_TABLE4))
+                {
+                    FLAGS_SET(event->connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_STRING_TABLE4);
+                }
             }
 
             /* TODO: sender nodename */
@@ -459,6 +710,12 @@ robotraconteurlite_status robotraconteurlite_node_event_special_request(struct r
                         event->connection->message_flags_inv_mask = (ROBOTRACONTEURLITE_MESSAGE_FLAGS_ROUTING_INFO |
                                                                      ROBOTRACONTEURLITE_MESSAGE_FLAGS_ENDPOINT_INFO);
                     }
+                    if (FLAGS_CHECK(caps_flags, ROBOTRACONTEURLITE_CONNECTION_PARSE_CAPABILITY_STRING_TABLE4) &&
+                        (event->connection->recv_string_table != NULL))
+                    {
+                        FLAGS_SET(event->connection->connection_state,
+                                  ROBOTRACONTEURLITE_STATUS_FLAGS_STRING_TABLE4);
+                    }
                 }
             }
 
@@ -489,6 +746,19 @@ robotraconteurlite_status robotraconteurlite_node_event_special_request(struct r
         (void)robotraconteurlite_node_consume_event(node, event);
         return ROBOTRACONTEURLITE_ERROR_CONSUMED;
     }
+    case ROBOTRACONTEURLITE_MESSAGEENTRYTYPE_STRINGTABLEOP: {
+        return robotraconteurlite_node_event_string_table_op(node, event);
+    }
+    case ROBOTRACONTEURLITE_MESSAGEENTRYTYPE_STRINGTABLEOPRET: {
+        if (event->received_message.received_message_entry_header.error == 0U)
+        {
+            (void)robotraconteurlite_node_string_table_op_ret_read(event->connection,
+                                                                   &event->received_message.entry_reader);
+        }
+        /* Consume the return, handled by the connection */
+        (void)robotraconteurlite_node_consume_event(node, event);
+        return ROBOTRACONTEURLITE_ERROR_CONSUMED;
+    }
 
     default:
         break;
@@ -531,8 +801,8 @@ robotraconteurlite_status robotraconteurlite_node_verify_incoming_message(
     return ROBOTRACONTEURLITE_ERROR_SUCCESS;
 }
 
-robotraconteurlite_status robotraconteurlite_node_begin_send_messageentry(
-    struct robotraconteurlite_node_send_messageentry_data* send_data)
+static robotraconteurlite_status robotraconteurlite_node_begin_send_message(
+    struct robotraconteurlite_node_send_messageentry_data* send_data, uint32_t entry_count)
 {
     robotraconteurlite_status rv = -1;
     uint8_t message_flags_mask = 0;
@@ -549,6 +819,7 @@ robotraconteurlite_status robotraconteurlite_node_begin_send_messageentry(
 
     (void)memset(&send_data->message_header, 0, sizeof(struct robotraconteurlite_message_header));
     send_data->message_header.message_version = 2;
+    send_data->message_header.entry_count = entry_count;
     if (robotraconteurlite_nodeid_copy_to(&send_data->node->nodeid, &send_data->message_header.sender_nodeid) != 0)
     {
         return ROBOTRACONTEURLITE_ERROR_INTERNAL_ERROR;
@@ -575,6 +846,27 @@ robotraconteurlite_status robotraconteurlite_node_begin_send_messageentry(
 
     rv = robotraconteurlite_message_writer_begin_message_ex(&send_data->message_writer, &send_data->message_header,
                                                             &send_data->entry_writer, message_flags_mask);
+    return rv;
+}
+
+static robotraconteurlite_status robotraconteurlite_node_end_send_message(
+    struct robotraconteurlite_node_send_messageentry_data* send_data)
+{
+    robotraconteurlite_status rv = robotraconteurlite_message_writer_end_message(
+        &send_data->message_writer, &send_data->message_header, &send_data->entry_writer);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    rv = robotraconteurlite_connection_end_send_message(send_data->connection, send_data->message_header.message_size);
+    return rv;
+}
+
+robotraconteurlite_status robotraconteurlite_node_begin_send_messageentry(
+    struct robotraconteurlite_node_send_messageentry_data* send_data)
+{
+    robotraconteurlite_status rv = robotraconteurlite_node_begin_send_message(send_data, 1U);
     if (FAILED(rv))
     {
         return rv;
@@ -595,15 +887,77 @@ robotraconteurlite_status robotraconteurlite_node_end_send_messageentry(
         return rv;
     }
 
-    rv = robotraconteurlite_message_writer_end_message(&send_data->message_writer, &send_data->message_header,
-                                                       &send_data->entry_writer);
+    return robotraconteurlite_node_end_send_message(send_data);
+}
+
+robotraconteurlite_status robotraconteurlite_node_begin_send_messageentry_batch(
+    struct robotraconteurlite_node_send_messageentry_data* send_data, uint32_t max_entries)
+{
+    robotraconteurlite_status rv = -1;
+
+    if ((max_entries == 0U) || (max_entries > UINT16_MAX))
+    {
+        return ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER;
+    }
+
+    /* The entry count field is sized for max_entries and patched with the actual count when the batch ends */
+    rv = robotraconteurlite_node_begin_send_message(send_data, max_entries);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    rv = robotraconteurlite_connection_end_send_message(send_data->connection, send_data->message_header.message_size);
-    return rv;
+    send_data->batch_max_entries = max_entries;
+    if (send_data->message_writer.entry_count_offset == SIZE_MAX)
+    {
+        /* Peer does not accept multiple entries */
+        send_data->batch_max_entries = 1U;
+    }
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status robotraconteurlite_node_batch_begin_messageentry(
+    struct robotraconteurlite_node_send_messageentry_data* send_data)
+{
+    if (!(send_data->entry_writer.entries_written_count < send_data->batch_max_entries))
+    {
+        return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+    }
+
+    return robotraconteurlite_messageentry_writer_begin_entry(&send_data->entry_writer,
+                                                              send_data->message_entry_header,
+                                                              &send_data->element_writer);
+}
+
+robotraconteurlite_status robotraconteurlite_node_batch_begin_messageentry_response(
+    struct robotraconteurlite_node_send_messageentry_data* send_data,
+    struct robotraconteurlite_messageentry_header* request_message_entry_header)
+{
+    (void)memcpy(&send_data->message_entry_header_storage, request_message_entry_header,
+                 sizeof(struct robotraconteurlite_messageentry_header));
+    send_data->message_entry_header_storage.entry_type++;
+    send_data->message_entry_header = &send_data->message_entry_header_storage;
+    return robotraconteurlite_node_batch_begin_messageentry(send_data);
+}
+
+robotraconteurlite_status robotraconteurlite_node_batch_end_messageentry(
+    struct robotraconteurlite_node_send_messageentry_data* send_data)
+{
+    return robotraconteurlite_messageentry_writer_end_entry(&send_data->entry_writer, send_data->message_entry_header,
+                                                            &send_data->element_writer);
+}
+
+robotraconteurlite_status robotraconteurlite_node_end_send_messageentry_batch(
+    struct robotraconteurlite_node_send_messageentry_data* send_data)
+{
+    if (send_data->entry_writer.entries_written_count == 0U)
+    {
+        (void)robotraconteurlite_connection_abort_send_message(send_data->connection);
+        return ROBOTRACONTEURLITE_ERROR_NO_MORE;
+    }
+
+    return robotraconteurlite_node_end_send_message(send_data);
 }
 
 robotraconteurlite_status robotraconteurlite_node_abort_send_messageentry(
@@ -700,21 +1054,26 @@ robotraconteurlite_status robotraconteurlite_connection_send_messageentry_error_
     return ROBOTRACONTEURLITE_ERROR_SUCCESS;
 }
 
-robotraconteurlite_status robotraconteurlite_node_receive_messageentry(
+static robotraconteurlite_status robotraconteurlite_node_receive_messageentry_read_header(
     struct robotraconteurlite_node_receive_messageentry_data* receive_data)
+{
+    /* Apply storage buffer for entry header strings */
+    receive_data->received_message_entry_header.member_name.data = receive_data->member_name_char;
+    receive_data->received_message_entry_header.member_name.len = sizeof(receive_data->member_name_char);
+    receive_data->received_message_entry_header.service_path.data = receive_data->service_path_char;
+    receive_data->received_message_entry_header.service_path.len = sizeof(receive_data->service_path_char);
+    receive_data->received_message_entry_header.metadata.data = receive_data->extended_char;
+    receive_data->received_message_entry_header.metadata.len = sizeof(receive_data->extended_char);
+
+    return robotraconteurlite_messageentry_reader_read_header(&receive_data->entry_reader,
+                                                              &receive_data->received_message_entry_header);
+}
+
+static robotraconteurlite_status robotraconteurlite_node_receive_messageentry_read(
+    struct robotraconteurlite_node_receive_messageentry_data* receive_data,
+    struct robotraconteurlite_message_reader* message_reader)
 {
     robotraconteurlite_status rv = -1;
-    struct robotraconteurlite_message_reader message_reader;
-    receive_data->buffer_storage.data = NULL;
-    receive_data->buffer_storage.len = 0;
-    receive_data->buffer_vec_storage.buffer_vec = &receive_data->buffer_storage;
-    receive_data->buffer_vec_storage.buffer_vec_cnt = 1;
-    rv = robotraconteurlite_connection_message_receive(receive_data->connection, &message_reader,
-                                                       &receive_data->buffer_vec_storage);
-    if (FAILED(rv))
-    {
-        return rv;
-    }
 
     /* Apply storage buffers for header strings */
     receive_data->received_message_header.receiver_nodename.data = receive_data->receiver_nodename_char;
@@ -722,7 +1081,7 @@ robotraconteurlite_status robotraconteurlite_node_receive_messageentry(
     receive_data->received_message_header.sender_nodename.data = receive_data->sender_nodename_char;
     receive_data->received_message_header.sender_nodename.len = sizeof(receive_data->sender_nodename_char);
 
-    rv = robotraconteurlite_message_reader_read_header(&message_reader, &receive_data->received_message_header);
+    rv = robotraconteurlite_message_reader_read_header(message_reader, &receive_data->received_message_header);
     if (FAILED(rv))
     {
         return rv;
@@ -735,29 +1094,109 @@ robotraconteurlite_status robotraconteurlite_node_receive_messageentry(
         return rv;
     }
 
-    /* TODO: Support multiple entries in one message */
-    rv = robotraconteurlite_message_reader_begin_read_entries(&message_reader, &receive_data->entry_reader);
+    rv = robotraconteurlite_message_reader_begin_read_entries(message_reader, &receive_data->entry_reader);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    /* Apply storage buffer for entry header strings */
-    receive_data->received_message_entry_header.member_name.data = receive_data->member_name_char;
-    receive_data->received_message_entry_header.member_name.len = sizeof(receive_data->member_name_char);
-    receive_data->received_message_entry_header.service_path.data = receive_data->service_path_char;
-    receive_data->received_message_entry_header.service_path.len = sizeof(receive_data->service_path_char);
-    receive_data->received_message_entry_header.metadata.data = receive_data->extended_char;
-    receive_data->received_message_entry_header.metadata.len = sizeof(receive_data->extended_char);
+    /* Continue after the entries of a multiple entry message that were delivered by earlier events */
+    if (receive_data->connection->recv_message_entry_index > 0U)
+    {
+        rv = robotraconteurlite_messageentry_reader_seek(&receive_data->entry_reader,
+                                                         receive_data->connection->recv_message_entry_offset,
+                                                         receive_data->connection->recv_message_entry_index);
+        if (FAILED(rv))
+        {
+            return rv;
+        }
+    }
+    receive_data->entry_index = receive_data->connection->recv_message_entry_index;
 
-    rv = robotraconteurlite_messageentry_reader_read_header(&receive_data->entry_reader,
-                                                            &receive_data->received_message_entry_header);
+    return robotraconteurlite_node_receive_messageentry_read_header(receive_data);
+}
+
+static void robotraconteurlite_node_receive_messageentry_init_buffer(
+    struct robotraconteurlite_node_receive_messageentry_data* receive_data)
+{
+    (void)memset(receive_data->buffer_storage, 0, sizeof(receive_data->buffer_storage));
+    receive_data->buffer_vec_storage.buffer_vec = receive_data->buffer_storage;
+    receive_data->buffer_vec_storage.buffer_vec_cnt =
+        sizeof(receive_data->buffer_storage) / sizeof(receive_data->buffer_storage[0]);
+}
+
+robotraconteurlite_status robotraconteurlite_node_receive_messageentry(
+    struct robotraconteurlite_node_receive_messageentry_data* receive_data)
+{
+    robotraconteurlite_status rv = -1;
+    struct robotraconteurlite_message_reader message_reader;
+    robotraconteurlite_node_receive_messageentry_init_buffer(receive_data);
+    rv = robotraconteurlite_connection_message_receive(receive_data->connection, &message_reader,
+                                                       &receive_data->buffer_vec_storage);
     if (FAILED(rv))
     {
         return rv;
     }
 
-    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    /* Header strings are only copied into the storage below if they straddle buffer segments */
+    if (FLAGS_CHECK(receive_data->node->node_flags, ROBOTRACONTEURLITE_NODE_FLAGS_HEADER_STRING_VIEWS))
+    {
+        (void)robotraconteurlite_message_reader_set_string_views(&message_reader, 1U);
+    }
+
+    if (FLAGS_CHECK(receive_data->node->node_flags, ROBOTRACONTEURLITE_NODE_FLAGS_VALIDATE_MESSAGES))
+    {
+        if (receive_data->connection->recv_message_entry_index == 0U)
+        {
+            rv = robotraconteurlite_message_reader_validate(&message_reader);
+            if (FAILED(rv))
+            {
+                return rv;
+            }
+        }
+        else
+        {
+            /* Validated when the first entry was delivered, the receive buffer has not changed since */
+            message_reader.validated = 1U;
+        }
+    }
+
+    return robotraconteurlite_node_receive_messageentry_read(receive_data, &message_reader);
+}
+
+robotraconteurlite_status robotraconteurlite_node_receive_messageentry_header(
+    struct robotraconteurlite_node_receive_messageentry_data* receive_data)
+{
+    robotraconteurlite_status rv = -1;
+    struct robotraconteurlite_message_reader message_reader;
+    robotraconteurlite_node_receive_messageentry_init_buffer(receive_data);
+    rv = robotraconteurlite_connection_message_receive_header(receive_data->connection, &message_reader,
+                                                              &receive_data->buffer_vec_storage);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    if (FLAGS_CHECK(receive_data->node->node_flags, ROBOTRACONTEURLITE_NODE_FLAGS_HEADER_STRING_VIEWS))
+    {
+        (void)robotraconteurlite_message_reader_set_string_views(&message_reader, 1U);
+    }
+
+    /* The message is validated when it is complete, before the message received event */
+    return robotraconteurlite_node_receive_messageentry_read(receive_data, &message_reader);
+}
+
+robotraconteurlite_status robotraconteurlite_node_receive_messageentry_move_next(
+    struct robotraconteurlite_node_receive_messageentry_data* receive_data)
+{
+    robotraconteurlite_status rv = robotraconteurlite_messageentry_reader_move_next(&receive_data->entry_reader);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+    receive_data->entry_index++;
+
+    return robotraconteurlite_node_receive_messageentry_read_header(receive_data);
 }
 
 robotraconteurlite_status robotraconteurlite_node_receive_messageentry_consume(
@@ -937,6 +1376,27 @@ robotraconteurlite_status robotraconteurlite_event_is_member(struct robotraconte
     return 1;
 }
 
+robotraconteurlite_status robotraconteurlite_event_is_member_name(struct robotraconteurlite_event* event,
+                                                                  const char* member_name)
+{
+    assert(event->event_type == ROBOTRACONTEURLITE_EVENT_TYPE_MESSAGE_RECEIVED);
+    if (robotraconteurlite_string_cmp_c_str(&event->received_message.received_message_entry_header.member_name,
+                                            member_name) != 0)
+    {
+        return 0;
+    }
+    return 1;
+}
+
+robotraconteurlite_status robotraconteurlite_event_find_member_handler(
+    struct robotraconteurlite_event* event, const struct robotraconteurlite_member_dispatch* dispatch,
+    uint32_t* handler_id)
+{
+    assert(event->event_type == ROBOTRACONTEURLITE_EVENT_TYPE_MESSAGE_RECEIVED);
+    return robotraconteurlite_member_dispatch_find(dispatch, &event->received_message.received_message_entry_header,
+                                                   handler_id);
+}
+
 robotraconteurlite_status robotraconteurlite_client_is_connected(struct robotraconteurlite_node* node,
                                                                  struct robotraconteurlite_connection* connection)
 {
@@ -1161,6 +1621,7 @@ robotraconteurlite_status robotraconteurlite_client_handshake(
     case ROBOTRACONTEURLITE_CLIENT_HANDSHAKE_INIT: {
         struct robotraconteurlite_node_send_messageentry_data send_data;
         uint32_t old_connection_state = 0;
+        uint32_t caps_flags = 0;
         if (handshake_data->connection->local_endpoint == 0U)
         {
             handshake_data->connection->local_endpoint = rand();
@@ -1178,9 +1639,13 @@ robotraconteurlite_status robotraconteurlite_client_handshake(
             return robotraconteurlite_client_handshake_handle_error(handshake_data, rv);
         }
 
-        rv = robotraconteurlite_node_transport_populate_capabilities(
-            &send_data.element_writer, (ROBOTRACONTEURLITE_CONNECTION_PARSE_CAPABILITY_MESSAGE2 |
-                                        ROBOTRACONTEURLITE_CONNECTION_PARSE_CAPABILITY_MESSAGE4));
+        caps_flags = (ROBOTRACONTEURLITE_CONNECTION_PARSE_CAPABILITY_MESSAGE2 |
+                      ROBOTRACONTEURLITE_CONNECTION_PARSE_CAPABILITY_MESSAGE4);
+        if (handshake_data->connection->recv_string_table != NULL)
+        {
+            FLAGS_SET(caps_flags, ROBOTRACONTEURLITE_CONNECTION_PARSE_CAPABILITY_STRING_TABLE4);
+        }
+        rv = robotraconteurlite_node_transport_populate_capabilities(&send_data.element_writer, caps_flags);
         if (FAILED(rv))
         {
             return robotraconteurlite_client_handshake_handle_error(handshake_data, rv);
@@ -1333,6 +1798,104 @@ robotraconteurlite_status robotraconteurlite_client_send_heartbeat(struct robotr
     return ROBOTRACONTEURLITE_ERROR_SUCCESS;
 }
 
+robotraconteurlite_status robotraconteurlite_node_send_string_table_update(
+    struct robotraconteurlite_node* node, struct robotraconteurlite_connection* connection)
+{
+    uint32_t codes_data[ROBOTRACONTEURLITE_STRING_TABLE_OP_MAX_ENTRIES];
+    uint32_t lengths_data[ROBOTRACONTEURLITE_STRING_TABLE_OP_MAX_ENTRIES];
+    struct robotraconteurlite_array_uint32 codes;
+    struct robotraconteurlite_array_uint32 lengths;
+    struct robotraconteurlite_string element_name;
+    struct robotraconteurlite_string strings;
+    struct robotraconteurlite_node_send_messageentry_data send_data;
+    const struct robotraconteurlite_string_table* table = connection->send_string_table;
+    size_t strings_len = 0;
+    size_t first = 0;
+    size_t i = 0;
+    robotraconteurlite_status rv = -1;
+
+    if ((table == NULL) ||
+        (!FLAGS_CHECK(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_STRING_TABLE4)))
+    {
+        return ROBOTRACONTEURLITE_ERROR_INVALID_OPERATION;
+    }
+
+    for (first = 0; first < table->entries_count; first++)
+    {
+        if (!FLAGS_CHECK(table->entries[first].flags, ROBOTRACONTEURLITE_STRING_TABLE_ENTRY_FLAGS_CONFIRMED))
+        {
+            break;
+        }
+    }
+
+    if (first >= table->entries_count)
+    {
+        return ROBOTRACONTEURLITE_ERROR_NO_MORE;
+    }
+
+    /* Send a run of unconfirmed entries. Entries are stored in order, so their strings are contiguous. */
+    codes.data = codes_data;
+    codes.len = 0;
+    lengths.data = lengths_data;
+    lengths.len = 0;
+    for (i = first; (i < table->entries_count) && (codes.len < ROBOTRACONTEURLITE_STRING_TABLE_OP_MAX_ENTRIES); i++)
+    {
+        const struct robotraconteurlite_string_table_entry* entry = &table->entries[i];
+        if (FLAGS_CHECK(entry->flags, ROBOTRACONTEURLITE_STRING_TABLE_ENTRY_FLAGS_CONFIRMED))
+        {
+            break;
+        }
+        codes_data[codes.len] = entry->code;
+        lengths_data[lengths.len] = (uint32_t)entry->value.len;
+        codes.len++;
+        lengths.len++;
+        strings_len += entry->value.len;
+    }
+
+    send_data.node = node;
+    send_data.connection = connection;
+    send_data.message_entry_header = &send_data.message_entry_header_storage;
+    (void)memset(send_data.message_entry_header, 0, sizeof(struct robotraconteurlite_messageentry_header));
+    send_data.message_entry_header->entry_type = ROBOTRACONTEURLITE_MESSAGEENTRYTYPE_STRINGTABLEOP;
+    connection->last_request_id++;
+    send_data.message_entry_header->request_id = connection->last_request_id;
+    rv = robotraconteurlite_node_begin_send_messageentry(&send_data);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    robotraconteurlite_string_from_c_str("codes", &element_name);
+    rv = robotraconteurlite_messageelement_writer_write_uint32_array(&send_data.element_writer, &element_name, &codes);
+    if (FAILED(rv))
+    {
+        (void)robotraconteurlite_node_abort_send_messageentry(&send_data);
+        return rv;
+    }
+
+    robotraconteurlite_string_from_c_str("lengths", &element_name);
+    rv = robotraconteurlite_messageelement_writer_write_uint32_array(&send_data.element_writer, &element_name,
+                                                                     &lengths);
+    if (FAILED(rv))
+    {
+        (void)robotraconteurlite_node_abort_send_messageentry(&send_data);
+        return rv;
+    }
+
+    strings.data = table->entries[first].value.data;
+    strings.len = strings_len;
+    robotraconteurlite_string_from_c_str("strings", &element_name);
+    rv = robotraconteurlite_messageelement_writer_write_data_string(&send_data.element_writer, &element_name,
+                                                                    &strings);
+    if (FAILED(rv))
+    {
+        (void)robotraconteurlite_node_abort_send_messageentry(&send_data);
+        return rv;
+    }
+
+    return robotraconteurlite_node_end_send_messageentry(&send_data);
+}
+
 robotraconteurlite_status robotraconteurlite_node_next_wake(struct robotraconteurlite_node* node,
                                                             robotraconteurlite_timespec now,
                                                             robotraconteurlite_timespec* wake_time)
@@ -1418,6 +1981,12 @@ robotraconteurlite_status robotraconteurlite_node_transport_parse_capabilities(
 
                     FLAGS_SET(*parsed_flags, ROBOTRACONTEURLITE_CONNECTION_PARSE_CAPABILITY_MESSAGE4);
                 }
+                if (((c & ROBOTRACONTEURLITE_TRANSPORT_CAPABILITY_CODE_PAGE_MASK) ==
+                     ROBOTRACONTEURLITE_TRANSPORT_CAPABILITY_CODE_MESSAGE4_STRINGTABLE_PAGE) &&
+                    (FLAGS_CHECK(c, ROBOTRACONTEURLITE_TRANSPORT_CAPABILITY_CODE_MESSAGE4_STRINGTABLE_ENABLE)))
+                {
+                    FLAGS_SET(*parsed_flags, ROBOTRACONTEURLITE_CONNECTION_PARSE_CAPABILITY_STRING_TABLE4);
+                }
             }
         }
     }
@@ -1428,7 +1997,7 @@ robotraconteurlite_status robotraconteurlite_node_transport_parse_capabilities(
 robotraconteurlite_status robotraconteurlite_node_transport_populate_capabilities(
     struct robotraconteurlite_messageelement_writer* element_writer, uint32_t capability_flags)
 {
-    uint32_t caps_reply[2];
+    uint32_t caps_reply[3];
     size_t caps_reply_len = 0;
     robotraconteurlite_status rv = -1;
     if (FLAGS_CHECK(capability_flags, ROBOTRACONTEURLITE_CONNECTION_PARSE_CAPABILITY_MESSAGE2))
@@ -1443,6 +2012,12 @@ robotraconteurlite_status robotraconteurlite_node_transport_populate_capabilitie
                                      ROBOTRACONTEURLITE_TRANSPORT_CAPABILITY_CODE_MESSAGE4_BASIC_ENABLE;
         caps_reply_len++;
     }
+    if (FLAGS_CHECK(capability_flags, ROBOTRACONTEURLITE_CONNECTION_PARSE_CAPABILITY_STRING_TABLE4))
+    {
+        caps_reply[caps_reply_len] = ROBOTRACONTEURLITE_TRANSPORT_CAPABILITY_CODE_MESSAGE4_STRINGTABLE_PAGE |
+                                     ROBOTRACONTEURLITE_TRANSPORT_CAPABILITY_CODE_MESSAGE4_STRINGTABLE_ENABLE;
+        caps_reply_len++;
+    }
 
     if (caps_reply_len > 0U)
     {
@@ -0,0 +1,412 @@
+/* Copyright 2011-2024 Wason Technology, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "robotraconteurlite/string_table.h"
+#include "robotraconteurlite/util.h"
+#include <string.h>
+#include <assert.h>
+
+#define FAILED ROBOTRACONTEURLITE_FAILED
+
+robotraconteurlite_status robotraconteurlite_string_table_init(struct robotraconteurlite_string_table* table,
+                                                               struct robotraconteurlite_string_table_entry* entries,
+                                                               size_t entries_len, char* string_storage,
+                                                               size_t string_storage_len)
+{
+    assert(table != NULL);
+    assert(entries != NULL);
+    assert(string_storage != NULL);
+
+    table->entries = entries;
+    table->entries_len = entries_len;
+    table->entries_count = 0;
+    table->string_storage = string_storage;
+    table->string_storage_len = string_storage_len;
+    table->string_storage_used = 0;
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+static struct robotraconteurlite_string_table_entry* robotraconteurlite_string_table_find_entry(
+    const struct robotraconteurlite_string_table* table, uint32_t code)
+{
+    size_t i = 0;
+    for (i = 0; i < table->entries_count; i++)
+    {
+        if (table->entries[i].code == code)
+        {
+            return &table->entries[i];
+        }
+    }
+    return NULL;
+}
+
+robotraconteurlite_status robotraconteurlite_string_table_add(struct robotraconteurlite_string_table* table,
+                                                              uint32_t code,
+                                                              const struct robotraconteurlite_string* value)
+{
+    struct robotraconteurlite_string_table_entry* entry = NULL;
+
+    assert(table != NULL);
+    assert(value != NULL);
+
+    if ((code == 0U) || (value->len == 0U))
+    {
+        return ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER;
+    }
+
+    entry = robotraconteurlite_string_table_find_entry(table, code);
+    if (entry != NULL)
+    {
+        if (robotraconteurlite_string_cmp(&entry->value, value) != 0)
+        {
+            return ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER;
+        }
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    }
+
+    if ((table->entries_count >= table->entries_len) ||
+        (value->len > (table->string_storage_len - table->string_storage_used)))
+    {
+        return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+    }
+
+    entry = &table->entries[table->entries_count];
+    entry->code = code;
+    entry->flags = ROBOTRACONTEURLITE_STRING_TABLE_ENTRY_FLAGS_NULL;
+    entry->value.data = &table->string_storage[table->string_storage_used];
+    entry->value.len = value->len;
+    (void)memcpy(entry->value.data, value->data, value->len);
+    table->string_storage_used += value->len;
+    table->entries_count++;
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status robotraconteurlite_string_table_confirm(struct robotraconteurlite_string_table* table,
+                                                                  uint32_t code)
+{
+    struct robotraconteurlite_string_table_entry* entry = NULL;
+
+    assert(table != NULL);
+
+    entry = robotraconteurlite_string_table_find_entry(table, code);
+    if (entry == NULL)
+    {
+        return ROBOTRACONTEURLITE_ERROR_KEY_NOT_FOUND;
+    }
+
+    ROBOTRACONTEURLITE_FLAGS_SET(entry->flags, ROBOTRACONTEURLITE_STRING_TABLE_ENTRY_FLAGS_CONFIRMED);
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+void robotraconteurlite_string_table_clear_confirmed(struct robotraconteurlite_string_table* table)
+{
+    size_t i = 0;
+
+    assert(table != NULL);
+
+    for (i = 0; i < table->entries_count; i++)
+    {
+        ROBOTRACONTEURLITE_FLAGS_CLEAR(table->entries[i].flags, ROBOTRACONTEURLITE_STRING_TABLE_ENTRY_FLAGS_CONFIRMED);
+    }
+}
+
+void robotraconteurlite_string_table_clear(struct robotraconteurlite_string_table* table)
+{
+    assert(table != NULL);
+
+    table->entries_count = 0;
+    table->string_storage_used = 0;
+}
+
+robotraconteurlite_status robotraconteurlite_string_table_find_code(const struct robotraconteurlite_string_table* table,
+                                                                    const struct robotraconteurlite_string* value,
+                                                                    uint8_t confirmed_only, uint32_t* code)
+{
+    size_t i = 0;
+
+    assert(table != NULL);
+    assert(value != NULL);
+    assert(code != NULL);
+
+    if (value->len == 0U)
+    {
+        return ROBOTRACONTEURLITE_ERROR_KEY_NOT_FOUND;
+    }
+
+    for (i = 0; i < table->entries_count; i++)
+    {
+        const struct robotraconteurlite_string_table_entry* entry = &table->entries[i];
+        if ((confirmed_only != 0U) &&
+            (!ROBOTRACONTEURLITE_FLAGS_CHECK(entry->flags, ROBOTRACONTEURLITE_STRING_TABLE_ENTRY_FLAGS_CONFIRMED)))
+        {
+            continue;
+        }
+        if ((entry->value.len == value->len) && (memcmp(entry->value.data, value->data, value->len) == 0))
+        {
+            *code = entry->code;
+            return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+        }
+    }
+
+    return ROBOTRACONTEURLITE_ERROR_KEY_NOT_FOUND;
+}
+
+robotraconteurlite_status robotraconteurlite_string_table_find_string(
+    const struct robotraconteurlite_string_table* table, uint32_t code, struct robotraconteurlite_string* value)
+{
+    const struct robotraconteurlite_string_table_entry* entry = NULL;
+
+    assert(table != NULL);
+    assert(value != NULL);
+
+    entry = robotraconteurlite_string_table_find_entry(table, code);
+    if (entry == NULL)
+    {
+        return ROBOTRACONTEURLITE_ERROR_KEY_NOT_FOUND;
+    }
+
+    value->data = entry->value.data;
+    value->len = entry->value.len;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status robotraconteurlite_string_intern_init(struct robotraconteurlite_string_intern* intern,
+                                                                struct robotraconteurlite_string_intern_entry* entries,
+                                                                size_t entries_len, char* string_storage,
+                                                                size_t string_storage_len)
+{
+    assert(intern != NULL);
+    assert(entries != NULL);
+    assert(string_storage != NULL);
+
+    if ((entries_len == 0U) || (entries_len > UINT32_MAX))
+    {
+        return ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER;
+    }
+
+    intern->entries = entries;
+    intern->entries_len = entries_len;
+    intern->string_storage = string_storage;
+    intern->string_storage_len = string_storage_len;
+    robotraconteurlite_string_intern_clear(intern);
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+void robotraconteurlite_string_intern_clear(struct robotraconteurlite_string_intern* intern)
+{
+    size_t i = 0;
+
+    assert(intern != NULL);
+
+    for (i = 0; i < intern->entries_len; i++)
+    {
+        intern->entries[i].hash = 0;
+        intern->entries[i].value.data = NULL;
+        intern->entries[i].value.len = 0;
+    }
+    intern->entries_count = 0;
+    intern->string_storage_used = 0;
+}
+
+/* Compare an interned string with len bytes at source_pos, which may be split across segments */
+static uint8_t robotraconteurlite_string_intern_equals_buffer_vec(const struct robotraconteurlite_string* value,
+                                                                  const struct robotraconteurlite_buffer_vec* source,
+                                                                  size_t source_pos, size_t len)
+{
+    struct robotraconteurlite_buffer_vec_cursor cursor;
+    size_t done = 0;
+
+    (void)robotraconteurlite_buffer_vec_cursor_init(&cursor, source);
+    while (done < len)
+    {
+        struct robotraconteurlite_buffer span;
+        if (FAILED(robotraconteurlite_buffer_vec_cursor_peek(&cursor, source_pos + done, &span)) || (span.len == 0U))
+        {
+            return 0;
+        }
+        span.len = (span.len < (len - done)) ? span.len : (len - done);
+        if (memcmp(&value->data[done], span.data, span.len) != 0)
+        {
+            return 0;
+        }
+        done += span.len;
+    }
+    return 1;
+}
+
+/* Probe from the home slot of hash. Returns the slot holding the string in *slot, or the first free slot with
+   KEY_NOT_FOUND. The string is value, or the len bytes at source_pos in source if value is NULL. */
+static robotraconteurlite_status robotraconteurlite_string_intern_probe(
+    const struct robotraconteurlite_string_intern* intern, uint32_t hash, const struct robotraconteurlite_string* value,
+    const struct robotraconteurlite_buffer_vec* source, size_t source_pos, size_t len, size_t* slot)
+{
+    size_t i = hash % intern->entries_len;
+    size_t j = 0;
+
+    for (j = 0; j < intern->entries_len; j++)
+    {
+        const struct robotraconteurlite_string_intern_entry* entry = &intern->entries[i];
+        if (entry->value.len == 0U)
+        {
+            *slot = i;
+            return ROBOTRACONTEURLITE_ERROR_KEY_NOT_FOUND;
+        }
+
+        if ((entry->hash == hash) && (entry->value.len == len))
+        {
+            uint8_t equal = 0;
+            if (value != NULL)
+            {
+                equal = (memcmp(entry->value.data, value->data, len) == 0) ? 1U : 0U;
+            }
+            else
+            {
+                equal = robotraconteurlite_string_intern_equals_buffer_vec(&entry->value, source, source_pos, len);
+            }
+            if (equal != 0U)
+            {
+                *slot = i;
+                return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+            }
+        }
+
+        i = (i + 1U) % intern->entries_len;
+    }
+
+    *slot = SIZE_MAX;
+    return ROBOTRACONTEURLITE_ERROR_KEY_NOT_FOUND;
+}
+
+robotraconteurlite_status robotraconteurlite_string_intern_add(struct robotraconteurlite_string_intern* intern,
+                                                               const struct robotraconteurlite_string* value,
+                                                               uint32_t* id)
+{
+    struct robotraconteurlite_string_intern_entry* entry = NULL;
+    uint32_t hash = 0;
+    size_t slot = 0;
+    robotraconteurlite_status rv = -1;
+
+    assert(intern != NULL);
+    assert(value != NULL);
+    assert(id != NULL);
+
+    if (value->len == 0U)
+    {
+        return ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER;
+    }
+
+    hash = robotraconteurlite_string_hash(value);
+    rv = robotraconteurlite_string_intern_probe(intern, hash, value, NULL, 0, value->len, &slot);
+    if (rv == ROBOTRACONTEURLITE_ERROR_SUCCESS)
+    {
+        *id = (uint32_t)slot;
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    }
+
+    if ((slot == SIZE_MAX) || (value->len > (intern->string_storage_len - intern->string_storage_used)))
+    {
+        return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+    }
+
+    entry = &intern->entries[slot];
+    entry->hash = hash;
+    entry->value.data = &intern->string_storage[intern->string_storage_used];
+    entry->value.len = value->len;
+    (void)memcpy(entry->value.data, value->data, value->len);
+    intern->string_storage_used += value->len;
+    intern->entries_count++;
+
+    *id = (uint32_t)slot;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status robotraconteurlite_string_intern_find(const struct robotraconteurlite_string_intern* intern,
+                                                                const struct robotraconteurlite_string* value,
+                                                                uint32_t* id)
+{
+    size_t slot = 0;
+    robotraconteurlite_status rv = -1;
+
+    assert(intern != NULL);
+    assert(value != NULL);
+    assert(id != NULL);
+
+    if ((value->len == 0U) || (intern->entries_count == 0U))
+    {
+        return ROBOTRACONTEURLITE_ERROR_KEY_NOT_FOUND;
+    }
+
+    rv = robotraconteurlite_string_intern_probe(intern, robotraconteurlite_string_hash(value), value, NULL, 0,
+                                                value->len, &slot);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    *id = (uint32_t)slot;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status robotraconteurlite_string_intern_find_buffer_vec(
+    const struct robotraconteurlite_string_intern* intern, const struct robotraconteurlite_buffer_vec* source,
+    size_t source_pos, size_t len, uint32_t* id)
+{
+    uint32_t hash = 0;
+    size_t slot = 0;
+    robotraconteurlite_status rv = -1;
+
+    assert(intern != NULL);
+    assert(source != NULL);
+    assert(id != NULL);
+
+    if ((len == 0U) || (intern->entries_count == 0U))
+    {
+        return ROBOTRACONTEURLITE_ERROR_KEY_NOT_FOUND;
+    }
+
+    rv = robotraconteurlite_buffer_vec_string_hash(source, source_pos, len, &hash);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    rv = robotraconteurlite_string_intern_probe(intern, hash, NULL, source, source_pos, len, &slot);
+    if (FAILED(rv))
+    {
+        return rv;
+    }
+
+    *id = (uint32_t)slot;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status robotraconteurlite_string_intern_get_string(
+    const struct robotraconteurlite_string_intern* intern, uint32_t id, struct robotraconteurlite_string* value)
+{
+    assert(intern != NULL);
+    assert(value != NULL);
+
+    if ((id >= intern->entries_len) || (intern->entries[id].value.len == 0U))
+    {
+        return ROBOTRACONTEURLITE_ERROR_KEY_NOT_FOUND;
+    }
+
+    value->data = intern->entries[id].value.data;
+    value->len = intern->entries[id].value.len;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
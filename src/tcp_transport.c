@@ -151,7 +151,7 @@ static struct robotraconteurlite_tcp_transport_storage* get_storage(struct robot
 }
 
 static robotraconteurlite_status robotraconteurlite_tcp_connection_buffer_recv_websocket(
-    struct robotraconteurlite_connection* connection, size_t len)
+    struct robotraconteurlite_connection* connection, uint8_t* buffer, size_t* pos, size_t len)
 {
     struct robotraconteurlite_tcp_transport_storage* storage = get_storage(connection);
     if ((storage->recv_websocket_frame_pos == storage->recv_websocket_frame_len) &&
@@ -244,10 +244,9 @@ static robotraconteurlite_status robotraconteurlite_tcp_connection_buffer_recv_w
     }
     if (FLAGS_CHECK(storage->tcp_transport_state, ROBOTRACONTEURLITE_TCP_TRANSPORT_STATE_RECV_WEBSOCKET_IN_FRAME))
     {
-        uint32_t recv_len =
-            storage->recv_websocket_frame_len + (connection->recv_buffer_pos - storage->recv_websocket_frame_pos);
+        uint32_t recv_len = storage->recv_websocket_frame_len + (*pos - storage->recv_websocket_frame_pos);
         int last_errno = -1;
-        uint32_t prev_recv_buffer_pos = 0;
+        size_t prev_recv_buffer_pos = 0;
         robotraconteurlite_status rv = -1;
         size_t n = 0;
         size_t i = 0;
@@ -256,18 +255,17 @@ static robotraconteurlite_status robotraconteurlite_tcp_connection_buffer_recv_w
             recv_len = (uint32_t)len;
         }
 
-        prev_recv_buffer_pos = connection->recv_buffer_pos;
-        rv = robotraconteurlite_tcp_socket_recv_nonblocking(connection->sock, connection->recv_buffer,
-                                                            &connection->recv_buffer_pos, recv_len, &last_errno);
+        prev_recv_buffer_pos = *pos;
+        rv = robotraconteurlite_tcp_socket_recv_nonblocking(connection->sock, buffer, pos, recv_len, &last_errno);
         if (FAILED(rv))
         {
             FLAGS_SET(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_ERROR);
             return rv;
         }
-        n = connection->recv_buffer_pos - prev_recv_buffer_pos;
+        n = *pos - prev_recv_buffer_pos;
         for (i = 0; i < n; i++)
         {
-            connection->recv_buffer[prev_recv_buffer_pos + i] ^=
+            buffer[prev_recv_buffer_pos + i] ^=
                 storage->recv_websocket_mask[(storage->recv_websocket_frame_pos + i) % 4U];
         }
         storage->recv_websocket_frame_pos += n;
@@ -276,18 +274,119 @@ static robotraconteurlite_status robotraconteurlite_tcp_connection_buffer_recv_w
     return ROBOTRACONTEURLITE_ERROR_SUCCESS;
 }
 
-robotraconteurlite_status robotraconteurlite_tcp_connection_buffer_recv(
-    struct robotraconteurlite_connection* connection, size_t len)
+static robotraconteurlite_status robotraconteurlite_tcp_connection_buffer_recv_ex(
+    struct robotraconteurlite_connection* connection, uint8_t* buffer, size_t* pos, size_t len)
 {
     int last_errno = -1;
     struct robotraconteurlite_tcp_transport_storage* storage = get_storage(connection);
     if (FLAGS_CHECK(storage->tcp_transport_state, ROBOTRACONTEURLITE_TCP_TRANSPORT_STATE_IS_WEBSOCKET))
     {
-        return robotraconteurlite_tcp_connection_buffer_recv_websocket(connection, len);
+        return robotraconteurlite_tcp_connection_buffer_recv_websocket(connection, buffer, pos, len);
+    }
+
+    return robotraconteurlite_tcp_socket_recv_nonblocking(connection->sock, buffer, pos, len, &last_errno);
+}
+
+robotraconteurlite_status robotraconteurlite_tcp_connection_buffer_recv(
+    struct robotraconteurlite_connection* connection, size_t len)
+{
+    return robotraconteurlite_tcp_connection_buffer_recv_ex(connection, connection->recv_buffer,
+                                                            &connection->recv_buffer_pos, len);
+}
+
+/* Release the consumed or rejected message and move any bytes of the next message to the start of the receive
+   buffer */
+static void robotraconteurlite_tcp_connection_recv_next_message(struct robotraconteurlite_connection* connection)
+{
+    size_t message_buffer_len = connection->recv_message_len;
+
+    /* Only the start of a streamed message is in the receive buffer */
+    if (FLAGS_CHECK(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_STREAMING))
+    {
+        message_buffer_len = connection->recv_stream_offset;
+    }
+
+    if (connection->recv_buffer_pos > message_buffer_len)
+    {
+        (void)memmove(connection->recv_buffer, &connection->recv_buffer[message_buffer_len],
+                      connection->recv_buffer_pos - message_buffer_len);
+    }
+    connection->recv_buffer_pos -= message_buffer_len;
+    connection->recv_message_len = 0;
+    (void)robotraconteurlite_connection_release_recv_buffer(connection);
+    connection->recv_sink = NULL;
+    connection->recv_sink_len = 0;
+    connection->recv_sink_pos = 0;
+    connection->recv_stream_offset = 0;
+    FLAGS_CLEAR(connection->connection_state,
+                (ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_CONSUMED | ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_RECEIVED |
+                 ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_HEADER_RECEIVED |
+                 ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_HEADER_CONSUMED |
+                 ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_STREAMING | ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_REJECTED |
+                 ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_CHUNK_RECEIVED));
+    FLAGS_SET(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_RECEIVE_REQUESTED);
+}
+
+/* Receive the rest of a streamed message into the sink, or drop it if the message was rejected */
+static robotraconteurlite_status robotraconteurlite_tcp_connection_communicate_recv_stream(
+    struct robotraconteurlite_connection* connection, robotraconteurlite_timespec now)
+{
+    size_t stream_len = connection->recv_message_len - connection->recv_stream_offset;
+    size_t prev_sink_pos = connection->recv_sink_pos;
+    robotraconteurlite_status rv = -1;
+
+    if (FLAGS_CHECK(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_REJECTED))
+    {
+        /* recv_sink_pos counts the dropped bytes, the sink is overwritten by each receive */
+        size_t recv_pos = 0;
+        size_t recv_len = stream_len - connection->recv_sink_pos;
+        if (recv_len > connection->recv_sink_len)
+        {
+            recv_len = connection->recv_sink_len;
+        }
+        rv = robotraconteurlite_tcp_connection_buffer_recv_ex(connection, connection->recv_sink, &recv_pos, recv_len);
+        connection->recv_sink_pos += recv_pos;
+    }
+    else
+    {
+        rv = robotraconteurlite_tcp_connection_buffer_recv_ex(connection, connection->recv_sink,
+                                                              &connection->recv_sink_pos, stream_len);
+    }
+
+    if (FAILED(rv))
+    {
+        FLAGS_SET(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_ERROR);
+        FLAGS_CLEAR(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_RECEIVE_REQUESTED);
+        return rv;
+    }
+
+    if (connection->recv_sink_pos == prev_sink_pos)
+    {
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    }
+
+    /* A long stream is still traffic for the heartbeat timeout */
+    connection->last_recv_message_time = now;
+
+    if (connection->recv_sink_pos < stream_len)
+    {
+        if (!FLAGS_CHECK(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_REJECTED))
+        {
+            FLAGS_SET(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_CHUNK_RECEIVED);
+        }
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+    }
+
+    if (FLAGS_CHECK(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_REJECTED))
+    {
+        robotraconteurlite_tcp_connection_recv_next_message(connection);
+        return ROBOTRACONTEURLITE_ERROR_SUCCESS;
     }
 
-    return robotraconteurlite_tcp_socket_recv_nonblocking(connection->sock, connection->recv_buffer,
-                                                          &connection->recv_buffer_pos, len, &last_errno);
+    FLAGS_CLEAR(connection->connection_state, (ROBOTRACONTEURLITE_STATUS_FLAGS_RECEIVE_REQUESTED |
+                                               ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_CHUNK_RECEIVED));
+    FLAGS_SET(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_RECEIVED);
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
 }
 
 robotraconteurlite_status robotraconteurlite_tcp_connection_communicate_recv(
@@ -302,27 +401,47 @@ robotraconteurlite_status robotraconteurlite_tcp_connection_communicate_recv(
     /* If the message has been consumed, move the receive buffer to the beginning */
     if (FLAGS_CHECK(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_CONSUMED))
     {
-        if (connection->recv_buffer_pos > connection->recv_message_len)
-        {
-            (void)memmove(connection->recv_buffer, &connection->recv_buffer[connection->recv_message_len],
-                          connection->recv_buffer_pos - connection->recv_message_len);
-        }
-        connection->recv_buffer_pos -= connection->recv_message_len;
-        connection->recv_message_len = 0;
-        FLAGS_CLEAR(connection->connection_state, (ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_CONSUMED |
-                                                   ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_RECEIVED));
-        FLAGS_SET(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_RECEIVE_REQUESTED);
+        robotraconteurlite_tcp_connection_recv_next_message(connection);
+    }
+
+    if (FLAGS_CHECK(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_RECEIVE_REQUESTED) &&
+        FLAGS_CHECK(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_STREAMING))
+    {
+        return robotraconteurlite_tcp_connection_communicate_recv_stream(connection, now);
     }
 
     if (FLAGS_CHECK(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_RECEIVE_REQUESTED))
     {
+        robotraconteurlite_status rv = -1;
+        /* Receive data, up to the end of the receive buffer once the message length is known */
+        size_t recv_op_len = (connection->recv_message_len == 0U) ? 64U : connection->recv_buffer_len;
 
-        /* Receive data */
-        size_t recv_op_len =
-            (connection->recv_message_len == 0U) ? 64U : (connection->recv_buffer_len - connection->recv_buffer_pos);
+        /* A message larger than the receive buffer continues in a buffer lent from the pool once the receive buffer
+           is full, unless a pending header event handler streams or rejects it first */
+        if ((connection->recv_message_len > connection->recv_buffer_len) &&
+            (connection->recv_buffer_pos >= connection->recv_buffer_len))
+        {
+            if (robotraconteurlite_connection_is_message_header_received_event(connection) != 0)
+            {
+                return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+            }
+            rv = robotraconteurlite_connection_borrow_recv_buffer(connection);
+            if (rv == ROBOTRACONTEURLITE_ERROR_RETRY)
+            {
+                /* Wait for another connection to return a buffer */
+                return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+            }
+            if (FAILED(rv))
+            {
+                FLAGS_SET(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_ERROR);
+                FLAGS_CLEAR(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_RECEIVE_REQUESTED);
+                return rv;
+            }
+            return robotraconteurlite_tcp_connection_communicate_recv_stream(connection, now);
+        }
 
         /* Receive data */
-        robotraconteurlite_status rv = robotraconteurlite_tcp_connection_buffer_recv(connection, recv_op_len);
+        rv = robotraconteurlite_tcp_connection_buffer_recv(connection, recv_op_len);
         if (FAILED(rv))
         {
             FLAGS_SET(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_ERROR);
@@ -346,6 +465,16 @@ robotraconteurlite_status robotraconteurlite_tcp_connection_communicate_recv(
             FLAGS_CLEAR(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_RECEIVE_REQUESTED);
             FLAGS_SET(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_RECEIVED);
             connection->last_recv_message_time = now;
+            return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+        }
+
+        /* Raise the header event of a partly received message */
+        rv = robotraconteurlite_connection_check_message_header(connection);
+        if (FAILED(rv))
+        {
+            FLAGS_SET(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_ERROR);
+            FLAGS_CLEAR(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_RECEIVE_REQUESTED);
+            return rv;
         }
 
         return ROBOTRACONTEURLITE_ERROR_SUCCESS;
@@ -485,9 +614,20 @@ robotraconteurlite_status robotraconteurlite_tcp_connection_buffer_send(
     struct robotraconteurlite_tcp_transport_storage* storage = get_storage(connection);
     if (FLAGS_CHECK(storage->tcp_transport_state, ROBOTRACONTEURLITE_TCP_TRANSPORT_STATE_IS_WEBSOCKET))
     {
+        if (connection->send_buffer_vec != NULL)
+        {
+            /* Websocket masking modifies the payload in place, user memory cannot be sent directly */
+            return ROBOTRACONTEURLITE_ERROR_NOT_IMPLEMENTED;
+        }
         return robotraconteurlite_tcp_connection_buffer_send_websocket(connection, len);
     }
 
+    if (connection->send_buffer_vec != NULL)
+    {
+        return robotraconteurlite_tcp_socket_sendv_nonblocking(connection->sock, connection->send_buffer_vec,
+                                                               &connection->send_buffer_pos, len, &last_errno);
+    }
+
     return robotraconteurlite_tcp_socket_send_nonblocking(connection->sock, connection->send_buffer,
                                                           &connection->send_buffer_pos, len, &last_errno);
 }
@@ -506,6 +646,8 @@ robotraconteurlite_status robotraconteurlite_tcp_connection_communicate_send(
         FLAGS_CLEAR(connection->connection_state, (ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_SENT_CONSUMED |
                                                    ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_SENT));
         connection->send_buffer_pos = 0;
+        /* Scatter-gather segments are released once the sent event has been consumed */
+        connection->send_buffer_vec = NULL;
         return ROBOTRACONTEURLITE_ERROR_SUCCESS;
     }
 
@@ -538,8 +680,7 @@ robotraconteurlite_status robotraconteurlite_tcp_connection_communicate_send(
     else if (FLAGS_CHECK(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_SENDING))
     {
         /* Send data */
-        size_t send_op_len =
-            (connection->send_message_len == 0U) ? 64U : (connection->send_message_len - connection->send_buffer_pos);
+        size_t send_op_len = (connection->send_message_len == 0U) ? 64U : connection->send_message_len;
         robotraconteurlite_status rv = robotraconteurlite_tcp_connection_buffer_send(connection, send_op_len);
         if (FAILED(rv))
         {
@@ -813,8 +954,9 @@ static robotraconteurlite_status robotraconteurlite_tcp_connection_handshake_ser
 
         /* We are now connected using websocket! */
         FLAGS_SET(storage->tcp_transport_state, ROBOTRACONTEURLITE_TCP_TRANSPORT_STATE_IS_WEBSOCKET);
-        FLAGS_SET(connection->connection_state,
-                  ROBOTRACONTEURLITE_STATUS_FLAGS_CONNECTED | ROBOTRACONTEURLITE_STATUS_FLAGS_RECEIVE_REQUESTED);
+        FLAGS_SET(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_CONNECTED |
+                                                    ROBOTRACONTEURLITE_STATUS_FLAGS_RECEIVE_REQUESTED |
+                                                    ROBOTRACONTEURLITE_STATUS_FLAGS_SEND_COPY_ONLY);
         FLAGS_CLEAR(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_CONNECTING);
         /* Clear send buffer */
         connection->send_buffer_pos = 0;
@@ -845,7 +987,8 @@ static robotraconteurlite_status robotraconteurlite_tcp_connection_handshake_ser
         FLAGS_CLEAR(storage->tcp_transport_state, ROBOTRACONTEURLITE_TCP_TRANSPORT_STATE_IS_WEBSOCKET);
         FLAGS_SET(connection->connection_state,
                   ROBOTRACONTEURLITE_STATUS_FLAGS_CONNECTED | ROBOTRACONTEURLITE_STATUS_FLAGS_RECEIVE_REQUESTED);
-        FLAGS_CLEAR(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_CONNECTING);
+        FLAGS_CLEAR(connection->connection_state,
+                    ROBOTRACONTEURLITE_STATUS_FLAGS_CONNECTING | ROBOTRACONTEURLITE_STATUS_FLAGS_SEND_COPY_ONLY);
         return ROBOTRACONTEURLITE_ERROR_SUCCESS;
     }
 
@@ -855,6 +998,7 @@ static robotraconteurlite_status robotraconteurlite_tcp_connection_handshake_ser
     {
         /* We are connected with a websocket client, begin handshake */
         FLAGS_SET(storage->tcp_transport_state, ROBOTRACONTEURLITE_TCP_TRANSPORT_STATE_IS_WEBSOCKET);
+        FLAGS_SET(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_SEND_COPY_ONLY);
     }
     else
     {
@@ -885,8 +1029,9 @@ static robotraconteurlite_status robotraconteurlite_tcp_connection_handshake_ser
     if ((connection->send_message_len > 0U) && (connection->send_buffer_pos == connection->send_message_len))
     {
         /* We are connected using websockets! */
-        FLAGS_SET(connection->connection_state,
-                  ROBOTRACONTEURLITE_STATUS_FLAGS_CONNECTED | ROBOTRACONTEURLITE_STATUS_FLAGS_RECEIVE_REQUESTED);
+        FLAGS_SET(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_CONNECTED |
+                                                    ROBOTRACONTEURLITE_STATUS_FLAGS_RECEIVE_REQUESTED |
+                                                    ROBOTRACONTEURLITE_STATUS_FLAGS_SEND_COPY_ONLY);
         FLAGS_CLEAR(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_CONNECTING);
         FLAGS_SET(storage->tcp_transport_state, ROBOTRACONTEURLITE_TCP_TRANSPORT_STATE_IS_WEBSOCKET);
         /* Clear send buffer */
@@ -959,6 +1104,7 @@ static robotraconteurlite_status robotraconteurlite_tcp_connection_handshake_cli
     FLAGS_CLEAR(connection->connection_state,
                 (ROBOTRACONTEURLITE_STATUS_FLAGS_CONNECTING | ROBOTRACONTEURLITE_STATUS_FLAGS_BLOCK_SEND |
                  ROBOTRACONTEURLITE_STATUS_FLAGS_SENDING | ROBOTRACONTEURLITE_STATUS_FLAGS_SEND_REQUESTED));
+    FLAGS_SET(connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_SEND_COPY_ONLY);
     FLAGS_SET(storage->tcp_transport_state, ROBOTRACONTEURLITE_TCP_TRANSPORT_STATE_IS_WEBSOCKET);
     FLAGS_CLEAR(storage->tcp_transport_state, ROBOTRACONTEURLITE_TCP_TRANSPORT_STATE_IN_HTTP_HEADER);
     /* Clear send buffer */
@@ -1187,7 +1333,8 @@ robotraconteurlite_status robotraconteurlite_tcp_connect_service(
         struct robotraconteurlite_tcp_transport_storage* storage = get_storage(c);
         FLAGS_SET(storage->tcp_transport_state, ROBOTRACONTEURLITE_TCP_TRANSPORT_STATE_IS_WEBSOCKET |
                                                     ROBOTRACONTEURLITE_TCP_TRANSPORT_STATE_IN_HTTP_HEADER);
-        FLAGS_SET(c->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_BLOCK_SEND);
+        FLAGS_SET(c->connection_state,
+                  ROBOTRACONTEURLITE_STATUS_FLAGS_BLOCK_SEND | ROBOTRACONTEURLITE_STATUS_FLAGS_SEND_COPY_ONLY);
     }
     c->last_recv_message_time = connect_data->now;
     c->last_send_message_time = connect_data->now;
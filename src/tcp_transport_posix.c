@@ -21,6 +21,7 @@
 /* Linux socket includes */
 #include <sys/types.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <netinet/in.h>
 #include <netinet/tcp.h>
 #include <fcntl.h>
@@ -44,6 +45,9 @@
 
 #define FAILED ROBOTRACONTEURLITE_FAILED
 
+/* Maximum number of iovec entries passed to a single sendmsg call */
+#define ROBOTRACONTEURLITE_TCP_SENDV_MAX_IOV 16U
+
 robotraconteurlite_status robotraconteurlite_tcp_sha1(const uint8_t* data, size_t len,
                                                       struct robotraconteurlite_tcp_sha1_storage* storage)
 {
@@ -157,6 +161,79 @@ robotraconteurlite_status robotraconteurlite_tcp_socket_send_nonblocking(int soc
     return 0;
 }
 
+robotraconteurlite_status robotraconteurlite_tcp_socket_sendv_nonblocking(
+    int sock, const struct robotraconteurlite_buffer_vec* buffers, size_t* pos, size_t len, int* errno_out)
+{
+    size_t pos1 = *pos;
+    while (*pos < len)
+    {
+        struct iovec iov[ROBOTRACONTEURLITE_TCP_SENDV_MAX_IOV];
+        struct msghdr msg;
+        size_t iov_cnt = 0;
+        size_t segment_start = 0;
+        size_t i = 0;
+        ssize_t ret = 0;
+
+        /* Gather the segments covering [*pos, len) */
+        for (i = 0; (i < buffers->buffer_vec_cnt) && (iov_cnt < ROBOTRACONTEURLITE_TCP_SENDV_MAX_IOV) &&
+                    (segment_start < len);
+             i++)
+        {
+            const struct robotraconteurlite_buffer* segment = &buffers->buffer_vec[i];
+            size_t segment_end = segment_start + segment->len;
+            if (segment_end > len)
+            {
+                segment_end = len;
+            }
+            if (segment_end > *pos)
+            {
+                size_t begin = (*pos > segment_start) ? (*pos - segment_start) : 0U;
+                iov[iov_cnt].iov_base = &segment->data[begin];
+                iov[iov_cnt].iov_len = (segment_end - segment_start) - begin;
+                iov_cnt++;
+            }
+            segment_start += segment->len;
+        }
+
+        if (iov_cnt == 0U)
+        {
+            return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+        }
+
+        (void)memset(&msg, 0, sizeof(msg));
+        msg.msg_iov = iov;
+        msg.msg_iovlen = iov_cnt;
+
+        ret = sendmsg(sock, &msg, MSG_DONTWAIT);
+        if (ret < 0)
+        {
+            /* False positive cppcheck warning for errno not set */
+            /* cppcheck-suppress misra-c2012-22.10 */
+            if (errno == EWOULDBLOCK)
+            {
+                return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+            }
+            /* False positive cppcheck warning for errno not set */
+            /* cppcheck-suppress misra-c2012-22.10 */
+            *errno_out = errno;
+            return ROBOTRACONTEURLITE_ERROR_CONNECTION_ERROR;
+        }
+        *pos += ret;
+        if (ret == 0)
+        {
+            if (*pos == pos1)
+            {
+                return ROBOTRACONTEURLITE_ERROR_CONNECTION_ERROR;
+            }
+            else
+            {
+                return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+            }
+        }
+    }
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
 robotraconteurlite_status robotraconteurlite_tcp_socket_begin_server(const struct sockaddr_storage* serv_addr,
                                                                      size_t backlog, int* sock_out, int* errno_out)
 {
@@ -10,8 +10,11 @@ if [ ! -f "src/template/array_types.c.j2" ] ; then
 fi
 
 jinja2 src/template/array_types.c.j2 > src/array_types.c
+jinja2 src/template/array_convert.c.j2 > src/array_convert.c
 jinja2 src/template/array.h.j2 > include/robotraconteurlite/array.h
 jinja2 src/template/message_data.c.j2 > src/message_data.c
 jinja2 src/template/message_data.h.j2 > include/robotraconteurlite/message_data.h
+jinja2 src/template/message_struct.c.j2 test/message_struct_test_types.json > test/message_struct_test_types.c
+jinja2 src/template/message_struct.h.j2 test/message_struct_test_types.json > test/message_struct_test_types.h
 
 python3 -m pre_commit run --all
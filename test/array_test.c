@@ -345,8 +345,146 @@ void robotraconteurlite_string_test(void** state)
     assert_true(robotraconteurlite_string_cmp(&str2, &str1) == 1);
     assert_true(robotraconteurlite_string_cmp(&str1, &str3) == -1);
 
-    assert_true(robotraconteurlite_string_hash(&str1) == 0x30070005);
-    assert_true(robotraconteurlite_string_hash(&str2) == 0x30010006);
+    assert_true(robotraconteurlite_string_hash(&str1) == 0xBF5BCBF1U);
+    assert_true(robotraconteurlite_string_hash(&str2) == 0x525CE947U);
+    assert_true(robotraconteurlite_string_hash(&str1) == robotraconteurlite_string_hash(&str4));
+}
+
+void robotraconteurlite_buffer_vec_string_hash_test(void** state)
+{
+    uint8_t seg1[] = {'x', 'j', 'o', 'i', 'n'};
+    uint8_t seg2[] = {'t', '_', 'p', 'o', 's', 'i', 't', 'i', 'o', 'n'};
+    char position_data[] = "joint_position";
+    char velocity_data[] = "joint_velocity";
+    struct robotraconteurlite_string position;
+    struct robotraconteurlite_string velocity;
+    struct robotraconteurlite_buffer bufs[2];
+    struct robotraconteurlite_buffer_vec vec;
+    uint32_t hash = 0;
+
+    ROBOTRACONTEURLITE_UNUSED(state);
+
+    position.data = position_data;
+    position.len = strlen(position_data);
+    velocity.data = velocity_data;
+    velocity.len = strlen(velocity_data);
+
+    /* Names sharing length, first and last bytes must not collide */
+    assert_true(robotraconteurlite_string_hash(&position) != robotraconteurlite_string_hash(&velocity));
+    assert_true((robotraconteurlite_string_hash(&position) % 16U) != (robotraconteurlite_string_hash(&velocity) % 16U));
+
+    bufs[0].data = seg1;
+    bufs[0].len = sizeof(seg1);
+    bufs[1].data = seg2;
+    bufs[1].len = sizeof(seg2);
+    vec.buffer_vec = bufs;
+    vec.buffer_vec_cnt = 2;
+
+    assert_int_equal(robotraconteurlite_buffer_vec_string_hash(&vec, 1, position.len, &hash), 0);
+    assert_true(hash == robotraconteurlite_string_hash(&position));
+    assert_int_equal(robotraconteurlite_buffer_vec_string_hash(&vec, 2, position.len, &hash),
+                     ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE);
+}
+
+void robotraconteurlite_arraytest_buffer_vec_cursor(void** state)
+{
+    uint8_t a1[3] = {0, 0, 0};
+    uint8_t a2[4] = {0, 0, 0, 0};
+    uint8_t a3[5] = {0, 0, 0, 0, 0};
+    uint8_t src[12] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+    uint8_t dest[12];
+    struct robotraconteurlite_buffer bufs[3];
+    struct robotraconteurlite_buffer_vec vec;
+    struct robotraconteurlite_buffer_vec_cursor cursor;
+
+    ROBOTRACONTEURLITE_UNUSED(state);
+
+    bufs[0].data = a1;
+    bufs[0].len = sizeof(a1);
+    bufs[1].data = a2;
+    bufs[1].len = sizeof(a2);
+    bufs[2].data = a3;
+    bufs[2].len = sizeof(a3);
+    vec.buffer_vec = bufs;
+    vec.buffer_vec_cnt = 3;
+
+    assert_return_code(robotraconteurlite_buffer_vec_cursor_init(&cursor, &vec), 0);
+    assert_true(cursor.total_len == 12);
+
+    /* Sequential writes spanning segment boundaries */
+    assert_return_code(robotraconteurlite_buffer_vec_cursor_write(&cursor, 0, src, 2), 0);
+    assert_return_code(robotraconteurlite_buffer_vec_cursor_write(&cursor, 2, &src[2], 6), 0);
+    assert_true(cursor.segment == 2);
+    assert_return_code(robotraconteurlite_buffer_vec_cursor_write(&cursor, 8, &src[8], 4), 0);
+    assert_true(a1[2] == 2);
+    assert_true(a2[0] == 3);
+    assert_true(a3[4] == 11);
+
+    /* Backward seek and read across all segments */
+    (void)memset(dest, 0, sizeof(dest));
+    assert_return_code(robotraconteurlite_buffer_vec_cursor_read(&cursor, 1, dest, 11), 0);
+    assert_true(memcmp(dest, &src[1], 11) == 0);
+    assert_return_code(robotraconteurlite_buffer_vec_cursor_seek(&cursor, 7), 0);
+    assert_true(cursor.segment == 2);
+    assert_true(cursor.segment_pos == 0);
+
+    /* Out of range */
+    assert_true(robotraconteurlite_buffer_vec_cursor_read(&cursor, 10, dest, 3) ==
+                ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE);
+    assert_true(robotraconteurlite_buffer_vec_cursor_write(&cursor, 13, src, 0) ==
+                ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE);
+}
+
+void robotraconteurlite_buffer_vec_copy_to_mem_strided_test(void** state)
+{
+    uint16_t source_data[10];
+    uint16_t dest[15];
+    struct robotraconteurlite_buffer bufs[2];
+    struct robotraconteurlite_buffer_vec vec;
+    uint16_t i = 0;
+
+    ROBOTRACONTEURLITE_UNUSED(state);
+
+    for (i = 0; i < 10U; i++)
+    {
+        source_data[i] = (uint16_t)(i + 100U);
+    }
+
+    /* Element 1 straddles the two segments */
+    bufs[0].data = (uint8_t*)source_data;
+    bufs[0].len = 3;
+    bufs[1].data = &((uint8_t*)source_data)[3];
+    bufs[1].len = sizeof(source_data) - 3U;
+    vec.buffer_vec = bufs;
+    vec.buffer_vec_cnt = 2;
+
+    (void)memset(dest, 0, sizeof(dest));
+    assert_int_equal(robotraconteurlite_buffer_vec_copy_to_mem_strided(&vec, 0, (uint8_t*)dest, sizeof(dest),
+                                                                       3U * sizeof(uint16_t), sizeof(uint16_t), 5),
+                     0);
+    for (i = 0; i < 15U; i++)
+    {
+        assert_true(dest[i] == (((i % 3U) == 0U) ? (uint16_t)(100U + (i / 3U)) : 0U));
+    }
+
+    /* Sub-range into a contiguous destination */
+    (void)memset(dest, 0, sizeof(dest));
+    assert_int_equal(robotraconteurlite_buffer_vec_copy_to_mem_strided(&vec, 6U * sizeof(uint16_t), (uint8_t*)dest,
+                                                                       sizeof(dest), sizeof(uint16_t),
+                                                                       sizeof(uint16_t), 4),
+                     0);
+    assert_true((dest[0] == 106U) && (dest[3] == 109U) && (dest[4] == 0U));
+
+    assert_int_equal(robotraconteurlite_buffer_vec_copy_to_mem_strided(&vec, 0, (uint8_t*)dest, sizeof(dest), 1U,
+                                                                       sizeof(uint16_t), 2),
+                     ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER);
+    assert_int_equal(robotraconteurlite_buffer_vec_copy_to_mem_strided(&vec, 0, (uint8_t*)dest, sizeof(dest),
+                                                                       4U * sizeof(uint16_t), sizeof(uint16_t), 5),
+                     ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE);
+    assert_int_equal(robotraconteurlite_buffer_vec_copy_to_mem_strided(&vec, 2U * sizeof(uint16_t), (uint8_t*)dest,
+                                                                       sizeof(dest), sizeof(uint16_t),
+                                                                       sizeof(uint16_t), 9),
+                     ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE);
 }
 
 int main(void)
@@ -354,7 +492,10 @@ int main(void)
     const struct CMUnitTest tests[] = {cmocka_unit_test(robotraconteurlite_arraytest_buffer),
                                        cmocka_unit_test(robotraconteurlite_arraytest_buffer_vec_copy_vec),
                                        cmocka_unit_test(robotraconteurlite_arraytest_buffer_vec_copy_vec_ex),
+                                       cmocka_unit_test(robotraconteurlite_arraytest_buffer_vec_cursor),
                                        cmocka_unit_test(robotraconteurlite_buffer_copy_to_double_test),
-                                       cmocka_unit_test(robotraconteurlite_string_test)};
+                                       cmocka_unit_test(robotraconteurlite_string_test),
+                                       cmocka_unit_test(robotraconteurlite_buffer_vec_string_hash_test),
+                                       cmocka_unit_test(robotraconteurlite_buffer_vec_copy_to_mem_strided_test)};
     return cmocka_run_group_tests(tests, NULL, NULL);
 }
@@ -0,0 +1,602 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+
+#include "robotraconteurlite/node.h"
+#include "robotraconteurlite/tcp_transport.h"
+
+#define inline
+#include <cmocka.h>
+
+/* The server receive buffer is smaller than the test message so the rest of it goes to a pool buffer */
+#define ROBOTRACONTEURLITE_CONNECTION_TEST_SERVER_BUFFER_SIZE 1032U
+#define ROBOTRACONTEURLITE_CONNECTION_TEST_CLIENT_BUFFER_SIZE 4096U
+#define ROBOTRACONTEURLITE_CONNECTION_TEST_ARRAY_LEN 600U
+/* Message that fits the server receive buffer with less than 64 bytes to spare */
+#define ROBOTRACONTEURLITE_CONNECTION_TEST_NEARLY_FULL_ARRAY_LEN 235U
+#define ROBOTRACONTEURLITE_CONNECTION_TEST_MAX_ITERATIONS 1000U
+
+static void robotraconteurlite_connection_test_init_node(struct robotraconteurlite_node* node,
+                                                         struct robotraconteurlite_connection connections[],
+                                                         uint8_t buffers[], size_t buffer_size, int is_server)
+{
+    struct robotraconteurlite_connection* connections_head = NULL;
+    struct robotraconteurlite_nodeid nodeid;
+    struct robotraconteurlite_string nodename;
+
+    connections_head = robotraconteurlite_connections_init_from_array(connections, 2U, buffers, buffer_size, 4U);
+    assert_true(connections_head != NULL);
+    if (is_server != 0)
+    {
+        robotraconteurlite_tcp_connection_init_connections_server(connections_head);
+        robotraconteurlite_string_from_c_str("test_server", &nodename);
+    }
+    else
+    {
+        robotraconteurlite_tcp_connection_init_connections_client(connections_head);
+        robotraconteurlite_string_from_c_str("test_client", &nodename);
+    }
+    assert_return_code(robotraconteurlite_nodeid_newrandom(&nodeid), 0);
+    assert_return_code(robotraconteurlite_node_init(node, &nodeid, &nodename, connections_head), 0);
+}
+
+/* Listen on a free loopback port and fill in the address of the test service */
+static void robotraconteurlite_connection_test_listen(struct robotraconteurlite_connection_acceptor* acceptor,
+                                                      struct robotraconteurlite_addr* service_addr)
+{
+    struct sockaddr_storage listen_addr;
+    struct sockaddr_in* listen_addr_in = (struct sockaddr_in*)&listen_addr;
+    socklen_t listen_addr_len = sizeof(listen_addr);
+
+    (void)memset(&listen_addr, 0, sizeof(listen_addr));
+    listen_addr_in->sin_family = AF_INET;
+    listen_addr_in->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    assert_return_code(robotraconteurlite_tcp_acceptor_listen(acceptor, &listen_addr, 4), 0);
+    assert_return_code(getsockname(acceptor->sock, (struct sockaddr*)&listen_addr, &listen_addr_len), 0);
+
+    (void)memset(service_addr, 0, sizeof(struct robotraconteurlite_addr));
+    (void)memcpy(&service_addr->socket_addr, &listen_addr, sizeof(struct sockaddr_in));
+    robotraconteurlite_string_from_c_str("test_service", &service_addr->service_name);
+}
+
+static void robotraconteurlite_connection_test_communicate(struct robotraconteurlite_connection_acceptor* acceptor,
+                                                           struct robotraconteurlite_node* server_node,
+                                                           struct robotraconteurlite_node* client_node)
+{
+    assert_return_code(robotraconteurlite_tcp_acceptor_communicate(acceptor, server_node->connections_head, 0), 0);
+    assert_return_code(robotraconteurlite_tcp_connections_communicate(server_node->connections_head, 0), 0);
+    assert_return_code(robotraconteurlite_tcp_connections_communicate(client_node->connections_head, 0), 0);
+}
+
+/* Answer the handshake requests of the client until the end of the event cycle */
+static void robotraconteurlite_connection_test_serve(struct robotraconteurlite_node* server_node)
+{
+    struct robotraconteurlite_event event;
+    struct robotraconteurlite_node_service_object service_object;
+    robotraconteurlite_status rv = -1;
+
+    robotraconteurlite_string_from_c_str("test_service", &service_object.service_path);
+    robotraconteurlite_string_from_c_str("example.test_service.test_object", &service_object.qualified_type);
+    service_object.service_def = NULL;
+
+    do
+    {
+        assert_return_code(robotraconteurlite_node_next_event(server_node, &event, 0), 0);
+        if (event.event_type == ROBOTRACONTEURLITE_EVENT_TYPE_MESSAGE_RECEIVED)
+        {
+            rv = robotraconteurlite_node_event_special_request(server_node, &event);
+            if (rv == ROBOTRACONTEURLITE_ERROR_CONSUMED)
+            {
+                continue;
+            }
+            assert_return_code(rv, 0);
+            assert_int_equal(event.received_message.received_message_entry_header.entry_type,
+                             ROBOTRACONTEURLITE_MESSAGEENTRYTYPE_OBJECTTYPENAME);
+            assert_return_code(
+                robotraconteurlite_node_event_special_request_object_type_name(server_node, &event, &service_object, 1),
+                0);
+        }
+        assert_return_code(robotraconteurlite_node_consume_event(server_node, &event), 0);
+    } while (event.event_type != ROBOTRACONTEURLITE_EVENT_TYPE_NEXT_CYCLE);
+}
+
+/* Connect a client connection to the test service and run the client handshake */
+static struct robotraconteurlite_connection* robotraconteurlite_connection_test_connect(
+    struct robotraconteurlite_connection_acceptor* acceptor, struct robotraconteurlite_node* server_node,
+    struct robotraconteurlite_node* client_node, struct robotraconteurlite_addr* service_addr)
+{
+    struct robotraconteurlite_tcp_connect_service_data connect_data;
+    struct robotraconteurlite_client_handshake_data handshake_data;
+    struct robotraconteurlite_event event;
+    robotraconteurlite_status rv = ROBOTRACONTEURLITE_ERROR_RETRY;
+    size_t i = 0;
+
+    (void)memset(&connect_data, 0, sizeof(connect_data));
+    connect_data.connections_head = client_node->connections_head;
+    connect_data.service_address = service_addr;
+    assert_return_code(robotraconteurlite_tcp_connect_service(&connect_data, 0), 0);
+
+    (void)memset(&handshake_data, 0, sizeof(handshake_data));
+    handshake_data.node = client_node;
+    handshake_data.connection = connect_data.client_out;
+    for (i = 0; (i < ROBOTRACONTEURLITE_CONNECTION_TEST_MAX_ITERATIONS) && (rv == ROBOTRACONTEURLITE_ERROR_RETRY);
+         i++)
+    {
+        robotraconteurlite_connection_test_communicate(acceptor, server_node, client_node);
+        robotraconteurlite_connection_test_serve(server_node);
+        assert_return_code(robotraconteurlite_node_next_event(client_node, &event, 0), 0);
+        rv = robotraconteurlite_client_handshake(&handshake_data, &event, 0);
+    }
+    assert_int_equal(rv, ROBOTRACONTEURLITE_ERROR_SUCCESS);
+    assert_true(robotraconteurlite_connection_is_connected(connect_data.client_out) != 0);
+
+    return connect_data.client_out;
+}
+
+/* Send a message with an int32 array element of array_len elements */
+static void robotraconteurlite_connection_test_send(struct robotraconteurlite_node* client_node,
+                                                    struct robotraconteurlite_connection* client_connection,
+                                                    size_t array_len)
+{
+    struct robotraconteurlite_node_send_messageentry_data send_data;
+    struct robotraconteurlite_messageentry_header entry_header;
+    struct robotraconteurlite_string value_name;
+    int32_t value_data[ROBOTRACONTEURLITE_CONNECTION_TEST_ARRAY_LEN];
+    struct robotraconteurlite_array_int32 value;
+    size_t i = 0;
+
+    for (i = 0; i < array_len; i++)
+    {
+        value_data[i] = (int32_t)(i * 3U);
+    }
+    value.data = value_data;
+    value.len = array_len;
+
+    (void)memset(&send_data, 0, sizeof(send_data));
+    (void)memset(&entry_header, 0, sizeof(entry_header));
+    entry_header.entry_type = ROBOTRACONTEURLITE_MESSAGEENTRYTYPE_PROPERTYSETREQ;
+    robotraconteurlite_string_from_c_str("test_service", &entry_header.service_path);
+    robotraconteurlite_string_from_c_str("value", &entry_header.member_name);
+    robotraconteurlite_string_from_c_str("value", &value_name);
+    send_data.node = client_node;
+    send_data.connection = client_connection;
+    send_data.message_entry_header = &entry_header;
+
+    assert_return_code(robotraconteurlite_node_begin_send_messageentry(&send_data), 0);
+    assert_return_code(
+        robotraconteurlite_messageelement_writer_write_int32_array(&send_data.element_writer, &value_name, &value), 0);
+    assert_return_code(robotraconteurlite_node_end_send_messageentry(&send_data), 0);
+}
+
+/* Consume the client events of one event cycle, such as the completed sends */
+static void robotraconteurlite_connection_test_consume_client_events(struct robotraconteurlite_node* client_node)
+{
+    struct robotraconteurlite_event event;
+
+    do
+    {
+        assert_return_code(robotraconteurlite_node_next_event(client_node, &event, 0), 0);
+        assert_return_code(robotraconteurlite_node_consume_event(client_node, &event), 0);
+    } while (event.event_type != ROBOTRACONTEURLITE_EVENT_TYPE_NEXT_CYCLE);
+}
+
+/* Run the transports until the server node has a message or closed event, consuming other events */
+static void robotraconteurlite_connection_test_next_event(struct robotraconteurlite_connection_acceptor* acceptor,
+                                                          struct robotraconteurlite_node* server_node,
+                                                          struct robotraconteurlite_node* client_node,
+                                                          struct robotraconteurlite_event* event)
+{
+    size_t i = 0;
+
+    for (i = 0; i < ROBOTRACONTEURLITE_CONNECTION_TEST_MAX_ITERATIONS; i++)
+    {
+        robotraconteurlite_connection_test_communicate(acceptor, server_node, client_node);
+        robotraconteurlite_connection_test_consume_client_events(client_node);
+        assert_return_code(robotraconteurlite_node_next_event(server_node, event, 0), 0);
+        if ((event->event_type == ROBOTRACONTEURLITE_EVENT_TYPE_MESSAGE_RECEIVED) ||
+            (event->event_type == ROBOTRACONTEURLITE_EVENT_TYPE_CONNECTION_CLOSED))
+        {
+            break;
+        }
+        assert_return_code(robotraconteurlite_node_consume_event(server_node, event), 0);
+    }
+    assert_true(i < ROBOTRACONTEURLITE_CONNECTION_TEST_MAX_ITERATIONS);
+}
+
+/* Run the transports until the receive buffer of the server connection is full, before a pool buffer is borrowed */
+static void robotraconteurlite_connection_test_receive_until_full(
+    struct robotraconteurlite_connection_acceptor* acceptor, struct robotraconteurlite_node* server_node,
+    struct robotraconteurlite_node* client_node, struct robotraconteurlite_connection* server_connection)
+{
+    size_t i = 0;
+
+    for (i = 0; (i < ROBOTRACONTEURLITE_CONNECTION_TEST_MAX_ITERATIONS) &&
+                (server_connection->recv_buffer_pos < server_connection->recv_buffer_len);
+         i++)
+    {
+        robotraconteurlite_connection_test_communicate(acceptor, server_node, client_node);
+    }
+    assert_int_equal(server_connection->recv_buffer_pos, server_connection->recv_buffer_len);
+    assert_true(server_connection->recv_message_len > server_connection->recv_buffer_len);
+}
+
+static void robotraconteurlite_connection_test_check_message(struct robotraconteurlite_event* event, size_t array_len)
+{
+    struct robotraconteurlite_messageelement_reader element_reader;
+    struct robotraconteurlite_string value_name;
+    int32_t value_data[ROBOTRACONTEURLITE_CONNECTION_TEST_ARRAY_LEN];
+    struct robotraconteurlite_array_int32 value;
+    size_t i = 0;
+
+    assert_int_equal(event->event_type, ROBOTRACONTEURLITE_EVENT_TYPE_MESSAGE_RECEIVED);
+    assert_int_equal(event->event_error_code, ROBOTRACONTEURLITE_ERROR_SUCCESS);
+
+    (void)memset(value_data, 0, sizeof(value_data));
+    value.data = value_data;
+    value.len = ROBOTRACONTEURLITE_CONNECTION_TEST_ARRAY_LEN;
+    robotraconteurlite_string_from_c_str("value", &value_name);
+    assert_return_code(robotraconteurlite_messageentry_reader_find_element(&event->received_message.entry_reader,
+                                                                           &value_name, &element_reader),
+                       0);
+    assert_return_code(robotraconteurlite_messageelement_reader_read_data_int32_array(&element_reader, &value), 0);
+    assert_int_equal(value.len, array_len);
+    for (i = 0; i < array_len; i++)
+    {
+        assert_int_equal(value_data[i], (int32_t)(i * 3U));
+    }
+}
+
+static void robotraconteurlite_connection_pool_borrow_test(void** state)
+{
+    struct robotraconteurlite_node server_node;
+    struct robotraconteurlite_node client_node;
+    struct robotraconteurlite_connection server_connections[2];
+    struct robotraconteurlite_connection client_connections[2];
+    uint8_t server_buffers[4U * ROBOTRACONTEURLITE_CONNECTION_TEST_SERVER_BUFFER_SIZE];
+    uint8_t client_buffers[4U * ROBOTRACONTEURLITE_CONNECTION_TEST_CLIENT_BUFFER_SIZE];
+    struct robotraconteurlite_connection_buffer_pool pool;
+    struct robotraconteurlite_connection_buffer_pool_entry pool_entries[2];
+    uint8_t pool_buffers[2U * 2048U];
+    struct robotraconteurlite_connection_acceptor acceptor;
+    struct robotraconteurlite_addr service_addr;
+    struct robotraconteurlite_connection* client_connection = NULL;
+    struct robotraconteurlite_connection* server_connection = &server_connections[0];
+    struct robotraconteurlite_event event;
+    ROBOTRACONTEURLITE_UNUSED(state);
+
+    robotraconteurlite_connection_test_init_node(&server_node, server_connections, server_buffers,
+                                                 ROBOTRACONTEURLITE_CONNECTION_TEST_SERVER_BUFFER_SIZE, 1);
+    robotraconteurlite_connection_test_init_node(&client_node, client_connections, client_buffers,
+                                                 ROBOTRACONTEURLITE_CONNECTION_TEST_CLIENT_BUFFER_SIZE, 0);
+    assert_return_code(robotraconteurlite_connection_buffer_pool_init(&pool, pool_entries, 2U, pool_buffers, 2048U),
+                       0);
+    assert_return_code(robotraconteurlite_connections_set_recv_buffer_pool(server_node.connections_head, &pool), 0);
+    robotraconteurlite_connection_test_listen(&acceptor, &service_addr);
+    client_connection =
+        robotraconteurlite_connection_test_connect(&acceptor, &server_node, &client_node, &service_addr);
+
+    robotraconteurlite_connection_test_send(&client_node, client_connection,
+                                            ROBOTRACONTEURLITE_CONNECTION_TEST_ARRAY_LEN);
+    assert_true(client_connection->send_message_len > (ROBOTRACONTEURLITE_CONNECTION_TEST_SERVER_BUFFER_SIZE + 512U));
+    assert_true(client_connection->send_message_len < (ROBOTRACONTEURLITE_CONNECTION_TEST_SERVER_BUFFER_SIZE + 2048U));
+    robotraconteurlite_connection_test_next_event(&acceptor, &server_node, &client_node, &event);
+    assert_true(event.connection == server_connection);
+
+    /* The rest of the message is received in a pool buffer */
+    assert_true(ROBOTRACONTEURLITE_FLAGS_CHECK(server_connection->connection_state,
+                                               ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_STREAMING));
+    assert_true(pool_entries[0].owner == server_connection);
+    assert_true(pool_entries[1].owner == NULL);
+    assert_true(server_connection->recv_sink == pool_entries[0].data);
+    assert_int_equal(server_connection->recv_stream_offset, ROBOTRACONTEURLITE_CONNECTION_TEST_SERVER_BUFFER_SIZE);
+    assert_int_equal(server_connection->recv_stream_offset + server_connection->recv_sink_pos,
+                     server_connection->recv_message_len);
+    robotraconteurlite_connection_test_check_message(&event, ROBOTRACONTEURLITE_CONNECTION_TEST_ARRAY_LEN);
+
+    /* The buffer is returned once the consumed message is released */
+    assert_return_code(robotraconteurlite_node_consume_event(&server_node, &event), 0);
+    assert_true(pool_entries[0].owner == server_connection);
+    robotraconteurlite_connection_test_communicate(&acceptor, &server_node, &client_node);
+    assert_true(pool_entries[0].owner == NULL);
+    assert_true(server_connection->recv_sink == NULL);
+    assert_false(ROBOTRACONTEURLITE_FLAGS_CHECK(server_connection->connection_state,
+                                                ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_STREAMING |
+                                                    ROBOTRACONTEURLITE_STATUS_FLAGS_ERROR));
+
+    /* The next message borrows again */
+    robotraconteurlite_connection_test_send(&client_node, client_connection,
+                                            ROBOTRACONTEURLITE_CONNECTION_TEST_ARRAY_LEN);
+    robotraconteurlite_connection_test_next_event(&acceptor, &server_node, &client_node, &event);
+    assert_true(pool_entries[0].owner == server_connection);
+    robotraconteurlite_connection_test_check_message(&event, ROBOTRACONTEURLITE_CONNECTION_TEST_ARRAY_LEN);
+    assert_return_code(robotraconteurlite_node_consume_event(&server_node, &event), 0);
+
+    robotraconteurlite_tcp_connections_close(client_node.connections_head);
+    robotraconteurlite_tcp_connections_close(server_node.connections_head);
+    assert_return_code(robotraconteurlite_tcp_acceptor_close(&acceptor), 0);
+}
+
+static void robotraconteurlite_connection_pool_release_on_close_test(void** state)
+{
+    struct robotraconteurlite_node server_node;
+    struct robotraconteurlite_node client_node;
+    struct robotraconteurlite_connection server_connections[2];
+    struct robotraconteurlite_connection client_connections[2];
+    uint8_t server_buffers[4U * ROBOTRACONTEURLITE_CONNECTION_TEST_SERVER_BUFFER_SIZE];
+    uint8_t client_buffers[4U * ROBOTRACONTEURLITE_CONNECTION_TEST_CLIENT_BUFFER_SIZE];
+    struct robotraconteurlite_connection_buffer_pool pool;
+    struct robotraconteurlite_connection_buffer_pool_entry pool_entries[1];
+    uint8_t pool_buffers[2048U];
+    struct robotraconteurlite_connection_acceptor acceptor;
+    struct robotraconteurlite_addr service_addr;
+    struct robotraconteurlite_connection* client_connection = NULL;
+    struct robotraconteurlite_connection* server_connection = &server_connections[0];
+    struct robotraconteurlite_event event;
+    ROBOTRACONTEURLITE_UNUSED(state);
+
+    robotraconteurlite_connection_test_init_node(&server_node, server_connections, server_buffers,
+                                                 ROBOTRACONTEURLITE_CONNECTION_TEST_SERVER_BUFFER_SIZE, 1);
+    robotraconteurlite_connection_test_init_node(&client_node, client_connections, client_buffers,
+                                                 ROBOTRACONTEURLITE_CONNECTION_TEST_CLIENT_BUFFER_SIZE, 0);
+    assert_return_code(robotraconteurlite_connection_buffer_pool_init(&pool, pool_entries, 1U, pool_buffers, 2048U),
+                       0);
+    assert_return_code(robotraconteurlite_connections_set_recv_buffer_pool(server_node.connections_head, &pool), 0);
+    robotraconteurlite_connection_test_listen(&acceptor, &service_addr);
+    client_connection =
+        robotraconteurlite_connection_test_connect(&acceptor, &server_node, &client_node, &service_addr);
+
+    robotraconteurlite_connection_test_send(&client_node, client_connection,
+                                            ROBOTRACONTEURLITE_CONNECTION_TEST_ARRAY_LEN);
+    robotraconteurlite_connection_test_next_event(&acceptor, &server_node, &client_node, &event);
+    assert_int_equal(event.event_type, ROBOTRACONTEURLITE_EVENT_TYPE_MESSAGE_RECEIVED);
+    assert_true(pool_entries[0].owner == server_connection);
+
+    /* The buffer stays lent until the closed event is consumed and the connection is reset */
+    assert_return_code(robotraconteurlite_connection_close(server_connection), 0);
+    robotraconteurlite_connection_test_next_event(&acceptor, &server_node, &client_node, &event);
+    assert_int_equal(event.event_type, ROBOTRACONTEURLITE_EVENT_TYPE_CONNECTION_CLOSED);
+    assert_true(event.connection == server_connection);
+    assert_true(pool_entries[0].owner == server_connection);
+    assert_return_code(robotraconteurlite_node_consume_event(&server_node, &event), 0);
+    robotraconteurlite_connection_test_communicate(&acceptor, &server_node, &client_node);
+
+    assert_true(pool_entries[0].owner == NULL);
+    assert_true(server_connection->recv_sink == NULL);
+    assert_int_equal(server_connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_IDLE);
+
+    robotraconteurlite_tcp_connections_close(client_node.connections_head);
+    robotraconteurlite_tcp_connections_close(server_node.connections_head);
+    assert_return_code(robotraconteurlite_tcp_acceptor_close(&acceptor), 0);
+}
+
+static void robotraconteurlite_connection_pool_exhausted_test(void** state)
+{
+    struct robotraconteurlite_node server_node;
+    struct robotraconteurlite_node client_node;
+    struct robotraconteurlite_connection server_connections[2];
+    struct robotraconteurlite_connection client_connections[2];
+    uint8_t server_buffers[4U * ROBOTRACONTEURLITE_CONNECTION_TEST_SERVER_BUFFER_SIZE];
+    uint8_t client_buffers[4U * ROBOTRACONTEURLITE_CONNECTION_TEST_CLIENT_BUFFER_SIZE];
+    struct robotraconteurlite_connection_buffer_pool pool;
+    struct robotraconteurlite_connection_buffer_pool_entry pool_entries[1];
+    uint8_t pool_buffers[2048U];
+    struct robotraconteurlite_connection_acceptor acceptor;
+    struct robotraconteurlite_addr service_addr;
+    struct robotraconteurlite_connection* client_connection1 = NULL;
+    struct robotraconteurlite_connection* client_connection2 = NULL;
+    struct robotraconteurlite_event event;
+    ROBOTRACONTEURLITE_UNUSED(state);
+
+    robotraconteurlite_connection_test_init_node(&server_node, server_connections, server_buffers,
+                                                 ROBOTRACONTEURLITE_CONNECTION_TEST_SERVER_BUFFER_SIZE, 1);
+    robotraconteurlite_connection_test_init_node(&client_node, client_connections, client_buffers,
+                                                 ROBOTRACONTEURLITE_CONNECTION_TEST_CLIENT_BUFFER_SIZE, 0);
+    assert_return_code(robotraconteurlite_connection_buffer_pool_init(&pool, pool_entries, 1U, pool_buffers, 2048U),
+                       0);
+    assert_return_code(robotraconteurlite_connections_set_recv_buffer_pool(server_node.connections_head, &pool), 0);
+    robotraconteurlite_connection_test_listen(&acceptor, &service_addr);
+    client_connection1 =
+        robotraconteurlite_connection_test_connect(&acceptor, &server_node, &client_node, &service_addr);
+    client_connection2 =
+        robotraconteurlite_connection_test_connect(&acceptor, &server_node, &client_node, &service_addr);
+    assert_true(client_connection1 != client_connection2);
+
+    /* The first connection holds the only pool buffer while its message is not consumed */
+    robotraconteurlite_connection_test_send(&client_node, client_connection1,
+                                            ROBOTRACONTEURLITE_CONNECTION_TEST_ARRAY_LEN);
+    robotraconteurlite_connection_test_next_event(&acceptor, &server_node, &client_node, &event);
+    assert_true(event.connection == &server_connections[0]);
+    assert_true(pool_entries[0].owner == &server_connections[0]);
+
+    /* The second connection waits with a full receive buffer */
+    robotraconteurlite_connection_test_send(&client_node, client_connection2,
+                                            ROBOTRACONTEURLITE_CONNECTION_TEST_ARRAY_LEN);
+    robotraconteurlite_connection_test_receive_until_full(&acceptor, &server_node, &client_node,
+                                                          &server_connections[1]);
+    assert_int_equal(robotraconteurlite_connection_borrow_recv_buffer(&server_connections[1]),
+                     ROBOTRACONTEURLITE_ERROR_RETRY);
+    robotraconteurlite_connection_test_communicate(&acceptor, &server_node, &client_node);
+    assert_false(ROBOTRACONTEURLITE_FLAGS_CHECK(server_connections[1].connection_state,
+                                                ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_STREAMING |
+                                                    ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_RECEIVED |
+                                                    ROBOTRACONTEURLITE_STATUS_FLAGS_ERROR));
+    assert_int_equal(server_connections[1].recv_buffer_pos, ROBOTRACONTEURLITE_CONNECTION_TEST_SERVER_BUFFER_SIZE);
+
+    /* The receive continues once the first message is consumed and its buffer returned */
+    robotraconteurlite_connection_test_check_message(&event, ROBOTRACONTEURLITE_CONNECTION_TEST_ARRAY_LEN);
+    assert_return_code(robotraconteurlite_node_consume_event(&server_node, &event), 0);
+    robotraconteurlite_connection_test_next_event(&acceptor, &server_node, &client_node, &event);
+    assert_true(event.connection == &server_connections[1]);
+    assert_true(pool_entries[0].owner == &server_connections[1]);
+    robotraconteurlite_connection_test_check_message(&event, ROBOTRACONTEURLITE_CONNECTION_TEST_ARRAY_LEN);
+    assert_return_code(robotraconteurlite_node_consume_event(&server_node, &event), 0);
+
+    robotraconteurlite_tcp_connections_close(client_node.connections_head);
+    robotraconteurlite_tcp_connections_close(server_node.connections_head);
+    assert_return_code(robotraconteurlite_tcp_acceptor_close(&acceptor), 0);
+}
+
+static void robotraconteurlite_connection_pool_too_small_test(void** state)
+{
+    struct robotraconteurlite_node server_node;
+    struct robotraconteurlite_node client_node;
+    struct robotraconteurlite_connection server_connections[2];
+    struct robotraconteurlite_connection client_connections[2];
+    uint8_t server_buffers[4U * ROBOTRACONTEURLITE_CONNECTION_TEST_SERVER_BUFFER_SIZE];
+    uint8_t client_buffers[4U * ROBOTRACONTEURLITE_CONNECTION_TEST_CLIENT_BUFFER_SIZE];
+    struct robotraconteurlite_connection_buffer_pool pool;
+    struct robotraconteurlite_connection_buffer_pool_entry pool_entries[2];
+    uint8_t pool_buffers[2U * 512U];
+    struct robotraconteurlite_connection_acceptor acceptor;
+    struct robotraconteurlite_addr service_addr;
+    struct robotraconteurlite_connection* client_connection = NULL;
+    struct robotraconteurlite_connection* server_connection = &server_connections[0];
+    ROBOTRACONTEURLITE_UNUSED(state);
+
+    robotraconteurlite_connection_test_init_node(&server_node, server_connections, server_buffers,
+                                                 ROBOTRACONTEURLITE_CONNECTION_TEST_SERVER_BUFFER_SIZE, 1);
+    robotraconteurlite_connection_test_init_node(&client_node, client_connections, client_buffers,
+                                                 ROBOTRACONTEURLITE_CONNECTION_TEST_CLIENT_BUFFER_SIZE, 0);
+    assert_return_code(robotraconteurlite_connection_buffer_pool_init(&pool, pool_entries, 2U, pool_buffers, 512U),
+                       0);
+    assert_return_code(robotraconteurlite_connections_set_recv_buffer_pool(server_node.connections_head, &pool), 0);
+    robotraconteurlite_connection_test_listen(&acceptor, &service_addr);
+    client_connection =
+        robotraconteurlite_connection_test_connect(&acceptor, &server_node, &client_node, &service_addr);
+
+    /* No pool buffer holds the rest of the message, even though all are free */
+    robotraconteurlite_connection_test_send(&client_node, client_connection,
+                                            ROBOTRACONTEURLITE_CONNECTION_TEST_ARRAY_LEN);
+    robotraconteurlite_connection_test_receive_until_full(&acceptor, &server_node, &client_node, server_connection);
+    assert_int_equal(robotraconteurlite_connection_borrow_recv_buffer(server_connection),
+                     ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE);
+    assert_int_equal(robotraconteurlite_tcp_connection_communicate(server_connection, 0),
+                     ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE);
+    assert_true(
+        ROBOTRACONTEURLITE_FLAGS_CHECK(server_connection->connection_state, ROBOTRACONTEURLITE_STATUS_FLAGS_ERROR));
+    assert_false(ROBOTRACONTEURLITE_FLAGS_CHECK(server_connection->connection_state,
+                                                ROBOTRACONTEURLITE_STATUS_FLAGS_RECEIVE_REQUESTED |
+                                                    ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_STREAMING));
+    assert_true(pool_entries[0].owner == NULL);
+    assert_true(pool_entries[1].owner == NULL);
+
+    /* Without a pool the message cannot be received either */
+    assert_return_code(robotraconteurlite_connections_set_recv_buffer_pool(server_node.connections_head, NULL), 0);
+    assert_int_equal(robotraconteurlite_connection_borrow_recv_buffer(server_connection),
+                     ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE);
+    assert_return_code(robotraconteurlite_connection_release_recv_buffer(server_connection), 0);
+
+    robotraconteurlite_tcp_connections_close(client_node.connections_head);
+    robotraconteurlite_tcp_connections_close(server_node.connections_head);
+    assert_return_code(robotraconteurlite_tcp_acceptor_close(&acceptor), 0);
+}
+
+static void robotraconteurlite_connection_recv_nearly_full_test(void** state)
+{
+    struct robotraconteurlite_node server_node;
+    struct robotraconteurlite_node client_node;
+    struct robotraconteurlite_connection server_connections[2];
+    struct robotraconteurlite_connection client_connections[2];
+    uint8_t server_buffers[4U * ROBOTRACONTEURLITE_CONNECTION_TEST_SERVER_BUFFER_SIZE];
+    uint8_t client_buffers[4U * ROBOTRACONTEURLITE_CONNECTION_TEST_CLIENT_BUFFER_SIZE];
+    struct robotraconteurlite_connection_acceptor acceptor;
+    struct robotraconteurlite_addr service_addr;
+    struct robotraconteurlite_connection* client_connection = NULL;
+    struct robotraconteurlite_event event;
+    ROBOTRACONTEURLITE_UNUSED(state);
+
+    robotraconteurlite_connection_test_init_node(&server_node, server_connections, server_buffers,
+                                                 ROBOTRACONTEURLITE_CONNECTION_TEST_SERVER_BUFFER_SIZE, 1);
+    robotraconteurlite_connection_test_init_node(&client_node, client_connections, client_buffers,
+                                                 ROBOTRACONTEURLITE_CONNECTION_TEST_CLIENT_BUFFER_SIZE, 0);
+    robotraconteurlite_connection_test_listen(&acceptor, &service_addr);
+    client_connection =
+        robotraconteurlite_connection_test_connect(&acceptor, &server_node, &client_node, &service_addr);
+
+    /* The receive length is an end position in the receive buffer. A message that needs more than the free space
+       left after the first receive still arrives in full. */
+    robotraconteurlite_connection_test_send(&client_node, client_connection,
+                                            ROBOTRACONTEURLITE_CONNECTION_TEST_NEARLY_FULL_ARRAY_LEN);
+    assert_true(client_connection->send_message_len > (ROBOTRACONTEURLITE_CONNECTION_TEST_SERVER_BUFFER_SIZE - 64U));
+    assert_true(client_connection->send_message_len <= ROBOTRACONTEURLITE_CONNECTION_TEST_SERVER_BUFFER_SIZE);
+    robotraconteurlite_connection_test_next_event(&acceptor, &server_node, &client_node, &event);
+    assert_true(event.connection == &server_connections[0]);
+    robotraconteurlite_connection_test_check_message(&event, ROBOTRACONTEURLITE_CONNECTION_TEST_NEARLY_FULL_ARRAY_LEN);
+    assert_return_code(robotraconteurlite_node_consume_event(&server_node, &event), 0);
+
+    robotraconteurlite_tcp_connections_close(client_node.connections_head);
+    robotraconteurlite_tcp_connections_close(server_node.connections_head);
+    assert_return_code(robotraconteurlite_tcp_acceptor_close(&acceptor), 0);
+}
+
+static void robotraconteurlite_connection_send_copy_only_test(void** state)
+{
+    struct robotraconteurlite_node server_node;
+    struct robotraconteurlite_node client_node;
+    struct robotraconteurlite_connection server_connections[2];
+    struct robotraconteurlite_connection client_connections[2];
+    uint8_t server_buffers[4U * ROBOTRACONTEURLITE_CONNECTION_TEST_CLIENT_BUFFER_SIZE];
+    uint8_t client_buffers[4U * ROBOTRACONTEURLITE_CONNECTION_TEST_CLIENT_BUFFER_SIZE];
+    struct robotraconteurlite_connection_acceptor acceptor;
+    struct robotraconteurlite_addr service_addr;
+    struct robotraconteurlite_connection* client_connection = NULL;
+    struct robotraconteurlite_connection* websocket_connection = NULL;
+    struct robotraconteurlite_message_writer message_writer;
+    struct robotraconteurlite_buffer buffer_storage[4];
+    struct robotraconteurlite_buffer_vec buffer_vec_storage;
+    ROBOTRACONTEURLITE_UNUSED(state);
+
+    robotraconteurlite_connection_test_init_node(&server_node, server_connections, server_buffers,
+                                                 ROBOTRACONTEURLITE_CONNECTION_TEST_CLIENT_BUFFER_SIZE, 1);
+    robotraconteurlite_connection_test_init_node(&client_node, client_connections, client_buffers,
+                                                 ROBOTRACONTEURLITE_CONNECTION_TEST_CLIENT_BUFFER_SIZE, 0);
+    robotraconteurlite_connection_test_listen(&acceptor, &service_addr);
+    client_connection =
+        robotraconteurlite_connection_test_connect(&acceptor, &server_node, &client_node, &service_addr);
+    ROBOTRACONTEURLITE_FLAGS_SET(service_addr.flags, ROBOTRACONTEURLITE_ADDR_FLAGS_WEBSOCKET);
+    robotraconteurlite_string_from_c_str("127.0.0.1", &service_addr.http_host);
+    robotraconteurlite_string_from_c_str("/", &service_addr.http_path);
+    websocket_connection =
+        robotraconteurlite_connection_test_connect(&acceptor, &server_node, &client_node, &service_addr);
+
+    buffer_vec_storage.buffer_vec = buffer_storage;
+    buffer_vec_storage.buffer_vec_cnt = 4U;
+    assert_return_code(robotraconteurlite_connection_begin_send_message_ex(client_connection, &message_writer,
+                                                                          &buffer_vec_storage, 64U),
+                       0);
+    assert_true(client_connection->send_buffer_vec == &buffer_vec_storage);
+    assert_int_equal(message_writer.external_segment_capacity, 4U);
+    assert_return_code(robotraconteurlite_connection_abort_send_message(client_connection), 0);
+
+    /* A websocket connection masks the payload in place, so arrays are copied into the send buffer */
+    buffer_vec_storage.buffer_vec_cnt = 4U;
+    assert_return_code(robotraconteurlite_connection_begin_send_message_ex(websocket_connection, &message_writer,
+                                                                          &buffer_vec_storage, 64U),
+                       0);
+    assert_true(websocket_connection->send_buffer_vec == NULL);
+    assert_int_equal(message_writer.external_segment_capacity, 0U);
+    assert_int_equal(buffer_vec_storage.buffer_vec_cnt, 1U);
+    assert_return_code(robotraconteurlite_connection_abort_send_message(websocket_connection), 0);
+
+    robotraconteurlite_tcp_connections_close(client_node.connections_head);
+    robotraconteurlite_tcp_connections_close(server_node.connections_head);
+    assert_return_code(robotraconteurlite_tcp_acceptor_close(&acceptor), 0);
+}
+
+int main(void)
+{
+    const struct CMUnitTest tests[] = {cmocka_unit_test(robotraconteurlite_connection_pool_borrow_test),
+                                       cmocka_unit_test(robotraconteurlite_connection_pool_release_on_close_test),
+                                       cmocka_unit_test(robotraconteurlite_connection_pool_exhausted_test),
+                                       cmocka_unit_test(robotraconteurlite_connection_pool_too_small_test),
+                                       cmocka_unit_test(robotraconteurlite_connection_recv_nearly_full_test),
+                                       cmocka_unit_test(robotraconteurlite_connection_send_copy_only_test)};
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
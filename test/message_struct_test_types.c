@@ -0,0 +1,626 @@
+/* Copyright 2011-2024 Wason Technology, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Generated by src/template/gen.sh from src/template/message_struct.c.j2, do not edit */
+
+#include "message_struct_test_types.h"
+#include "robotraconteurlite/util.h"
+#include <string.h>
+#include <assert.h>
+
+/* experimental.message_struct_test.Vector3 */
+
+/* The namedarray is copied as a flat array of numbers */
+typedef char message_struct_test_vector3_layout_check
+    [(sizeof(struct message_struct_test_vector3) == (3U * sizeof(double))) ? 1 : -1];
+
+robotraconteurlite_status message_struct_test_vector3_read_array(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct message_struct_test_vector3* dest, size_t* dest_len)
+{
+    return robotraconteurlite_messageelement_reader_read_namedarray_ex(
+        element_reader, (uint8_t*)dest, dest_len, ROBOTRACONTEURLITE_DATATYPE_DOUBLE,
+        sizeof(double), 3U);
+}
+
+robotraconteurlite_status message_struct_test_vector3_write_array(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name,
+    const struct message_struct_test_vector3* source, size_t source_len)
+{
+    struct robotraconteurlite_string type_name;
+    robotraconteurlite_string_from_c_str("experimental.message_struct_test.Vector3", &type_name);
+    return robotraconteurlite_messageelement_writer_write_namedarray_ex(
+        element_writer, element_name, &type_name, (const uint8_t*)source, source_len,
+        ROBOTRACONTEURLITE_DATATYPE_DOUBLE, sizeof(double), 3U);
+}
+/* experimental.message_struct_test.Sample */
+
+static robotraconteurlite_status message_struct_test_sample_read_fields(
+    struct robotraconteurlite_messageelement_field_reader* fields,
+    struct message_struct_test_sample* dest)
+{
+    struct robotraconteurlite_messageelement_reader field_reader;
+    struct robotraconteurlite_string field_name;
+    robotraconteurlite_status rv = -1;
+    size_t len = 0;
+
+    robotraconteurlite_string_from_c_str("id", &field_name);
+    rv = robotraconteurlite_messageelement_field_reader_next(fields, &field_name, &field_reader);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+    rv = robotraconteurlite_messageelement_reader_read_data_uint32(&field_reader, &dest->id);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    robotraconteurlite_string_from_c_str("gains", &field_name);
+    rv = robotraconteurlite_messageelement_field_reader_next(fields, &field_name, &field_reader);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+    len = 3U;
+    rv = robotraconteurlite_messageelement_reader_read_data_ex(&field_reader,
+                                                               /* cppcheck-suppress invalidPointerCast */
+                                                               (uint8_t*)dest->gains, &len,
+                                                               ROBOTRACONTEURLITE_DATATYPE_SINGLE,
+                                                               sizeof(float));
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+    if (len != 3U)
+    {
+        return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
+    }
+
+    robotraconteurlite_string_from_c_str("offset", &field_name);
+    rv = robotraconteurlite_messageelement_field_reader_next(fields, &field_name, &field_reader);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+    len = 1U;
+    rv = message_struct_test_vector3_read_array(&field_reader, &dest->offset, &len);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+    if (len != 1U)
+    {
+        return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
+    }
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+static robotraconteurlite_status message_struct_test_sample_write_fields(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct message_struct_test_sample* source)
+{
+    struct robotraconteurlite_string field_name;
+    robotraconteurlite_status rv = -1;
+
+    robotraconteurlite_string_from_c_str("id", &field_name);
+    rv = robotraconteurlite_messageelement_writer_write_uint32(element_writer, &field_name, source->id);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    robotraconteurlite_string_from_c_str("gains", &field_name);
+    rv = robotraconteurlite_messageelement_writer_write_raw(element_writer, &field_name,
+                                                            /* cppcheck-suppress invalidPointerCast */
+                                                            (const uint8_t*)source->gains,
+                                                            3U,
+                                                            ROBOTRACONTEURLITE_DATATYPE_SINGLE,
+                                                            sizeof(float));
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    robotraconteurlite_string_from_c_str("offset", &field_name);
+    rv = message_struct_test_vector3_write_array(element_writer, &field_name, &source->offset, 1U);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status message_struct_test_sample_read_array(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct message_struct_test_sample* dest, size_t* dest_len)
+{
+    struct robotraconteurlite_messageelement_field_reader items;
+    struct robotraconteurlite_messageelement_field_reader fields;
+    struct robotraconteurlite_messageelement_reader item_reader;
+    robotraconteurlite_status rv = -1;
+    size_t i = 0;
+
+    assert(dest_len != NULL);
+
+    rv = robotraconteurlite_messageelement_reader_begin_read_fields(element_reader,
+                                                                    ROBOTRACONTEURLITE_DATATYPE_POD_ARRAY, &items);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    /* Each pod is read in place into dest[i] */
+    while (1)
+    {
+        rv = robotraconteurlite_messageelement_field_reader_next_element(&items, &item_reader);
+        if (ROBOTRACONTEURLITE_FAILED(rv))
+        {
+            if (ROBOTRACONTEURLITE_NO_MORE(rv))
+            {
+                break;
+            }
+            return rv;
+        }
+
+        if (!(i < *dest_len))
+        {
+            return ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE;
+        }
+
+        rv = robotraconteurlite_messageelement_reader_begin_read_fields(&item_reader, ROBOTRACONTEURLITE_DATATYPE_POD,
+                                                                        &fields);
+        if (ROBOTRACONTEURLITE_FAILED(rv))
+        {
+            return rv;
+        }
+
+        rv = message_struct_test_sample_read_fields(&fields, &dest[i]);
+        if (ROBOTRACONTEURLITE_FAILED(rv))
+        {
+            return rv;
+        }
+        i++;
+    }
+
+    *dest_len = i;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status message_struct_test_sample_write_array(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name,
+    const struct message_struct_test_sample* source, size_t source_len)
+{
+    struct robotraconteurlite_messageelement_header header;
+    struct robotraconteurlite_messageelement_header item_header;
+    struct robotraconteurlite_messageelement_writer nested_writer;
+    struct robotraconteurlite_messageelement_writer item_writer;
+    char item_name[10];
+    robotraconteurlite_status rv = -1;
+    size_t i = 0;
+
+    assert(element_name != NULL);
+
+    (void)memset(&header, 0, sizeof(header));
+    header.element_type = ROBOTRACONTEURLITE_DATATYPE_POD_ARRAY;
+    header.element_name = *element_name;
+    robotraconteurlite_string_from_c_str("experimental.message_struct_test.Sample", &header.element_type_name);
+    rv = robotraconteurlite_messageelement_writer_begin_nested_element(element_writer, &header, &nested_writer);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    for (i = 0; i < source_len; i++)
+    {
+        (void)memset(&item_header, 0, sizeof(item_header));
+        item_header.element_type = ROBOTRACONTEURLITE_DATATYPE_POD;
+        rv = robotraconteurlite_messageelement_writer_begin_indexed_element(&nested_writer, &item_header, (uint32_t)i,
+                                                                            item_name, sizeof(item_name), &item_writer);
+        if (ROBOTRACONTEURLITE_FAILED(rv))
+        {
+            return rv;
+        }
+
+        rv = message_struct_test_sample_write_fields(&item_writer, &source[i]);
+        if (ROBOTRACONTEURLITE_FAILED(rv))
+        {
+            return rv;
+        }
+
+        rv = robotraconteurlite_messageelement_writer_end_nested_element(&nested_writer, &item_header, &item_writer);
+        if (ROBOTRACONTEURLITE_FAILED(rv))
+        {
+            return rv;
+        }
+    }
+
+    return robotraconteurlite_messageelement_writer_end_nested_element(element_writer, &header, &nested_writer);
+}
+/* experimental.message_struct_test.Pose */
+
+static robotraconteurlite_status message_struct_test_pose_read_fields(
+    struct robotraconteurlite_messageelement_field_reader* fields,
+    struct message_struct_test_pose* dest)
+{
+    struct robotraconteurlite_messageelement_reader field_reader;
+    struct robotraconteurlite_string field_name;
+    robotraconteurlite_status rv = -1;
+    size_t len = 0;
+
+    robotraconteurlite_string_from_c_str("seq", &field_name);
+    rv = robotraconteurlite_messageelement_field_reader_next(fields, &field_name, &field_reader);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+    rv = robotraconteurlite_messageelement_reader_read_data_uint32(&field_reader, &dest->seq);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    robotraconteurlite_string_from_c_str("label", &field_name);
+    rv = robotraconteurlite_messageelement_field_reader_next(fields, &field_name, &field_reader);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+    len = sizeof(dest->label);
+    rv = robotraconteurlite_messageelement_reader_read_data_ex(&field_reader, (uint8_t*)dest->label, &len,
+                                                               ROBOTRACONTEURLITE_DATATYPE_STRING, sizeof(char));
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+    dest->label_len = len;
+
+    robotraconteurlite_string_from_c_str("position", &field_name);
+    rv = robotraconteurlite_messageelement_field_reader_next(fields, &field_name, &field_reader);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+    len = 1U;
+    rv = message_struct_test_vector3_read_array(&field_reader, &dest->position, &len);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+    if (len != 1U)
+    {
+        return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
+    }
+
+    robotraconteurlite_string_from_c_str("waypoints", &field_name);
+    rv = robotraconteurlite_messageelement_field_reader_next(fields, &field_name, &field_reader);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+    len = 4U;
+    rv = message_struct_test_vector3_read_array(&field_reader, dest->waypoints, &len);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+    dest->waypoints_len = len;
+
+    robotraconteurlite_string_from_c_str("samples", &field_name);
+    rv = robotraconteurlite_messageelement_field_reader_next(fields, &field_name, &field_reader);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+    len = 3U;
+    rv = message_struct_test_sample_read_array(&field_reader, dest->samples, &len);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+    dest->samples_len = len;
+
+    robotraconteurlite_string_from_c_str("covariance", &field_name);
+    rv = robotraconteurlite_messageelement_field_reader_next(fields, &field_name, &field_reader);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+    len = 6U;
+    rv = robotraconteurlite_messageelement_reader_read_data_ex(&field_reader,
+                                                               /* cppcheck-suppress invalidPointerCast */
+                                                               (uint8_t*)dest->covariance, &len,
+                                                               ROBOTRACONTEURLITE_DATATYPE_DOUBLE,
+                                                               sizeof(double));
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+    if (len != 6U)
+    {
+        return ROBOTRACONTEURLITE_ERROR_PROTOCOL;
+    }
+
+    robotraconteurlite_string_from_c_str("weights", &field_name);
+    rv = robotraconteurlite_messageelement_field_reader_next(fields, &field_name, &field_reader);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+    len = 8U;
+    rv = robotraconteurlite_messageelement_reader_read_data_ex(&field_reader,
+                                                               /* cppcheck-suppress invalidPointerCast */
+                                                               (uint8_t*)dest->weights, &len,
+                                                               ROBOTRACONTEURLITE_DATATYPE_DOUBLE,
+                                                               sizeof(double));
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+    dest->weights_len = len;
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+static robotraconteurlite_status message_struct_test_pose_write_fields(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct message_struct_test_pose* source)
+{
+    struct robotraconteurlite_string field_name;
+    robotraconteurlite_status rv = -1;
+
+    robotraconteurlite_string_from_c_str("seq", &field_name);
+    rv = robotraconteurlite_messageelement_writer_write_uint32(element_writer, &field_name, source->seq);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    robotraconteurlite_string_from_c_str("label", &field_name);
+    if (source->label_len > sizeof(source->label))
+    {
+        return ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER;
+    }
+    rv = robotraconteurlite_messageelement_writer_write_raw(element_writer, &field_name,
+                                                            (const uint8_t*)source->label, source->label_len,
+                                                            ROBOTRACONTEURLITE_DATATYPE_STRING, sizeof(char));
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    robotraconteurlite_string_from_c_str("position", &field_name);
+    rv = message_struct_test_vector3_write_array(element_writer, &field_name, &source->position, 1U);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    robotraconteurlite_string_from_c_str("waypoints", &field_name);
+    if (source->waypoints_len > 4U)
+    {
+        return ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER;
+    }
+    rv = message_struct_test_vector3_write_array(element_writer, &field_name, source->waypoints, source->waypoints_len);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    robotraconteurlite_string_from_c_str("samples", &field_name);
+    if (source->samples_len > 3U)
+    {
+        return ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER;
+    }
+    rv = message_struct_test_sample_write_array(element_writer, &field_name, source->samples, source->samples_len);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    robotraconteurlite_string_from_c_str("covariance", &field_name);
+    rv = robotraconteurlite_messageelement_writer_write_raw(element_writer, &field_name,
+                                                            /* cppcheck-suppress invalidPointerCast */
+                                                            (const uint8_t*)source->covariance,
+                                                            6U,
+                                                            ROBOTRACONTEURLITE_DATATYPE_DOUBLE,
+                                                            sizeof(double));
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    robotraconteurlite_string_from_c_str("weights", &field_name);
+    if (source->weights_len > 8U)
+    {
+        return ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER;
+    }
+    rv = robotraconteurlite_messageelement_writer_write_raw(element_writer, &field_name,
+                                                            /* cppcheck-suppress invalidPointerCast */
+                                                            (const uint8_t*)source->weights,
+                                                            source->weights_len,
+                                                            ROBOTRACONTEURLITE_DATATYPE_DOUBLE,
+                                                            sizeof(double));
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status message_struct_test_pose_read(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct message_struct_test_pose* dest)
+{
+    struct robotraconteurlite_messageelement_field_reader fields;
+    robotraconteurlite_status rv = -1;
+
+    assert(dest != NULL);
+
+    rv = robotraconteurlite_messageelement_reader_begin_read_fields(element_reader,
+                                                                    ROBOTRACONTEURLITE_DATATYPE_STRUCTURE, &fields);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    return message_struct_test_pose_read_fields(&fields, dest);
+}
+
+robotraconteurlite_status message_struct_test_pose_write(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name,
+    const struct message_struct_test_pose* source)
+{
+    struct robotraconteurlite_messageelement_header header;
+    struct robotraconteurlite_messageelement_writer nested_writer;
+    robotraconteurlite_status rv = -1;
+
+    assert(element_name != NULL);
+    assert(source != NULL);
+
+    (void)memset(&header, 0, sizeof(header));
+    header.element_type = ROBOTRACONTEURLITE_DATATYPE_STRUCTURE;
+    header.element_name = *element_name;
+    robotraconteurlite_string_from_c_str("experimental.message_struct_test.Pose", &header.element_type_name);
+    rv = robotraconteurlite_messageelement_writer_begin_nested_element(element_writer, &header, &nested_writer);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    rv = message_struct_test_pose_write_fields(&nested_writer, source);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    return robotraconteurlite_messageelement_writer_end_nested_element(element_writer, &header, &nested_writer);
+}
+/* experimental.message_struct_test.RobotState */
+
+static robotraconteurlite_status message_struct_test_robot_state_read_fields(
+    struct robotraconteurlite_messageelement_field_reader* fields,
+    struct message_struct_test_robot_state* dest)
+{
+    struct robotraconteurlite_messageelement_reader field_reader;
+    struct robotraconteurlite_string field_name;
+    robotraconteurlite_status rv = -1;
+
+    robotraconteurlite_string_from_c_str("pose", &field_name);
+    rv = robotraconteurlite_messageelement_field_reader_next(fields, &field_name, &field_reader);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+    rv = message_struct_test_pose_read(&field_reader, &dest->pose);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    robotraconteurlite_string_from_c_str("enabled", &field_name);
+    rv = robotraconteurlite_messageelement_field_reader_next(fields, &field_name, &field_reader);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+    rv = robotraconteurlite_messageelement_reader_read_data_uint8(&field_reader, &dest->enabled);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+static robotraconteurlite_status message_struct_test_robot_state_write_fields(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct message_struct_test_robot_state* source)
+{
+    struct robotraconteurlite_string field_name;
+    robotraconteurlite_status rv = -1;
+
+    robotraconteurlite_string_from_c_str("pose", &field_name);
+    rv = message_struct_test_pose_write(element_writer, &field_name, &source->pose);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    robotraconteurlite_string_from_c_str("enabled", &field_name);
+    rv = robotraconteurlite_messageelement_writer_write_uint8(element_writer, &field_name, source->enabled);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+robotraconteurlite_status message_struct_test_robot_state_read(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct message_struct_test_robot_state* dest)
+{
+    struct robotraconteurlite_messageelement_field_reader fields;
+    robotraconteurlite_status rv = -1;
+
+    assert(dest != NULL);
+
+    rv = robotraconteurlite_messageelement_reader_begin_read_fields(element_reader,
+                                                                    ROBOTRACONTEURLITE_DATATYPE_STRUCTURE, &fields);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    return message_struct_test_robot_state_read_fields(&fields, dest);
+}
+
+robotraconteurlite_status message_struct_test_robot_state_write(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name,
+    const struct message_struct_test_robot_state* source)
+{
+    struct robotraconteurlite_messageelement_header header;
+    struct robotraconteurlite_messageelement_writer nested_writer;
+    robotraconteurlite_status rv = -1;
+
+    assert(element_name != NULL);
+    assert(source != NULL);
+
+    (void)memset(&header, 0, sizeof(header));
+    header.element_type = ROBOTRACONTEURLITE_DATATYPE_STRUCTURE;
+    header.element_name = *element_name;
+    robotraconteurlite_string_from_c_str("experimental.message_struct_test.RobotState", &header.element_type_name);
+    rv = robotraconteurlite_messageelement_writer_begin_nested_element(element_writer, &header, &nested_writer);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    rv = message_struct_test_robot_state_write_fields(&nested_writer, source);
+    if (ROBOTRACONTEURLITE_FAILED(rv))
+    {
+        return rv;
+    }
+
+    return robotraconteurlite_messageelement_writer_end_nested_element(element_writer, &header, &nested_writer);
+}
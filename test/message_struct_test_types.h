@@ -0,0 +1,106 @@
+/* Copyright 2011-2024 Wason Technology, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Generated by src/template/gen.sh from src/template/message_struct.h.j2, do not edit */
+
+#ifndef MESSAGE_STRUCT_TEST_TYPES_H
+#define MESSAGE_STRUCT_TEST_TYPES_H
+
+#include "robotraconteurlite/message.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* experimental.message_struct_test.Vector3 */
+struct message_struct_test_vector3
+{
+    double x;
+    double y;
+    double z;
+};
+
+robotraconteurlite_status message_struct_test_vector3_read_array(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct message_struct_test_vector3* dest, size_t* dest_len);
+
+robotraconteurlite_status message_struct_test_vector3_write_array(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name,
+    const struct message_struct_test_vector3* source, size_t source_len);
+
+/* experimental.message_struct_test.Sample */
+struct message_struct_test_sample
+{
+    uint32_t id;
+    float gains[3];
+    struct message_struct_test_vector3 offset;
+};
+
+robotraconteurlite_status message_struct_test_sample_read_array(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct message_struct_test_sample* dest, size_t* dest_len);
+
+robotraconteurlite_status message_struct_test_sample_write_array(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name,
+    const struct message_struct_test_sample* source, size_t source_len);
+
+/* experimental.message_struct_test.Pose */
+struct message_struct_test_pose
+{
+    uint32_t seq;
+    char label[32];
+    size_t label_len;
+    struct message_struct_test_vector3 position;
+    struct message_struct_test_vector3 waypoints[4];
+    size_t waypoints_len;
+    struct message_struct_test_sample samples[3];
+    size_t samples_len;
+    double covariance[6];
+    double weights[8];
+    size_t weights_len;
+};
+
+robotraconteurlite_status message_struct_test_pose_read(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct message_struct_test_pose* dest);
+
+robotraconteurlite_status message_struct_test_pose_write(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name,
+    const struct message_struct_test_pose* source);
+
+/* experimental.message_struct_test.RobotState */
+struct message_struct_test_robot_state
+{
+    struct message_struct_test_pose pose;
+    uint8_t enabled;
+};
+
+robotraconteurlite_status message_struct_test_robot_state_read(
+    struct robotraconteurlite_messageelement_reader* element_reader,
+    struct message_struct_test_robot_state* dest);
+
+robotraconteurlite_status message_struct_test_robot_state_write(
+    struct robotraconteurlite_messageelement_writer* element_writer,
+    const struct robotraconteurlite_string* element_name,
+    const struct message_struct_test_robot_state* source);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MESSAGE_STRUCT_TEST_TYPES_H */
@@ -3,12 +3,15 @@
 #include <stddef.h>
 #include <setjmp.h>
 #include <stdint.h>
+#include <stdio.h>
 #include <string.h>
 #include <time.h>
 #include <stdlib.h>
 #include <math.h>
 
 #include "robotraconteurlite/message.h"
+#include "robotraconteurlite/member_dispatch.h"
+#include "message_struct_test_types.h"
 
 #define inline
 #include <cmocka.h>
@@ -924,6 +927,7 @@ void robotraconteurlite_message_run_writer_basictest(uint8_t* buffer_bytes, size
     buffer.buffer_vec_cnt = 1;
     assert_return_code(robotraconteurlite_message_writer_init(&writer, &buffer, 0, *buffer_bytes_len, message_ver), 0);
 
+    (void)memset(&header, 0, sizeof(header));
     header.message_size = 0;
     header.message_version = 2;
     header.header_size = 0;
@@ -950,6 +954,7 @@ void robotraconteurlite_message_run_writer_basictest(uint8_t* buffer_bytes, size
         char member_name[] = "my_member";
         char service_path[] = "my.service.object[%28abc]";
         char extended[] = "more\nblah\nblah";
+        (void)memset(&entry_header, 0, sizeof(entry_header));
         entry_header.entry_size = 0;
         entry_header.entry_type = ROBOTRACONTEURLITE_MESSAGEENTRYTYPE_PROPERTYGETRES;
         entry_header.member_name.data = member_name;
@@ -985,6 +990,7 @@ void robotraconteurlite_message_run_writer_basictest(uint8_t* buffer_bytes, size
         struct robotraconteurlite_array_double el1_data;
         struct robotraconteurlite_string el2_data;
 
+        (void)memset(&entry_header, 0, sizeof(entry_header));
         entry_header.entry_size = 0;
         entry_header.entry_type = ROBOTRACONTEURLITE_MESSAGEENTRYTYPE_FUNCTIONCALLRES;
         entry_header.member_name.data = member_name;
@@ -1403,6 +1409,2978 @@ void robotraconteurlite_message4_writer_basictest_single_entry(void** state)
     }
 }
 
+static void robotraconteurlite_message_write_view_test_message(uint8_t* buffer_bytes, size_t* buffer_bytes_len)
+{
+    struct robotraconteurlite_buffer buffer1;
+    struct robotraconteurlite_buffer_vec buffer;
+    struct robotraconteurlite_message_writer writer;
+    struct robotraconteurlite_messageentry_writer entry_writer;
+    struct robotraconteurlite_message_header header;
+    struct robotraconteurlite_messageentry_header entry_header;
+    struct robotraconteurlite_messageelement_writer element_writer;
+    double el1_data_d[] = {1, 2, 3, 4, 5};
+    uint8_t el2_data_d[] = {10, 20, 30};
+    struct robotraconteurlite_array_double el1_data;
+    struct robotraconteurlite_array_uint8 el2_data;
+    struct robotraconteurlite_string el_name;
+
+    buffer1.data = buffer_bytes;
+    buffer1.len = *buffer_bytes_len;
+    buffer.buffer_vec = &buffer1;
+    buffer.buffer_vec_cnt = 1;
+    assert_return_code(robotraconteurlite_message_writer_init(&writer, &buffer, 0, *buffer_bytes_len, 2), 0);
+
+    (void)memset(&header, 0, sizeof(header));
+    assert_return_code(robotraconteurlite_message_writer_begin_message(&writer, &header, &entry_writer), 0);
+
+    (void)memset(&entry_header, 0, sizeof(entry_header));
+    entry_header.entry_type = ROBOTRACONTEURLITE_MESSAGEENTRYTYPE_FUNCTIONCALLRES;
+    assert_return_code(
+        robotraconteurlite_messageentry_writer_begin_entry(&entry_writer, &entry_header, &element_writer), 0);
+
+    el1_data.data = el1_data_d;
+    el1_data.len = sizeof(el1_data_d) / sizeof(double);
+    robotraconteurlite_string_from_c_str("el1", &el_name);
+    assert_return_code(
+        robotraconteurlite_messageelement_writer_write_double_array(&element_writer, &el_name, &el1_data), 0);
+
+    el2_data.data = el2_data_d;
+    el2_data.len = sizeof(el2_data_d);
+    robotraconteurlite_string_from_c_str("el2", &el_name);
+    assert_return_code(robotraconteurlite_messageelement_writer_write_uint8_array(&element_writer, &el_name, &el2_data),
+                       0);
+
+    assert_return_code(robotraconteurlite_messageentry_writer_end_entry(&entry_writer, &entry_header, &element_writer),
+                       0);
+    assert_return_code(robotraconteurlite_message_writer_end_message(&writer, &header, &entry_writer), 0);
+
+    *buffer_bytes_len = header.message_size;
+}
+
+static void robotraconteurlite_message_find_view_test_element(struct robotraconteurlite_buffer_vec* buffer,
+                                                              size_t buffer_len, const char* element_name,
+                                                              struct robotraconteurlite_messageelement_reader* reader)
+{
+    struct robotraconteurlite_message_reader message_reader;
+    struct robotraconteurlite_message_header header;
+    struct robotraconteurlite_messageentry_reader entry_reader;
+    struct robotraconteurlite_string el_name;
+
+    robotraconteurlite_string_from_c_str(element_name, &el_name);
+    assert_return_code(robotraconteurlite_message_reader_init(&message_reader, buffer, 0, buffer_len), 0);
+    (void)memset(&header, 0, sizeof(header));
+    assert_return_code(robotraconteurlite_message_reader_read_header(&message_reader, &header), 0);
+    assert_return_code(robotraconteurlite_message_reader_begin_read_entries(&message_reader, &entry_reader), 0);
+    assert_return_code(robotraconteurlite_messageentry_reader_find_element(&entry_reader, &el_name, reader), 0);
+}
+
+void robotraconteurlite_message_read_data_view_test(void** state)
+{
+    /* double storage keeps the message buffer 8 byte aligned */
+    double buffer_storage[64];
+    uint8_t* buffer_bytes = (uint8_t*)buffer_storage;
+    size_t buffer_bytes_len = sizeof(buffer_storage);
+    double expected[] = {1, 2, 3, 4, 5};
+    double copy_storage[5];
+    struct robotraconteurlite_buffer buffer1[2];
+    struct robotraconteurlite_buffer_vec buffer;
+    struct robotraconteurlite_messageelement_reader element_reader;
+    struct robotraconteurlite_array_double view;
+    size_t data_offset = 0;
+    size_t data_size = 0;
+    uint32_t data_count = 0;
+    robotraconteurlite_status rv = -1;
+
+    robotraconteurlite_message_write_view_test_message(buffer_bytes, &buffer_bytes_len);
+
+    buffer1[0].data = buffer_bytes;
+    buffer1[0].len = buffer_bytes_len;
+    buffer.buffer_vec = buffer1;
+    buffer.buffer_vec_cnt = 1;
+
+    /* Contiguous buffer, view or copy depending on alignment of the data in the buffer */
+    robotraconteurlite_message_find_view_test_element(&buffer, buffer_bytes_len, "el1", &element_reader);
+    assert_return_code(robotraconteurlite_messageelement_reader_get_data_info(&element_reader, &data_offset, &data_size,
+                                                                              &data_count,
+                                                                              ROBOTRACONTEURLITE_DATATYPE_DOUBLE, 8),
+                       0);
+    view.data = copy_storage;
+    view.len = 5;
+    rv = robotraconteurlite_messageelement_reader_read_data_double_view(&element_reader, &view);
+    if ((data_offset % sizeof(double)) == 0U)
+    {
+        assert_true(rv == ROBOTRACONTEURLITE_ERROR_SUCCESS);
+        assert_true((uint8_t*)view.data == &buffer_bytes[data_offset]);
+    }
+    else
+    {
+        assert_true(rv == ROBOTRACONTEURLITE_STATUS_COPIED);
+        assert_true(view.data == copy_storage);
+    }
+    assert_true(view.len == 5);
+    assert_true(cmp_double(view.data, expected, 5) == 0);
+
+    /* Byte sized data is always viewed in place */
+    {
+        struct robotraconteurlite_array_uint8 view8;
+        robotraconteurlite_message_find_view_test_element(&buffer, buffer_bytes_len, "el2", &element_reader);
+        view8.data = NULL;
+        view8.len = 0;
+        assert_true(robotraconteurlite_messageelement_reader_read_data_uint8_view(&element_reader, &view8) ==
+                    ROBOTRACONTEURLITE_ERROR_SUCCESS);
+        assert_true(view8.len == 3);
+        assert_true(view8.data > buffer_bytes && view8.data < &buffer_bytes[buffer_bytes_len]);
+        assert_true(view8.data[0] == 10 && view8.data[1] == 20 && view8.data[2] == 30);
+    }
+
+    /* Data split across two segments falls back to copying */
+    buffer1[0].len = data_offset + 4;
+    buffer1[1].data = &buffer_bytes[data_offset + 4];
+    buffer1[1].len = buffer_bytes_len - (data_offset + 4);
+    buffer.buffer_vec_cnt = 2;
+
+    robotraconteurlite_message_find_view_test_element(&buffer, buffer_bytes_len, "el1", &element_reader);
+    (void)memset(copy_storage, 0, sizeof(copy_storage));
+    view.data = copy_storage;
+    view.len = 5;
+    assert_true(robotraconteurlite_messageelement_reader_read_data_double_view(&element_reader, &view) ==
+                ROBOTRACONTEURLITE_STATUS_COPIED);
+    assert_true(view.data == copy_storage);
+    assert_true(view.len == 5);
+    assert_true(cmp_double(view.data, expected, 5) == 0);
+
+    /* No fallback storage */
+    view.data = NULL;
+    view.len = 0;
+    assert_true(robotraconteurlite_messageelement_reader_read_data_double_view(&element_reader, &view) ==
+                ROBOTRACONTEURLITE_ERROR_INVALID_OPERATION);
+}
+
+static void robotraconteurlite_message_run_element_index_test(uint8_t* message_bytes, size_t message_bytes_len)
+{
+    struct robotraconteurlite_buffer buffer1;
+    struct robotraconteurlite_buffer_vec buffer;
+    struct robotraconteurlite_message_reader reader;
+    struct robotraconteurlite_message_header header;
+    struct robotraconteurlite_messageentry_reader entry_reader;
+    struct robotraconteurlite_messageelement_reader element_reader;
+    struct robotraconteurlite_messageelement_reader nested_element_reader;
+    struct robotraconteurlite_messageelement_index_entry index_entries[8];
+    struct robotraconteurlite_messageelement_index index;
+    struct robotraconteurlite_messageelement_index_entry nested_index_entries[16];
+    struct robotraconteurlite_messageelement_index nested_index;
+    struct robotraconteurlite_string name;
+    double doubles_expected[] = {1, 2, 3, 4};
+    double doubles_storage[4];
+    struct robotraconteurlite_array_double doubles;
+
+    buffer1.data = message_bytes;
+    buffer1.len = message_bytes_len;
+    buffer.buffer_vec = &buffer1;
+    buffer.buffer_vec_cnt = 1;
+
+    assert_return_code(robotraconteurlite_message_reader_init(&reader, &buffer, 0, message_bytes_len), 0);
+    (void)memset(&header, 0, sizeof(header));
+    assert_return_code(robotraconteurlite_message_reader_read_header(&reader, &header), 0);
+    assert_return_code(robotraconteurlite_message_reader_begin_read_entries(&reader, &entry_reader), 0);
+
+    /* First entry has no elements */
+    index.entries = index_entries;
+    index.entries_len = 8;
+    assert_return_code(robotraconteurlite_messageentry_reader_build_element_index(&entry_reader, &index), 0);
+    assert_true(index.entries_count == 0);
+    robotraconteurlite_string_from_c_str("el1", &name);
+    assert_true(robotraconteurlite_messageentry_reader_find_element(&entry_reader, &name, &element_reader) ==
+                ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_NOT_FOUND);
+
+    assert_return_code(robotraconteurlite_messageentry_reader_move_next(&entry_reader), 0);
+    assert_true(entry_reader.element_index == NULL);
+
+    /* Index too small for the entry */
+    index.entries_len = 3;
+    assert_true(robotraconteurlite_messageentry_reader_build_element_index(&entry_reader, &index) ==
+                ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE);
+    assert_true(entry_reader.element_index == NULL);
+
+    index.entries_len = 8;
+    assert_return_code(robotraconteurlite_messageentry_reader_build_element_index(&entry_reader, &index), 0);
+    assert_true(index.entries_count == 4);
+    assert_true(entry_reader.element_index == &index);
+
+    robotraconteurlite_string_from_c_str("el1", &name);
+    assert_return_code(robotraconteurlite_messageentry_reader_find_element_verify_array(
+                           &entry_reader, &name, &element_reader, ROBOTRACONTEURLITE_DATATYPE_DOUBLE, 5, 0),
+                       0);
+    assert_true(element_reader.current_element == 0);
+
+    robotraconteurlite_string_from_c_str("el2", &name);
+    assert_return_code(
+        robotraconteurlite_messageentry_reader_find_element_verify_string(&entry_reader, &name, &element_reader, 32),
+        0);
+    assert_true(element_reader.current_element == 1);
+
+    robotraconteurlite_string_from_c_str("el4_is_a_very_long_name_it_keeps_going_and_going_and_going", &name);
+    assert_return_code(robotraconteurlite_messageentry_reader_find_element_verify_scalar(
+                           &entry_reader, &name, &element_reader, ROBOTRACONTEURLITE_DATATYPE_DOUBLE),
+                       0);
+    assert_true(element_reader.current_element == 3);
+    assert_true(robotraconteurlite_messageelement_reader_move_next(&element_reader) ==
+                ROBOTRACONTEURLITE_ERROR_NO_MORE);
+
+    robotraconteurlite_string_from_c_str("el5", &name);
+    assert_true(robotraconteurlite_messageentry_reader_find_element(&entry_reader, &name, &element_reader) ==
+                ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_NOT_FOUND);
+
+    robotraconteurlite_string_from_c_str("el3", &name);
+    assert_return_code(robotraconteurlite_messageentry_reader_find_element(&entry_reader, &name, &element_reader), 0);
+    assert_true(element_reader.current_element == 2);
+
+    /* Nested elements of el3 */
+    nested_index.entries = nested_index_entries;
+    nested_index.entries_len = 16;
+    assert_return_code(
+        robotraconteurlite_messageelement_reader_build_nested_element_index(&element_reader, &nested_index), 0);
+    assert_true(nested_index.entries_count == 14);
+
+    robotraconteurlite_string_from_c_str("sub_doubles", &name);
+    assert_return_code(robotraconteurlite_messageelement_reader_find_nested_element_verify_array(
+                           &element_reader, &name, &nested_element_reader, ROBOTRACONTEURLITE_DATATYPE_DOUBLE, 4, 0),
+                       0);
+    doubles.data = doubles_storage;
+    doubles.len = 4;
+    assert_return_code(
+        robotraconteurlite_messageelement_reader_read_data_double_array(&nested_element_reader, &doubles), 0);
+    assert_true(doubles.len == 4);
+    assert_true(cmp_double(doubles.data, doubles_expected, 4) == 0);
+
+    robotraconteurlite_string_from_c_str("sub_string", &name);
+    assert_return_code(robotraconteurlite_messageelement_reader_find_nested_element_verify_string(
+                           &element_reader, &name, &nested_element_reader, 64),
+                       0);
+
+    robotraconteurlite_string_from_c_str("sub_bool", &name);
+    assert_true(robotraconteurlite_messageelement_reader_find_nested_element_verify_scalar(
+                    &element_reader, &name, &nested_element_reader, ROBOTRACONTEURLITE_DATATYPE_BOOL) ==
+                ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_TYPE_MISMATCH);
+
+    robotraconteurlite_string_from_c_str("sub_missing", &name);
+    assert_true(robotraconteurlite_messageelement_reader_find_nested_element(&element_reader, &name,
+                                                                            &nested_element_reader) ==
+                ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_NOT_FOUND);
+}
+
+void robotraconteurlite_message_element_index_test(void** state)
+{
+    robotraconteurlite_message_run_element_index_test(message2, sizeof(message2));
+    robotraconteurlite_message_run_element_index_test(message4, sizeof(message4));
+}
+
+static void robotraconteurlite_message_run_external_segments_test(uint16_t message_version)
+{
+    uint8_t send_bytes[256];
+    double big1_d[200];
+    double big2_d[200];
+    double read_d[200];
+    uint8_t small_d[] = {10, 20, 30};
+    uint8_t small_read_d[3];
+    struct robotraconteurlite_buffer segments[5];
+    struct robotraconteurlite_buffer_vec buffer;
+    struct robotraconteurlite_message_writer writer;
+    struct robotraconteurlite_messageentry_writer entry_writer;
+    struct robotraconteurlite_message_header header;
+    struct robotraconteurlite_messageentry_header entry_header;
+    struct robotraconteurlite_messageelement_writer element_writer;
+    struct robotraconteurlite_messageelement_reader element_reader;
+    struct robotraconteurlite_array_double big;
+    struct robotraconteurlite_array_uint8 small;
+    struct robotraconteurlite_string el_name;
+    size_t i = 0;
+
+    for (i = 0; i < 200U; i++)
+    {
+        big1_d[i] = (double)i;
+        big2_d[i] = (double)i * -2.0;
+    }
+
+    segments[0].data = send_bytes;
+    segments[0].len = sizeof(send_bytes);
+    buffer.buffer_vec = segments;
+    buffer.buffer_vec_cnt = 1;
+    assert_return_code(
+        robotraconteurlite_message_writer_init(&writer, &buffer, 0, sizeof(send_bytes), message_version), 0);
+    assert_true(robotraconteurlite_message_writer_enable_external_segments(&writer, 0, 64) ==
+                ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER);
+    assert_return_code(robotraconteurlite_message_writer_enable_external_segments(&writer, 5, 64), 0);
+
+    (void)memset(&header, 0, sizeof(header));
+    assert_return_code(robotraconteurlite_message_writer_begin_message(&writer, &header, &entry_writer), 0);
+    (void)memset(&entry_header, 0, sizeof(entry_header));
+    entry_header.entry_type = ROBOTRACONTEURLITE_MESSAGEENTRYTYPE_FUNCTIONCALLRES;
+    assert_return_code(
+        robotraconteurlite_messageentry_writer_begin_entry(&entry_writer, &entry_header, &element_writer), 0);
+
+    /* Payloads larger than the send buffer are referenced, small payloads are copied */
+    big.data = big1_d;
+    big.len = 200;
+    robotraconteurlite_string_from_c_str("big1", &el_name);
+    assert_return_code(robotraconteurlite_messageelement_writer_write_double_array(&element_writer, &el_name, &big),
+                       0);
+    small.data = small_d;
+    small.len = sizeof(small_d);
+    robotraconteurlite_string_from_c_str("small", &el_name);
+    assert_return_code(robotraconteurlite_messageelement_writer_write_uint8_array(&element_writer, &el_name, &small),
+                       0);
+    assert_true(buffer.buffer_vec_cnt == 3);
+    big.data = big2_d;
+    robotraconteurlite_string_from_c_str("big2", &el_name);
+    assert_return_code(robotraconteurlite_messageelement_writer_write_double_array(&element_writer, &el_name, &big),
+                       0);
+    assert_true(buffer.buffer_vec_cnt == 5);
+    assert_true(segments[1].data == (uint8_t*)big1_d);
+    assert_true(segments[3].data == (uint8_t*)big2_d);
+    /* The referenced payloads do not use up the send buffer */
+    assert_true(element_writer.external_written_size == (2U * sizeof(big1_d)));
+    assert_true(element_writer.buffer_count < sizeof(send_bytes));
+    assert_true((element_writer.elements_written_size - element_writer.external_written_size) <
+                element_writer.buffer_count);
+
+    assert_return_code(robotraconteurlite_messageentry_writer_end_entry(&entry_writer, &entry_header, &element_writer),
+                       0);
+    assert_true(entry_writer.external_written_size == (2U * sizeof(big1_d)));
+    assert_true((entry_writer.entries_written_size - entry_writer.external_written_size + entry_writer.buffer_count) <
+                sizeof(send_bytes));
+    assert_return_code(robotraconteurlite_message_writer_end_message(&writer, &header, &entry_writer), 0);
+    assert_true(header.message_size > (2U * sizeof(big1_d)));
+    assert_true((header.message_size - (2U * sizeof(big1_d))) <= sizeof(send_bytes));
+
+    /* Read the message back through the segment list */
+    robotraconteurlite_message_find_view_test_element(&buffer, header.message_size, "big2", &element_reader);
+    big.data = read_d;
+    big.len = 200;
+    assert_return_code(robotraconteurlite_messageelement_reader_read_data_double_array(&element_reader, &big), 0);
+    assert_true(big.len == 200);
+    assert_true(cmp_double(read_d, big2_d, 200) == 0);
+
+    robotraconteurlite_message_find_view_test_element(&buffer, header.message_size, "big1", &element_reader);
+    big.len = 200;
+    assert_return_code(robotraconteurlite_messageelement_reader_read_data_double_array(&element_reader, &big), 0);
+    assert_true(cmp_double(read_d, big1_d, 200) == 0);
+
+    robotraconteurlite_message_find_view_test_element(&buffer, header.message_size, "small", &element_reader);
+    small.data = small_read_d;
+    small.len = sizeof(small_read_d);
+    assert_return_code(robotraconteurlite_messageelement_reader_read_data_uint8_array(&element_reader, &small), 0);
+    assert_true(memcmp(small_read_d, small_d, sizeof(small_d)) == 0);
+}
+
+void robotraconteurlite_message_external_segments_test(void** state)
+{
+    ROBOTRACONTEURLITE_UNUSED(state);
+    robotraconteurlite_message_run_external_segments_test(2);
+    robotraconteurlite_message_run_external_segments_test(4);
+}
+
+static void robotraconteurlite_message_run_template_test(uint16_t message_version)
+{
+    uint8_t template_bytes[256];
+    double value_d[] = {1, 2, 3};
+    double patched_d[] = {-4, 5.5, 6e10};
+    double read_d[3];
+    struct robotraconteurlite_buffer buffer1;
+    struct robotraconteurlite_buffer_vec buffer;
+    struct robotraconteurlite_message_writer writer;
+    struct robotraconteurlite_messageentry_writer entry_writer;
+    struct robotraconteurlite_message_header header;
+    struct robotraconteurlite_messageentry_header entry_header;
+    struct robotraconteurlite_messageelement_writer element_writer;
+    struct robotraconteurlite_message_reader reader;
+    struct robotraconteurlite_messageentry_reader entry_reader;
+    struct robotraconteurlite_messageelement_reader element_reader;
+    struct robotraconteurlite_message_template message_template;
+    struct robotraconteurlite_message_template_slot slots[2];
+    struct robotraconteurlite_array_double value;
+    struct robotraconteurlite_string el_name;
+    size_t slot = 0;
+
+    buffer1.data = template_bytes;
+    buffer1.len = sizeof(template_bytes);
+    buffer.buffer_vec = &buffer1;
+    buffer.buffer_vec_cnt = 1;
+    assert_return_code(
+        robotraconteurlite_message_writer_init(&writer, &buffer, 0, sizeof(template_bytes), message_version), 0);
+
+    /* Placeholders keep message 4 fields at full width */
+    (void)memset(&header, 0, sizeof(header));
+    header.sender_endpoint = UINT32_MAX;
+    header.receiver_endpoint = UINT32_MAX;
+    assert_return_code(robotraconteurlite_message_writer_begin_message(&writer, &header, &entry_writer), 0);
+    (void)memset(&entry_header, 0, sizeof(entry_header));
+    entry_header.entry_type = ROBOTRACONTEURLITE_MESSAGEENTRYTYPE_PROPERTYGETRES;
+    entry_header.request_id = UINT32_MAX;
+    robotraconteurlite_string_from_c_str("prop", &entry_header.member_name);
+    assert_return_code(
+        robotraconteurlite_messageentry_writer_begin_entry(&entry_writer, &entry_header, &element_writer), 0);
+    value.data = value_d;
+    value.len = 3;
+    robotraconteurlite_string_from_c_str("value", &el_name);
+    assert_return_code(robotraconteurlite_messageelement_writer_write_double_array(&element_writer, &el_name, &value),
+                       0);
+    assert_return_code(robotraconteurlite_messageentry_writer_end_entry(&entry_writer, &entry_header, &element_writer),
+                       0);
+    assert_return_code(robotraconteurlite_message_writer_end_message(&writer, &header, &entry_writer), 0);
+
+    assert_return_code(
+        robotraconteurlite_message_template_init(&message_template, template_bytes, header.message_size, slots, 2), 0);
+    robotraconteurlite_message_find_view_test_element(&buffer, header.message_size, "value", &element_reader);
+    assert_return_code(robotraconteurlite_message_template_add_slot(&message_template, &element_reader, &slot), 0);
+    assert_true(slot == 0);
+
+    assert_return_code(robotraconteurlite_message_template_set_endpoints(&message_template, 1234, 5678), 0);
+    assert_return_code(robotraconteurlite_message_template_set_request_id(&message_template, 42), 0);
+    assert_return_code(
+        robotraconteurlite_message_template_set_slot(&message_template, slot, patched_d, sizeof(patched_d)), 0);
+    assert_true(robotraconteurlite_message_template_set_slot(&message_template, slot, patched_d, 8) ==
+                ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER);
+    assert_true(robotraconteurlite_message_template_set_slot(&message_template, 1, patched_d, 8) ==
+                ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE);
+
+    /* Patched message must parse as a regular message */
+    assert_return_code(robotraconteurlite_message_reader_init(&reader, &buffer, 0, header.message_size), 0);
+    (void)memset(&header, 0, sizeof(header));
+    assert_return_code(robotraconteurlite_message_reader_read_header(&reader, &header), 0);
+    assert_true(header.sender_endpoint == 1234);
+    assert_true(header.receiver_endpoint == 5678);
+    assert_return_code(robotraconteurlite_message_reader_begin_read_entries(&reader, &entry_reader), 0);
+    (void)memset(&entry_header, 0, sizeof(entry_header));
+    assert_return_code(robotraconteurlite_messageentry_reader_read_header(&entry_reader, &entry_header), 0);
+    assert_true(entry_header.request_id == 42);
+
+    robotraconteurlite_message_find_view_test_element(&buffer, header.message_size, "value", &element_reader);
+    value.data = read_d;
+    value.len = 3;
+    assert_return_code(robotraconteurlite_messageelement_reader_read_data_double_array(&element_reader, &value), 0);
+    assert_true(cmp_double(read_d, patched_d, 3) == 0);
+}
+
+void robotraconteurlite_message_template_test(void** state)
+{
+    ROBOTRACONTEURLITE_UNUSED(state);
+    robotraconteurlite_message_run_template_test(2);
+    robotraconteurlite_message_run_template_test(4);
+}
+
+static void robotraconteurlite_message_run_size_of_test(uint16_t message_version)
+{
+    uint8_t send_bytes[1024];
+    double value_d[] = {1, 2, 3, 4, 5};
+    struct robotraconteurlite_buffer buffer1;
+    struct robotraconteurlite_buffer_vec buffer;
+    struct robotraconteurlite_message_writer writer;
+    struct robotraconteurlite_messageentry_writer entry_writer;
+    struct robotraconteurlite_message_header header;
+    struct robotraconteurlite_messageentry_header entry_header;
+    struct robotraconteurlite_messageelement_writer element_writer;
+    struct robotraconteurlite_messageelement_writer nested_writer;
+    struct robotraconteurlite_messageelement_header nested_header;
+    struct robotraconteurlite_array_double value;
+    struct robotraconteurlite_string el_name;
+    struct robotraconteurlite_string str_value;
+    size_t s = 0;
+    size_t nested_size = 0;
+    size_t elements_size = 0;
+    size_t entry_size = 0;
+    size_t message_size = 0;
+
+    buffer1.data = send_bytes;
+    buffer1.len = sizeof(send_bytes);
+    buffer.buffer_vec = &buffer1;
+    buffer.buffer_vec_cnt = 1;
+    assert_return_code(
+        robotraconteurlite_message_writer_init(&writer, &buffer, 0, sizeof(send_bytes), message_version), 0);
+
+    (void)memset(&header, 0, sizeof(header));
+    header.sender_endpoint = 1000;
+    header.receiver_endpoint = 70000;
+    header.entry_count = 1;
+    robotraconteurlite_string_from_c_str("sender_node", &header.sender_nodename);
+    (void)memset(&entry_header, 0, sizeof(entry_header));
+    entry_header.entry_type = ROBOTRACONTEURLITE_MESSAGEENTRYTYPE_FUNCTIONCALLRES;
+    entry_header.request_id = 300;
+    entry_header.error = ROBOTRACONTEURLITE_MESSAGEERRORTYPE_NONE;
+    robotraconteurlite_string_from_c_str("service.obj", &entry_header.service_path);
+    robotraconteurlite_string_from_c_str("func", &entry_header.member_name);
+    (void)memset(&nested_header, 0, sizeof(nested_header));
+    nested_header.element_type = ROBOTRACONTEURLITE_DATATYPE_STRUCTURE;
+    nested_header.element_number = -200;
+    robotraconteurlite_string_from_c_str("nested", &nested_header.element_name);
+    robotraconteurlite_string_from_c_str("example.Struct", &nested_header.element_type_name);
+    value.data = value_d;
+    value.len = 5;
+
+    /* Compute the size before writing */
+    robotraconteurlite_string_from_c_str("value", &el_name);
+    assert_return_code(
+        robotraconteurlite_messageelement_writer_size_of_double_array(message_version, &el_name, value.len, &s), 0);
+    elements_size = s;
+    robotraconteurlite_string_from_c_str("str", &el_name);
+    robotraconteurlite_string_from_c_str("hello world", &str_value);
+    assert_return_code(
+        robotraconteurlite_messageelement_writer_size_of_data_string(message_version, &el_name, &str_value, &s), 0);
+    elements_size += s;
+
+    assert_return_code(robotraconteurlite_messageelement_writer_size_of_header(message_version, &nested_header, &s),
+                       0);
+    nested_size = s;
+    robotraconteurlite_string_from_c_str("x", &el_name);
+    assert_return_code(robotraconteurlite_messageelement_writer_size_of_uint32(message_version, &el_name, &s), 0);
+    assert_return_code(robotraconteurlite_message_size_add(&nested_size, s), 0);
+    assert_return_code(robotraconteurlite_message_size_add(&elements_size, nested_size), 0);
+
+    assert_return_code(robotraconteurlite_messageentry_writer_size_of_header(message_version, &entry_header, &s), 0);
+    entry_size = s + elements_size;
+    assert_return_code(robotraconteurlite_message_writer_size_of_header(message_version, &header, 0xFFU, &s), 0);
+    message_size = s + entry_size;
+
+    /* Write the message and compare */
+    assert_return_code(robotraconteurlite_message_writer_begin_message(&writer, &header, &entry_writer), 0);
+    assert_return_code(
+        robotraconteurlite_messageentry_writer_begin_entry(&entry_writer, &entry_header, &element_writer), 0);
+    robotraconteurlite_string_from_c_str("value", &el_name);
+    assert_return_code(robotraconteurlite_messageelement_writer_write_double_array(&element_writer, &el_name, &value),
+                       0);
+    robotraconteurlite_string_from_c_str("str", &el_name);
+    assert_return_code(
+        robotraconteurlite_messageelement_writer_write_data_string(&element_writer, &el_name, &str_value), 0);
+    assert_return_code(
+        robotraconteurlite_messageelement_writer_begin_nested_element(&element_writer, &nested_header, &nested_writer),
+        0);
+    robotraconteurlite_string_from_c_str("x", &el_name);
+    assert_return_code(robotraconteurlite_messageelement_writer_write_uint32(&nested_writer, &el_name, 12), 0);
+    assert_return_code(
+        robotraconteurlite_messageelement_writer_end_nested_element(&element_writer, &nested_header, &nested_writer),
+        0);
+    assert_true(element_writer.elements_written_size == elements_size);
+    assert_return_code(robotraconteurlite_messageentry_writer_end_entry(&entry_writer, &entry_header, &element_writer),
+                       0);
+    assert_true(entry_writer.entries_written_size == entry_size);
+    assert_return_code(robotraconteurlite_message_writer_end_message(&writer, &header, &entry_writer), 0);
+    assert_true(header.message_size == message_size);
+
+    s = UINT32_MAX;
+    assert_true(robotraconteurlite_message_size_add(&s, 1) == ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE);
+    assert_true(robotraconteurlite_messageelement_writer_size_of_raw(3, &el_name, 1, 1, &s) ==
+                ROBOTRACONTEURLITE_ERROR_PROTOCOL);
+}
+
+void robotraconteurlite_message_size_of_test(void** state)
+{
+    ROBOTRACONTEURLITE_UNUSED(state);
+    robotraconteurlite_message_run_size_of_test(2);
+    robotraconteurlite_message_run_size_of_test(4);
+}
+
+static size_t robotraconteurlite_message_write_compact_test_message(struct robotraconteurlite_buffer_vec* buffer,
+                                                                    size_t buffer_len, uint8_t compact)
+{
+    uint8_t inner_d[300];
+    struct robotraconteurlite_message_writer writer;
+    struct robotraconteurlite_messageentry_writer entry_writer;
+    struct robotraconteurlite_message_header header;
+    struct robotraconteurlite_messageentry_header entry_header;
+    struct robotraconteurlite_messageelement_writer element_writer;
+    struct robotraconteurlite_messageelement_writer pose_writer;
+    struct robotraconteurlite_messageelement_writer inner_writer;
+    struct robotraconteurlite_messageelement_header pose_header;
+    struct robotraconteurlite_messageelement_header inner_header;
+    struct robotraconteurlite_array_uint8 inner;
+    struct robotraconteurlite_string el_name;
+    size_t i = 0;
+
+    for (i = 0; i < sizeof(inner_d); i++)
+    {
+        inner_d[i] = (uint8_t)i;
+    }
+
+    assert_return_code(robotraconteurlite_message_writer_init(&writer, buffer, 0, buffer_len, 4), 0);
+    if (compact != 0U)
+    {
+        assert_return_code(robotraconteurlite_message_writer_enable_compact_uint_x(&writer), 0);
+    }
+
+    (void)memset(&header, 0, sizeof(header));
+    header.entry_count = 1;
+    assert_return_code(robotraconteurlite_message_writer_begin_message(&writer, &header, &entry_writer), 0);
+    (void)memset(&entry_header, 0, sizeof(entry_header));
+    entry_header.entry_type = ROBOTRACONTEURLITE_MESSAGEENTRYTYPE_PROPERTYGETRES;
+    robotraconteurlite_string_from_c_str("pose", &entry_header.member_name);
+    assert_return_code(
+        robotraconteurlite_messageentry_writer_begin_entry(&entry_writer, &entry_header, &element_writer), 0);
+
+    robotraconteurlite_string_from_c_str("a", &el_name);
+    assert_return_code(robotraconteurlite_messageelement_writer_write_uint32(&element_writer, &el_name, 7), 0);
+
+    (void)memset(&pose_header, 0, sizeof(pose_header));
+    pose_header.element_type = ROBOTRACONTEURLITE_DATATYPE_STRUCTURE;
+    robotraconteurlite_string_from_c_str("pose", &pose_header.element_name);
+    robotraconteurlite_string_from_c_str("example.Pose", &pose_header.element_type_name);
+    assert_return_code(
+        robotraconteurlite_messageelement_writer_begin_nested_element(&element_writer, &pose_header, &pose_writer), 0);
+    robotraconteurlite_string_from_c_str("x", &el_name);
+    assert_return_code(robotraconteurlite_messageelement_writer_write_double(&pose_writer, &el_name, 1.5), 0);
+
+    (void)memset(&inner_header, 0, sizeof(inner_header));
+    inner_header.element_type = ROBOTRACONTEURLITE_DATATYPE_STRUCTURE;
+    robotraconteurlite_string_from_c_str("inner", &inner_header.element_name);
+    robotraconteurlite_string_from_c_str("example.Inner", &inner_header.element_type_name);
+    assert_return_code(
+        robotraconteurlite_messageelement_writer_begin_nested_element(&pose_writer, &inner_header, &inner_writer), 0);
+    inner.data = inner_d;
+    inner.len = sizeof(inner_d);
+    robotraconteurlite_string_from_c_str("data", &el_name);
+    assert_return_code(robotraconteurlite_messageelement_writer_write_uint8_array(&inner_writer, &el_name, &inner), 0);
+    assert_return_code(
+        robotraconteurlite_messageelement_writer_end_nested_element(&pose_writer, &inner_header, &inner_writer), 0);
+    assert_return_code(
+        robotraconteurlite_messageelement_writer_end_nested_element(&element_writer, &pose_header, &pose_writer), 0);
+
+    robotraconteurlite_string_from_c_str("b", &el_name);
+    assert_return_code(robotraconteurlite_messageelement_writer_write_uint32(&element_writer, &el_name, 8), 0);
+    assert_return_code(robotraconteurlite_messageentry_writer_end_entry(&entry_writer, &entry_header, &element_writer),
+                       0);
+    assert_return_code(robotraconteurlite_message_writer_end_message(&writer, &header, &entry_writer), 0);
+
+    return header.message_size;
+}
+
+static void robotraconteurlite_message_verify_compact_test_message(struct robotraconteurlite_buffer_vec* buffer,
+                                                                   size_t message_len)
+{
+    uint8_t read_d[300];
+    struct robotraconteurlite_messageelement_reader element_reader;
+    struct robotraconteurlite_messageelement_reader pose_reader;
+    struct robotraconteurlite_messageelement_reader inner_reader;
+    struct robotraconteurlite_messageelement_reader data_reader;
+    struct robotraconteurlite_array_uint8 read_a;
+    struct robotraconteurlite_string el_name;
+    uint32_t u = 0;
+    double d = 0;
+    size_t i = 0;
+
+    robotraconteurlite_message_find_view_test_element(buffer, message_len, "a", &element_reader);
+    assert_return_code(robotraconteurlite_messageelement_reader_read_data_uint32(&element_reader, &u), 0);
+    assert_true(u == 7U);
+    robotraconteurlite_message_find_view_test_element(buffer, message_len, "b", &element_reader);
+    assert_return_code(robotraconteurlite_messageelement_reader_read_data_uint32(&element_reader, &u), 0);
+    assert_true(u == 8U);
+
+    robotraconteurlite_message_find_view_test_element(buffer, message_len, "pose", &pose_reader);
+    robotraconteurlite_string_from_c_str("x", &el_name);
+    assert_return_code(robotraconteurlite_messageelement_reader_find_nested_element(&pose_reader, &el_name,
+                                                                                    &element_reader),
+                       0);
+    assert_return_code(robotraconteurlite_messageelement_reader_read_data_double(&element_reader, &d), 0);
+    assert_true(d == 1.5);
+    robotraconteurlite_string_from_c_str("inner", &el_name);
+    assert_return_code(
+        robotraconteurlite_messageelement_reader_find_nested_element(&pose_reader, &el_name, &inner_reader), 0);
+    robotraconteurlite_string_from_c_str("data", &el_name);
+    assert_return_code(
+        robotraconteurlite_messageelement_reader_find_nested_element(&inner_reader, &el_name, &data_reader), 0);
+    read_a.data = read_d;
+    read_a.len = sizeof(read_d);
+    assert_return_code(robotraconteurlite_messageelement_reader_read_data_uint8_array(&data_reader, &read_a), 0);
+    assert_true(read_a.len == sizeof(read_d));
+    for (i = 0; i < sizeof(read_d); i++)
+    {
+        assert_true(read_d[i] == (uint8_t)i);
+    }
+}
+
+/* More than 65535 elements, so both the size and count of the containers need the full 5 byte width */
+#define ROBOTRACONTEURLITE_MESSAGE_TEST_LARGE_COUNT 65537U
+static uint8_t robotraconteurlite_message_large_container_bytes[1048576];
+
+void robotraconteurlite_message_compact_large_container_test(void** state)
+{
+    struct robotraconteurlite_buffer segment;
+    struct robotraconteurlite_buffer_vec buffer;
+    struct robotraconteurlite_message_writer writer;
+    struct robotraconteurlite_messageentry_writer entry_writer;
+    struct robotraconteurlite_messageelement_writer element_writer;
+    struct robotraconteurlite_messageelement_writer list_writer;
+    struct robotraconteurlite_message_header header;
+    struct robotraconteurlite_messageentry_header entry_header;
+    struct robotraconteurlite_messageelement_header list_header;
+    struct robotraconteurlite_message_reader reader;
+    struct robotraconteurlite_messageentry_reader entry_reader;
+    struct robotraconteurlite_messageelement_reader element_reader;
+    struct robotraconteurlite_messageelement_reader nested_reader;
+    struct robotraconteurlite_messageelement_header element_header;
+    struct robotraconteurlite_string el_name;
+    uint8_t v = 0;
+    size_t i = 0;
+
+    ROBOTRACONTEURLITE_UNUSED(state);
+
+    segment.data = robotraconteurlite_message_large_container_bytes;
+    segment.len = sizeof(robotraconteurlite_message_large_container_bytes);
+    buffer.buffer_vec = &segment;
+    buffer.buffer_vec_cnt = 1;
+
+    assert_return_code(robotraconteurlite_message_writer_init(&writer, &buffer, 0, segment.len, 4), 0);
+    assert_return_code(robotraconteurlite_message_writer_enable_compact_uint_x(&writer), 0);
+    (void)memset(&header, 0, sizeof(header));
+    header.entry_count = 1;
+    assert_return_code(robotraconteurlite_message_writer_begin_message(&writer, &header, &entry_writer), 0);
+    (void)memset(&entry_header, 0, sizeof(entry_header));
+    entry_header.entry_type = ROBOTRACONTEURLITE_MESSAGEENTRYTYPE_PROPERTYGETRES;
+    robotraconteurlite_string_from_c_str("big", &entry_header.member_name);
+    assert_return_code(
+        robotraconteurlite_messageentry_writer_begin_entry(&entry_writer, &entry_header, &element_writer), 0);
+
+    (void)memset(&list_header, 0, sizeof(list_header));
+    list_header.element_type = ROBOTRACONTEURLITE_DATATYPE_LIST;
+    robotraconteurlite_string_from_c_str("big", &list_header.element_name);
+    assert_return_code(
+        robotraconteurlite_messageelement_writer_begin_nested_element(&element_writer, &list_header, &list_writer), 0);
+    el_name.data = NULL;
+    el_name.len = 0;
+    for (i = 0; i < ROBOTRACONTEURLITE_MESSAGE_TEST_LARGE_COUNT; i++)
+    {
+        assert_return_code(robotraconteurlite_messageelement_writer_write_uint8(&list_writer, &el_name, (uint8_t)i), 0);
+    }
+    assert_return_code(
+        robotraconteurlite_messageelement_writer_end_nested_element(&element_writer, &list_header, &list_writer), 0);
+
+    /* The entry itself also has more than 65535 elements */
+    for (i = 1; i < ROBOTRACONTEURLITE_MESSAGE_TEST_LARGE_COUNT; i++)
+    {
+        assert_return_code(robotraconteurlite_messageelement_writer_write_uint8(&element_writer, &el_name, (uint8_t)i),
+                           0);
+    }
+    assert_return_code(robotraconteurlite_messageentry_writer_end_entry(&entry_writer, &entry_header, &element_writer),
+                       0);
+    assert_return_code(robotraconteurlite_message_writer_end_message(&writer, &header, &entry_writer), 0);
+
+    assert_return_code(robotraconteurlite_message_reader_init(&reader, &buffer, 0, header.message_size), 0);
+    assert_return_code(robotraconteurlite_message_reader_validate(&reader), 0);
+    (void)memset(&header, 0, sizeof(header));
+    assert_return_code(robotraconteurlite_message_reader_read_header(&reader, &header), 0);
+    assert_return_code(robotraconteurlite_message_reader_begin_read_entries(&reader, &entry_reader), 0);
+    (void)memset(&entry_header, 0, sizeof(entry_header));
+    assert_return_code(robotraconteurlite_messageentry_reader_read_header(&entry_reader, &entry_header), 0);
+    assert_int_equal(entry_header.element_count, ROBOTRACONTEURLITE_MESSAGE_TEST_LARGE_COUNT);
+
+    assert_return_code(robotraconteurlite_messageentry_reader_begin_read_elements(&entry_reader, &element_reader), 0);
+    (void)memset(&element_header, 0, sizeof(element_header));
+    assert_return_code(robotraconteurlite_messageelement_reader_read_header(&element_reader, &element_header), 0);
+    assert_int_equal(element_header.data_count, ROBOTRACONTEURLITE_MESSAGE_TEST_LARGE_COUNT);
+    assert_return_code(robotraconteurlite_messageelement_reader_begin_read_nested_elements(&element_reader,
+                                                                                            &nested_reader),
+                       0);
+    for (i = 0; i < ROBOTRACONTEURLITE_MESSAGE_TEST_LARGE_COUNT; i++)
+    {
+        if (i > 0U)
+        {
+            assert_return_code(robotraconteurlite_messageelement_reader_move_next(&nested_reader), 0);
+        }
+        assert_return_code(robotraconteurlite_messageelement_reader_read_data_uint8(&nested_reader, &v), 0);
+        assert_int_equal(v, (uint8_t)i);
+    }
+    assert_int_equal(robotraconteurlite_messageelement_reader_move_next(&nested_reader),
+                     ROBOTRACONTEURLITE_ERROR_NO_MORE);
+
+    for (i = 1; i < ROBOTRACONTEURLITE_MESSAGE_TEST_LARGE_COUNT; i++)
+    {
+        assert_return_code(robotraconteurlite_messageelement_reader_move_next(&element_reader), 0);
+        assert_return_code(robotraconteurlite_messageelement_reader_read_data_uint8(&element_reader, &v), 0);
+        assert_int_equal(v, (uint8_t)i);
+    }
+    assert_int_equal(robotraconteurlite_messageelement_reader_move_next(&element_reader),
+                     ROBOTRACONTEURLITE_ERROR_NO_MORE);
+}
+
+void robotraconteurlite_message_compact_uint_x_test(void** state)
+{
+    uint8_t padded_bytes[512];
+    uint8_t compact_bytes[512];
+    struct robotraconteurlite_buffer segments[2];
+    struct robotraconteurlite_buffer_vec buffer;
+    struct robotraconteurlite_message_writer writer;
+    size_t padded_len = 0;
+    size_t compact_len = 0;
+
+    ROBOTRACONTEURLITE_UNUSED(state);
+
+    segments[0].data = padded_bytes;
+    segments[0].len = sizeof(padded_bytes);
+    buffer.buffer_vec = segments;
+    buffer.buffer_vec_cnt = 1;
+    padded_len = robotraconteurlite_message_write_compact_test_message(&buffer, sizeof(padded_bytes), 0);
+    robotraconteurlite_message_verify_compact_test_message(&buffer, padded_len);
+
+    segments[0].data = compact_bytes;
+    compact_len = robotraconteurlite_message_write_compact_test_message(&buffer, sizeof(compact_bytes), 1);
+    robotraconteurlite_message_verify_compact_test_message(&buffer, compact_len);
+
+    /* Entry, pose and inner each save 2 bytes of size and 4 bytes of count */
+    assert_true(compact_len == (padded_len - 18U));
+
+    /* Same result when the buffer is split into segments */
+    (void)memset(compact_bytes, 0, sizeof(compact_bytes));
+    segments[0].data = compact_bytes;
+    segments[0].len = 100;
+    segments[1].data = &compact_bytes[100];
+    segments[1].len = sizeof(compact_bytes) - 100U;
+    buffer.buffer_vec_cnt = 2;
+    assert_true(robotraconteurlite_message_write_compact_test_message(&buffer, sizeof(compact_bytes), 1) ==
+                compact_len);
+    robotraconteurlite_message_verify_compact_test_message(&buffer, compact_len);
+
+    buffer.buffer_vec_cnt = 1;
+    assert_return_code(robotraconteurlite_message_writer_init(&writer, &buffer, 0, 100, 2), 0);
+    assert_true(robotraconteurlite_message_writer_enable_compact_uint_x(&writer) ==
+                ROBOTRACONTEURLITE_ERROR_INVALID_VERSION);
+}
+
+/* A nested element inside a nested element lies past the start of the outer element, so its bounds are checked
+   against the end of the outer element and not its length */
+static void robotraconteurlite_message_run_nested_in_nested_test(uint16_t message_version)
+{
+    uint8_t message_bytes[512];
+    struct robotraconteurlite_buffer segment;
+    struct robotraconteurlite_buffer_vec buffer;
+    struct robotraconteurlite_message_writer writer;
+    struct robotraconteurlite_messageentry_writer entry_writer;
+    struct robotraconteurlite_messageelement_writer element_writer;
+    struct robotraconteurlite_messageelement_writer outer_writer;
+    struct robotraconteurlite_messageelement_writer inner_writer;
+    struct robotraconteurlite_message_header header;
+    struct robotraconteurlite_messageentry_header entry_header;
+    struct robotraconteurlite_messageelement_header outer_header;
+    struct robotraconteurlite_messageelement_header inner_header;
+    struct robotraconteurlite_messageelement_reader outer_reader;
+    struct robotraconteurlite_messageelement_reader outer_nested_reader;
+    struct robotraconteurlite_messageelement_reader inner_nested_reader;
+    struct robotraconteurlite_string el_name;
+    int32_t values_d[] = {1, 2, 3};
+    int32_t read_d[3];
+    struct robotraconteurlite_array_int32 values;
+    int32_t v = 0;
+
+    segment.data = message_bytes;
+    segment.len = sizeof(message_bytes);
+    buffer.buffer_vec = &segment;
+    buffer.buffer_vec_cnt = 1;
+
+    assert_return_code(
+        robotraconteurlite_message_writer_init(&writer, &buffer, 0, sizeof(message_bytes), message_version), 0);
+    (void)memset(&header, 0, sizeof(header));
+    header.entry_count = 1;
+    assert_return_code(robotraconteurlite_message_writer_begin_message(&writer, &header, &entry_writer), 0);
+    (void)memset(&entry_header, 0, sizeof(entry_header));
+    entry_header.entry_type = ROBOTRACONTEURLITE_MESSAGEENTRYTYPE_PROPERTYGETRES;
+    robotraconteurlite_string_from_c_str("outer", &entry_header.member_name);
+    assert_return_code(
+        robotraconteurlite_messageentry_writer_begin_entry(&entry_writer, &entry_header, &element_writer), 0);
+
+    robotraconteurlite_string_from_c_str("a", &el_name);
+    assert_return_code(robotraconteurlite_messageelement_writer_write_int32(&element_writer, &el_name, 4), 0);
+
+    (void)memset(&outer_header, 0, sizeof(outer_header));
+    outer_header.element_type = ROBOTRACONTEURLITE_DATATYPE_STRUCTURE;
+    robotraconteurlite_string_from_c_str("outer", &outer_header.element_name);
+    robotraconteurlite_string_from_c_str("example.Outer", &outer_header.element_type_name);
+    assert_return_code(
+        robotraconteurlite_messageelement_writer_begin_nested_element(&element_writer, &outer_header, &outer_writer),
+        0);
+    robotraconteurlite_string_from_c_str("x", &el_name);
+    assert_return_code(robotraconteurlite_messageelement_writer_write_int32(&outer_writer, &el_name, 5), 0);
+
+    (void)memset(&inner_header, 0, sizeof(inner_header));
+    inner_header.element_type = ROBOTRACONTEURLITE_DATATYPE_STRUCTURE;
+    robotraconteurlite_string_from_c_str("inner", &inner_header.element_name);
+    robotraconteurlite_string_from_c_str("example.Inner", &inner_header.element_type_name);
+    assert_return_code(
+        robotraconteurlite_messageelement_writer_begin_nested_element(&outer_writer, &inner_header, &inner_writer), 0);
+    values.data = values_d;
+    values.len = 3;
+    robotraconteurlite_string_from_c_str("values", &el_name);
+    assert_return_code(robotraconteurlite_messageelement_writer_write_int32_array(&inner_writer, &el_name, &values),
+                       0);
+    assert_return_code(
+        robotraconteurlite_messageelement_writer_end_nested_element(&outer_writer, &inner_header, &inner_writer), 0);
+    assert_return_code(
+        robotraconteurlite_messageelement_writer_end_nested_element(&element_writer, &outer_header, &outer_writer), 0);
+    assert_return_code(robotraconteurlite_messageentry_writer_end_entry(&entry_writer, &entry_header, &element_writer),
+                       0);
+    assert_return_code(robotraconteurlite_message_writer_end_message(&writer, &header, &entry_writer), 0);
+
+    robotraconteurlite_message_find_view_test_element(&buffer, header.message_size, "outer", &outer_reader);
+    assert_return_code(robotraconteurlite_messageelement_reader_begin_read_nested_elements(&outer_reader,
+                                                                                            &outer_nested_reader),
+                       0);
+    assert_return_code(robotraconteurlite_messageelement_reader_read_data_int32(&outer_nested_reader, &v), 0);
+    assert_true(v == 5);
+    assert_return_code(robotraconteurlite_messageelement_reader_move_next(&outer_nested_reader), 0);
+    assert_return_code(robotraconteurlite_messageelement_reader_begin_read_nested_elements(&outer_nested_reader,
+                                                                                            &inner_nested_reader),
+                       0);
+    values.data = read_d;
+    values.len = 3;
+    assert_return_code(robotraconteurlite_messageelement_reader_read_data_int32_array(&inner_nested_reader, &values),
+                       0);
+    assert_true(values.len == 3U);
+    assert_true(memcmp(read_d, values_d, sizeof(values_d)) == 0);
+    assert_int_equal(robotraconteurlite_messageelement_reader_move_next(&inner_nested_reader),
+                     ROBOTRACONTEURLITE_ERROR_NO_MORE);
+    assert_int_equal(robotraconteurlite_messageelement_reader_move_next(&outer_nested_reader),
+                     ROBOTRACONTEURLITE_ERROR_NO_MORE);
+}
+
+void robotraconteurlite_message_nested_in_nested_test(void** state)
+{
+    ROBOTRACONTEURLITE_UNUSED(state);
+    robotraconteurlite_message_run_nested_in_nested_test(2);
+    robotraconteurlite_message_run_nested_in_nested_test(4);
+}
+
+void robotraconteurlite_message_header_split_test(void** state)
+{
+    uint8_t message_bytes[512];
+    struct robotraconteurlite_buffer segments[2];
+    struct robotraconteurlite_buffer_vec buffer;
+    size_t message_len = 0;
+    size_t split = 0;
+    uint8_t compact = 0;
+
+    ROBOTRACONTEURLITE_UNUSED(state);
+
+    /* Headers decoded from a contiguous span must match the cursor fallback used when a header straddles a segment
+       boundary, so split the same bytes at every position */
+    for (compact = 0; compact < 2U; compact++)
+    {
+        segments[0].data = message_bytes;
+        segments[0].len = sizeof(message_bytes);
+        buffer.buffer_vec = segments;
+        buffer.buffer_vec_cnt = 1;
+        message_len = robotraconteurlite_message_write_compact_test_message(&buffer, sizeof(message_bytes), compact);
+
+        for (split = 1; split < message_len; split++)
+        {
+            segments[0].len = split;
+            segments[1].data = &message_bytes[split];
+            segments[1].len = message_len - split;
+            buffer.buffer_vec_cnt = 2;
+            robotraconteurlite_message_verify_compact_test_message(&buffer, message_len);
+        }
+    }
+}
+
+static size_t robotraconteurlite_message_write_string_table_test_message(
+    uint8_t* buffer_bytes, size_t buffer_bytes_len, const struct robotraconteurlite_string_table* table)
+{
+    struct robotraconteurlite_buffer buffer1;
+    struct robotraconteurlite_buffer_vec buffer;
+    struct robotraconteurlite_message_writer writer;
+    struct robotraconteurlite_messageentry_writer entry_writer;
+    struct robotraconteurlite_message_header header;
+    struct robotraconteurlite_messageentry_header entry_header;
+    struct robotraconteurlite_messageelement_writer element_writer;
+    struct robotraconteurlite_messageelement_writer pose_writer;
+    struct robotraconteurlite_messageelement_header pose_header;
+    struct robotraconteurlite_string el_name;
+
+    buffer1.data = buffer_bytes;
+    buffer1.len = buffer_bytes_len;
+    buffer.buffer_vec = &buffer1;
+    buffer.buffer_vec_cnt = 1;
+
+    assert_return_code(robotraconteurlite_message_writer_init(&writer, &buffer, 0, buffer_bytes_len, 4), 0);
+    if (table != NULL)
+    {
+        assert_return_code(robotraconteurlite_message_writer_set_string_table(&writer, table), 0);
+    }
+
+    (void)memset(&header, 0, sizeof(header));
+    header.entry_count = 1;
+    assert_return_code(robotraconteurlite_message_writer_begin_message(&writer, &header, &entry_writer), 0);
+    (void)memset(&entry_header, 0, sizeof(entry_header));
+    entry_header.entry_type = ROBOTRACONTEURLITE_MESSAGEENTRYTYPE_PROPERTYGETRES;
+    robotraconteurlite_string_from_c_str("robot", &entry_header.service_path);
+    robotraconteurlite_string_from_c_str("pose", &entry_header.member_name);
+    assert_return_code(
+        robotraconteurlite_messageentry_writer_begin_entry(&entry_writer, &entry_header, &element_writer), 0);
+
+    robotraconteurlite_string_from_c_str("value", &el_name);
+    assert_return_code(robotraconteurlite_messageelement_writer_write_double(&element_writer, &el_name, 2.5), 0);
+
+    (void)memset(&pose_header, 0, sizeof(pose_header));
+    pose_header.element_type = ROBOTRACONTEURLITE_DATATYPE_STRUCTURE;
+    robotraconteurlite_string_from_c_str("pose", &pose_header.element_name);
+    robotraconteurlite_string_from_c_str("example.Pose", &pose_header.element_type_name);
+    assert_return_code(
+        robotraconteurlite_messageelement_writer_begin_nested_element(&element_writer, &pose_header, &pose_writer), 0);
+    robotraconteurlite_string_from_c_str("value", &el_name);
+    assert_return_code(robotraconteurlite_messageelement_writer_write_double(&pose_writer, &el_name, 1.5), 0);
+    assert_return_code(
+        robotraconteurlite_messageelement_writer_end_nested_element(&element_writer, &pose_header, &pose_writer), 0);
+
+    assert_return_code(robotraconteurlite_messageentry_writer_end_entry(&entry_writer, &entry_header, &element_writer),
+                       0);
+    assert_return_code(robotraconteurlite_message_writer_end_message(&writer, &header, &entry_writer), 0);
+
+    return header.message_size;
+}
+
+void robotraconteurlite_message_string_table_test(void** state)
+{
+    uint8_t plain_bytes[256];
+    uint8_t coded_bytes[256];
+    struct robotraconteurlite_string_table_entry table_entries[4];
+    char table_storage[32];
+    struct robotraconteurlite_string_table table;
+    struct robotraconteurlite_buffer buffer1;
+    struct robotraconteurlite_buffer_vec buffer;
+    struct robotraconteurlite_message_reader reader;
+    struct robotraconteurlite_message_header header;
+    struct robotraconteurlite_messageentry_reader entry_reader;
+    struct robotraconteurlite_messageentry_header entry_header;
+    struct robotraconteurlite_messageelement_reader element_reader;
+    struct robotraconteurlite_messageelement_reader pose_reader;
+    struct robotraconteurlite_messageelement_header element_header;
+    struct robotraconteurlite_messageelement_index_entry index_entries[4];
+    struct robotraconteurlite_messageelement_index index;
+    char service_path_char[32];
+    char member_name_char[32];
+    char type_name_char[32];
+    struct robotraconteurlite_string str;
+    uint32_t code = 0;
+    size_t plain_len = 0;
+    size_t coded_len = 0;
+    double d = 0;
+
+    ROBOTRACONTEURLITE_UNUSED(state);
+
+    assert_return_code(robotraconteurlite_string_table_init(&table, table_entries, 4, table_storage,
+                                                            sizeof(table_storage)),
+                       0);
+    robotraconteurlite_string_from_c_str("pose", &str);
+    assert_return_code(robotraconteurlite_string_table_add(&table, 1, &str), 0);
+    assert_return_code(robotraconteurlite_string_table_add(&table, 1, &str), 0);
+    robotraconteurlite_string_from_c_str("example.Pose", &str);
+    assert_true(robotraconteurlite_string_table_add(&table, 1, &str) == ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER);
+    assert_true(robotraconteurlite_string_table_add(&table, 0, &str) == ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER);
+    assert_return_code(robotraconteurlite_string_table_add(&table, 2, &str), 0);
+    robotraconteurlite_string_from_c_str("value", &str);
+    assert_return_code(robotraconteurlite_string_table_add(&table, 300, &str), 0);
+    robotraconteurlite_string_from_c_str("a_string_that_does_not_fit", &str);
+    assert_true(robotraconteurlite_string_table_add(&table, 4, &str) == ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE);
+
+    /* Unconfirmed entries are not used for sending */
+    robotraconteurlite_string_from_c_str("value", &str);
+    assert_true(robotraconteurlite_string_table_find_code(&table, &str, 1, &code) ==
+                ROBOTRACONTEURLITE_ERROR_KEY_NOT_FOUND);
+    assert_return_code(robotraconteurlite_string_table_find_code(&table, &str, 0, &code), 0);
+    assert_true(code == 300U);
+    plain_len = robotraconteurlite_message_write_string_table_test_message(plain_bytes, sizeof(plain_bytes), &table);
+    assert_true(plain_len == robotraconteurlite_message_write_string_table_test_message(
+                                 coded_bytes, sizeof(coded_bytes), NULL));
+
+    assert_return_code(robotraconteurlite_string_table_confirm(&table, 1), 0);
+    assert_return_code(robotraconteurlite_string_table_confirm(&table, 2), 0);
+    assert_return_code(robotraconteurlite_string_table_confirm(&table, 300), 0);
+    assert_true(robotraconteurlite_string_table_confirm(&table, 5) == ROBOTRACONTEURLITE_ERROR_KEY_NOT_FOUND);
+    coded_len = robotraconteurlite_message_write_string_table_test_message(coded_bytes, sizeof(coded_bytes), &table);
+
+    /* "pose" twice and "value" twice replaced by 1 and 3 byte codes, "example.Pose" by a 1 byte code, each saving
+       the string length prefix */
+    assert_true(coded_len == (plain_len - 2U * 4U - 2U * 3U - 12U));
+
+    buffer1.data = coded_bytes;
+    buffer1.len = coded_len;
+    buffer.buffer_vec = &buffer1;
+    buffer.buffer_vec_cnt = 1;
+    assert_return_code(robotraconteurlite_message_reader_init(&reader, &buffer, 0, coded_len), 0);
+    assert_return_code(robotraconteurlite_message_reader_set_string_table(&reader, &table), 0);
+    (void)memset(&header, 0, sizeof(header));
+    assert_return_code(robotraconteurlite_message_reader_read_header(&reader, &header), 0);
+    assert_return_code(robotraconteurlite_message_reader_begin_read_entries(&reader, &entry_reader), 0);
+
+    (void)memset(&entry_header, 0, sizeof(entry_header));
+    entry_header.service_path.data = service_path_char;
+    entry_header.service_path.len = sizeof(service_path_char);
+    entry_header.member_name.data = member_name_char;
+    entry_header.member_name.len = sizeof(member_name_char);
+    assert_return_code(robotraconteurlite_messageentry_reader_read_header(&entry_reader, &entry_header), 0);
+    assert_true(robotraconteurlite_string_cmp_c_str(&entry_header.service_path, "robot") == 0);
+    assert_true(entry_header.service_path_code == 0U);
+    assert_true(robotraconteurlite_string_cmp_c_str(&entry_header.member_name, "pose") == 0);
+    assert_true(entry_header.member_name_code == 1U);
+
+    /* Scan lookup of coded element names */
+    robotraconteurlite_string_from_c_str("value", &str);
+    assert_return_code(robotraconteurlite_messageentry_reader_find_element(&entry_reader, &str, &element_reader), 0);
+    assert_return_code(robotraconteurlite_messageelement_reader_read_data_double(&element_reader, &d), 0);
+    assert_true(d == 2.5);
+
+    /* Index lookup of coded element names */
+    index.entries = index_entries;
+    index.entries_len = 4;
+    assert_return_code(robotraconteurlite_messageentry_reader_build_element_index(&entry_reader, &index), 0);
+    robotraconteurlite_string_from_c_str("pose", &str);
+    assert_return_code(robotraconteurlite_messageentry_reader_find_element(&entry_reader, &str, &pose_reader), 0);
+    (void)memset(&element_header, 0, sizeof(element_header));
+    element_header.element_type_name.data = type_name_char;
+    element_header.element_type_name.len = sizeof(type_name_char);
+    assert_return_code(robotraconteurlite_messageelement_reader_read_header(&pose_reader, &element_header), 0);
+    assert_true(robotraconteurlite_string_cmp_c_str(&element_header.element_type_name, "example.Pose") == 0);
+    assert_true(element_header.element_type_name_code == 2U);
+    robotraconteurlite_string_from_c_str("value", &str);
+    assert_return_code(
+        robotraconteurlite_messageelement_reader_find_nested_element(&pose_reader, &str, &element_reader), 0);
+    assert_return_code(robotraconteurlite_messageelement_reader_read_data_double(&element_reader, &d), 0);
+    assert_true(d == 1.5);
+
+    /* Without the table codes are not resolved */
+    assert_return_code(robotraconteurlite_message_reader_init(&reader, &buffer, 0, coded_len), 0);
+    (void)memset(&header, 0, sizeof(header));
+    assert_return_code(robotraconteurlite_message_reader_read_header(&reader, &header), 0);
+    assert_return_code(robotraconteurlite_message_reader_begin_read_entries(&reader, &entry_reader), 0);
+    (void)memset(&entry_header, 0, sizeof(entry_header));
+    assert_return_code(robotraconteurlite_messageentry_reader_read_header(&entry_reader, &entry_header), 0);
+    assert_true(entry_header.member_name.len == 0U);
+    assert_true(entry_header.member_name_code == 1U);
+    robotraconteurlite_string_from_c_str("value", &str);
+    assert_true(robotraconteurlite_messageentry_reader_find_element(&entry_reader, &str, &element_reader) ==
+                ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_NOT_FOUND);
+
+    robotraconteurlite_string_table_clear_confirmed(&table);
+    assert_true(robotraconteurlite_message_write_string_table_test_message(coded_bytes, sizeof(coded_bytes),
+                                                                           &table) == plain_len);
+    robotraconteurlite_string_table_clear(&table);
+    assert_true(robotraconteurlite_string_table_find_string(&table, 1, &str) ==
+                ROBOTRACONTEURLITE_ERROR_KEY_NOT_FOUND);
+}
+
+static void robotraconteurlite_message_init_struct_test_pose(struct message_struct_test_pose* pose)
+{
+    size_t i = 0;
+
+    (void)memset(pose, 0, sizeof(*pose));
+    pose->seq = 17;
+    (void)memcpy(pose->label, "tool0", 5);
+    pose->label_len = 5;
+    pose->position.x = 1.5;
+    pose->position.y = -2.0;
+    pose->position.z = 3.25;
+    pose->waypoints_len = 2;
+    for (i = 0; i < 2U; i++)
+    {
+        pose->waypoints[i].x = (double)i;
+        pose->waypoints[i].y = (double)i + 0.5;
+        pose->waypoints[i].z = -(double)i;
+    }
+    pose->samples_len = 3;
+    for (i = 0; i < 3U; i++)
+    {
+        pose->samples[i].id = (uint32_t)(100U + i);
+        pose->samples[i].gains[0] = 1.0F;
+        pose->samples[i].gains[1] = 2.0F;
+        pose->samples[i].gains[2] = (float)i;
+        pose->samples[i].offset.z = (double)i * 10.0;
+    }
+    for (i = 0; i < 6U; i++)
+    {
+        pose->covariance[i] = (double)i * 0.1;
+    }
+    pose->weights_len = 1;
+    pose->weights[0] = 0.75;
+}
+
+static void robotraconteurlite_message_verify_struct_test_pose(const struct message_struct_test_pose* pose)
+{
+    struct message_struct_test_pose expected;
+    size_t i = 0;
+
+    robotraconteurlite_message_init_struct_test_pose(&expected);
+    assert_true(pose->seq == expected.seq);
+    assert_true(pose->label_len == expected.label_len);
+    assert_true(memcmp(pose->label, expected.label, expected.label_len) == 0);
+    assert_true(cmp_double(&pose->position.x, &expected.position.x, 3) == 0);
+    assert_true(pose->waypoints_len == expected.waypoints_len);
+    assert_true(cmp_double(&pose->waypoints[0].x, &expected.waypoints[0].x, 6) == 0);
+    assert_true(pose->samples_len == expected.samples_len);
+    for (i = 0; i < expected.samples_len; i++)
+    {
+        assert_true(pose->samples[i].id == expected.samples[i].id);
+        assert_true(memcmp(pose->samples[i].gains, expected.samples[i].gains, sizeof(expected.samples[i].gains)) == 0);
+        assert_true(cmp_double(&pose->samples[i].offset.x, &expected.samples[i].offset.x, 3) == 0);
+    }
+    assert_true(cmp_double(pose->covariance, expected.covariance, 6) == 0);
+    assert_true(pose->weights_len == expected.weights_len);
+    assert_true(cmp_double(pose->weights, expected.weights, 1) == 0);
+}
+
+static void robotraconteurlite_message_run_struct_test(uint16_t message_version)
+{
+    uint8_t send_bytes[4096];
+    struct robotraconteurlite_buffer buffer1;
+    struct robotraconteurlite_buffer_vec buffer;
+    struct robotraconteurlite_message_writer writer;
+    struct robotraconteurlite_messageentry_writer entry_writer;
+    struct robotraconteurlite_message_header header;
+    struct robotraconteurlite_messageentry_header entry_header;
+    struct robotraconteurlite_messageelement_writer element_writer;
+    struct robotraconteurlite_messageelement_header nested_header;
+    struct robotraconteurlite_messageelement_writer nested_writer;
+    struct robotraconteurlite_messageelement_reader element_reader;
+    struct message_struct_test_robot_state state;
+    struct message_struct_test_robot_state read_state;
+    struct message_struct_test_vector3 read_vectors[1];
+    struct robotraconteurlite_string el_name;
+    size_t read_len = 0;
+
+    (void)memset(&state, 0, sizeof(state));
+    robotraconteurlite_message_init_struct_test_pose(&state.pose);
+    state.enabled = 1;
+
+    buffer1.data = send_bytes;
+    buffer1.len = sizeof(send_bytes);
+    buffer.buffer_vec = &buffer1;
+    buffer.buffer_vec_cnt = 1;
+    assert_return_code(
+        robotraconteurlite_message_writer_init(&writer, &buffer, 0, sizeof(send_bytes), message_version), 0);
+    (void)memset(&header, 0, sizeof(header));
+    assert_return_code(robotraconteurlite_message_writer_begin_message(&writer, &header, &entry_writer), 0);
+    (void)memset(&entry_header, 0, sizeof(entry_header));
+    entry_header.entry_type = ROBOTRACONTEURLITE_MESSAGEENTRYTYPE_PROPERTYGETRES;
+    robotraconteurlite_string_from_c_str("state", &entry_header.member_name);
+    assert_return_code(
+        robotraconteurlite_messageentry_writer_begin_entry(&entry_writer, &entry_header, &element_writer), 0);
+    robotraconteurlite_string_from_c_str("state", &el_name);
+    assert_return_code(message_struct_test_robot_state_write(&element_writer, &el_name, &state), 0);
+
+    /* Fields written out of declared order must still be found */
+    (void)memset(&nested_header, 0, sizeof(nested_header));
+    nested_header.element_type = ROBOTRACONTEURLITE_DATATYPE_STRUCTURE;
+    robotraconteurlite_string_from_c_str("reordered", &nested_header.element_name);
+    robotraconteurlite_string_from_c_str("experimental.message_struct_test.RobotState",
+                                         &nested_header.element_type_name);
+    assert_return_code(
+        robotraconteurlite_messageelement_writer_begin_nested_element(&element_writer, &nested_header, &nested_writer),
+        0);
+    robotraconteurlite_string_from_c_str("enabled", &el_name);
+    assert_return_code(robotraconteurlite_messageelement_writer_write_uint8(&nested_writer, &el_name, 1), 0);
+    robotraconteurlite_string_from_c_str("pose", &el_name);
+    assert_return_code(message_struct_test_pose_write(&nested_writer, &el_name, &state.pose), 0);
+    assert_return_code(
+        robotraconteurlite_messageelement_writer_end_nested_element(&element_writer, &nested_header, &nested_writer),
+        0);
+
+    /* Lengths beyond the field capacity are rejected */
+    state.pose.weights_len = 9;
+    robotraconteurlite_string_from_c_str("invalid", &el_name);
+    assert_true(message_struct_test_robot_state_write(&element_writer, &el_name, &state) ==
+                ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER);
+
+    assert_return_code(robotraconteurlite_messageentry_writer_end_entry(&entry_writer, &entry_header, &element_writer),
+                       0);
+    assert_return_code(robotraconteurlite_message_writer_end_message(&writer, &header, &entry_writer), 0);
+
+    robotraconteurlite_message_find_view_test_element(&buffer, header.message_size, "state", &element_reader);
+    (void)memset(&read_state, 0, sizeof(read_state));
+    assert_return_code(message_struct_test_robot_state_read(&element_reader, &read_state), 0);
+    assert_true(read_state.enabled == 1);
+    robotraconteurlite_message_verify_struct_test_pose(&read_state.pose);
+
+    robotraconteurlite_message_find_view_test_element(&buffer, header.message_size, "reordered", &element_reader);
+    (void)memset(&read_state, 0, sizeof(read_state));
+    assert_return_code(message_struct_test_robot_state_read(&element_reader, &read_state), 0);
+    assert_true(read_state.enabled == 1);
+    robotraconteurlite_message_verify_struct_test_pose(&read_state.pose);
+
+    /* A structure is not a namedarray */
+    read_len = 1;
+    robotraconteurlite_message_find_view_test_element(&buffer, header.message_size, "state", &element_reader);
+    assert_true(message_struct_test_vector3_read_array(&element_reader, read_vectors, &read_len) ==
+                ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_TYPE_MISMATCH);
+}
+
+void robotraconteurlite_message_struct_test(void** state)
+{
+    ROBOTRACONTEURLITE_UNUSED(state);
+    robotraconteurlite_message_run_struct_test(2);
+    robotraconteurlite_message_run_struct_test(4);
+}
+
+static void robotraconteurlite_message_run_multidimarray_test(uint16_t message_version)
+{
+    /* double storage keeps the message buffer 8 byte aligned */
+    double send_storage[64];
+    uint8_t* send_bytes = (uint8_t*)send_storage;
+    uint32_t dims_d[] = {3, 2};
+    uint32_t bad_dims_d[] = {4, 2};
+    double value_d[] = {1, 2, 3, 4, 5, 6};
+    uint32_t read_dims_d[4];
+    double read_d[8];
+    struct robotraconteurlite_buffer buffer1;
+    struct robotraconteurlite_buffer_vec buffer;
+    struct robotraconteurlite_message_writer writer;
+    struct robotraconteurlite_messageentry_writer entry_writer;
+    struct robotraconteurlite_message_header header;
+    struct robotraconteurlite_messageentry_header entry_header;
+    struct robotraconteurlite_messageelement_writer element_writer;
+    struct robotraconteurlite_messageelement_reader element_reader;
+    struct robotraconteurlite_multidimarray_double value;
+    struct robotraconteurlite_multidimarray_double read_value;
+    struct robotraconteurlite_string el_name;
+    robotraconteurlite_status rv = -1;
+
+    buffer1.data = send_bytes;
+    buffer1.len = sizeof(send_storage);
+    buffer.buffer_vec = &buffer1;
+    buffer.buffer_vec_cnt = 1;
+    assert_return_code(
+        robotraconteurlite_message_writer_init(&writer, &buffer, 0, sizeof(send_storage), message_version), 0);
+    (void)memset(&header, 0, sizeof(header));
+    assert_return_code(robotraconteurlite_message_writer_begin_message(&writer, &header, &entry_writer), 0);
+    (void)memset(&entry_header, 0, sizeof(entry_header));
+    entry_header.entry_type = ROBOTRACONTEURLITE_MESSAGEENTRYTYPE_PROPERTYGETRES;
+    robotraconteurlite_string_from_c_str("image", &entry_header.member_name);
+    assert_return_code(
+        robotraconteurlite_messageentry_writer_begin_entry(&entry_writer, &entry_header, &element_writer), 0);
+    value.dims.data = dims_d;
+    value.dims.len = 2;
+    value.array.data = value_d;
+    value.array.len = 6;
+    robotraconteurlite_string_from_c_str("value", &el_name);
+    assert_return_code(
+        robotraconteurlite_messageelement_writer_write_multidimarray_double(&element_writer, &el_name, &value), 0);
+    robotraconteurlite_string_from_c_str("flat", &el_name);
+    assert_return_code(
+        robotraconteurlite_messageelement_writer_write_double_array(&element_writer, &el_name, &value.array), 0);
+
+    /* dims must describe exactly the array length */
+    value.dims.data = bad_dims_d;
+    robotraconteurlite_string_from_c_str("invalid", &el_name);
+    assert_true(robotraconteurlite_messageelement_writer_write_multidimarray_double(&element_writer, &el_name,
+                                                                                    &value) ==
+                ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER);
+
+    assert_return_code(robotraconteurlite_messageentry_writer_end_entry(&entry_writer, &entry_header, &element_writer),
+                       0);
+    assert_return_code(robotraconteurlite_message_writer_end_message(&writer, &header, &entry_writer), 0);
+
+    robotraconteurlite_message_find_view_test_element(&buffer, header.message_size, "value", &element_reader);
+    read_value.dims.data = read_dims_d;
+    read_value.dims.len = 4;
+    read_value.array.data = read_d;
+    read_value.array.len = 8;
+    assert_return_code(robotraconteurlite_messageelement_reader_read_multidimarray_double(&element_reader, &read_value),
+                       0);
+    assert_true(read_value.dims.len == 2U);
+    assert_true((read_dims_d[0] == 3U) && (read_dims_d[1] == 2U));
+    assert_true(read_value.array.len == 6U);
+    assert_true(cmp_double(read_d, value_d, 6) == 0);
+
+    /* The view points into the message buffer, or falls back to the caller storage if misaligned */
+    (void)memset(read_d, 0, sizeof(read_d));
+    read_value.dims.data = read_dims_d;
+    read_value.dims.len = 4;
+    read_value.array.data = read_d;
+    read_value.array.len = 8;
+    rv = robotraconteurlite_messageelement_reader_read_multidimarray_double_view(&element_reader, &read_value);
+    assert_return_code(rv, 0);
+    if (rv == ROBOTRACONTEURLITE_ERROR_SUCCESS)
+    {
+        assert_true((uint8_t*)read_value.array.data > send_bytes);
+        assert_true((uint8_t*)read_value.array.data < (send_bytes + header.message_size));
+        assert_true((uint8_t*)read_value.dims.data > send_bytes);
+    }
+    assert_true(read_value.dims.len == 2U);
+    assert_true((read_value.dims.data[0] == 3U) && (read_value.dims.data[1] == 2U));
+    assert_true(read_value.array.len == 6U);
+    assert_true(cmp_double(read_value.array.data, value_d, 6) == 0);
+
+    robotraconteurlite_message_find_view_test_element(&buffer, header.message_size, "flat", &element_reader);
+    read_value.dims.data = read_dims_d;
+    read_value.dims.len = 4;
+    read_value.array.data = read_d;
+    read_value.array.len = 8;
+    assert_true(robotraconteurlite_messageelement_reader_read_multidimarray_double(&element_reader, &read_value) ==
+                ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_TYPE_MISMATCH);
+}
+
+void robotraconteurlite_message_multidimarray_test(void** state)
+{
+    ROBOTRACONTEURLITE_UNUSED(state);
+    robotraconteurlite_message_run_multidimarray_test(2);
+    robotraconteurlite_message_run_multidimarray_test(4);
+}
+
+static void robotraconteurlite_message_run_header_string_views_test(uint16_t message_version)
+{
+    uint8_t send_bytes[256];
+    char member_name_char[32];
+    char service_path_char[32];
+    struct robotraconteurlite_buffer buffer1[2];
+    struct robotraconteurlite_buffer_vec buffer;
+    struct robotraconteurlite_message_writer writer;
+    struct robotraconteurlite_messageentry_writer entry_writer;
+    struct robotraconteurlite_message_header header;
+    struct robotraconteurlite_messageentry_header entry_header;
+    struct robotraconteurlite_messageelement_writer element_writer;
+    struct robotraconteurlite_message_reader reader;
+    struct robotraconteurlite_messageentry_reader entry_reader;
+    struct robotraconteurlite_messageentry_buffer_info entry_buffer_info;
+    size_t message_size = 0;
+    size_t split = 0;
+
+    buffer1[0].data = send_bytes;
+    buffer1[0].len = sizeof(send_bytes);
+    buffer.buffer_vec = buffer1;
+    buffer.buffer_vec_cnt = 1;
+    assert_return_code(
+        robotraconteurlite_message_writer_init(&writer, &buffer, 0, sizeof(send_bytes), message_version), 0);
+    (void)memset(&header, 0, sizeof(header));
+    assert_return_code(robotraconteurlite_message_writer_begin_message(&writer, &header, &entry_writer), 0);
+    (void)memset(&entry_header, 0, sizeof(entry_header));
+    entry_header.entry_type = ROBOTRACONTEURLITE_MESSAGEENTRYTYPE_PROPERTYGETREQ;
+    robotraconteurlite_string_from_c_str("service.path", &entry_header.service_path);
+    robotraconteurlite_string_from_c_str("member_name", &entry_header.member_name);
+    assert_return_code(
+        robotraconteurlite_messageentry_writer_begin_entry(&entry_writer, &entry_header, &element_writer), 0);
+    assert_return_code(robotraconteurlite_messageentry_writer_end_entry(&entry_writer, &entry_header, &element_writer),
+                       0);
+    assert_return_code(robotraconteurlite_message_writer_end_message(&writer, &header, &entry_writer), 0);
+    message_size = header.message_size;
+
+    /* Contiguous strings are returned as views into the buffer */
+    assert_return_code(robotraconteurlite_message_reader_init(&reader, &buffer, 0, message_size), 0);
+    assert_return_code(robotraconteurlite_message_reader_set_string_views(&reader, 1U), 0);
+    (void)memset(&header, 0, sizeof(header));
+    assert_return_code(robotraconteurlite_message_reader_read_header(&reader, &header), 0);
+    assert_return_code(robotraconteurlite_message_reader_begin_read_entries(&reader, &entry_reader), 0);
+    (void)memset(&entry_header, 0, sizeof(entry_header));
+    entry_header.member_name.data = member_name_char;
+    entry_header.member_name.len = sizeof(member_name_char);
+    entry_header.service_path.data = service_path_char;
+    entry_header.service_path.len = sizeof(service_path_char);
+    assert_return_code(
+        robotraconteurlite_messageentry_reader_read_header_ex(&entry_reader, &entry_header, &entry_buffer_info), 0);
+    assert_true(robotraconteurlite_string_cmp_c_str(&entry_header.member_name, "member_name") == 0);
+    assert_true(robotraconteurlite_string_cmp_c_str(&entry_header.service_path, "service.path") == 0);
+    assert_true((uint8_t*)entry_header.member_name.data > send_bytes);
+    assert_true((uint8_t*)entry_header.member_name.data < (send_bytes + message_size));
+    assert_true((uint8_t*)entry_header.service_path.data > send_bytes);
+    assert_true((uint8_t*)entry_header.service_path.data < (send_bytes + message_size));
+
+    /* A string that straddles buffer segments is copied into the header storage */
+    split = (size_t)((uint8_t*)entry_header.member_name.data - send_bytes) + 4U;
+    buffer1[0].len = split;
+    buffer1[1].data = send_bytes + split;
+    buffer1[1].len = message_size - split;
+    buffer.buffer_vec_cnt = 2;
+    assert_return_code(robotraconteurlite_message_reader_init(&reader, &buffer, 0, message_size), 0);
+    assert_return_code(robotraconteurlite_message_reader_set_string_views(&reader, 1U), 0);
+    (void)memset(&header, 0, sizeof(header));
+    assert_return_code(robotraconteurlite_message_reader_read_header(&reader, &header), 0);
+    assert_return_code(robotraconteurlite_message_reader_begin_read_entries(&reader, &entry_reader), 0);
+    (void)memset(&entry_header, 0, sizeof(entry_header));
+    entry_header.member_name.data = member_name_char;
+    entry_header.member_name.len = sizeof(member_name_char);
+    entry_header.service_path.data = service_path_char;
+    entry_header.service_path.len = sizeof(service_path_char);
+    assert_return_code(robotraconteurlite_messageentry_reader_read_header(&entry_reader, &entry_header), 0);
+    assert_true(robotraconteurlite_string_cmp_c_str(&entry_header.member_name, "member_name") == 0);
+    assert_true(entry_header.member_name.data == member_name_char);
+    assert_true(robotraconteurlite_string_cmp_c_str(&entry_header.service_path, "service.path") == 0);
+    assert_true(entry_header.service_path.data != service_path_char);
+}
+
+void robotraconteurlite_message_header_string_views_test(void** state)
+{
+    ROBOTRACONTEURLITE_UNUSED(state);
+    robotraconteurlite_message_run_header_string_views_test(2);
+    robotraconteurlite_message_run_header_string_views_test(4);
+}
+
+#define MEMBER_DISPATCH_TEST_LEN 80U
+
+void robotraconteurlite_message_member_dispatch_test(void** state)
+{
+    static char member_names[MEMBER_DISPATCH_TEST_LEN][16];
+    struct robotraconteurlite_member_dispatch_entry entries[MEMBER_DISPATCH_TEST_LEN];
+    uint16_t slots[100];
+    uint16_t displacements[20];
+    struct robotraconteurlite_member_dispatch dispatch;
+    struct robotraconteurlite_messageentry_header header;
+    uint32_t handler_id = 0;
+    size_t i = 0;
+    ROBOTRACONTEURLITE_UNUSED(state);
+
+    for (i = 0; i < MEMBER_DISPATCH_TEST_LEN; i++)
+    {
+        (void)sprintf(member_names[i], "member_%d", (int)(i / 2U));
+        entries[i].entry_type = ((i % 2U) == 0U) ? ROBOTRACONTEURLITE_MESSAGEENTRYTYPE_PROPERTYGETREQ
+                                                 : ROBOTRACONTEURLITE_MESSAGEENTRYTYPE_PROPERTYSETREQ;
+        entries[i].service_path = (i < 40U) ? "service1" : "service1.child";
+        entries[i].member_name = member_names[i];
+        entries[i].handler_id = (uint32_t)(1000U + i);
+    }
+
+    assert_int_equal(robotraconteurlite_member_dispatch_init(&dispatch, entries, MEMBER_DISPATCH_TEST_LEN, slots,
+                                                             sizeof(slots) / sizeof(slots[0]), displacements,
+                                                             sizeof(displacements) / sizeof(displacements[0])),
+                     ROBOTRACONTEURLITE_ERROR_SUCCESS);
+
+    (void)memset(&header, 0, sizeof(header));
+    for (i = 0; i < MEMBER_DISPATCH_TEST_LEN; i++)
+    {
+        header.entry_type = entries[i].entry_type;
+        header.service_path.data = (char*)entries[i].service_path; /* cppcheck-suppress cstyleCast */
+        header.service_path.len = strlen(entries[i].service_path);
+        header.member_name.data = member_names[i];
+        header.member_name.len = strlen(member_names[i]);
+        handler_id = 0;
+        assert_int_equal(robotraconteurlite_member_dispatch_find(&dispatch, &header, &handler_id),
+                         ROBOTRACONTEURLITE_ERROR_SUCCESS);
+        assert_int_equal(handler_id, 1000U + i);
+    }
+
+    /* Wrong entry type, unknown member and a prefix of a known member all miss */
+    header.entry_type = ROBOTRACONTEURLITE_MESSAGEENTRYTYPE_FUNCTIONCALLREQ;
+    assert_int_equal(robotraconteurlite_member_dispatch_find(&dispatch, &header, &handler_id),
+                     ROBOTRACONTEURLITE_ERROR_KEY_NOT_FOUND);
+    header.entry_type = ROBOTRACONTEURLITE_MESSAGEENTRYTYPE_PROPERTYGETREQ;
+    header.member_name.data = "unknown";
+    header.member_name.len = 7;
+    assert_int_equal(robotraconteurlite_member_dispatch_find(&dispatch, &header, &handler_id),
+                     ROBOTRACONTEURLITE_ERROR_KEY_NOT_FOUND);
+    header.member_name.data = member_names[0];
+    header.member_name.len = strlen(member_names[0]) - 1U;
+    assert_int_equal(robotraconteurlite_member_dispatch_find(&dispatch, &header, &handler_id),
+                     ROBOTRACONTEURLITE_ERROR_KEY_NOT_FOUND);
+
+    /* Duplicate keys are rejected */
+    entries[3].entry_type = entries[1].entry_type;
+    entries[3].member_name = entries[1].member_name;
+    assert_int_equal(robotraconteurlite_member_dispatch_init(&dispatch, entries, MEMBER_DISPATCH_TEST_LEN, slots,
+                                                             sizeof(slots) / sizeof(slots[0]), displacements,
+                                                             sizeof(displacements) / sizeof(displacements[0])),
+                     ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER);
+}
+
+void robotraconteurlite_message_string_intern_test(void** state)
+{
+    struct robotraconteurlite_string_intern_entry intern_entries[4];
+    char intern_storage[40];
+    struct robotraconteurlite_string_intern intern;
+    uint8_t seg1[] = {'j', 'o', 'i', 'n', 't', '_', 'v'};
+    uint8_t seg2[] = {'e', 'l', 'o', 'c', 'i', 't', 'y'};
+    struct robotraconteurlite_buffer bufs[2];
+    struct robotraconteurlite_buffer_vec vec;
+    struct robotraconteurlite_string str;
+    uint32_t position_id = 0;
+    uint32_t velocity_id = 0;
+    uint32_t id = 0;
+
+    ROBOTRACONTEURLITE_UNUSED(state);
+
+    assert_return_code(robotraconteurlite_string_intern_init(&intern, intern_entries, 4, intern_storage,
+                                                             sizeof(intern_storage)),
+                       0);
+    robotraconteurlite_string_from_c_str("joint_position", &str);
+    assert_true(robotraconteurlite_string_intern_find(&intern, &str, &id) == ROBOTRACONTEURLITE_ERROR_KEY_NOT_FOUND);
+    assert_return_code(robotraconteurlite_string_intern_add(&intern, &str, &position_id), 0);
+    assert_return_code(robotraconteurlite_string_intern_add(&intern, &str, &id), 0);
+    assert_true(id == position_id);
+    robotraconteurlite_string_from_c_str("joint_velocity", &str);
+    assert_return_code(robotraconteurlite_string_intern_add(&intern, &str, &velocity_id), 0);
+    assert_true(velocity_id != position_id);
+    assert_true(velocity_id < 4U);
+    robotraconteurlite_string_from_c_str("", &str);
+    assert_true(robotraconteurlite_string_intern_add(&intern, &str, &id) == ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER);
+    robotraconteurlite_string_from_c_str("joint_effort_limit", &str);
+    assert_true(robotraconteurlite_string_intern_add(&intern, &str, &id) == ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE);
+
+    /* A name split across receive segments is found without copying it */
+    bufs[0].data = seg1;
+    bufs[0].len = sizeof(seg1);
+    bufs[1].data = seg2;
+    bufs[1].len = sizeof(seg2);
+    vec.buffer_vec = bufs;
+    vec.buffer_vec_cnt = 2;
+    assert_return_code(robotraconteurlite_string_intern_find_buffer_vec(&intern, &vec, 0, 14, &id), 0);
+    assert_true(id == velocity_id);
+    assert_true(robotraconteurlite_string_intern_find_buffer_vec(&intern, &vec, 0, 13, &id) ==
+                ROBOTRACONTEURLITE_ERROR_KEY_NOT_FOUND);
+
+    assert_return_code(robotraconteurlite_string_intern_get_string(&intern, position_id, &str), 0);
+    assert_true(robotraconteurlite_string_cmp_c_str(&str, "joint_position") == 0);
+    assert_true(robotraconteurlite_string_intern_get_string(&intern, 4, &str) ==
+                ROBOTRACONTEURLITE_ERROR_KEY_NOT_FOUND);
+
+    robotraconteurlite_string_intern_clear(&intern);
+    robotraconteurlite_string_from_c_str("joint_position", &str);
+    assert_true(robotraconteurlite_string_intern_find(&intern, &str, &id) == ROBOTRACONTEURLITE_ERROR_KEY_NOT_FOUND);
+    robotraconteurlite_string_from_c_str("joint_effort", &str);
+    assert_return_code(robotraconteurlite_string_intern_add(&intern, &str, &id), 0);
+}
+
+static size_t robotraconteurlite_message_write_validate_test_message(uint8_t* buffer_bytes, size_t buffer_bytes_len,
+                                                                     uint16_t message_version, size_t nesting)
+{
+    struct robotraconteurlite_buffer buffer1;
+    struct robotraconteurlite_buffer_vec buffer;
+    struct robotraconteurlite_message_writer writer;
+    struct robotraconteurlite_messageentry_writer entry_writer;
+    struct robotraconteurlite_message_header header;
+    struct robotraconteurlite_messageentry_header entry_header;
+    struct robotraconteurlite_messageelement_writer element_writers[ROBOTRACONTEURLITE_MESSAGE_VALIDATE_MAX_DEPTH + 1U];
+    struct robotraconteurlite_messageelement_header nested_headers[ROBOTRACONTEURLITE_MESSAGE_VALIDATE_MAX_DEPTH];
+    struct message_struct_test_robot_state state;
+    double samples_data[] = {1.0, 2.0, 3.0, 4.0};
+    struct robotraconteurlite_array_double samples;
+    struct robotraconteurlite_string el_name;
+    size_t i = 0;
+
+    (void)memset(&state, 0, sizeof(state));
+    robotraconteurlite_message_init_struct_test_pose(&state.pose);
+    state.enabled = 1;
+    samples.data = samples_data;
+    samples.len = 4;
+
+    buffer1.data = buffer_bytes;
+    buffer1.len = buffer_bytes_len;
+    buffer.buffer_vec = &buffer1;
+    buffer.buffer_vec_cnt = 1;
+    assert_return_code(
+        robotraconteurlite_message_writer_init(&writer, &buffer, 0, buffer_bytes_len, message_version), 0);
+    (void)memset(&header, 0, sizeof(header));
+    assert_return_code(robotraconteurlite_message_writer_begin_message(&writer, &header, &entry_writer), 0);
+
+    (void)memset(&entry_header, 0, sizeof(entry_header));
+    entry_header.entry_type = ROBOTRACONTEURLITE_MESSAGEENTRYTYPE_PROPERTYGETRES;
+    robotraconteurlite_string_from_c_str("state", &entry_header.member_name);
+    assert_return_code(
+        robotraconteurlite_messageentry_writer_begin_entry(&entry_writer, &entry_header, &element_writers[0]), 0);
+    robotraconteurlite_string_from_c_str("state", &el_name);
+    assert_return_code(message_struct_test_robot_state_write(&element_writers[0], &el_name, &state), 0);
+    robotraconteurlite_string_from_c_str("samples", &el_name);
+    assert_return_code(
+        robotraconteurlite_messageelement_writer_write_double_array(&element_writers[0], &el_name, &samples), 0);
+
+    /* Chain of nested structures, the innermost holding one value */
+    for (i = 0; i < nesting; i++)
+    {
+        (void)memset(&nested_headers[i], 0, sizeof(nested_headers[i]));
+        nested_headers[i].element_type = ROBOTRACONTEURLITE_DATATYPE_STRUCTURE;
+        robotraconteurlite_string_from_c_str("nested", &nested_headers[i].element_name);
+        robotraconteurlite_string_from_c_str("experimental.message_struct_test.Nested",
+                                             &nested_headers[i].element_type_name);
+        assert_return_code(robotraconteurlite_messageelement_writer_begin_nested_element(
+                               &element_writers[i], &nested_headers[i], &element_writers[i + 1U]),
+                           0);
+    }
+    robotraconteurlite_string_from_c_str("value", &el_name);
+    assert_return_code(robotraconteurlite_messageelement_writer_write_double(&element_writers[nesting], &el_name, 2.5),
+                       0);
+    for (i = nesting; i > 0U; i--)
+    {
+        assert_return_code(robotraconteurlite_messageelement_writer_end_nested_element(
+                               &element_writers[i - 1U], &nested_headers[i - 1U], &element_writers[i]),
+                           0);
+    }
+    assert_return_code(
+        robotraconteurlite_messageentry_writer_end_entry(&entry_writer, &entry_header, &element_writers[0]), 0);
+
+    /* Second entry without elements */
+    (void)memset(&entry_header, 0, sizeof(entry_header));
+    entry_header.entry_type = ROBOTRACONTEURLITE_MESSAGEENTRYTYPE_PROPERTYSETRES;
+    robotraconteurlite_string_from_c_str("enabled", &entry_header.member_name);
+    assert_return_code(
+        robotraconteurlite_messageentry_writer_begin_entry(&entry_writer, &entry_header, &element_writers[0]), 0);
+    assert_return_code(
+        robotraconteurlite_messageentry_writer_end_entry(&entry_writer, &entry_header, &element_writers[0]), 0);
+
+    assert_return_code(robotraconteurlite_message_writer_end_message(&writer, &header, &entry_writer), 0);
+    return header.message_size;
+}
+
+static void robotraconteurlite_message_run_validate_test(uint16_t message_version)
+{
+    /* double storage keeps the message buffer 8 byte aligned */
+    double message_storage[512];
+    uint8_t* message_bytes = (uint8_t*)message_storage;
+    struct robotraconteurlite_buffer buffer1;
+    struct robotraconteurlite_buffer_vec buffer;
+    struct robotraconteurlite_message_reader reader;
+    struct robotraconteurlite_messageentry_reader entry_reader;
+    struct robotraconteurlite_messageelement_reader element_reader;
+    struct robotraconteurlite_messageelement_header element_header;
+    struct robotraconteurlite_messageelement_buffer_info element_buffer_info;
+    struct message_struct_test_robot_state read_state;
+    double samples_data[4];
+    struct robotraconteurlite_array_double samples;
+    float samples_single_data[4];
+    struct robotraconteurlite_array_single samples_single;
+    struct robotraconteurlite_string el_name;
+    size_t message_len = 0;
+    double d = 0;
+
+    message_len = robotraconteurlite_message_write_validate_test_message(message_bytes, sizeof(message_storage),
+                                                                         message_version, 3);
+    buffer1.data = message_bytes;
+    buffer1.len = message_len;
+    buffer.buffer_vec = &buffer1;
+    buffer.buffer_vec_cnt = 1;
+    assert_return_code(robotraconteurlite_message_reader_init(&reader, &buffer, 0, message_len), 0);
+    assert_return_code(robotraconteurlite_message_reader_validate(&reader), 0);
+    assert_true(reader.validated == 1U);
+
+    /* Reads through the validated reader use the trusted path */
+    assert_return_code(robotraconteurlite_message_reader_begin_read_entries(&reader, &entry_reader), 0);
+    robotraconteurlite_string_from_c_str("state", &el_name);
+    assert_return_code(robotraconteurlite_messageentry_reader_find_element(&entry_reader, &el_name, &element_reader),
+                       0);
+    assert_true(element_reader.validated == 1U);
+    (void)memset(&read_state, 0, sizeof(read_state));
+    assert_return_code(message_struct_test_robot_state_read(&element_reader, &read_state), 0);
+    assert_true(read_state.enabled == 1);
+    robotraconteurlite_message_verify_struct_test_pose(&read_state.pose);
+
+    robotraconteurlite_string_from_c_str("samples", &el_name);
+    assert_return_code(robotraconteurlite_messageentry_reader_find_element(&entry_reader, &el_name, &element_reader),
+                       0);
+    samples.data = samples_data;
+    samples.len = 3;
+    assert_true(robotraconteurlite_messageelement_reader_read_data_double_array(&element_reader, &samples) ==
+                ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE);
+    samples.len = 4;
+    assert_return_code(robotraconteurlite_messageelement_reader_read_data_double_array(&element_reader, &samples), 0);
+    assert_true((samples.len == 4U) && (samples_data[0] == 1.0) && (samples_data[3] == 4.0));
+    assert_true(robotraconteurlite_messageelement_reader_read_data_double(&element_reader, &d) ==
+                ROBOTRACONTEURLITE_ERROR_PROTOCOL);
+    samples_single.data = samples_single_data;
+    samples_single.len = 4;
+    assert_true(robotraconteurlite_messageelement_reader_read_data_single_array(&element_reader, &samples_single) ==
+                ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_TYPE_MISMATCH);
+
+    /* A data count that does not match the data size is rejected */
+    (void)memset(&element_header, 0, sizeof(element_header));
+    assert_return_code(robotraconteurlite_messageelement_reader_read_header_ex(&element_reader, &element_header,
+                                                                               &element_buffer_info),
+                       0);
+    message_bytes[element_buffer_info.element_count_offset]++;
+    assert_return_code(robotraconteurlite_message_reader_init(&reader, &buffer, 0, message_len), 0);
+    assert_true(robotraconteurlite_message_reader_validate(&reader) == ROBOTRACONTEURLITE_ERROR_PROTOCOL);
+    assert_true(reader.validated == 0U);
+    message_bytes[element_buffer_info.element_count_offset]--;
+
+    assert_return_code(robotraconteurlite_message_reader_init(&reader, &buffer, 0, message_len), 0);
+    assert_return_code(robotraconteurlite_message_reader_validate(&reader), 0);
+
+    /* Nesting deeper than the validation stack */
+    message_len = robotraconteurlite_message_write_validate_test_message(
+        message_bytes, sizeof(message_storage), message_version, ROBOTRACONTEURLITE_MESSAGE_VALIDATE_MAX_DEPTH);
+    buffer1.len = message_len;
+    assert_return_code(robotraconteurlite_message_reader_init(&reader, &buffer, 0, message_len), 0);
+    assert_true(robotraconteurlite_message_reader_validate(&reader) == ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE);
+}
+
+void robotraconteurlite_message_validate_test(void** state)
+{
+    ROBOTRACONTEURLITE_UNUSED(state);
+    robotraconteurlite_message_run_validate_test(2);
+    robotraconteurlite_message_run_validate_test(4);
+}
+
+static void robotraconteurlite_message_run_reserve_test(uint16_t message_version)
+{
+    /* double storage keeps the message buffer 8 byte aligned */
+    double send_storage[64];
+    uint8_t* send_bytes = (uint8_t*)send_storage;
+    double split_storage[64];
+    double value_d[] = {1.5, 2.5, 3.5};
+    uint8_t read_b[16];
+    double read_d[3];
+    size_t read_len = 0;
+    size_t i = 0;
+    struct robotraconteurlite_buffer buffer1;
+    struct robotraconteurlite_buffer split_buffers[2];
+    struct robotraconteurlite_buffer_vec buffer;
+    struct robotraconteurlite_message_writer writer;
+    struct robotraconteurlite_messageentry_writer entry_writer;
+    struct robotraconteurlite_message_header header;
+    struct robotraconteurlite_messageentry_header entry_header;
+    struct robotraconteurlite_messageelement_writer element_writer;
+    struct robotraconteurlite_messageelement_reader element_reader;
+    struct robotraconteurlite_array_uint8 reserved_b;
+    struct robotraconteurlite_array_double reserved_d;
+    struct robotraconteurlite_array_uint8 read_array_b;
+    struct robotraconteurlite_array_double read_array_d;
+    struct robotraconteurlite_string el_name;
+    robotraconteurlite_status rv = -1;
+
+    buffer1.data = send_bytes;
+    buffer1.len = sizeof(send_storage);
+    buffer.buffer_vec = &buffer1;
+    buffer.buffer_vec_cnt = 1;
+    assert_return_code(
+        robotraconteurlite_message_writer_init(&writer, &buffer, 0, sizeof(send_storage), message_version), 0);
+    (void)memset(&header, 0, sizeof(header));
+    assert_return_code(robotraconteurlite_message_writer_begin_message(&writer, &header, &entry_writer), 0);
+    (void)memset(&entry_header, 0, sizeof(entry_header));
+    entry_header.entry_type = ROBOTRACONTEURLITE_MESSAGEENTRYTYPE_PROPERTYGETRES;
+    robotraconteurlite_string_from_c_str("image", &entry_header.member_name);
+    assert_return_code(
+        robotraconteurlite_messageentry_writer_begin_entry(&entry_writer, &entry_header, &element_writer), 0);
+
+    /* Nothing to commit before a reservation */
+    assert_true(robotraconteurlite_messageelement_writer_commit_reserved(&element_writer) ==
+                ROBOTRACONTEURLITE_ERROR_INVALID_OPERATION);
+
+    /* Fill the data in place in the send buffer */
+    robotraconteurlite_string_from_c_str("bytes", &el_name);
+    assert_return_code(
+        robotraconteurlite_messageelement_writer_reserve_uint8_array(&element_writer, &el_name, 16, &reserved_b), 0);
+    assert_true(reserved_b.len == 16U);
+    assert_true(reserved_b.data > send_bytes);
+    assert_true(reserved_b.data < (send_bytes + sizeof(send_storage)));
+    for (i = 0; i < 16U; i++)
+    {
+        reserved_b.data[i] = (uint8_t)(i * 3U);
+    }
+    assert_return_code(robotraconteurlite_messageelement_writer_commit_reserved(&element_writer), 0);
+    assert_true(element_writer.elements_written_count == 1U);
+    assert_true(robotraconteurlite_messageelement_writer_commit_reserved(&element_writer) ==
+                ROBOTRACONTEURLITE_ERROR_INVALID_OPERATION);
+
+    /* Typed data may be misaligned depending on the header, in which case the copying writer is used */
+    robotraconteurlite_string_from_c_str("value", &el_name);
+    rv = robotraconteurlite_messageelement_writer_reserve_double_array(&element_writer, &el_name, 3, &reserved_d);
+    if (rv == ROBOTRACONTEURLITE_ERROR_NO_VALUE)
+    {
+        read_array_d.data = value_d;
+        read_array_d.len = 3;
+        assert_return_code(
+            robotraconteurlite_messageelement_writer_write_double_array(&element_writer, &el_name, &read_array_d), 0);
+    }
+    else
+    {
+        assert_return_code(rv, 0);
+        assert_true(reserved_d.len == 3U);
+        (void)memcpy(reserved_d.data, value_d, sizeof(value_d));
+        assert_return_code(robotraconteurlite_messageelement_writer_commit_reserved(&element_writer), 0);
+    }
+
+    /* A reservation is abandoned by writing another element in its place */
+    robotraconteurlite_string_from_c_str("abandoned", &el_name);
+    assert_return_code(
+        robotraconteurlite_messageelement_writer_reserve_uint8_array(&element_writer, &el_name, 4, &reserved_b), 0);
+    robotraconteurlite_string_from_c_str("scalar", &el_name);
+    assert_return_code(robotraconteurlite_messageelement_writer_write_uint32(&element_writer, &el_name, 7), 0);
+    assert_true(robotraconteurlite_messageelement_writer_commit_reserved(&element_writer) ==
+                ROBOTRACONTEURLITE_ERROR_INVALID_OPERATION);
+    assert_true(element_writer.elements_written_count == 3U);
+
+    assert_return_code(robotraconteurlite_messageentry_writer_end_entry(&entry_writer, &entry_header, &element_writer),
+                       0);
+    assert_return_code(robotraconteurlite_message_writer_end_message(&writer, &header, &entry_writer), 0);
+
+    robotraconteurlite_message_find_view_test_element(&buffer, header.message_size, "bytes", &element_reader);
+    read_array_b.data = read_b;
+    read_array_b.len = sizeof(read_b);
+    assert_return_code(robotraconteurlite_messageelement_reader_read_data_uint8_array(&element_reader, &read_array_b),
+                       0);
+    assert_true(read_array_b.len == 16U);
+    for (i = 0; i < 16U; i++)
+    {
+        assert_true(read_b[i] == (uint8_t)(i * 3U));
+    }
+
+    robotraconteurlite_message_find_view_test_element(&buffer, header.message_size, "value", &element_reader);
+    read_array_d.data = read_d;
+    read_array_d.len = 3;
+    assert_return_code(robotraconteurlite_messageelement_reader_read_data_double_array(&element_reader, &read_array_d),
+                       0);
+    assert_true(read_array_d.len == 3U);
+    assert_true(cmp_double(read_d, value_d, 3) == 0);
+
+    /* Reservations that straddle buffer segments fail without advancing the writer */
+    split_buffers[0].data = (uint8_t*)split_storage;
+    split_buffers[0].len = 128;
+    split_buffers[1].data = &((uint8_t*)split_storage)[128];
+    split_buffers[1].len = sizeof(split_storage) - 128U;
+    buffer.buffer_vec = split_buffers;
+    buffer.buffer_vec_cnt = 2;
+    assert_return_code(
+        robotraconteurlite_message_writer_init(&writer, &buffer, 0, sizeof(split_storage), message_version), 0);
+    (void)memset(&header, 0, sizeof(header));
+    assert_return_code(robotraconteurlite_message_writer_begin_message(&writer, &header, &entry_writer), 0);
+    assert_return_code(
+        robotraconteurlite_messageentry_writer_begin_entry(&entry_writer, &entry_header, &element_writer), 0);
+    robotraconteurlite_string_from_c_str("bytes", &el_name);
+    assert_true(robotraconteurlite_messageelement_writer_reserve_uint8_array(&element_writer, &el_name, 128,
+                                                                             &reserved_b) ==
+                ROBOTRACONTEURLITE_ERROR_NO_VALUE);
+    assert_true(robotraconteurlite_messageelement_writer_commit_reserved(&element_writer) ==
+                ROBOTRACONTEURLITE_ERROR_INVALID_OPERATION);
+    assert_true(element_writer.elements_written_count == 0U);
+    read_len = element_writer.buffer_offset;
+    read_array_b.data = read_b;
+    read_array_b.len = sizeof(read_b);
+    assert_return_code(
+        robotraconteurlite_messageelement_writer_write_uint8_array(&element_writer, &el_name, &read_array_b), 0);
+    assert_true(element_writer.buffer_offset > read_len);
+}
+
+void robotraconteurlite_message_reserve_test(void** state)
+{
+    ROBOTRACONTEURLITE_UNUSED(state);
+    robotraconteurlite_message_run_reserve_test(2);
+    robotraconteurlite_message_run_reserve_test(4);
+}
+
+static void robotraconteurlite_message_run_convert_test(uint16_t message_version, size_t split)
+{
+    /* double storage keeps the message buffer 8 byte aligned */
+    double send_storage[128];
+    uint8_t* send_bytes = (uint8_t*)send_storage;
+    double zero = 0.0;
+    double value_d[5];
+    int16_t value_i16[] = {-5, 300, 7};
+    uint64_t value_u64[] = {UINT64_MAX, 5};
+    struct robotraconteurlite_cdouble value_cd[2];
+    int8_t read_i8[5];
+    float read_f[5];
+    uint8_t read_u8[3];
+    int64_t read_i64[2];
+    double read_d[3];
+    struct robotraconteurlite_csingle read_cs[2];
+    size_t read_len = 0;
+    struct robotraconteurlite_buffer buffer1[2];
+    struct robotraconteurlite_buffer_vec buffer;
+    struct robotraconteurlite_message_writer writer;
+    struct robotraconteurlite_messageentry_writer entry_writer;
+    struct robotraconteurlite_message_header header;
+    struct robotraconteurlite_messageentry_header entry_header;
+    struct robotraconteurlite_messageelement_writer element_writer;
+    struct robotraconteurlite_messageelement_reader element_reader;
+    struct robotraconteurlite_string el_name;
+    struct robotraconteurlite_string str_value;
+
+    value_d[0] = 1.5;
+    value_d[1] = -2.7;
+    value_d[2] = 1e10;
+    value_d[3] = -1e10;
+    value_d[4] = zero / zero;
+    value_cd[0].real = 1.25;
+    value_cd[0].imag = -2.5;
+    value_cd[1].real = 3.0;
+    value_cd[1].imag = 4.0;
+
+    /* An odd split makes elements straddle the buffer segments */
+    buffer1[0].data = send_bytes;
+    buffer1[0].len = split;
+    buffer1[1].data = &send_bytes[split];
+    buffer1[1].len = sizeof(send_storage) - split;
+    buffer.buffer_vec = buffer1;
+    buffer.buffer_vec_cnt = 2;
+    assert_return_code(
+        robotraconteurlite_message_writer_init(&writer, &buffer, 0, sizeof(send_storage), message_version), 0);
+    (void)memset(&header, 0, sizeof(header));
+    assert_return_code(robotraconteurlite_message_writer_begin_message(&writer, &header, &entry_writer), 0);
+    (void)memset(&entry_header, 0, sizeof(entry_header));
+    entry_header.entry_type = ROBOTRACONTEURLITE_MESSAGEENTRYTYPE_PROPERTYGETRES;
+    robotraconteurlite_string_from_c_str("sensor", &entry_header.member_name);
+    assert_return_code(
+        robotraconteurlite_messageentry_writer_begin_entry(&entry_writer, &entry_header, &element_writer), 0);
+
+    robotraconteurlite_string_from_c_str("d", &el_name);
+    assert_return_code(robotraconteurlite_messageelement_writer_write_array_convert(
+                           &element_writer, &el_name, (const uint8_t*)value_d, 5, ROBOTRACONTEURLITE_DATATYPE_DOUBLE,
+                           ROBOTRACONTEURLITE_DATATYPE_DOUBLE),
+                       0);
+    robotraconteurlite_string_from_c_str("i16", &el_name);
+    assert_return_code(robotraconteurlite_messageelement_writer_write_array_convert(
+                           &element_writer, &el_name, (const uint8_t*)value_i16, 3, ROBOTRACONTEURLITE_DATATYPE_INT16,
+                           ROBOTRACONTEURLITE_DATATYPE_SINGLE),
+                       0);
+    robotraconteurlite_string_from_c_str("u64", &el_name);
+    assert_return_code(robotraconteurlite_messageelement_writer_write_array_convert(
+                           &element_writer, &el_name, (const uint8_t*)value_u64, 2,
+                           ROBOTRACONTEURLITE_DATATYPE_UINT64, ROBOTRACONTEURLITE_DATATYPE_UINT64),
+                       0);
+    robotraconteurlite_string_from_c_str("cd", &el_name);
+    assert_return_code(robotraconteurlite_messageelement_writer_write_array_convert(
+                           &element_writer, &el_name, (const uint8_t*)value_cd, 2,
+                           ROBOTRACONTEURLITE_DATATYPE_CDOUBLE, ROBOTRACONTEURLITE_DATATYPE_CDOUBLE),
+                       0);
+    robotraconteurlite_string_from_c_str("s", &el_name);
+    robotraconteurlite_string_from_c_str("text", &str_value);
+    assert_return_code(
+        robotraconteurlite_messageelement_writer_write_data_string(&element_writer, &el_name, &str_value), 0);
+
+    /* Unsupported pairs fail before anything is written */
+    read_len = element_writer.buffer_offset;
+    assert_true(robotraconteurlite_messageelement_writer_write_array_convert(
+                    &element_writer, &el_name, (const uint8_t*)value_d, 5, ROBOTRACONTEURLITE_DATATYPE_DOUBLE,
+                    ROBOTRACONTEURLITE_DATATYPE_BOOL) == ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_TYPE_MISMATCH);
+    assert_true(element_writer.buffer_offset == read_len);
+
+    assert_return_code(robotraconteurlite_messageentry_writer_end_entry(&entry_writer, &entry_header, &element_writer),
+                       0);
+    assert_return_code(robotraconteurlite_message_writer_end_message(&writer, &header, &entry_writer), 0);
+
+    /* Floating point converts to integers with truncation and saturation, NaN converts to zero */
+    robotraconteurlite_message_find_view_test_element(&buffer, header.message_size, "d", &element_reader);
+    read_len = 5;
+    assert_return_code(robotraconteurlite_messageelement_reader_read_data_array_convert(
+                           &element_reader, (uint8_t*)read_i8, &read_len, ROBOTRACONTEURLITE_DATATYPE_INT8),
+                       0);
+    assert_true(read_len == 5U);
+    assert_true((read_i8[0] == 1) && (read_i8[1] == -2) && (read_i8[2] == INT8_MAX) && (read_i8[3] == INT8_MIN) &&
+                (read_i8[4] == 0));
+    read_len = 5;
+    assert_return_code(robotraconteurlite_messageelement_reader_read_data_array_convert(
+                           &element_reader, (uint8_t*)read_f, &read_len, ROBOTRACONTEURLITE_DATATYPE_SINGLE),
+                       0);
+    assert_true((read_f[0] == 1.5F) && (read_f[2] == 1e10F) && (read_f[4] != read_f[4]));
+    read_len = 4;
+    assert_true(robotraconteurlite_messageelement_reader_read_data_array_convert(
+                    &element_reader, (uint8_t*)read_f, &read_len, ROBOTRACONTEURLITE_DATATYPE_SINGLE) ==
+                ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE);
+    read_len = 5;
+    assert_true(robotraconteurlite_messageelement_reader_read_data_array_convert(
+                    &element_reader, (uint8_t*)read_i8, &read_len, ROBOTRACONTEURLITE_DATATYPE_BOOL) ==
+                ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_TYPE_MISMATCH);
+
+    /* The int16 data was written as single */
+    robotraconteurlite_message_find_view_test_element(&buffer, header.message_size, "i16", &element_reader);
+    read_len = 3;
+    assert_return_code(robotraconteurlite_messageelement_reader_read_data_array_convert(
+                           &element_reader, (uint8_t*)read_d, &read_len, ROBOTRACONTEURLITE_DATATYPE_DOUBLE),
+                       0);
+    assert_true((read_len == 3U) && (read_d[0] == -5.0) && (read_d[1] == 300.0) && (read_d[2] == 7.0));
+    read_len = 3;
+    assert_return_code(robotraconteurlite_messageelement_reader_read_data_array_convert(
+                           &element_reader, read_u8, &read_len, ROBOTRACONTEURLITE_DATATYPE_UINT8),
+                       0);
+    assert_true((read_u8[0] == 0U) && (read_u8[1] == UINT8_MAX) && (read_u8[2] == 7U));
+
+    robotraconteurlite_message_find_view_test_element(&buffer, header.message_size, "u64", &element_reader);
+    read_len = 2;
+    assert_return_code(robotraconteurlite_messageelement_reader_read_data_array_convert(
+                           &element_reader, (uint8_t*)read_i64, &read_len, ROBOTRACONTEURLITE_DATATYPE_INT64),
+                       0);
+    assert_true((read_i64[0] == INT64_MAX) && (read_i64[1] == 5));
+
+    robotraconteurlite_message_find_view_test_element(&buffer, header.message_size, "cd", &element_reader);
+    read_len = 2;
+    assert_return_code(robotraconteurlite_messageelement_reader_read_data_array_convert(
+                           &element_reader, (uint8_t*)read_cs, &read_len, ROBOTRACONTEURLITE_DATATYPE_CSINGLE),
+                       0);
+    assert_true((read_cs[0].real == 1.25F) && (read_cs[0].imag == -2.5F) && (read_cs[1].imag == 4.0F));
+    assert_true(robotraconteurlite_messageelement_reader_read_data_array_convert(
+                    &element_reader, (uint8_t*)read_d, &read_len, ROBOTRACONTEURLITE_DATATYPE_DOUBLE) ==
+                ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_TYPE_MISMATCH);
+
+    robotraconteurlite_message_find_view_test_element(&buffer, header.message_size, "s", &element_reader);
+    read_len = 5;
+    assert_true(robotraconteurlite_messageelement_reader_read_data_array_convert(
+                    &element_reader, (uint8_t*)read_i8, &read_len, ROBOTRACONTEURLITE_DATATYPE_INT8) ==
+                ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_TYPE_MISMATCH);
+}
+
+void robotraconteurlite_message_convert_test(void** state)
+{
+    size_t split = 0;
+    ROBOTRACONTEURLITE_UNUSED(state);
+    for (split = 96; split < 160U; split += 7U)
+    {
+        robotraconteurlite_message_run_convert_test(2, split);
+        robotraconteurlite_message_run_convert_test(4, split);
+    }
+}
+
+static void robotraconteurlite_message_run_complex_split_test(uint16_t message_version, size_t split)
+{
+    /* double storage keeps the message buffer 8 byte aligned */
+    double send_storage[96];
+    uint8_t* send_bytes = (uint8_t*)send_storage;
+    double real_d[] = {1.0, 2.0, 3.0, 4.0, 5.0};
+    double imag_d[] = {-1.0, -2.0, -3.0, -4.0, -5.0};
+    float real_f[] = {0.5F, 1.5F, 2.5F};
+    float imag_f[] = {-0.5F, -1.5F, -2.5F};
+    double read_real_d[6];
+    double read_imag_d[5];
+    float read_real_f[3];
+    float read_imag_f[3];
+    struct robotraconteurlite_cdouble read_cd[5];
+    size_t i = 0;
+    struct robotraconteurlite_buffer buffer1[2];
+    struct robotraconteurlite_buffer_vec buffer;
+    struct robotraconteurlite_message_writer writer;
+    struct robotraconteurlite_messageentry_writer entry_writer;
+    struct robotraconteurlite_message_header header;
+    struct robotraconteurlite_messageentry_header entry_header;
+    struct robotraconteurlite_messageelement_writer element_writer;
+    struct robotraconteurlite_messageelement_reader element_reader;
+    struct robotraconteurlite_array_double real_a;
+    struct robotraconteurlite_array_double imag_a;
+    struct robotraconteurlite_array_single real_fa;
+    struct robotraconteurlite_array_single imag_fa;
+    struct robotraconteurlite_array_cdouble cd_a;
+    struct robotraconteurlite_string el_name;
+
+    /* An odd split makes values straddle the buffer segments */
+    buffer1[0].data = send_bytes;
+    buffer1[0].len = split;
+    buffer1[1].data = &send_bytes[split];
+    buffer1[1].len = sizeof(send_storage) - split;
+    buffer.buffer_vec = buffer1;
+    buffer.buffer_vec_cnt = 2;
+    assert_return_code(
+        robotraconteurlite_message_writer_init(&writer, &buffer, 0, sizeof(send_storage), message_version), 0);
+    (void)memset(&header, 0, sizeof(header));
+    assert_return_code(robotraconteurlite_message_writer_begin_message(&writer, &header, &entry_writer), 0);
+    (void)memset(&entry_header, 0, sizeof(entry_header));
+    entry_header.entry_type = ROBOTRACONTEURLITE_MESSAGEENTRYTYPE_PROPERTYGETRES;
+    robotraconteurlite_string_from_c_str("iq", &entry_header.member_name);
+    assert_return_code(
+        robotraconteurlite_messageentry_writer_begin_entry(&entry_writer, &entry_header, &element_writer), 0);
+
+    robotraconteurlite_string_from_c_str("cd", &el_name);
+    real_a.data = real_d;
+    real_a.len = 5;
+    imag_a.data = imag_d;
+    imag_a.len = 4;
+    assert_true(robotraconteurlite_messageelement_writer_write_cdouble_array_split(&element_writer, &el_name, &real_a,
+                                                                                   &imag_a) ==
+                ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER);
+    imag_a.len = 5;
+    assert_return_code(
+        robotraconteurlite_messageelement_writer_write_cdouble_array_split(&element_writer, &el_name, &real_a, &imag_a),
+        0);
+    robotraconteurlite_string_from_c_str("cs", &el_name);
+    real_fa.data = real_f;
+    real_fa.len = 3;
+    imag_fa.data = imag_f;
+    imag_fa.len = 3;
+    assert_return_code(robotraconteurlite_messageelement_writer_write_csingle_array_split(&element_writer, &el_name,
+                                                                                         &real_fa, &imag_fa),
+                       0);
+
+    assert_return_code(robotraconteurlite_messageentry_writer_end_entry(&entry_writer, &entry_header, &element_writer),
+                       0);
+    assert_return_code(robotraconteurlite_message_writer_end_message(&writer, &header, &entry_writer), 0);
+
+    /* The wire layout is interleaved */
+    robotraconteurlite_message_find_view_test_element(&buffer, header.message_size, "cd", &element_reader);
+    cd_a.data = read_cd;
+    cd_a.len = 5;
+    assert_return_code(robotraconteurlite_messageelement_reader_read_data_cdouble_array(&element_reader, &cd_a), 0);
+    assert_true(cd_a.len == 5U);
+    for (i = 0; i < 5U; i++)
+    {
+        assert_true((read_cd[i].real == real_d[i]) && (read_cd[i].imag == imag_d[i]));
+    }
+
+    real_a.data = read_real_d;
+    real_a.len = 6;
+    imag_a.data = read_imag_d;
+    imag_a.len = 4;
+    assert_true(robotraconteurlite_messageelement_reader_read_data_cdouble_array_split(&element_reader, &real_a,
+                                                                                       &imag_a) ==
+                ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE);
+    imag_a.len = 5;
+    assert_return_code(
+        robotraconteurlite_messageelement_reader_read_data_cdouble_array_split(&element_reader, &real_a, &imag_a), 0);
+    assert_true((real_a.len == 5U) && (imag_a.len == 5U));
+    assert_true(cmp_double(read_real_d, real_d, 5) == 0);
+    assert_true(cmp_double(read_imag_d, imag_d, 5) == 0);
+
+    robotraconteurlite_message_find_view_test_element(&buffer, header.message_size, "cs", &element_reader);
+    real_fa.data = read_real_f;
+    real_fa.len = 3;
+    imag_fa.data = read_imag_f;
+    imag_fa.len = 3;
+    assert_true(robotraconteurlite_messageelement_reader_read_data_cdouble_array_split(&element_reader, &real_a,
+                                                                                       &imag_a) ==
+                ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_TYPE_MISMATCH);
+    assert_return_code(
+        robotraconteurlite_messageelement_reader_read_data_csingle_array_split(&element_reader, &real_fa, &imag_fa),
+        0);
+    assert_true((real_fa.len == 3U) && (imag_fa.len == 3U));
+    for (i = 0; i < 3U; i++)
+    {
+        assert_true((read_real_f[i] == real_f[i]) && (read_imag_f[i] == imag_f[i]));
+    }
+}
+
+void robotraconteurlite_message_complex_split_test(void** state)
+{
+    size_t split = 0;
+    ROBOTRACONTEURLITE_UNUSED(state);
+    for (split = 48; split < 160U; split += 5U)
+    {
+        robotraconteurlite_message_run_complex_split_test(2, split);
+        robotraconteurlite_message_run_complex_split_test(4, split);
+    }
+}
+
+static void robotraconteurlite_message_run_strided_test(uint16_t message_version, size_t split)
+{
+    /* double storage keeps the message buffer 8 byte aligned */
+    double send_storage[64];
+    uint8_t* send_bytes = (uint8_t*)send_storage;
+    double value_d[] = {1, 2, 3, 4, 5, 6};
+    double matrix[3][2];
+    struct robotraconteurlite_buffer buffer1[2];
+    struct robotraconteurlite_buffer_vec buffer;
+    struct robotraconteurlite_message_writer writer;
+    struct robotraconteurlite_messageentry_writer entry_writer;
+    struct robotraconteurlite_message_header header;
+    struct robotraconteurlite_messageentry_header entry_header;
+    struct robotraconteurlite_messageelement_writer element_writer;
+    struct robotraconteurlite_messageelement_reader element_reader;
+    struct robotraconteurlite_array_double value;
+    struct robotraconteurlite_array_double column;
+    int32_t read_i32[6];
+    struct robotraconteurlite_array_int32 column_i32;
+    struct robotraconteurlite_string el_name;
+
+    /* An odd split makes elements straddle the buffer segments */
+    buffer1[0].data = send_bytes;
+    buffer1[0].len = split;
+    buffer1[1].data = &send_bytes[split];
+    buffer1[1].len = sizeof(send_storage) - split;
+    buffer.buffer_vec = buffer1;
+    buffer.buffer_vec_cnt = 2;
+    assert_return_code(
+        robotraconteurlite_message_writer_init(&writer, &buffer, 0, sizeof(send_storage), message_version), 0);
+    (void)memset(&header, 0, sizeof(header));
+    assert_return_code(robotraconteurlite_message_writer_begin_message(&writer, &header, &entry_writer), 0);
+    (void)memset(&entry_header, 0, sizeof(entry_header));
+    entry_header.entry_type = ROBOTRACONTEURLITE_MESSAGEENTRYTYPE_PROPERTYGETRES;
+    robotraconteurlite_string_from_c_str("telemetry", &entry_header.member_name);
+    assert_return_code(
+        robotraconteurlite_messageentry_writer_begin_entry(&entry_writer, &entry_header, &element_writer), 0);
+    robotraconteurlite_string_from_c_str("value", &el_name);
+    value.data = value_d;
+    value.len = 6;
+    assert_return_code(robotraconteurlite_messageelement_writer_write_double_array(&element_writer, &el_name, &value),
+                       0);
+    assert_return_code(robotraconteurlite_messageentry_writer_end_entry(&entry_writer, &entry_header, &element_writer),
+                       0);
+    assert_return_code(robotraconteurlite_message_writer_end_message(&writer, &header, &entry_writer), 0);
+
+    /* Elements 2 to 4 go to the second column of a 3x2 matrix */
+    robotraconteurlite_message_find_view_test_element(&buffer, header.message_size, "value", &element_reader);
+    (void)memset(matrix, 0, sizeof(matrix));
+    column.data = &matrix[0][1];
+    column.len = 5;
+    assert_return_code(robotraconteurlite_messageelement_reader_read_data_double_strided(&element_reader, &column, 2, 2,
+                                                                                        3),
+                       0);
+    assert_true(column.len == 5U);
+    assert_true((matrix[0][1] == 3.0) && (matrix[1][1] == 4.0) && (matrix[2][1] == 5.0));
+    assert_true((matrix[0][0] == 0.0) && (matrix[1][0] == 0.0) && (matrix[2][0] == 0.0));
+
+    assert_true(robotraconteurlite_messageelement_reader_read_data_double_strided(&element_reader, &column, 2, 4,
+                                                                                 3) ==
+                ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE);
+    column.len = 4;
+    assert_true(robotraconteurlite_messageelement_reader_read_data_double_strided(&element_reader, &column, 2, 0,
+                                                                                 3) ==
+                ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE);
+    column_i32.data = read_i32;
+    column_i32.len = 6;
+    assert_true(robotraconteurlite_messageelement_reader_read_data_int32_strided(&element_reader, &column_i32, 2, 0,
+                                                                                3) ==
+                ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_TYPE_MISMATCH);
+}
+
+void robotraconteurlite_message_strided_test(void** state)
+{
+    size_t split = 0;
+    ROBOTRACONTEURLITE_UNUSED(state);
+    for (split = 40; split < 100U; split += 3U)
+    {
+        robotraconteurlite_message_run_strided_test(2, split);
+        robotraconteurlite_message_run_strided_test(4, split);
+    }
+}
+
+static void robotraconteurlite_message_run_bool_bitset_test(uint16_t message_version, size_t split)
+{
+    /* double storage keeps the message buffer 8 byte aligned */
+    double send_storage[96];
+    uint8_t* send_bytes = (uint8_t*)send_storage;
+    uint64_t bits_data[3];
+    uint64_t read_bits_data[3];
+    struct robotraconteurlite_bool bools_data[150];
+    struct robotraconteurlite_bool read_bools_data[150];
+    size_t bit_count = 0;
+    size_t i = 0;
+    struct robotraconteurlite_buffer buffer1[2];
+    struct robotraconteurlite_buffer_vec buffer;
+    struct robotraconteurlite_message_writer writer;
+    struct robotraconteurlite_messageentry_writer entry_writer;
+    struct robotraconteurlite_message_header header;
+    struct robotraconteurlite_messageentry_header entry_header;
+    struct robotraconteurlite_messageelement_writer element_writer;
+    struct robotraconteurlite_messageelement_reader element_reader;
+    struct robotraconteurlite_array_uint64 bits;
+    struct robotraconteurlite_array_bool bools;
+    struct robotraconteurlite_string el_name;
+
+    bits_data[0] = ((uint64_t)0x80000001U << 32U) | 0xDEADBEEFU;
+    bits_data[1] = ((uint64_t)0x12345678U << 32U) | 0x9ABCDEF0U;
+    bits_data[2] = ((uint64_t)0xFFFFFFFFU << 32U) | 0x0F0F0F0FU;
+    for (i = 0; i < 150U; i++)
+    {
+        /* Any nonzero wire value is true */
+        bools_data[i].logical = ((i % 3U) == 0U) ? (uint8_t)(1U + (i % 200U)) : 0U;
+    }
+
+    /* An odd split makes the bools span both buffer segments */
+    buffer1[0].data = send_bytes;
+    buffer1[0].len = split;
+    buffer1[1].data = &send_bytes[split];
+    buffer1[1].len = sizeof(send_storage) - split;
+    buffer.buffer_vec = buffer1;
+    buffer.buffer_vec_cnt = 2;
+    assert_return_code(
+        robotraconteurlite_message_writer_init(&writer, &buffer, 0, sizeof(send_storage), message_version), 0);
+    (void)memset(&header, 0, sizeof(header));
+    assert_return_code(robotraconteurlite_message_writer_begin_message(&writer, &header, &entry_writer), 0);
+    (void)memset(&entry_header, 0, sizeof(entry_header));
+    entry_header.entry_type = ROBOTRACONTEURLITE_MESSAGEENTRYTYPE_PROPERTYGETRES;
+    robotraconteurlite_string_from_c_str("digital_io", &entry_header.member_name);
+    assert_return_code(
+        robotraconteurlite_messageentry_writer_begin_entry(&entry_writer, &entry_header, &element_writer), 0);
+
+    robotraconteurlite_string_from_c_str("outputs", &el_name);
+    bits.data = bits_data;
+    bits.len = 2;
+    assert_true(robotraconteurlite_messageelement_writer_write_bool_bitset(&element_writer, &el_name, &bits, 150) ==
+                ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER);
+    bits.len = 3;
+    assert_return_code(
+        robotraconteurlite_messageelement_writer_write_bool_bitset(&element_writer, &el_name, &bits, 150), 0);
+    robotraconteurlite_string_from_c_str("inputs", &el_name);
+    bools.data = bools_data;
+    bools.len = 150;
+    assert_return_code(robotraconteurlite_messageelement_writer_write_bool_array(&element_writer, &el_name, &bools), 0);
+
+    assert_return_code(robotraconteurlite_messageentry_writer_end_entry(&entry_writer, &entry_header, &element_writer),
+                       0);
+    assert_return_code(robotraconteurlite_message_writer_end_message(&writer, &header, &entry_writer), 0);
+
+    /* Bitsets are written as one byte per bool */
+    robotraconteurlite_message_find_view_test_element(&buffer, header.message_size, "outputs", &element_reader);
+    bools.data = read_bools_data;
+    bools.len = 150;
+    assert_return_code(robotraconteurlite_messageelement_reader_read_data_bool_array(&element_reader, &bools), 0);
+    assert_true(bools.len == 150U);
+    for (i = 0; i < 150U; i++)
+    {
+        assert_true(read_bools_data[i].logical == (uint8_t)((bits_data[i / 64U] >> (i % 64U)) & 1U));
+    }
+
+    bits.data = read_bits_data;
+    bits.len = 3;
+    assert_return_code(robotraconteurlite_messageelement_reader_read_data_bool_bitset(&element_reader, &bits,
+                                                                                      &bit_count),
+                       0);
+    assert_true((bits.len == 3U) && (bit_count == 150U));
+    assert_true((read_bits_data[0] == bits_data[0]) && (read_bits_data[1] == bits_data[1]));
+    /* Bits past the last bool are cleared */
+    assert_true(read_bits_data[2] == (bits_data[2] & (((uint64_t)1U << 22U) - 1U)));
+
+    robotraconteurlite_message_find_view_test_element(&buffer, header.message_size, "inputs", &element_reader);
+    bits.len = 2;
+    assert_true(robotraconteurlite_messageelement_reader_read_data_bool_bitset(&element_reader, &bits, &bit_count) ==
+                ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE);
+    bits.len = 3;
+    assert_return_code(robotraconteurlite_messageelement_reader_read_data_bool_bitset(&element_reader, &bits,
+                                                                                      &bit_count),
+                       0);
+    assert_true(bit_count == 150U);
+    for (i = 0; i < 150U; i++)
+    {
+        assert_true(((read_bits_data[i / 64U] >> (i % 64U)) & 1U) == (((i % 3U) == 0U) ? 1U : 0U));
+    }
+}
+
+void robotraconteurlite_message_bool_bitset_test(void** state)
+{
+    size_t split = 0;
+    ROBOTRACONTEURLITE_UNUSED(state);
+    for (split = 40; split < 200U; split += 7U)
+    {
+        robotraconteurlite_message_run_bool_bitset_test(2, split);
+        robotraconteurlite_message_run_bool_bitset_test(4, split);
+    }
+}
+
+static size_t robotraconteurlite_message_relay_test_message(struct robotraconteurlite_buffer_vec* source,
+                                                            size_t source_len,
+                                                            struct robotraconteurlite_buffer_vec* dest,
+                                                            size_t dest_len, uint16_t dest_version)
+{
+    char member_name_storage[32];
+    char string_storage[32];
+    struct robotraconteurlite_message_reader message_reader;
+    struct robotraconteurlite_message_header source_header;
+    struct robotraconteurlite_messageentry_reader entry_reader;
+    struct robotraconteurlite_messageentry_header entry_header;
+    struct robotraconteurlite_message_writer writer;
+    struct robotraconteurlite_message_header header;
+    struct robotraconteurlite_messageentry_writer entry_writer;
+
+    assert_return_code(robotraconteurlite_message_reader_init(&message_reader, source, 0, source_len), 0);
+    (void)memset(&source_header, 0, sizeof(source_header));
+    assert_return_code(robotraconteurlite_message_reader_read_header(&message_reader, &source_header), 0);
+    assert_return_code(robotraconteurlite_message_reader_begin_read_entries(&message_reader, &entry_reader), 0);
+
+    /* Only the message header and the request_id are rewritten */
+    assert_return_code(robotraconteurlite_message_writer_init(&writer, dest, 0, dest_len, dest_version), 0);
+    (void)memset(&header, 0, sizeof(header));
+    header.sender_endpoint = 11;
+    header.receiver_endpoint = 22;
+    header.entry_count = source_header.entry_count;
+    assert_return_code(robotraconteurlite_message_writer_begin_message(&writer, &header, &entry_writer), 0);
+
+    (void)memset(&entry_header, 0, sizeof(entry_header));
+    entry_header.member_name.data = member_name_storage;
+    entry_header.member_name.len = sizeof(member_name_storage);
+    assert_return_code(robotraconteurlite_messageentry_reader_read_header(&entry_reader, &entry_header), 0);
+    entry_header.request_id = 1234;
+
+    if (source_header.message_version != dest_version)
+    {
+        /* Transcoded element headers need room for their strings */
+        assert_true(robotraconteurlite_messageentry_writer_copy_entry(&entry_writer, &entry_header, &entry_reader,
+                                                                      string_storage, 4) ==
+                    ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE);
+    }
+    assert_return_code(robotraconteurlite_messageentry_writer_copy_entry(&entry_writer, &entry_header, &entry_reader,
+                                                                         string_storage, sizeof(string_storage)),
+                       0);
+    assert_true(robotraconteurlite_messageentry_reader_move_next(&entry_reader) == ROBOTRACONTEURLITE_ERROR_NO_MORE);
+    assert_return_code(robotraconteurlite_message_writer_end_message(&writer, &header, &entry_writer), 0);
+
+    return header.message_size;
+}
+
+static void robotraconteurlite_message_verify_relay_test_message(struct robotraconteurlite_buffer_vec* buffer,
+                                                                 size_t message_len, uint16_t message_version)
+{
+    char member_name_storage[32];
+    struct robotraconteurlite_message_reader message_reader;
+    struct robotraconteurlite_message_header header;
+    struct robotraconteurlite_messageentry_reader entry_reader;
+    struct robotraconteurlite_messageentry_header entry_header;
+
+    assert_return_code(robotraconteurlite_message_reader_init(&message_reader, buffer, 0, message_len), 0);
+    assert_return_code(robotraconteurlite_message_reader_validate(&message_reader), 0);
+    (void)memset(&header, 0, sizeof(header));
+    assert_return_code(robotraconteurlite_message_reader_read_header(&message_reader, &header), 0);
+    assert_true(header.message_version == message_version);
+    assert_true((header.sender_endpoint == 11U) && (header.receiver_endpoint == 22U));
+    assert_return_code(robotraconteurlite_message_reader_begin_read_entries(&message_reader, &entry_reader), 0);
+    (void)memset(&entry_header, 0, sizeof(entry_header));
+    entry_header.member_name.data = member_name_storage;
+    entry_header.member_name.len = sizeof(member_name_storage);
+    assert_return_code(robotraconteurlite_messageentry_reader_read_header(&entry_reader, &entry_header), 0);
+    assert_true(entry_header.entry_type == ROBOTRACONTEURLITE_MESSAGEENTRYTYPE_PROPERTYGETRES);
+    assert_true(entry_header.request_id == 1234U);
+    assert_true((entry_header.member_name.len == 4U) && (memcmp(member_name_storage, "pose", 4) == 0));
+    assert_true(entry_header.element_count == 3U);
+
+    robotraconteurlite_message_verify_compact_test_message(buffer, message_len);
+}
+
+void robotraconteurlite_message_copy_entry_test(void** state)
+{
+    uint8_t source_bytes[512];
+    uint8_t v2_bytes[1024];
+    uint8_t v4_bytes[1024];
+    struct robotraconteurlite_buffer segments[3];
+    struct robotraconteurlite_buffer_vec source;
+    struct robotraconteurlite_buffer_vec v2;
+    struct robotraconteurlite_buffer_vec v4;
+    size_t source_len = 0;
+    size_t v2_len = 0;
+    size_t v4_len = 0;
+    uint8_t compact = 0;
+
+    ROBOTRACONTEURLITE_UNUSED(state);
+
+    segments[0].data = source_bytes;
+    segments[0].len = sizeof(source_bytes);
+    source.buffer_vec = &segments[0];
+    source.buffer_vec_cnt = 1;
+    segments[1].data = v2_bytes;
+    segments[1].len = sizeof(v2_bytes);
+    v2.buffer_vec = &segments[1];
+    v2.buffer_vec_cnt = 1;
+    segments[2].data = v4_bytes;
+    segments[2].len = sizeof(v4_bytes);
+    v4.buffer_vec = &segments[2];
+    v4.buffer_vec_cnt = 1;
+
+    for (compact = 0; compact < 2U; compact++)
+    {
+        source_len = robotraconteurlite_message_write_compact_test_message(&source, sizeof(source_bytes), compact);
+
+        /* Same version, the element list is copied in one pass */
+        v4_len = robotraconteurlite_message_relay_test_message(&source, source_len, &v4, sizeof(v4_bytes), 4);
+        robotraconteurlite_message_verify_relay_test_message(&v4, v4_len, 4);
+
+        /* Message 4 to Message 2 and back, transcoding each element header */
+        v2_len = robotraconteurlite_message_relay_test_message(&source, source_len, &v2, sizeof(v2_bytes), 2);
+        robotraconteurlite_message_verify_relay_test_message(&v2, v2_len, 2);
+        (void)memset(v4_bytes, 0, sizeof(v4_bytes));
+        v4_len = robotraconteurlite_message_relay_test_message(&v2, v2_len, &v4, sizeof(v4_bytes), 4);
+        robotraconteurlite_message_verify_relay_test_message(&v4, v4_len, 4);
+    }
+}
+
+static robotraconteurlite_status robotraconteurlite_message_copy_nested_test_message(
+    struct robotraconteurlite_buffer_vec* source, size_t source_len, struct robotraconteurlite_buffer_vec* dest,
+    size_t dest_len, size_t* dest_message_len)
+{
+    char member_name_storage[32];
+    char string_storage[128];
+    struct robotraconteurlite_message_reader message_reader;
+    struct robotraconteurlite_message_header source_header;
+    struct robotraconteurlite_messageentry_reader entry_reader;
+    struct robotraconteurlite_messageentry_header entry_header;
+    struct robotraconteurlite_message_writer writer;
+    struct robotraconteurlite_message_header header;
+    struct robotraconteurlite_messageentry_writer entry_writer;
+    robotraconteurlite_status rv = -1;
+
+    assert_return_code(robotraconteurlite_message_reader_init(&message_reader, source, 0, source_len), 0);
+    (void)memset(&source_header, 0, sizeof(source_header));
+    assert_return_code(robotraconteurlite_message_reader_read_header(&message_reader, &source_header), 0);
+    assert_return_code(robotraconteurlite_message_reader_begin_read_entries(&message_reader, &entry_reader), 0);
+
+    assert_return_code(robotraconteurlite_message_writer_init(&writer, dest, 0, dest_len, 4), 0);
+    (void)memset(&header, 0, sizeof(header));
+    header.entry_count = source_header.entry_count;
+    assert_return_code(robotraconteurlite_message_writer_begin_message(&writer, &header, &entry_writer), 0);
+
+    do
+    {
+        (void)memset(&entry_header, 0, sizeof(entry_header));
+        entry_header.member_name.data = member_name_storage;
+        entry_header.member_name.len = sizeof(member_name_storage);
+        assert_return_code(robotraconteurlite_messageentry_reader_read_header(&entry_reader, &entry_header), 0);
+        rv = robotraconteurlite_messageentry_writer_copy_entry(&entry_writer, &entry_header, &entry_reader,
+                                                               string_storage, sizeof(string_storage));
+        if (rv != ROBOTRACONTEURLITE_ERROR_SUCCESS)
+        {
+            return rv;
+        }
+    } while (robotraconteurlite_messageentry_reader_move_next(&entry_reader) == ROBOTRACONTEURLITE_ERROR_SUCCESS);
+
+    assert_return_code(robotraconteurlite_message_writer_end_message(&writer, &header, &entry_writer), 0);
+    *dest_message_len = header.message_size;
+    return ROBOTRACONTEURLITE_ERROR_SUCCESS;
+}
+
+void robotraconteurlite_message_copy_entry_max_depth_test(void** state)
+{
+    /* double storage keeps the message buffers 8 byte aligned */
+    double source_storage[256];
+    double dest_storage[256];
+    struct robotraconteurlite_buffer segments[2];
+    struct robotraconteurlite_buffer_vec source;
+    struct robotraconteurlite_buffer_vec dest;
+    struct robotraconteurlite_message_reader reader;
+    struct robotraconteurlite_messageentry_reader entry_reader;
+    struct robotraconteurlite_messageelement_reader element_readers[ROBOTRACONTEURLITE_MESSAGE_VALIDATE_MAX_DEPTH];
+    struct robotraconteurlite_string el_name;
+    size_t source_len = 0;
+    size_t dest_len = 0;
+    size_t i = 0;
+    double d = 0;
+
+    ROBOTRACONTEURLITE_UNUSED(state);
+
+    segments[0].data = (uint8_t*)source_storage;
+    segments[0].len = sizeof(source_storage);
+    source.buffer_vec = &segments[0];
+    source.buffer_vec_cnt = 1;
+    segments[1].data = (uint8_t*)dest_storage;
+    segments[1].len = sizeof(dest_storage);
+    dest.buffer_vec = &segments[1];
+    dest.buffer_vec_cnt = 1;
+
+    /* The deepest nesting that validates is copied, transcoding each element header */
+    source_len = robotraconteurlite_message_write_validate_test_message(
+        (uint8_t*)source_storage, sizeof(source_storage), 2, ROBOTRACONTEURLITE_MESSAGE_VALIDATE_MAX_DEPTH - 1U);
+    segments[0].len = source_len;
+    assert_return_code(robotraconteurlite_message_reader_init(&reader, &source, 0, source_len), 0);
+    assert_return_code(robotraconteurlite_message_reader_validate(&reader), 0);
+    assert_return_code(robotraconteurlite_message_copy_nested_test_message(&source, source_len, &dest,
+                                                                           sizeof(dest_storage), &dest_len),
+                       0);
+
+    segments[1].len = dest_len;
+    assert_return_code(robotraconteurlite_message_reader_init(&reader, &dest, 0, dest_len), 0);
+    assert_return_code(robotraconteurlite_message_reader_validate(&reader), 0);
+    assert_return_code(robotraconteurlite_message_reader_begin_read_entries(&reader, &entry_reader), 0);
+    robotraconteurlite_string_from_c_str("nested", &el_name);
+    assert_return_code(
+        robotraconteurlite_messageentry_reader_find_element(&entry_reader, &el_name, &element_readers[0]), 0);
+    for (i = 1; i < (ROBOTRACONTEURLITE_MESSAGE_VALIDATE_MAX_DEPTH - 1U); i++)
+    {
+        assert_return_code(robotraconteurlite_messageelement_reader_find_nested_element(&element_readers[i - 1U],
+                                                                                        &el_name, &element_readers[i]),
+                           0);
+    }
+    robotraconteurlite_string_from_c_str("value", &el_name);
+    assert_return_code(robotraconteurlite_messageelement_reader_find_nested_element(
+                           &element_readers[ROBOTRACONTEURLITE_MESSAGE_VALIDATE_MAX_DEPTH - 2U], &el_name,
+                           &element_readers[ROBOTRACONTEURLITE_MESSAGE_VALIDATE_MAX_DEPTH - 1U]),
+                       0);
+    assert_return_code(robotraconteurlite_messageelement_reader_read_data_double(
+                           &element_readers[ROBOTRACONTEURLITE_MESSAGE_VALIDATE_MAX_DEPTH - 1U], &d),
+                       0);
+    assert_true(d == 2.5);
+
+    /* One level deeper is rejected, as by validation */
+    segments[0].len = sizeof(source_storage);
+    source_len = robotraconteurlite_message_write_validate_test_message(
+        (uint8_t*)source_storage, sizeof(source_storage), 2, ROBOTRACONTEURLITE_MESSAGE_VALIDATE_MAX_DEPTH);
+    segments[0].len = source_len;
+    segments[1].len = sizeof(dest_storage);
+    assert_int_equal(robotraconteurlite_message_copy_nested_test_message(&source, source_len, &dest,
+                                                                         sizeof(dest_storage), &dest_len),
+                     ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE);
+}
+
+void robotraconteurlite_message_reader_partial_test(void** state)
+{
+    uint8_t message_bytes[512];
+    struct robotraconteurlite_buffer segment;
+    struct robotraconteurlite_buffer_vec buffer;
+    struct robotraconteurlite_message_reader reader;
+    struct robotraconteurlite_message_header header;
+    struct robotraconteurlite_messageentry_reader entry_reader;
+    struct robotraconteurlite_messageentry_header entry_header;
+    struct robotraconteurlite_messageelement_reader element_reader;
+    size_t message_len = 0;
+    size_t received_len = 0;
+    size_t headers_len = 0;
+    robotraconteurlite_status rv = -1;
+
+    ROBOTRACONTEURLITE_UNUSED(state);
+
+    segment.data = message_bytes;
+    segment.len = sizeof(message_bytes);
+    buffer.buffer_vec = &segment;
+    buffer.buffer_vec_cnt = 1;
+    message_len = robotraconteurlite_message_write_compact_test_message(&buffer, sizeof(message_bytes), 0);
+
+    /* Only the preamble is required to start */
+    segment.len = 9;
+    assert_int_equal(robotraconteurlite_message_reader_init_partial(&reader, &buffer, 0, message_len),
+                     ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE);
+
+    /* Feed the message a byte at a time, the headers read once they have all arrived */
+    for (received_len = 10; received_len < message_len; received_len++)
+    {
+        segment.len = received_len;
+        assert_int_equal(robotraconteurlite_message_reader_init(&reader, &buffer, 0, message_len),
+                         ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE);
+        assert_int_equal(robotraconteurlite_message_reader_init_partial(&reader, &buffer, 0, message_len),
+                         ROBOTRACONTEURLITE_ERROR_SUCCESS);
+        (void)memset(&header, 0, sizeof(header));
+        rv = robotraconteurlite_message_reader_read_header(&reader, &header);
+        if (rv == ROBOTRACONTEURLITE_ERROR_SUCCESS)
+        {
+            rv = robotraconteurlite_message_reader_begin_read_entries(&reader, &entry_reader);
+        }
+        if (rv == ROBOTRACONTEURLITE_ERROR_SUCCESS)
+        {
+            (void)memset(&entry_header, 0, sizeof(entry_header));
+            rv = robotraconteurlite_messageentry_reader_read_header(&entry_reader, &entry_header);
+        }
+        if (rv == ROBOTRACONTEURLITE_ERROR_SUCCESS)
+        {
+            if (headers_len == 0U)
+            {
+                headers_len = received_len;
+            }
+            assert_int_equal(header.message_size, message_len);
+            assert_int_equal(header.entry_count, 1);
+            assert_int_equal(entry_header.entry_type, ROBOTRACONTEURLITE_MESSAGEENTRYTYPE_PROPERTYGETRES);
+            continue;
+        }
+        assert_int_equal(rv, ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE);
+        /* Once the headers have arrived they stay readable */
+        assert_int_equal(headers_len, 0);
+    }
+    assert_true(headers_len > 10U);
+    assert_true(headers_len < message_len);
+
+    /* Element data past the received bytes is out of range */
+    segment.len = headers_len;
+    assert_int_equal(robotraconteurlite_message_reader_init_partial(&reader, &buffer, 0, message_len),
+                     ROBOTRACONTEURLITE_ERROR_SUCCESS);
+    (void)memset(&header, 0, sizeof(header));
+    assert_int_equal(robotraconteurlite_message_reader_read_header(&reader, &header), ROBOTRACONTEURLITE_ERROR_SUCCESS);
+    assert_int_equal(robotraconteurlite_message_reader_begin_read_entries(&reader, &entry_reader),
+                     ROBOTRACONTEURLITE_ERROR_SUCCESS);
+    (void)memset(&entry_header, 0, sizeof(entry_header));
+    assert_int_equal(robotraconteurlite_messageentry_reader_read_header(&entry_reader, &entry_header),
+                     ROBOTRACONTEURLITE_ERROR_SUCCESS);
+    assert_int_equal(robotraconteurlite_messageentry_reader_begin_read_elements(&entry_reader, &element_reader),
+                     ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE);
+}
+
+static void robotraconteurlite_message_write_path_test_point(struct robotraconteurlite_messageelement_writer* writer,
+                                                            uint16_t message_version, const char* key,
+                                                            int32_t number, double x)
+{
+    struct robotraconteurlite_messageelement_writer point_writer;
+    struct robotraconteurlite_messageelement_header point_header;
+    struct robotraconteurlite_string el_name;
+
+    (void)memset(&point_header, 0, sizeof(point_header));
+    point_header.element_type = ROBOTRACONTEURLITE_DATATYPE_STRUCTURE;
+    robotraconteurlite_string_from_c_str("example.Point", &point_header.element_type_name);
+    /* Message 2 names numbered elements by their index */
+    if ((message_version == 4U) && (key == NULL))
+    {
+        point_header.element_number = number;
+    }
+    else
+    {
+        robotraconteurlite_string_from_c_str(key, &point_header.element_name);
+    }
+    assert_return_code(
+        robotraconteurlite_messageelement_writer_begin_nested_element(writer, &point_header, &point_writer), 0);
+    robotraconteurlite_string_from_c_str("x", &el_name);
+    assert_return_code(robotraconteurlite_messageelement_writer_write_double(&point_writer, &el_name, x), 0);
+    assert_return_code(
+        robotraconteurlite_messageelement_writer_end_nested_element(writer, &point_header, &point_writer), 0);
+}
+
+static size_t robotraconteurlite_message_write_path_test_message(struct robotraconteurlite_buffer_vec* buffer,
+                                                                 size_t buffer_len, uint16_t message_version)
+{
+    const char* list_names[] = {"0", "1", "2", "3"};
+    struct robotraconteurlite_message_writer writer;
+    struct robotraconteurlite_messageentry_writer entry_writer;
+    struct robotraconteurlite_message_header header;
+    struct robotraconteurlite_messageentry_header entry_header;
+    struct robotraconteurlite_messageelement_writer element_writer;
+    struct robotraconteurlite_messageelement_writer pose_writer;
+    struct robotraconteurlite_messageelement_writer container_writer;
+    struct robotraconteurlite_messageelement_header pose_header;
+    struct robotraconteurlite_messageelement_header container_header;
+    struct robotraconteurlite_string el_name;
+    int32_t i = 0;
+
+    assert_return_code(robotraconteurlite_message_writer_init(&writer, buffer, 0, buffer_len, message_version), 0);
+    (void)memset(&header, 0, sizeof(header));
+    header.entry_count = 1;
+    assert_return_code(robotraconteurlite_message_writer_begin_message(&writer, &header, &entry_writer), 0);
+    (void)memset(&entry_header, 0, sizeof(entry_header));
+    entry_header.entry_type = ROBOTRACONTEURLITE_MESSAGEENTRYTYPE_PROPERTYGETRES;
+    robotraconteurlite_string_from_c_str("pose", &entry_header.member_name);
+    assert_return_code(
+        robotraconteurlite_messageentry_writer_begin_entry(&entry_writer, &entry_header, &element_writer), 0);
+
+    robotraconteurlite_string_from_c_str("a", &el_name);
+    assert_return_code(robotraconteurlite_messageelement_writer_write_uint32(&element_writer, &el_name, 7), 0);
+
+    (void)memset(&pose_header, 0, sizeof(pose_header));
+    pose_header.element_type = ROBOTRACONTEURLITE_DATATYPE_STRUCTURE;
+    robotraconteurlite_string_from_c_str("pose", &pose_header.element_name);
+    robotraconteurlite_string_from_c_str("example.Pose", &pose_header.element_type_name);
+    assert_return_code(
+        robotraconteurlite_messageelement_writer_begin_nested_element(&element_writer, &pose_header, &pose_writer), 0);
+
+    (void)memset(&container_header, 0, sizeof(container_header));
+    container_header.element_type = ROBOTRACONTEURLITE_DATATYPE_LIST;
+    robotraconteurlite_string_from_c_str("position", &container_header.element_name);
+    assert_return_code(robotraconteurlite_messageelement_writer_begin_nested_element(&pose_writer, &container_header,
+                                                                                     &container_writer),
+                       0);
+    for (i = 0; i < 4; i++)
+    {
+        robotraconteurlite_message_write_path_test_point(
+            &container_writer, message_version, (message_version == 4U) ? NULL : list_names[i], i, 1.5 * i);
+    }
+    assert_return_code(robotraconteurlite_messageelement_writer_end_nested_element(&pose_writer, &container_header,
+                                                                                   &container_writer),
+                       0);
+
+    (void)memset(&container_header, 0, sizeof(container_header));
+    container_header.element_type = ROBOTRACONTEURLITE_DATATYPE_MAP_STRING;
+    robotraconteurlite_string_from_c_str("frames", &container_header.element_name);
+    assert_return_code(robotraconteurlite_messageelement_writer_begin_nested_element(&pose_writer, &container_header,
+                                                                                     &container_writer),
+                       0);
+    robotraconteurlite_message_write_path_test_point(&container_writer, message_version, "base", 0, 10.0);
+    robotraconteurlite_message_write_path_test_point(&container_writer, message_version, "tool", 0, 20.0);
+    assert_return_code(robotraconteurlite_messageelement_writer_end_nested_element(&pose_writer, &container_header,
+                                                                                   &container_writer),
+                       0);
+
+    (void)memset(&container_header, 0, sizeof(container_header));
+    container_header.element_type = ROBOTRACONTEURLITE_DATATYPE_MAP_INT32;
+    robotraconteurlite_string_from_c_str("ids", &container_header.element_name);
+    assert_return_code(robotraconteurlite_messageelement_writer_begin_nested_element(&pose_writer, &container_header,
+                                                                                     &container_writer),
+                       0);
+    robotraconteurlite_message_write_path_test_point(&container_writer, message_version,
+                                                     (message_version == 4U) ? NULL : "-3", -3, 30.0);
+    assert_return_code(robotraconteurlite_messageelement_writer_end_nested_element(&pose_writer, &container_header,
+                                                                                   &container_writer),
+                       0);
+
+    assert_return_code(
+        robotraconteurlite_messageelement_writer_end_nested_element(&element_writer, &pose_header, &pose_writer), 0);
+    assert_return_code(robotraconteurlite_messageentry_writer_end_entry(&entry_writer, &entry_header, &element_writer),
+                       0);
+    assert_return_code(robotraconteurlite_message_writer_end_message(&writer, &header, &entry_writer), 0);
+
+    return header.message_size;
+}
+
+static robotraconteurlite_status robotraconteurlite_message_find_path_test_double(
+    struct robotraconteurlite_buffer_vec* buffer, size_t message_len, const char* path,
+    struct robotraconteurlite_messageelement_path* compiled_path, double* value)
+{
+    struct robotraconteurlite_message_reader message_reader;
+    struct robotraconteurlite_message_header header;
+    struct robotraconteurlite_messageentry_reader entry_reader;
+    struct robotraconteurlite_messageelement_reader element_reader;
+    struct robotraconteurlite_string path_str;
+    robotraconteurlite_status rv = -1;
+
+    assert_return_code(robotraconteurlite_message_reader_init(&message_reader, buffer, 0, message_len), 0);
+    (void)memset(&header, 0, sizeof(header));
+    assert_return_code(robotraconteurlite_message_reader_read_header(&message_reader, &header), 0);
+    assert_return_code(robotraconteurlite_message_reader_begin_read_entries(&message_reader, &entry_reader), 0);
+
+    if (compiled_path != NULL)
+    {
+        rv = robotraconteurlite_messageentry_reader_find_compiled_path(&entry_reader, compiled_path, &element_reader);
+    }
+    else
+    {
+        robotraconteurlite_string_from_c_str(path, &path_str);
+        rv = robotraconteurlite_messageentry_reader_find_path(&entry_reader, &path_str, &element_reader);
+    }
+    if (rv != ROBOTRACONTEURLITE_ERROR_SUCCESS)
+    {
+        return rv;
+    }
+
+    return robotraconteurlite_messageelement_reader_read_data_double(&element_reader, value);
+}
+
+void robotraconteurlite_message_find_path_test(void** state)
+{
+    const char* invalid_paths[] = {"",       ".pose",   "pose.",    "pose..x", "pose[",
+                                   "pose[x]", "pose[2", "pose[\"a]", "pose]",   "pose[99999999999]"};
+    uint8_t v4_bytes[1024];
+    uint8_t v2_bytes[1024];
+    struct robotraconteurlite_buffer segments[2];
+    struct robotraconteurlite_buffer_vec v4;
+    struct robotraconteurlite_buffer_vec v2;
+    struct robotraconteurlite_messageelement_path_token tokens[4];
+    struct robotraconteurlite_messageelement_path compiled_path;
+    struct robotraconteurlite_string path_str;
+    size_t v4_len = 0;
+    size_t v2_len = 0;
+    size_t i = 0;
+    double d = 0;
+
+    ROBOTRACONTEURLITE_UNUSED(state);
+
+    segments[0].data = v4_bytes;
+    segments[0].len = sizeof(v4_bytes);
+    v4.buffer_vec = &segments[0];
+    v4.buffer_vec_cnt = 1;
+    segments[1].data = v2_bytes;
+    segments[1].len = sizeof(v2_bytes);
+    v2.buffer_vec = &segments[1];
+    v2.buffer_vec_cnt = 1;
+    v4_len = robotraconteurlite_message_write_path_test_message(&v4, sizeof(v4_bytes), 4);
+    v2_len = robotraconteurlite_message_write_path_test_message(&v2, sizeof(v2_bytes), 2);
+
+    for (i = 0; i < 2U; i++)
+    {
+        struct robotraconteurlite_buffer_vec* buffer = (i == 0U) ? &v4 : &v2;
+        size_t len = (i == 0U) ? v4_len : v2_len;
+
+        assert_return_code(
+            robotraconteurlite_message_find_path_test_double(buffer, len, "pose.position[2].x", NULL, &d), 0);
+        assert_true(d == 3.0);
+        assert_return_code(
+            robotraconteurlite_message_find_path_test_double(buffer, len, "pose.position[0].x", NULL, &d), 0);
+        assert_true(d == 0.0);
+        assert_return_code(
+            robotraconteurlite_message_find_path_test_double(buffer, len, "pose.frames[\"tool\"].x", NULL, &d), 0);
+        assert_true(d == 20.0);
+        assert_return_code(
+            robotraconteurlite_message_find_path_test_double(buffer, len, "pose.frames.base.x", NULL, &d), 0);
+        assert_true(d == 10.0);
+        assert_return_code(robotraconteurlite_message_find_path_test_double(buffer, len, "pose.ids[-3].x", NULL, &d),
+                           0);
+        assert_true(d == 30.0);
+
+        assert_int_equal(robotraconteurlite_message_find_path_test_double(buffer, len, "pose.position[4].x", NULL, &d),
+                         ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_NOT_FOUND);
+        assert_int_equal(robotraconteurlite_message_find_path_test_double(buffer, len, "pose.missing", NULL, &d),
+                         ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_NOT_FOUND);
+        assert_int_equal(robotraconteurlite_message_find_path_test_double(buffer, len, "a.x", NULL, &d),
+                         ROBOTRACONTEURLITE_ERROR_MESSAGEELEMENT_TYPE_MISMATCH);
+    }
+
+    for (i = 0; i < (sizeof(invalid_paths) / sizeof(invalid_paths[0])); i++)
+    {
+        robotraconteurlite_string_from_c_str(invalid_paths[i], &path_str);
+        assert_int_equal(robotraconteurlite_messageelement_path_compile(&path_str, tokens, 4, &compiled_path),
+                         ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER);
+    }
+    robotraconteurlite_string_from_c_str("pose.position[3].x.y", &path_str);
+    assert_int_equal(robotraconteurlite_messageelement_path_compile(&path_str, tokens, 4, &compiled_path),
+                     ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE);
+
+    /* A compiled path is reused across messages, the cached positions are only used when the element is there */
+    robotraconteurlite_string_from_c_str("pose.position[3].x", &path_str);
+    assert_return_code(robotraconteurlite_messageelement_path_compile(&path_str, tokens, 4, &compiled_path), 0);
+    assert_int_equal(compiled_path.tokens_count, 4);
+    assert_int_equal(tokens[2].token_type, ROBOTRACONTEURLITE_MESSAGEELEMENT_PATH_TOKEN_NUMBER);
+    assert_int_equal(tokens[2].element_number, 3);
+    for (i = 0; i < 3U; i++)
+    {
+        d = 0;
+        assert_return_code(robotraconteurlite_message_find_path_test_double(&v4, v4_len, NULL, &compiled_path, &d), 0);
+        assert_true(d == 4.5);
+        assert_true(tokens[2].cached_offset != SIZE_MAX);
+        assert_int_equal(tokens[2].cached_element, 3);
+        d = 0;
+        assert_return_code(robotraconteurlite_message_find_path_test_double(&v2, v2_len, NULL, &compiled_path, &d), 0);
+        assert_true(d == 4.5);
+    }
+}
+
 int main(void)
 {
     const struct CMUnitTest tests[] = {cmocka_unit_test(robotraconteurlite_message_reader_basictest),
@@ -1410,6 +4388,31 @@ int main(void)
                                        cmocka_unit_test(robotraconteurlite_message_writer_basictest),
                                        cmocka_unit_test(robotraconteurlite_message4_writer_basictest),
                                        cmocka_unit_test(robotraconteurlite_message4_writer_basictest_masked),
-                                       cmocka_unit_test(robotraconteurlite_message4_writer_basictest_single_entry)};
+                                       cmocka_unit_test(robotraconteurlite_message4_writer_basictest_single_entry),
+                                       cmocka_unit_test(robotraconteurlite_message_read_data_view_test),
+                                       cmocka_unit_test(robotraconteurlite_message_element_index_test),
+                                       cmocka_unit_test(robotraconteurlite_message_external_segments_test),
+                                       cmocka_unit_test(robotraconteurlite_message_template_test),
+                                       cmocka_unit_test(robotraconteurlite_message_size_of_test),
+                                       cmocka_unit_test(robotraconteurlite_message_compact_uint_x_test),
+                                       cmocka_unit_test(robotraconteurlite_message_nested_in_nested_test),
+                                       cmocka_unit_test(robotraconteurlite_message_compact_large_container_test),
+                                       cmocka_unit_test(robotraconteurlite_message_header_split_test),
+                                       cmocka_unit_test(robotraconteurlite_message_string_table_test),
+                                       cmocka_unit_test(robotraconteurlite_message_struct_test),
+                                       cmocka_unit_test(robotraconteurlite_message_multidimarray_test),
+                                       cmocka_unit_test(robotraconteurlite_message_header_string_views_test),
+                                       cmocka_unit_test(robotraconteurlite_message_member_dispatch_test),
+                                       cmocka_unit_test(robotraconteurlite_message_string_intern_test),
+                                       cmocka_unit_test(robotraconteurlite_message_validate_test),
+                                       cmocka_unit_test(robotraconteurlite_message_reserve_test),
+                                       cmocka_unit_test(robotraconteurlite_message_convert_test),
+                                       cmocka_unit_test(robotraconteurlite_message_complex_split_test),
+                                       cmocka_unit_test(robotraconteurlite_message_strided_test),
+                                       cmocka_unit_test(robotraconteurlite_message_bool_bitset_test),
+                                       cmocka_unit_test(robotraconteurlite_message_copy_entry_test),
+                                       cmocka_unit_test(robotraconteurlite_message_copy_entry_max_depth_test),
+                                       cmocka_unit_test(robotraconteurlite_message_reader_partial_test),
+                                       cmocka_unit_test(robotraconteurlite_message_find_path_test)};
     return cmocka_run_group_tests(tests, NULL, NULL);
 }
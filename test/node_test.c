@@ -0,0 +1,589 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+
+#include "robotraconteurlite/node.h"
+#include "robotraconteurlite/tcp_transport.h"
+
+#define inline
+#include <cmocka.h>
+
+#define ROBOTRACONTEURLITE_NODE_TEST_BUFFER_SIZE 4096U
+#define ROBOTRACONTEURLITE_NODE_TEST_MAX_ITERATIONS 1000U
+
+static void robotraconteurlite_node_test_init_node(struct robotraconteurlite_node* node,
+                                                   struct robotraconteurlite_connection connections[],
+                                                   uint8_t buffers[], size_t buffer_size, int is_server)
+{
+    struct robotraconteurlite_connection* connections_head = NULL;
+    struct robotraconteurlite_nodeid nodeid;
+    struct robotraconteurlite_string nodename;
+
+    connections_head = robotraconteurlite_connections_init_from_array(connections, 2U, buffers, buffer_size, 4U);
+    assert_true(connections_head != NULL);
+    if (is_server != 0)
+    {
+        robotraconteurlite_tcp_connection_init_connections_server(connections_head);
+        robotraconteurlite_string_from_c_str("test_server", &nodename);
+    }
+    else
+    {
+        robotraconteurlite_tcp_connection_init_connections_client(connections_head);
+        robotraconteurlite_string_from_c_str("test_client", &nodename);
+    }
+    assert_return_code(robotraconteurlite_nodeid_newrandom(&nodeid), 0);
+    assert_return_code(robotraconteurlite_node_init(node, &nodeid, &nodename, connections_head), 0);
+}
+
+/* Listen on a free loopback port and fill in the address of the test service */
+static void robotraconteurlite_node_test_listen(struct robotraconteurlite_connection_acceptor* acceptor,
+                                                struct robotraconteurlite_addr* service_addr)
+{
+    struct sockaddr_storage listen_addr;
+    struct sockaddr_in* listen_addr_in = (struct sockaddr_in*)&listen_addr;
+    socklen_t listen_addr_len = sizeof(listen_addr);
+
+    (void)memset(&listen_addr, 0, sizeof(listen_addr));
+    listen_addr_in->sin_family = AF_INET;
+    listen_addr_in->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    assert_return_code(robotraconteurlite_tcp_acceptor_listen(acceptor, &listen_addr, 4), 0);
+    assert_return_code(getsockname(acceptor->sock, (struct sockaddr*)&listen_addr, &listen_addr_len), 0);
+
+    (void)memset(service_addr, 0, sizeof(struct robotraconteurlite_addr));
+    (void)memcpy(&service_addr->socket_addr, &listen_addr, sizeof(struct sockaddr_in));
+    robotraconteurlite_string_from_c_str("test_service", &service_addr->service_name);
+}
+
+static void robotraconteurlite_node_test_communicate(struct robotraconteurlite_connection_acceptor* acceptor,
+                                                     struct robotraconteurlite_node* server_node,
+                                                     struct robotraconteurlite_node* client_node)
+{
+    assert_return_code(robotraconteurlite_tcp_acceptor_communicate(acceptor, server_node->connections_head, 0), 0);
+    assert_return_code(robotraconteurlite_tcp_connections_communicate(server_node->connections_head, 0), 0);
+    assert_return_code(robotraconteurlite_tcp_connections_communicate(client_node->connections_head, 0), 0);
+}
+
+/* Answer the handshake requests of the client until the end of the event cycle */
+static void robotraconteurlite_node_test_serve(struct robotraconteurlite_node* server_node)
+{
+    struct robotraconteurlite_event event;
+    struct robotraconteurlite_node_service_object service_object;
+    robotraconteurlite_status rv = -1;
+
+    robotraconteurlite_string_from_c_str("test_service", &service_object.service_path);
+    robotraconteurlite_string_from_c_str("example.test_service.test_object", &service_object.qualified_type);
+    service_object.service_def = NULL;
+
+    do
+    {
+        assert_return_code(robotraconteurlite_node_next_event(server_node, &event, 0), 0);
+        if (event.event_type == ROBOTRACONTEURLITE_EVENT_TYPE_MESSAGE_RECEIVED)
+        {
+            rv = robotraconteurlite_node_event_special_request(server_node, &event);
+            if (rv == ROBOTRACONTEURLITE_ERROR_CONSUMED)
+            {
+                continue;
+            }
+            assert_return_code(rv, 0);
+            assert_int_equal(event.received_message.received_message_entry_header.entry_type,
+                             ROBOTRACONTEURLITE_MESSAGEENTRYTYPE_OBJECTTYPENAME);
+            assert_return_code(
+                robotraconteurlite_node_event_special_request_object_type_name(server_node, &event, &service_object, 1),
+                0);
+        }
+        assert_return_code(robotraconteurlite_node_consume_event(server_node, &event), 0);
+    } while (event.event_type != ROBOTRACONTEURLITE_EVENT_TYPE_NEXT_CYCLE);
+}
+
+/* Connect a client connection to the test service and run the client handshake */
+static struct robotraconteurlite_connection* robotraconteurlite_node_test_connect(
+    struct robotraconteurlite_connection_acceptor* acceptor, struct robotraconteurlite_node* server_node,
+    struct robotraconteurlite_node* client_node, struct robotraconteurlite_addr* service_addr)
+{
+    struct robotraconteurlite_tcp_connect_service_data connect_data;
+    struct robotraconteurlite_client_handshake_data handshake_data;
+    struct robotraconteurlite_event event;
+    robotraconteurlite_status rv = ROBOTRACONTEURLITE_ERROR_RETRY;
+    size_t i = 0;
+
+    (void)memset(&connect_data, 0, sizeof(connect_data));
+    connect_data.connections_head = client_node->connections_head;
+    connect_data.service_address = service_addr;
+    assert_return_code(robotraconteurlite_tcp_connect_service(&connect_data, 0), 0);
+
+    (void)memset(&handshake_data, 0, sizeof(handshake_data));
+    handshake_data.node = client_node;
+    handshake_data.connection = connect_data.client_out;
+    for (i = 0; (i < ROBOTRACONTEURLITE_NODE_TEST_MAX_ITERATIONS) && (rv == ROBOTRACONTEURLITE_ERROR_RETRY); i++)
+    {
+        robotraconteurlite_node_test_communicate(acceptor, server_node, client_node);
+        robotraconteurlite_node_test_serve(server_node);
+        assert_return_code(robotraconteurlite_node_next_event(client_node, &event, 0), 0);
+        rv = robotraconteurlite_client_handshake(&handshake_data, &event, 0);
+    }
+    assert_int_equal(rv, ROBOTRACONTEURLITE_ERROR_SUCCESS);
+    assert_true(robotraconteurlite_connection_is_connected(connect_data.client_out) != 0);
+
+    return connect_data.client_out;
+}
+
+/* Consume the events of one event cycle, such as the completed sends */
+static void robotraconteurlite_node_test_consume_events(struct robotraconteurlite_node* node)
+{
+    struct robotraconteurlite_event event;
+
+    do
+    {
+        assert_return_code(robotraconteurlite_node_next_event(node, &event, 0), 0);
+        assert_return_code(robotraconteurlite_node_consume_event(node, &event), 0);
+    } while (event.event_type != ROBOTRACONTEURLITE_EVENT_TYPE_NEXT_CYCLE);
+}
+
+/* Run the transports until node has a message or closed event, consuming the other events of both nodes */
+static void robotraconteurlite_node_test_next_event(struct robotraconteurlite_connection_acceptor* acceptor,
+                                                    struct robotraconteurlite_node* server_node,
+                                                    struct robotraconteurlite_node* client_node,
+                                                    struct robotraconteurlite_node* node,
+                                                    struct robotraconteurlite_event* event)
+{
+    struct robotraconteurlite_node* peer_node = (node == server_node) ? client_node : server_node;
+    size_t i = 0;
+
+    for (i = 0; i < ROBOTRACONTEURLITE_NODE_TEST_MAX_ITERATIONS; i++)
+    {
+        robotraconteurlite_node_test_communicate(acceptor, server_node, client_node);
+        robotraconteurlite_node_test_consume_events(peer_node);
+        assert_return_code(robotraconteurlite_node_next_event(node, event, 0), 0);
+        if ((event->event_type == ROBOTRACONTEURLITE_EVENT_TYPE_MESSAGE_RECEIVED) ||
+            (event->event_type == ROBOTRACONTEURLITE_EVENT_TYPE_CONNECTION_CLOSED))
+        {
+            break;
+        }
+        assert_return_code(robotraconteurlite_node_consume_event(node, event), 0);
+    }
+    assert_true(i < ROBOTRACONTEURLITE_NODE_TEST_MAX_ITERATIONS);
+}
+
+/* Run the transports for one event cycle of node and check that no message is handed out */
+static void robotraconteurlite_node_test_no_message(struct robotraconteurlite_connection_acceptor* acceptor,
+                                                    struct robotraconteurlite_node* server_node,
+                                                    struct robotraconteurlite_node* client_node,
+                                                    struct robotraconteurlite_node* node)
+{
+    struct robotraconteurlite_event event;
+
+    robotraconteurlite_node_test_communicate(acceptor, server_node, client_node);
+    do
+    {
+        assert_return_code(robotraconteurlite_node_next_event(node, &event, 0), 0);
+        assert_true(event.event_type != ROBOTRACONTEURLITE_EVENT_TYPE_MESSAGE_RECEIVED);
+        assert_return_code(robotraconteurlite_node_consume_event(node, &event), 0);
+    } while (event.event_type != ROBOTRACONTEURLITE_EVENT_TYPE_NEXT_CYCLE);
+}
+
+/* Send entry_count entries in one message, each holding its index in the "value" element */
+static void robotraconteurlite_node_test_send_batch(struct robotraconteurlite_node* node,
+                                                    struct robotraconteurlite_connection* connection,
+                                                    uint32_t entry_count, uint32_t max_entries)
+{
+    struct robotraconteurlite_node_send_messageentry_data send_data;
+    struct robotraconteurlite_messageentry_header entry_header;
+    struct robotraconteurlite_string value_name;
+    uint32_t i = 0;
+
+    (void)memset(&send_data, 0, sizeof(send_data));
+    (void)memset(&entry_header, 0, sizeof(entry_header));
+    entry_header.entry_type = ROBOTRACONTEURLITE_MESSAGEENTRYTYPE_PROPERTYGETREQ;
+    robotraconteurlite_string_from_c_str("test_service", &entry_header.service_path);
+    robotraconteurlite_string_from_c_str("member", &entry_header.member_name);
+    robotraconteurlite_string_from_c_str("value", &value_name);
+    send_data.node = node;
+    send_data.connection = connection;
+    send_data.message_entry_header = &entry_header;
+
+    assert_return_code(robotraconteurlite_node_begin_send_messageentry_batch(&send_data, max_entries), 0);
+    for (i = 0; i < entry_count; i++)
+    {
+        entry_header.request_id = i + 1U;
+        assert_return_code(robotraconteurlite_node_batch_begin_messageentry(&send_data), 0);
+        assert_return_code(
+            robotraconteurlite_messageelement_writer_write_int32(&send_data.element_writer, &value_name, (int32_t)i),
+            0);
+        assert_return_code(robotraconteurlite_node_batch_end_messageentry(&send_data), 0);
+    }
+    assert_return_code(robotraconteurlite_node_end_send_messageentry_batch(&send_data), 0);
+}
+
+static void robotraconteurlite_node_test_check_entry(struct robotraconteurlite_event* event, uint16_t entry_type,
+                                                     uint32_t index)
+{
+    struct robotraconteurlite_messageelement_reader element_reader;
+    struct robotraconteurlite_string value_name;
+    int32_t value = -1;
+
+    assert_int_equal(event->event_type, ROBOTRACONTEURLITE_EVENT_TYPE_MESSAGE_RECEIVED);
+    assert_int_equal(event->event_error_code, ROBOTRACONTEURLITE_ERROR_SUCCESS);
+    assert_int_equal(event->received_message.entry_index, index);
+    assert_int_equal(event->received_message.received_message_entry_header.entry_type, entry_type);
+    assert_int_equal(event->received_message.received_message_entry_header.request_id, index + 1U);
+    assert_true(robotraconteurlite_string_cmp_c_str(
+                    &event->received_message.received_message_entry_header.member_name, "member") == 0);
+
+    robotraconteurlite_string_from_c_str("value", &value_name);
+    assert_return_code(robotraconteurlite_messageentry_reader_find_element(&event->received_message.entry_reader,
+                                                                           &value_name, &element_reader),
+                       0);
+    assert_return_code(robotraconteurlite_messageelement_reader_read_data_int32(&element_reader, &value), 0);
+    assert_int_equal(value, (int32_t)index);
+}
+
+static void robotraconteurlite_node_multiple_entry_events_test(void** state)
+{
+    struct robotraconteurlite_node server_node;
+    struct robotraconteurlite_node client_node;
+    struct robotraconteurlite_connection server_connections[2];
+    struct robotraconteurlite_connection client_connections[2];
+    uint8_t server_buffers[4U * ROBOTRACONTEURLITE_NODE_TEST_BUFFER_SIZE];
+    uint8_t client_buffers[4U * ROBOTRACONTEURLITE_NODE_TEST_BUFFER_SIZE];
+    struct robotraconteurlite_connection_acceptor acceptor;
+    struct robotraconteurlite_addr service_addr;
+    struct robotraconteurlite_connection* client_connection = NULL;
+    struct robotraconteurlite_connection* server_connection = &server_connections[0];
+    struct robotraconteurlite_event event;
+    size_t last_offset = 0;
+    uint32_t i = 0;
+    ROBOTRACONTEURLITE_UNUSED(state);
+
+    robotraconteurlite_node_test_init_node(&server_node, server_connections, server_buffers,
+                                           ROBOTRACONTEURLITE_NODE_TEST_BUFFER_SIZE, 1);
+    robotraconteurlite_node_test_init_node(&client_node, client_connections, client_buffers,
+                                           ROBOTRACONTEURLITE_NODE_TEST_BUFFER_SIZE, 0);
+    robotraconteurlite_node_test_listen(&acceptor, &service_addr);
+    client_connection = robotraconteurlite_node_test_connect(&acceptor, &server_node, &client_node, &service_addr);
+
+    robotraconteurlite_node_test_send_batch(&client_node, client_connection, 5U, 5U);
+
+    for (i = 0; i < 5U; i++)
+    {
+        robotraconteurlite_node_test_next_event(&acceptor, &server_node, &client_node, &server_node, &event);
+        assert_true(event.connection == server_connection);
+        assert_int_equal(event.received_message.received_message_header.entry_count, 5U);
+        robotraconteurlite_node_test_check_entry(&event, ROBOTRACONTEURLITE_MESSAGEENTRYTYPE_PROPERTYGETREQ, i);
+
+        assert_return_code(robotraconteurlite_node_consume_event(&server_node, &event), 0);
+        if (i < 4U)
+        {
+            /* Message held for the next entry, which starts where this entry ends */
+            assert_int_equal(server_connection->recv_message_entry_index, i + 1U);
+            assert_true(server_connection->recv_message_entry_offset > last_offset);
+            assert_int_equal(server_connection->recv_message_entry_offset,
+                             event.received_message.entry_reader.buffer_offset +
+                                 event.received_message.entry_reader.buffer_count);
+            last_offset = server_connection->recv_message_entry_offset;
+            assert_false(ROBOTRACONTEURLITE_FLAGS_CHECK(server_connection->connection_state,
+                                                        ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_CONSUMED));
+        }
+    }
+
+    /* Message released after the last entry */
+    assert_int_equal(server_connection->recv_message_entry_index, 0U);
+    assert_int_equal(server_connection->recv_message_entry_offset, 0U);
+    assert_true(ROBOTRACONTEURLITE_FLAGS_CHECK(server_connection->connection_state,
+                                               ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_CONSUMED));
+    robotraconteurlite_node_test_no_message(&acceptor, &server_node, &client_node, &server_node);
+
+    robotraconteurlite_tcp_connections_close(client_node.connections_head);
+    robotraconteurlite_tcp_connections_close(server_node.connections_head);
+    assert_return_code(robotraconteurlite_tcp_acceptor_close(&acceptor), 0);
+}
+
+static void robotraconteurlite_node_multiple_entry_move_next_test(void** state)
+{
+    struct robotraconteurlite_node server_node;
+    struct robotraconteurlite_node client_node;
+    struct robotraconteurlite_connection server_connections[2];
+    struct robotraconteurlite_connection client_connections[2];
+    uint8_t server_buffers[4U * ROBOTRACONTEURLITE_NODE_TEST_BUFFER_SIZE];
+    uint8_t client_buffers[4U * ROBOTRACONTEURLITE_NODE_TEST_BUFFER_SIZE];
+    struct robotraconteurlite_connection_acceptor acceptor;
+    struct robotraconteurlite_addr service_addr;
+    struct robotraconteurlite_connection* client_connection = NULL;
+    struct robotraconteurlite_connection* server_connection = &server_connections[0];
+    struct robotraconteurlite_event event;
+    ROBOTRACONTEURLITE_UNUSED(state);
+
+    robotraconteurlite_node_test_init_node(&server_node, server_connections, server_buffers,
+                                           ROBOTRACONTEURLITE_NODE_TEST_BUFFER_SIZE, 1);
+    robotraconteurlite_node_test_init_node(&client_node, client_connections, client_buffers,
+                                           ROBOTRACONTEURLITE_NODE_TEST_BUFFER_SIZE, 0);
+    robotraconteurlite_node_test_listen(&acceptor, &service_addr);
+    client_connection = robotraconteurlite_node_test_connect(&acceptor, &server_node, &client_node, &service_addr);
+
+    robotraconteurlite_node_test_send_batch(&client_node, client_connection, 4U, 4U);
+
+    /* Handler reads the first two entries in one event */
+    robotraconteurlite_node_test_next_event(&acceptor, &server_node, &client_node, &server_node, &event);
+    robotraconteurlite_node_test_check_entry(&event, ROBOTRACONTEURLITE_MESSAGEENTRYTYPE_PROPERTYGETREQ, 0U);
+    assert_return_code(robotraconteurlite_node_receive_messageentry_move_next(&event.received_message), 0);
+    robotraconteurlite_node_test_check_entry(&event, ROBOTRACONTEURLITE_MESSAGEENTRYTYPE_PROPERTYGETREQ, 1U);
+    assert_return_code(robotraconteurlite_node_consume_event(&server_node, &event), 0);
+    assert_int_equal(server_connection->recv_message_entry_index, 2U);
+
+    /* The next event continues with the third entry */
+    robotraconteurlite_node_test_next_event(&acceptor, &server_node, &client_node, &server_node, &event);
+    robotraconteurlite_node_test_check_entry(&event, ROBOTRACONTEURLITE_MESSAGEENTRYTYPE_PROPERTYGETREQ, 2U);
+    assert_return_code(robotraconteurlite_node_receive_messageentry_move_next(&event.received_message), 0);
+    robotraconteurlite_node_test_check_entry(&event, ROBOTRACONTEURLITE_MESSAGEENTRYTYPE_PROPERTYGETREQ, 3U);
+    assert_int_equal(robotraconteurlite_node_receive_messageentry_move_next(&event.received_message),
+                     ROBOTRACONTEURLITE_ERROR_NO_MORE);
+    assert_return_code(robotraconteurlite_node_consume_event(&server_node, &event), 0);
+
+    assert_int_equal(server_connection->recv_message_entry_index, 0U);
+    assert_true(ROBOTRACONTEURLITE_FLAGS_CHECK(server_connection->connection_state,
+                                               ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_CONSUMED));
+    robotraconteurlite_node_test_no_message(&acceptor, &server_node, &client_node, &server_node);
+
+    robotraconteurlite_tcp_connections_close(client_node.connections_head);
+    robotraconteurlite_tcp_connections_close(server_node.connections_head);
+    assert_return_code(robotraconteurlite_tcp_acceptor_close(&acceptor), 0);
+}
+
+static void robotraconteurlite_node_multiple_entry_error_consume_test(void** state)
+{
+    struct robotraconteurlite_node server_node;
+    struct robotraconteurlite_node client_node;
+    struct robotraconteurlite_connection server_connections[2];
+    struct robotraconteurlite_connection client_connections[2];
+    uint8_t server_buffers[4U * ROBOTRACONTEURLITE_NODE_TEST_BUFFER_SIZE];
+    uint8_t client_buffers[4U * ROBOTRACONTEURLITE_NODE_TEST_BUFFER_SIZE];
+    struct robotraconteurlite_connection_acceptor acceptor;
+    struct robotraconteurlite_addr service_addr;
+    struct robotraconteurlite_connection* client_connection = NULL;
+    struct robotraconteurlite_connection* server_connection = &server_connections[0];
+    struct robotraconteurlite_event event;
+    ROBOTRACONTEURLITE_UNUSED(state);
+
+    robotraconteurlite_node_test_init_node(&server_node, server_connections, server_buffers,
+                                           ROBOTRACONTEURLITE_NODE_TEST_BUFFER_SIZE, 1);
+    robotraconteurlite_node_test_init_node(&client_node, client_connections, client_buffers,
+                                           ROBOTRACONTEURLITE_NODE_TEST_BUFFER_SIZE, 0);
+    robotraconteurlite_node_test_listen(&acceptor, &service_addr);
+    client_connection = robotraconteurlite_node_test_connect(&acceptor, &server_node, &client_node, &service_addr);
+
+    robotraconteurlite_node_test_send_batch(&client_node, client_connection, 3U, 3U);
+
+    /* A handler that fails to read the entry reports the error in the event. The message is released instead of
+       being held for the remaining entries. */
+    robotraconteurlite_node_test_next_event(&acceptor, &server_node, &client_node, &server_node, &event);
+    robotraconteurlite_node_test_check_entry(&event, ROBOTRACONTEURLITE_MESSAGEENTRYTYPE_PROPERTYGETREQ, 0U);
+    event.event_error_code = ROBOTRACONTEURLITE_ERROR_PROTOCOL;
+    assert_return_code(robotraconteurlite_node_consume_event(&server_node, &event), 0);
+
+    assert_int_equal(server_connection->recv_message_entry_index, 0U);
+    assert_int_equal(server_connection->recv_message_entry_offset, 0U);
+    assert_true(ROBOTRACONTEURLITE_FLAGS_CHECK(server_connection->connection_state,
+                                               ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_CONSUMED));
+    robotraconteurlite_node_test_no_message(&acceptor, &server_node, &client_node, &server_node);
+
+    robotraconteurlite_tcp_connections_close(client_node.connections_head);
+    robotraconteurlite_tcp_connections_close(server_node.connections_head);
+    assert_return_code(robotraconteurlite_tcp_acceptor_close(&acceptor), 0);
+}
+
+static void robotraconteurlite_node_batch_entry_count_test(void** state)
+{
+    struct robotraconteurlite_node server_node;
+    struct robotraconteurlite_node client_node;
+    struct robotraconteurlite_connection server_connections[2];
+    struct robotraconteurlite_connection client_connections[2];
+    uint8_t server_buffers[4U * ROBOTRACONTEURLITE_NODE_TEST_BUFFER_SIZE];
+    uint8_t client_buffers[4U * ROBOTRACONTEURLITE_NODE_TEST_BUFFER_SIZE];
+    struct robotraconteurlite_connection_acceptor acceptor;
+    struct robotraconteurlite_addr service_addr;
+    struct robotraconteurlite_connection* client_connection = NULL;
+    struct robotraconteurlite_connection* server_connection = &server_connections[0];
+    struct robotraconteurlite_event event;
+    uint32_t i = 0;
+    ROBOTRACONTEURLITE_UNUSED(state);
+
+    robotraconteurlite_node_test_init_node(&server_node, server_connections, server_buffers,
+                                           ROBOTRACONTEURLITE_NODE_TEST_BUFFER_SIZE, 1);
+    robotraconteurlite_node_test_init_node(&client_node, client_connections, client_buffers,
+                                           ROBOTRACONTEURLITE_NODE_TEST_BUFFER_SIZE, 0);
+    robotraconteurlite_node_test_listen(&acceptor, &service_addr);
+    client_connection = robotraconteurlite_node_test_connect(&acceptor, &server_node, &client_node, &service_addr);
+
+    /* Entry count is written for max_entries and patched to the number of entries written */
+    robotraconteurlite_node_test_send_batch(&client_node, client_connection, 3U, 300U);
+
+    for (i = 0; i < 3U; i++)
+    {
+        robotraconteurlite_node_test_next_event(&acceptor, &server_node, &client_node, &server_node, &event);
+        assert_int_equal(event.received_message.received_message_header.entry_count, 3U);
+        robotraconteurlite_node_test_check_entry(&event, ROBOTRACONTEURLITE_MESSAGEENTRYTYPE_PROPERTYGETREQ, i);
+        assert_return_code(robotraconteurlite_node_consume_event(&server_node, &event), 0);
+    }
+    assert_true(ROBOTRACONTEURLITE_FLAGS_CHECK(server_connection->connection_state,
+                                               ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_CONSUMED));
+
+    robotraconteurlite_tcp_connections_close(client_node.connections_head);
+    robotraconteurlite_tcp_connections_close(server_node.connections_head);
+    assert_return_code(robotraconteurlite_tcp_acceptor_close(&acceptor), 0);
+}
+
+static void robotraconteurlite_node_batch_max_entries_test(void** state)
+{
+    struct robotraconteurlite_node server_node;
+    struct robotraconteurlite_node client_node;
+    struct robotraconteurlite_connection server_connections[2];
+    struct robotraconteurlite_connection client_connections[2];
+    uint8_t server_buffers[4U * ROBOTRACONTEURLITE_NODE_TEST_BUFFER_SIZE];
+    uint8_t client_buffers[4U * ROBOTRACONTEURLITE_NODE_TEST_BUFFER_SIZE];
+    struct robotraconteurlite_connection_acceptor acceptor;
+    struct robotraconteurlite_addr service_addr;
+    struct robotraconteurlite_connection* client_connection = NULL;
+    struct robotraconteurlite_connection* server_connection = &server_connections[0];
+    struct robotraconteurlite_node_send_messageentry_data send_data;
+    struct robotraconteurlite_messageentry_header entry_header;
+    struct robotraconteurlite_event event;
+    ROBOTRACONTEURLITE_UNUSED(state);
+
+    robotraconteurlite_node_test_init_node(&server_node, server_connections, server_buffers,
+                                           ROBOTRACONTEURLITE_NODE_TEST_BUFFER_SIZE, 1);
+    robotraconteurlite_node_test_init_node(&client_node, client_connections, client_buffers,
+                                           ROBOTRACONTEURLITE_NODE_TEST_BUFFER_SIZE, 0);
+    robotraconteurlite_node_test_listen(&acceptor, &service_addr);
+    client_connection = robotraconteurlite_node_test_connect(&acceptor, &server_node, &client_node, &service_addr);
+
+    (void)memset(&send_data, 0, sizeof(send_data));
+    (void)memset(&entry_header, 0, sizeof(entry_header));
+    entry_header.entry_type = ROBOTRACONTEURLITE_MESSAGEENTRYTYPE_PROPERTYGETREQ;
+    robotraconteurlite_string_from_c_str("test_service", &entry_header.service_path);
+    robotraconteurlite_string_from_c_str("member", &entry_header.member_name);
+    send_data.node = &client_node;
+    send_data.connection = client_connection;
+    send_data.message_entry_header = &entry_header;
+
+    assert_int_equal(robotraconteurlite_node_begin_send_messageentry_batch(&send_data, 0U),
+                     ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER);
+    assert_int_equal(robotraconteurlite_node_begin_send_messageentry_batch(&send_data, UINT16_MAX + 1U),
+                     ROBOTRACONTEURLITE_ERROR_INVALID_PARAMETER);
+
+    assert_return_code(robotraconteurlite_node_begin_send_messageentry_batch(&send_data, 2U), 0);
+    assert_return_code(robotraconteurlite_node_batch_begin_messageentry(&send_data), 0);
+    assert_return_code(robotraconteurlite_node_batch_end_messageentry(&send_data), 0);
+    assert_return_code(robotraconteurlite_node_batch_begin_messageentry(&send_data), 0);
+    assert_return_code(robotraconteurlite_node_batch_end_messageentry(&send_data), 0);
+    assert_int_equal(robotraconteurlite_node_batch_begin_messageentry(&send_data),
+                     ROBOTRACONTEURLITE_ERROR_OUT_OF_RANGE);
+    assert_return_code(robotraconteurlite_node_end_send_messageentry_batch(&send_data), 0);
+
+    /* Only the two entries that fit are sent */
+    robotraconteurlite_node_test_next_event(&acceptor, &server_node, &client_node, &server_node, &event);
+    assert_true(event.connection == server_connection);
+    assert_int_equal(event.received_message.received_message_header.entry_count, 2U);
+    assert_return_code(robotraconteurlite_node_receive_messageentry_move_next(&event.received_message), 0);
+    assert_int_equal(robotraconteurlite_node_receive_messageentry_move_next(&event.received_message),
+                     ROBOTRACONTEURLITE_ERROR_NO_MORE);
+    assert_return_code(robotraconteurlite_node_consume_event(&server_node, &event), 0);
+    robotraconteurlite_node_test_consume_events(&client_node);
+
+    /* An empty batch is not sent */
+    assert_return_code(robotraconteurlite_node_begin_send_messageentry_batch(&send_data, 2U), 0);
+    assert_int_equal(robotraconteurlite_node_end_send_messageentry_batch(&send_data), ROBOTRACONTEURLITE_ERROR_NO_MORE);
+    assert_false(ROBOTRACONTEURLITE_FLAGS_CHECK(client_connection->connection_state,
+                                                ROBOTRACONTEURLITE_STATUS_FLAGS_SEND_REQUESTED));
+    robotraconteurlite_node_test_no_message(&acceptor, &server_node, &client_node, &server_node);
+
+    robotraconteurlite_tcp_connections_close(client_node.connections_head);
+    robotraconteurlite_tcp_connections_close(server_node.connections_head);
+    assert_return_code(robotraconteurlite_tcp_acceptor_close(&acceptor), 0);
+}
+
+static void robotraconteurlite_node_batch_response_test(void** state)
+{
+    struct robotraconteurlite_node server_node;
+    struct robotraconteurlite_node client_node;
+    struct robotraconteurlite_connection server_connections[2];
+    struct robotraconteurlite_connection client_connections[2];
+    uint8_t server_buffers[4U * ROBOTRACONTEURLITE_NODE_TEST_BUFFER_SIZE];
+    uint8_t client_buffers[4U * ROBOTRACONTEURLITE_NODE_TEST_BUFFER_SIZE];
+    struct robotraconteurlite_connection_acceptor acceptor;
+    struct robotraconteurlite_addr service_addr;
+    struct robotraconteurlite_connection* client_connection = NULL;
+    struct robotraconteurlite_connection* server_connection = &server_connections[0];
+    struct robotraconteurlite_node_send_messageentry_data send_data;
+    struct robotraconteurlite_string value_name;
+    struct robotraconteurlite_event event;
+    uint32_t i = 0;
+    ROBOTRACONTEURLITE_UNUSED(state);
+
+    robotraconteurlite_node_test_init_node(&server_node, server_connections, server_buffers,
+                                           ROBOTRACONTEURLITE_NODE_TEST_BUFFER_SIZE, 1);
+    robotraconteurlite_node_test_init_node(&client_node, client_connections, client_buffers,
+                                           ROBOTRACONTEURLITE_NODE_TEST_BUFFER_SIZE, 0);
+    robotraconteurlite_node_test_listen(&acceptor, &service_addr);
+    client_connection = robotraconteurlite_node_test_connect(&acceptor, &server_node, &client_node, &service_addr);
+
+    robotraconteurlite_node_test_send_batch(&client_node, client_connection, 3U, 3U);
+
+    /* The server answers each request entry as it is handed out and sends the replies in one message */
+    (void)memset(&send_data, 0, sizeof(send_data));
+    send_data.node = &server_node;
+    send_data.connection = server_connection;
+    robotraconteurlite_string_from_c_str("value", &value_name);
+    for (i = 0; i < 3U; i++)
+    {
+        robotraconteurlite_node_test_next_event(&acceptor, &server_node, &client_node, &server_node, &event);
+        robotraconteurlite_node_test_check_entry(&event, ROBOTRACONTEURLITE_MESSAGEENTRYTYPE_PROPERTYGETREQ, i);
+        if (i == 0U)
+        {
+            assert_return_code(robotraconteurlite_node_begin_send_messageentry_batch(&send_data, 3U), 0);
+        }
+        assert_return_code(robotraconteurlite_node_batch_begin_messageentry_response(
+                               &send_data, &event.received_message.received_message_entry_header),
+                           0);
+        assert_return_code(
+            robotraconteurlite_messageelement_writer_write_int32(&send_data.element_writer, &value_name, (int32_t)i),
+            0);
+        assert_return_code(robotraconteurlite_node_batch_end_messageentry(&send_data), 0);
+        if (i == 2U)
+        {
+            assert_return_code(robotraconteurlite_node_end_send_messageentry_batch(&send_data), 0);
+        }
+        assert_return_code(robotraconteurlite_node_consume_event(&server_node, &event), 0);
+    }
+
+    for (i = 0; i < 3U; i++)
+    {
+        robotraconteurlite_node_test_next_event(&acceptor, &server_node, &client_node, &client_node, &event);
+        assert_true(event.connection == client_connection);
+        assert_int_equal(event.received_message.received_message_header.entry_count, 3U);
+        robotraconteurlite_node_test_check_entry(&event, ROBOTRACONTEURLITE_MESSAGEENTRYTYPE_PROPERTYGETRES, i);
+        assert_return_code(robotraconteurlite_node_consume_event(&client_node, &event), 0);
+    }
+    assert_true(ROBOTRACONTEURLITE_FLAGS_CHECK(client_connection->connection_state,
+                                               ROBOTRACONTEURLITE_STATUS_FLAGS_MESSAGE_CONSUMED));
+
+    robotraconteurlite_tcp_connections_close(client_node.connections_head);
+    robotraconteurlite_tcp_connections_close(server_node.connections_head);
+    assert_return_code(robotraconteurlite_tcp_acceptor_close(&acceptor), 0);
+}
+
+int main(void)
+{
+    const struct CMUnitTest tests[] = {cmocka_unit_test(robotraconteurlite_node_multiple_entry_events_test),
+                                       cmocka_unit_test(robotraconteurlite_node_multiple_entry_move_next_test),
+                                       cmocka_unit_test(robotraconteurlite_node_multiple_entry_error_consume_test),
+                                       cmocka_unit_test(robotraconteurlite_node_batch_entry_count_test),
+                                       cmocka_unit_test(robotraconteurlite_node_batch_max_entries_test),
+                                       cmocka_unit_test(robotraconteurlite_node_batch_response_test)};
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}